@@ -46,6 +46,19 @@ std::exception_ptr createJoynrTimeOutException(const std::string& message)
     return retval;
 }
 
+std::shared_ptr<JoynrException> convertToJoynrException(std::exception_ptr eptr)
+{
+    try {
+        std::rethrow_exception(eptr);
+    } catch (const JoynrException& error) {
+        return std::shared_ptr<JoynrException>(error.clone());
+    } catch (const std::exception& error) {
+        return std::make_shared<JoynrRuntimeException>(error.what());
+    } catch (...) {
+        return std::make_shared<JoynrRuntimeException>("unknown exception");
+    }
+}
+
 } // namespace exceptions
 
 } // namespace joynr
@@ -136,12 +136,14 @@ protected:
     {
 
         ReadLocker locker(_lockSelectiveBroadcastListeners);
-        const std::vector<std::shared_ptr<UnicastBroadcastListener>>& listeners =
-                _selectiveBroadcastListeners[broadcastName];
-        // Inform all the broadcast listeners for this broadcast
-        for (std::shared_ptr<UnicastBroadcastListener> listener : listeners) {
-            listener->selectiveBroadcastOccurred(filters, values...);
+        auto listeners = _selectiveBroadcastListeners.find(broadcastName);
+        if (listeners == _selectiveBroadcastListeners.cend()) {
+            return;
         }
+        // Inform all the broadcast listeners for this broadcast at once, so that equal
+        // filters are evaluated only once
+        UnicastBroadcastListener::groupedSelectiveBroadcastOccurred(
+                listeners->second, filters, values...);
     }
 
     /**
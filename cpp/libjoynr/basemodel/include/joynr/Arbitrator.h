@@ -22,9 +22,10 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <mutex>
 #include <string>
-#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -32,18 +33,27 @@
 
 #include "joynr/ArbitrationResult.h"
 #include "joynr/ArbitrationStrategyFunction.h"
+#include "joynr/BoostIoserviceForwardDecl.h"
 #include "joynr/DiscoveryQos.h"
 #include "joynr/Future.h"
 #include "joynr/JoynrExport.h"
 #include "joynr/Logger.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/PrivateCopyAssign.h"
-#include "joynr/Semaphore.h"
+#include "joynr/SteadyTimer.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/types/DiscoveryEntryWithMetaInfo.h"
 #include "joynr/types/DiscoveryQos.h"
 #include "joynr/types/Version.h"
 
+namespace boost
+{
+namespace system
+{
+class error_code;
+} // namespace system
+} // namespace boost
+
 namespace joynr
 {
 
@@ -54,6 +64,11 @@ class IDiscoveryAsync;
 
 /*
  *  Base class for different arbitration strategies.
+ *
+ *  The arbitration does not own a thread. Every attempt issues an asynchronous
+ *  lookup at the discovery proxy; its completion (or the expiry of the discovery
+ *  timeout) drives the arbitration to the next state. Retries are scheduled with
+ *  a timer on the given io_service.
  */
 class JOYNR_EXPORT Arbitrator : public std::enable_shared_from_this<Arbitrator>
 {
@@ -67,7 +82,8 @@ public:
      *  This blocking is need for example for the fixed channel arbitrator which
      *  sets the channelId instantly.
      */
-    Arbitrator(const std::string& domain,
+    Arbitrator(boost::asio::io_service& ioService,
+               const std::string& domain,
                const std::string& interfaceName,
                const joynr::types::Version& interfaceVersion,
                std::weak_ptr<joynr::system::IDiscoveryAsync> discoveryProxy,
@@ -88,20 +104,44 @@ public:
 private:
     /*
      *  attemptArbitration() has to be implemented by the concrete arbitration strategy.
-     *  This method attempts arbitration and sets arbitrationStatus to indicate the
-     *  state of arbitration.
+     *  This method starts an arbitration attempt without blocking. If it leaves a
+     *  lookup pending, the attempt is finished when the lookup completes or times out;
+     *  otherwise it is finished as soon as this method returns.
      */
     virtual void attemptArbitration();
 
-    virtual void receiveCapabilitiesLookupResults(
-            const std::vector<joynr::types::DiscoveryEntryWithMetaInfo>& discoveryEntries);
+    void runAttempt();
+    void scheduleAttempt(std::chrono::milliseconds delay);
+    void onRetryTimerExpired(const boost::system::error_code& errorCode);
+    void onLookupTimerExpired(const boost::system::error_code& errorCode,
+                              std::uint64_t attemptId);
 
-    std::int64_t getDurationMs() const;
+    /*
+     * Process the result of the pending lookup of the given attempt if it is available.
+     * Called from the continuations registered on the future returned by lookupAsync.
+     */
+    void onLookupFinished(std::uint64_t attemptId);
 
     /*
-     * Check that the pending future has completed successfully and reset it.
+     * Decide whether the arbitration is finished, has failed or has to be retried.
      */
-    void validatePendingFuture();
+    void onAttemptFinished();
+
+    void processLookupResult(
+            std::shared_ptr<joynr::Future<joynr::types::DiscoveryEntryWithMetaInfo>> future);
+    void processLookupResult(
+            std::shared_ptr<joynr::Future<std::vector<joynr::types::DiscoveryEntryWithMetaInfo>>>
+                    future);
+    void handleLookupError(const exceptions::JoynrException& exception);
+
+    void notifyArbitrationSuccess(const joynr::ArbitrationResult& arbitrationResult);
+    void notifyArbitrationError(const exceptions::DiscoveryException& exception);
+    void reportArbitrationError();
+
+    virtual void receiveCapabilitiesLookupResults(
+            const std::vector<joynr::types::DiscoveryEntryWithMetaInfo>& discoveryEntries);
+
+    std::int64_t getDurationMs() const;
 
     void assertNoPendingFuture();
 
@@ -112,6 +152,8 @@ private:
             const std::vector<types::DiscoveryEntryWithMetaInfo>& discoveryEntries);
 
     std::mutex _pendingFutureMutex;
+    std::uint64_t _attemptId;
+    bool _lookupPending;
     boost::variant<
             std::shared_ptr<joynr::Future<joynr::types::DiscoveryEntryWithMetaInfo>>,
             std::shared_ptr<joynr::Future<std::vector<joynr::types::DiscoveryEntryWithMetaInfo>>>>
@@ -129,6 +171,7 @@ private:
     std::unordered_set<joynr::types::Version> _discoveredIncompatibleVersions;
     exceptions::DiscoveryException _arbitrationError;
     std::unique_ptr<const ArbitrationStrategyFunction> _arbitrationStrategyFunction;
+    std::mutex _callbacksMutex;
     std::function<void(const joynr::ArbitrationResult& arbitrationResult)> _onSuccessCallback;
     std::function<void(const exceptions::DiscoveryException& exception)> _onErrorCallback;
 
@@ -142,14 +185,13 @@ private:
     static constexpr std::uint64_t _epsilonMs{10000};
 
     DISALLOW_COPY_AND_ASSIGN(Arbitrator);
-    Semaphore _semaphore;
+    SteadyTimer _retryTimer;
+    SteadyTimer _lookupTimer;
     std::atomic<bool> _arbitrationFinished;
     std::atomic<bool> _arbitrationFailedForever;
     std::atomic<bool> _arbitrationRunning;
     std::atomic<bool> _arbitrationStopped;
-    std::thread _arbitrationThread;
     std::chrono::steady_clock::time_point _startTimePoint;
-    std::once_flag _onceFlag;
     bool _filterByVersionAndArbitrationStrategy;
     MessagingQos _messagingQos;
     ADD_LOGGER(Arbitrator)
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "joynr/Arbitrator.h"
+#include "joynr/BoostIoserviceForwardDecl.h"
 #include "joynr/JoynrExport.h"
 
 namespace joynr
@@ -42,6 +43,7 @@ public:
      *  Creates an arbitrator object using the type specified in the qosParameters.
      */
     static std::shared_ptr<Arbitrator> createArbitrator(
+            boost::asio::io_service& ioService,
             const std::string& domain,
             const std::string& interfaceName,
             const types::Version& interfaceVersion,
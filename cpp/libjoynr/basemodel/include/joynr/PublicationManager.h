@@ -197,6 +197,20 @@ public:
     void selectiveBroadcastOccurred(const std::string& subscriptionId,
                                     const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
                                     const Ts&... values);
+
+    /**
+     * @brief Publishes a selective broadcast to several subscriptions at once
+     *
+     * The subscriptions are grouped by their filter parameters, the filter chain is
+     * evaluated only once for each distinct set of filter parameters.
+     * @param subscriptionIds The subscriptions of the broadcast
+     * @param filters The broadcast filters of the provider
+     * @param values Broadcast's value
+     */
+    template <typename BroadcastFilter, typename... Ts>
+    void selectiveBroadcastOccurred(const std::vector<std::string>& subscriptionIds,
+                                    const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+                                    const Ts&... values);
     void shutdown();
 
 private:
@@ -492,26 +506,39 @@ void PublicationManager::selectiveBroadcastOccurred(
         const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
         const Ts&... values)
 {
+    selectiveBroadcastOccurred(std::vector<std::string>{subscriptionId}, filters, values...);
+}
 
+template <typename BroadcastFilter, typename... Ts>
+void PublicationManager::selectiveBroadcastOccurred(
+        const std::vector<std::string>& subscriptionIds,
+        const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+        const Ts&... values)
+{
     JOYNR_LOG_DEBUG(logger(),
-                    "selectiveBroadcastOccurred for subscription {}.  Number of values: ",
-                    subscriptionId,
+                    "selectiveBroadcastOccurred for {} subscriptions. Number of values: {}",
+                    subscriptionIds.size(),
                     sizeof...(Ts));
 
-    std::unique_lock<std::mutex> publicationsLock(_publicationsMutex);
-    std::shared_ptr<Publication> publication = _publications.value(subscriptionId);
-    std::shared_ptr<BroadcastSubscriptionRequestInformation> subscriptionRequest =
-            _subscriptionId2BroadcastSubscriptionRequest.value(subscriptionId);
-
-    // See if the subscription is still valid
-    if (!publication || !subscriptionRequest) {
-        JOYNR_LOG_ERROR(logger(),
-                        "broadcastOccurred called for non-existing subscription {}",
-                        subscriptionId);
-        return;
-    }
+    // result of the filter chain per set of filter parameters; the parameters are kept in an
+    // ordered map, hence equal parameters compare equal regardless of their insertion order
+    std::map<std::map<std::string, std::string>, bool> filterChainResults;
+    const std::map<std::string, std::string> noFilterParameters;
+
+    for (const auto& subscriptionId : subscriptionIds) {
+        std::unique_lock<std::mutex> publicationsLock(_publicationsMutex);
+        std::shared_ptr<Publication> publication = _publications.value(subscriptionId);
+        std::shared_ptr<BroadcastSubscriptionRequestInformation> subscriptionRequest =
+                _subscriptionId2BroadcastSubscriptionRequest.value(subscriptionId);
+
+        // See if the subscription is still valid
+        if (!publication || !subscriptionRequest) {
+            JOYNR_LOG_ERROR(logger(),
+                            "broadcastOccurred called for non-existing subscription {}",
+                            subscriptionId);
+            continue;
+        }
 
-    {
         std::lock_guard<std::recursive_mutex> publicationLocker((publication->_mutex));
         publicationsLock.unlock();
         // Only proceed if publication can immediately be sent
@@ -519,8 +546,26 @@ void PublicationManager::selectiveBroadcastOccurred(
                 getTimeUntilNextPublication(publication, subscriptionRequest->getQos());
 
         if (timeUntilNextPublication == 0) {
-            // Execute broadcast filters
-            if (processFilterChain(subscriptionRequest, filters, values...)) {
+            // Execute broadcast filters once per distinct set of filter parameters
+            bool filterChainSucceeded = true;
+            if (!filters.empty()) {
+                const boost::optional<BroadcastFilterParameters>& filterParameters =
+                        subscriptionRequest->getFilterParameters();
+                const std::map<std::string, std::string>& filterParametersMap =
+                        filterParameters ? filterParameters->getFilterParameters()
+                                         : noFilterParameters;
+                auto filterChainResult = filterChainResults.find(filterParametersMap);
+                if (filterChainResult == filterChainResults.cend()) {
+                    filterChainResult =
+                            filterChainResults
+                                    .emplace(filterParametersMap,
+                                             processFilterChain(
+                                                     subscriptionRequest, filters, values...))
+                                    .first;
+                }
+                filterChainSucceeded = filterChainResult->second;
+            }
+            if (filterChainSucceeded) {
                 // Send the publication
                 BaseReply replyValues;
                 replyValues.setResponse(values...);
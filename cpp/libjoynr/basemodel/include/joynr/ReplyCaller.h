@@ -23,6 +23,7 @@
 #include <memory>
 
 #include "joynr/IReplyCaller.h"
+#include "joynr/Metrics.h"
 #include "joynr/ReplyInterpreter.h"
 #include "joynr/exceptions/JoynrException.h"
 
@@ -34,7 +35,9 @@ class BaseReplyCaller : public IReplyCaller
 public:
     BaseReplyCaller(std::function<void(const std::shared_ptr<exceptions::JoynrException>& error)>&&
                             errorFct)
-            : _errorFct(std::move(errorFct)), _hasTimeOutOccurred(false)
+            : _errorFct(std::move(errorFct)),
+              _hasTimeOutOccurred(false),
+              _creationTime(metrics::Clock::now())
     {
     }
 
@@ -53,8 +56,16 @@ public:
     }
 
 protected:
+    void recordRoundTripTime() const
+    {
+        static const std::shared_ptr<metrics::Histogram> roundTripHistogram =
+                metrics::MetricsRegistry::instance().getHistogram("proxy.reply.roundTripUs");
+        roundTripHistogram->recordElapsedSince(_creationTime);
+    }
+
     std::function<void(const std::shared_ptr<exceptions::JoynrException>& error)> _errorFct;
     bool _hasTimeOutOccurred;
+    const metrics::Clock::time_point _creationTime;
 };
 
 template <class... Ts>
@@ -84,6 +95,7 @@ public:
 
     void execute(Reply&& reply) override
     {
+        recordRoundTripTime();
         ReplyInterpreter<Ts...>::execute(*this, std::move(reply));
     }
 
@@ -117,6 +129,7 @@ public:
 
     void execute(Reply&& reply) override
     {
+        recordRoundTripTime();
         ReplyInterpreter<void>::execute(*this, std::move(reply));
     }
 
@@ -19,6 +19,7 @@
 #ifndef UNICASTBROADCASTLISTENER_H
 #define UNICASTBROADCASTLISTENER_H
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -51,6 +52,17 @@ public:
     template <typename... Ts>
     void broadcastOccurred(const Ts&... values);
 
+    /**
+     * Informs all given listeners about a selective broadcast. The subscriptions are handed
+     * over to their publication manager in a single call, so that the filters are evaluated
+     * only once for subscriptions with equal filter parameters.
+     */
+    template <typename BroadcastFilter, typename... Ts>
+    static void groupedSelectiveBroadcastOccurred(
+            const std::vector<std::shared_ptr<UnicastBroadcastListener>>& listeners,
+            const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+            const Ts&... values);
+
 private:
     std::string _subscriptionId;
 };
@@ -80,6 +92,27 @@ void UnicastBroadcastListener::broadcastOccurred(const Ts&... values)
     }
 }
 
+template <typename BroadcastFilter, typename... Ts>
+void UnicastBroadcastListener::groupedSelectiveBroadcastOccurred(
+        const std::vector<std::shared_ptr<UnicastBroadcastListener>>& listeners,
+        const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+        const Ts&... values)
+{
+    // usually all listeners belong to the same publication manager
+    std::map<std::shared_ptr<PublicationManager>, std::vector<std::string>>
+            subscriptionIdsByPublicationManager;
+    for (const auto& listener : listeners) {
+        if (auto publicationManagerSharedPtr = listener->_publicationManager.lock()) {
+            subscriptionIdsByPublicationManager[std::move(publicationManagerSharedPtr)].push_back(
+                    listener->_subscriptionId);
+        }
+    }
+    for (const auto& subscriptionIds : subscriptionIdsByPublicationManager) {
+        subscriptionIds.first->selectiveBroadcastOccurred(
+                subscriptionIds.second, filters, values...);
+    }
+}
+
 } // namespace joynr
 
 #endif // UNICASTBROADCASTLISTENER_H
@@ -20,6 +20,7 @@
 #define JOYNREXCEPTIONSUTIL_H
 
 #include <exception>
+#include <memory>
 
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/exceptions/MethodInvocationException.h"
@@ -35,6 +36,8 @@ std::exception_ptr convertToExceptionPtr(const JoynrException& error);
 
 std::exception_ptr createJoynrTimeOutException(const std::string& message);
 
+std::shared_ptr<JoynrException> convertToJoynrException(std::exception_ptr eptr);
+
 /**
  * @brief Util class to transforms between Variant and joynr exceptions.
  */
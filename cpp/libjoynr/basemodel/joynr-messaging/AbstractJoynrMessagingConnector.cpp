@@ -48,9 +48,18 @@ void AbstractJoynrMessagingConnector::operationRequest(std::shared_ptr<IReplyCal
                                                        boost::optional<MessagingQos> qos)
 {
     if (auto ptr = _messageSender.lock()) {
+        const MessagingQos& messagingQos = qos ? *qos : _qosSettings;
+        // providers registered in the same runtime get the typed request without serialization
+        if (ptr->sendInProcessRequest(_proxyParticipantId,
+                                      _providerParticipantId,
+                                      messagingQos,
+                                      request,
+                                      replyCaller)) {
+            return;
+        }
         ptr->sendRequest(_proxyParticipantId,
                          _providerParticipantId,
-                         qos ? *qos : _qosSettings,
+                         messagingQos,
                          request,
                          std::move(replyCaller),
                          _providerDiscoveryEntry.getIsLocal());
@@ -61,9 +70,14 @@ void AbstractJoynrMessagingConnector::operationOneWayRequest(OneWayRequest&& req
                                                              boost::optional<MessagingQos> qos)
 {
     if (auto ptr = _messageSender.lock()) {
+        const MessagingQos& messagingQos = qos ? *qos : _qosSettings;
+        if (ptr->sendInProcessOneWayRequest(
+                    _proxyParticipantId, _providerParticipantId, messagingQos, request)) {
+            return;
+        }
         ptr->sendOneWayRequest(_proxyParticipantId,
                                _providerParticipantId,
-                               qos ? *qos : _qosSettings,
+                               messagingQos,
                                request,
                                _providerDiscoveryEntry.getIsLocal());
     }
@@ -19,13 +19,15 @@
 #include "joynr/Arbitrator.h"
 
 #include <cassert>
+#include <sstream>
 #include <vector>
 
 #include <boost/algorithm/string/join.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
 
 #include "joynr/Future.h"
 #include "joynr/Logger.h"
-#include "joynr/Semaphore.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/exceptions/NoCompatibleProviderFoundException.h"
@@ -35,6 +37,7 @@
 namespace joynr
 {
 Arbitrator::Arbitrator(
+        boost::asio::io_service& ioService,
         const std::string& domain,
         const std::string& interfaceName,
         const joynr::types::Version& interfaceVersion,
@@ -44,6 +47,8 @@ Arbitrator::Arbitrator(
         std::unique_ptr<const ArbitrationStrategyFunction> arbitrationStrategyFunction)
         : std::enable_shared_from_this<Arbitrator>(),
           _pendingFutureMutex(),
+          _attemptId(0),
+          _lookupPending(false),
           _pendingFuture(),
           _discoveryProxy(discoveryProxy),
           _gbids(gbids),
@@ -60,14 +65,14 @@ Arbitrator::Arbitrator(
           _discoveredIncompatibleVersions(),
           _arbitrationError("Arbitration could not be finished in time."),
           _arbitrationStrategyFunction(std::move(arbitrationStrategyFunction)),
-          _semaphore(0),
+          _callbacksMutex(),
+          _retryTimer(ioService),
+          _lookupTimer(ioService),
           _arbitrationFinished(false),
           _arbitrationFailedForever(false),
           _arbitrationRunning(false),
           _arbitrationStopped(false),
-          _arbitrationThread(),
           _startTimePoint(),
-          _onceFlag(),
           _filterByVersionAndArbitrationStrategy(true),
           _messagingQos(static_cast<std::uint64_t>(_discoveryQos.getDiscoveryTimeoutMs()) +
                         _epsilonMs)
@@ -107,100 +112,19 @@ void Arbitrator::startArbitration(
 
     _arbitrationRunning = true;
     _arbitrationStopped = false;
+    _arbitrationFinished = false;
+    _arbitrationFailedForever = false;
 
-    _onSuccessCallback = onSuccess;
-    _onErrorCallback = onError;
+    {
+        std::lock_guard<std::mutex> lock(_callbacksMutex);
+        _onSuccessCallback = std::move(onSuccess);
+        _onErrorCallback = std::move(onError);
+    }
 
     _filterByVersionAndArbitrationStrategy = filterByVersionAndArbitrationStrategy;
 
-    _arbitrationThread = std::thread([thisWeakPtr =
-                                              joynr::util::as_weak_ptr(shared_from_this())]() {
-        auto thisSharedPtr = thisWeakPtr.lock();
-        if (!thisSharedPtr) {
-            return;
-        }
-
-        thisSharedPtr->_arbitrationFinished = false;
-        thisSharedPtr->_arbitrationFailedForever = false;
-
-        JOYNR_LOG_TRACE(logger(),
-                        "Entering arbitration thread for domain: [{}], interface: {}, GBIDs = >{}<",
-                        thisSharedPtr->_serializedDomainsList,
-                        thisSharedPtr->_interfaceName,
-                        thisSharedPtr->_gbidString);
-
-        while (!thisSharedPtr->_arbitrationStopped) {
-            thisSharedPtr->attemptArbitration();
-
-            // exit if arbitration has finished successfully
-            if (thisSharedPtr->_arbitrationFinished) {
-                thisSharedPtr->assertNoPendingFuture();
-                return;
-            }
-
-            // check if we should break the loop and report errors to the user
-            if (thisSharedPtr->_arbitrationStopped) {
-                // stopArbitration has been invoked
-                break;
-            }
-
-            // If there are no suitable providers, retry the arbitration after the retry
-            // interval
-            // elapsed
-            const std::int64_t durationMs = thisSharedPtr->getDurationMs();
-
-            if (thisSharedPtr->_discoveryQos.getDiscoveryTimeoutMs() <= durationMs) {
-                // discovery timeout reached
-                break;
-            } else if (thisSharedPtr->_arbitrationFailedForever) {
-                // arbitration failed -> inform caller immediately
-                break;
-            } else if (thisSharedPtr->_discoveryQos.getDiscoveryTimeoutMs() - durationMs <=
-                       thisSharedPtr->_discoveryQos.getRetryIntervalMs()) {
-                // no retry possible -> inform caller about cancelled arbitration
-                // immediately
-                break;
-            } else {
-                // wait for retry interval and attempt a new arbitration
-                JOYNR_LOG_TRACE(logger(),
-                                "Rescheduling arbitration with delay {}ms",
-                                thisSharedPtr->_discoveryQos.getRetryIntervalMs());
-                auto waitIntervalMs = std::chrono::milliseconds(
-                        thisSharedPtr->_discoveryQos.getRetryIntervalMs());
-                thisSharedPtr->_semaphore.waitFor(waitIntervalMs);
-            }
-        }
-
-        if (thisSharedPtr->_onErrorCallback) {
-            if (thisSharedPtr->_arbitrationStopped) {
-                thisSharedPtr->_arbitrationError.setMessage(
-                        "Shutting Down Arbitration for interface " + thisSharedPtr->_interfaceName);
-                std::call_once(thisSharedPtr->_onceFlag,
-                               thisSharedPtr->_onErrorCallback,
-                               thisSharedPtr->_arbitrationError);
-                // If this point is reached the arbitration timed out
-            } else if (thisSharedPtr->_discoveredIncompatibleVersions.empty()) {
-                std::call_once(thisSharedPtr->_onceFlag,
-                               thisSharedPtr->_onErrorCallback,
-                               thisSharedPtr->_arbitrationError);
-            } else {
-                std::call_once(thisSharedPtr->_onceFlag,
-                               thisSharedPtr->_onErrorCallback,
-                               exceptions::NoCompatibleProviderFoundException(
-                                       thisSharedPtr->_discoveredIncompatibleVersions));
-            }
-            thisSharedPtr->_onSuccessCallback = nullptr;
-            thisSharedPtr->_onErrorCallback = nullptr;
-        }
-
-        thisSharedPtr->_arbitrationRunning = false;
-        JOYNR_LOG_DEBUG(logger(),
-                        "Exiting arbitration thread for domain: [{}], interface: {}, GBIDs = >{}<",
-                        thisSharedPtr->_serializedDomainsList,
-                        thisSharedPtr->_interfaceName,
-                        thisSharedPtr->_gbidString);
-        thisSharedPtr->assertNoPendingFuture();
-    });
+    // the first attempt is run on the io_service as well, so the caller is never blocked
+    scheduleAttempt(std::chrono::milliseconds(0));
 }
 
 void Arbitrator::stopArbitration()
@@ -210,44 +134,189 @@ void Arbitrator::stopArbitration()
                     _serializedDomainsList,
                     _interfaceName,
                     _gbidString);
+    const std::string errorMessage = "Shutting Down Arbitration for interface " + _interfaceName;
+    boost::variant<
+            std::shared_ptr<joynr::Future<joynr::types::DiscoveryEntryWithMetaInfo>>,
+            std::shared_ptr<joynr::Future<std::vector<joynr::types::DiscoveryEntryWithMetaInfo>>>>
+            pendingFuture;
     {
         std::unique_lock<std::mutex> lock(_pendingFutureMutex);
         _arbitrationStopped = true;
-
-        // check if there is a pending future and stop it if still in progress
-        auto error = std::make_shared<joynr::exceptions::JoynrRuntimeException>(
-                "Shutting Down Arbitration for interface " + _interfaceName);
-        boost::apply_visitor(
-                [error](auto& future) {
-                    if (future) {
-                        if (future->getStatus() == StatusCodeEnum::IN_PROGRESS) {
-                            future->onError(error);
-                        }
-                        future.reset();
-                    }
-                },
-                _pendingFuture);
+        _lookupPending = false;
+        pendingFuture = _pendingFuture;
+        boost::apply_visitor([](auto& future) { future.reset(); }, _pendingFuture);
     }
 
-    _semaphore.notify();
+    // stop the pending future if still in progress; this runs its continuations,
+    // hence it must not be done while holding _pendingFutureMutex
+    auto error = std::make_shared<joynr::exceptions::JoynrRuntimeException>(errorMessage);
+    boost::apply_visitor(
+            [error](auto& future) {
+                if (future && future->getStatus() == StatusCodeEnum::IN_PROGRESS) {
+                    future->onError(error);
+                }
+            },
+            pendingFuture);
+
+    _retryTimer.cancel();
+    _lookupTimer.cancel();
+
+    // no-op if the result has already been reported
+    notifyArbitrationError(exceptions::DiscoveryException(errorMessage));
+    _arbitrationRunning = false;
+}
 
-    if (_arbitrationThread.joinable()) {
-        JOYNR_LOG_DEBUG(logger(), "Thread can be joined. Joining thread ({}) ...", _interfaceName);
-        _arbitrationThread.join();
+void Arbitrator::scheduleAttempt(std::chrono::milliseconds delay)
+{
+    _retryTimer.expiresFromNow(delay);
+    _retryTimer.asyncWait([thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
+                                  const boost::system::error_code& errorCode) {
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            thisSharedPtr->onRetryTimerExpired(errorCode);
+        }
+    });
+}
+
+void Arbitrator::onRetryTimerExpired(const boost::system::error_code& errorCode)
+{
+    if (errorCode == boost::asio::error::operation_aborted || _arbitrationStopped) {
+        return;
     }
+    if (errorCode) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Failed to schedule arbitration for interface {}: {}",
+                        _interfaceName,
+                        errorCode.message());
+    }
+    runAttempt();
 }
 
-void Arbitrator::validatePendingFuture()
+void Arbitrator::runAttempt()
 {
-    std::unique_lock<std::mutex> lock(_pendingFutureMutex);
+    JOYNR_LOG_TRACE(logger(),
+                    "Attempting arbitration for domain: [{}], interface: {}, GBIDs = >{}<",
+                    _serializedDomainsList,
+                    _interfaceName,
+                    _gbidString);
+
+    attemptArbitration();
+
+    std::uint64_t attemptId;
+    bool lookupPending;
+    boost::variant<
+            std::shared_ptr<joynr::Future<joynr::types::DiscoveryEntryWithMetaInfo>>,
+            std::shared_ptr<joynr::Future<std::vector<joynr::types::DiscoveryEntryWithMetaInfo>>>>
+            pendingFuture;
+    {
+        std::unique_lock<std::mutex> lock(_pendingFutureMutex);
+        attemptId = _attemptId;
+        lookupPending = _lookupPending;
+        pendingFuture = _pendingFuture;
+    }
+
+    if (!lookupPending) {
+        onAttemptFinished();
+        return;
+    }
+
+    // the results are taken from the future, the continuations only signal its completion;
+    // they run immediately if the lookup has already finished
+    auto onLookupFinished = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+                             attemptId](const auto&...) {
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            thisSharedPtr->onLookupFinished(attemptId);
+        }
+    };
     boost::apply_visitor(
-            [](auto& future) {
+            [&onLookupFinished](auto& future) {
                 if (future) {
-                    assert(future->getStatus() != StatusCodeEnum::IN_PROGRESS);
-                    future.reset();
+                    // the future returned by then() also fails if the lookup fails
+                    future->then(onLookupFinished)->catchError(onLookupFinished);
                 }
             },
-            _pendingFuture);
+            pendingFuture);
+}
+
+void Arbitrator::onAttemptFinished()
+{
+    // exit if arbitration has finished successfully
+    if (_arbitrationFinished) {
+        assertNoPendingFuture();
+        return;
+    }
+
+    // stopArbitration has been invoked and already reported the error
+    if (_arbitrationStopped) {
+        return;
+    }
+
+    // If there are no suitable providers, retry the arbitration after the retry interval
+    // elapsed
+    const std::int64_t durationMs = getDurationMs();
+
+    if (_discoveryQos.getDiscoveryTimeoutMs() <= durationMs) {
+        // discovery timeout reached
+        reportArbitrationError();
+    } else if (_arbitrationFailedForever) {
+        // arbitration failed -> inform caller immediately
+        reportArbitrationError();
+    } else if (_discoveryQos.getDiscoveryTimeoutMs() - durationMs <=
+               _discoveryQos.getRetryIntervalMs()) {
+        // no retry possible -> inform caller about cancelled arbitration immediately
+        reportArbitrationError();
+    } else {
+        // wait for retry interval and attempt a new arbitration
+        JOYNR_LOG_TRACE(logger(),
+                        "Rescheduling arbitration with delay {}ms",
+                        _discoveryQos.getRetryIntervalMs());
+        scheduleAttempt(std::chrono::milliseconds(_discoveryQos.getRetryIntervalMs()));
+    }
+}
+
+void Arbitrator::reportArbitrationError()
+{
+    if (_discoveredIncompatibleVersions.empty()) {
+        notifyArbitrationError(_arbitrationError);
+    } else {
+        notifyArbitrationError(
+                exceptions::NoCompatibleProviderFoundException(_discoveredIncompatibleVersions));
+    }
+
+    _arbitrationRunning = false;
+    JOYNR_LOG_DEBUG(logger(),
+                    "Arbitration failed for domain: [{}], interface: {}, GBIDs = >{}<",
+                    _serializedDomainsList,
+                    _interfaceName,
+                    _gbidString);
+    assertNoPendingFuture();
+}
+
+void Arbitrator::notifyArbitrationSuccess(const joynr::ArbitrationResult& arbitrationResult)
+{
+    std::function<void(const joynr::ArbitrationResult& arbitrationResult)> onSuccess;
+    {
+        std::lock_guard<std::mutex> lock(_callbacksMutex);
+        onSuccess = std::move(_onSuccessCallback);
+        _onSuccessCallback = nullptr;
+        _onErrorCallback = nullptr;
+    }
+    if (onSuccess) {
+        onSuccess(arbitrationResult);
+    }
+}
+
+void Arbitrator::notifyArbitrationError(const exceptions::DiscoveryException& exception)
+{
+    std::function<void(const exceptions::DiscoveryException& exception)> onError;
+    {
+        std::lock_guard<std::mutex> lock(_callbacksMutex);
+        onError = std::move(_onErrorCallback);
+        _onSuccessCallback = nullptr;
+        _onErrorCallback = nullptr;
+    }
+    if (onError) {
+        onError(exception);
+    }
 }
 
 void Arbitrator::assertNoPendingFuture()
@@ -264,15 +333,9 @@ void Arbitrator::assertNoPendingFuture()
 void Arbitrator::attemptArbitration()
 {
     assertNoPendingFuture();
-    std::vector<joynr::types::DiscoveryEntryWithMetaInfo> result;
     const bool isArbitrationStrategyFixedParticipant =
             _discoveryQos.getArbitrationStrategy() ==
             DiscoveryQos::ArbitrationStrategy::FIXED_PARTICIPANT;
-    const std::string fixedParticipantId =
-            isArbitrationStrategyFixedParticipant
-                    // custom parameter is present in this case, checked in ArbitratorFactory
-                    ? _discoveryQos.getCustomParameter("fixedParticipantId").getValue()
-                    : "";
 
     JOYNR_LOG_DEBUG(logger(),
                     "DISCOVERY lookup for domain: [{}], interface: {}, GBIDs = >{}<",
@@ -295,107 +358,198 @@ void Arbitrator::attemptArbitration()
         _systemDiscoveryQos.setDiscoveryTimeout(remainingTtlMs);
         _messagingQos.setTtl(static_cast<std::uint64_t>(remainingTtlMs) + _epsilonMs);
 
-        if (isArbitrationStrategyFixedParticipant) {
-            types::DiscoveryEntryWithMetaInfo fixedParticipantResult;
-
-            auto future = discoveryProxySharedPtr->lookupAsync(fixedParticipantId,
-                                                               _systemDiscoveryQos,
-                                                               _gbids,
-                                                               nullptr,
-                                                               nullptr,
-                                                               nullptr,
-                                                               _messagingQos);
-            {
-                std::unique_lock<std::mutex> lock(_pendingFutureMutex);
-                if (_arbitrationStopped) {
-                    return;
-                } else {
-                    _pendingFuture = future;
-                }
+        std::uint64_t attemptId;
+        {
+            std::unique_lock<std::mutex> lock(_pendingFutureMutex);
+            if (_arbitrationStopped) {
+                return;
             }
+            attemptId = ++_attemptId;
+            _lookupPending = true;
+        }
 
-            future->get(remainingTtlMs, fixedParticipantResult);
-            validatePendingFuture();
-            // _filterByVersionAndArbitrationStrategy allows to determine whether the
-            // GuidedProxyBuilder is used. false => GuidedProxyBuilder
-            if (_filterByVersionAndArbitrationStrategy &&
-                fixedParticipantResult.getInterfaceName() != _interfaceName) {
-                _arbitrationFailedForever = true;
-                std::stringstream msg;
-                msg << "incompatible interface returned, expected: " << _interfaceName
-                    << " actual: " << fixedParticipantResult.getInterfaceName();
-                throw exceptions::DiscoveryException(msg.str());
+        auto storePendingFuture = [this](auto future) {
+            std::unique_lock<std::mutex> lock(_pendingFutureMutex);
+            if (!_lookupPending) {
+                // stopArbitration has been invoked in the meantime
+                return false;
             }
-            result.push_back(fixedParticipantResult);
+            _pendingFuture = std::move(future);
+            return true;
+        };
+
+        bool lookupStarted;
+        if (isArbitrationStrategyFixedParticipant) {
+            // custom parameter is present in this case, checked in ArbitratorFactory
+            const std::string fixedParticipantId =
+                    _discoveryQos.getCustomParameter("fixedParticipantId").getValue();
+            lookupStarted = storePendingFuture(
+                    discoveryProxySharedPtr->lookupAsync(fixedParticipantId,
+                                                         _systemDiscoveryQos,
+                                                         _gbids,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         _messagingQos));
         } else {
-            auto future = discoveryProxySharedPtr->lookupAsync(_domains,
-                                                               _interfaceName,
-                                                               _systemDiscoveryQos,
-                                                               _gbids,
-                                                               nullptr,
-                                                               nullptr,
-                                                               nullptr,
-                                                               _messagingQos);
-            {
-                std::unique_lock<std::mutex> lock(_pendingFutureMutex);
-                if (_arbitrationStopped) {
-                    return;
-                } else {
-                    _pendingFuture = future;
+            lookupStarted = storePendingFuture(
+                    discoveryProxySharedPtr->lookupAsync(_domains,
+                                                         _interfaceName,
+                                                         _systemDiscoveryQos,
+                                                         _gbids,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         _messagingQos));
+        }
+
+        if (lookupStarted) {
+            _lookupTimer.expiresFromNow(std::chrono::milliseconds(remainingTtlMs));
+            _lookupTimer.asyncWait([thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+                                    attemptId](const boost::system::error_code& errorCode) {
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->onLookupTimerExpired(errorCode, attemptId);
                 }
-            }
+            });
+        }
+    } catch (const exceptions::JoynrException& e) {
+        handleLookupError(e);
+    }
+}
 
-            future->get(remainingTtlMs, result);
-            validatePendingFuture();
+void Arbitrator::onLookupFinished(std::uint64_t attemptId)
+{
+    boost::variant<
+            std::shared_ptr<joynr::Future<joynr::types::DiscoveryEntryWithMetaInfo>>,
+            std::shared_ptr<joynr::Future<std::vector<joynr::types::DiscoveryEntryWithMetaInfo>>>>
+            finishedFuture;
+    {
+        std::unique_lock<std::mutex> lock(_pendingFutureMutex);
+        if (!_lookupPending || attemptId != _attemptId) {
+            // outdated notification or the result has already been processed
+            return;
         }
+        const bool isFinished = boost::apply_visitor(
+                [](const auto& future) {
+                    return future && future->getStatus() != StatusCodeEnum::IN_PROGRESS;
+                },
+                _pendingFuture);
+        if (!isFinished) {
+            return;
+        }
+        finishedFuture = _pendingFuture;
+        boost::apply_visitor([](auto& future) { future.reset(); }, _pendingFuture);
+        _lookupPending = false;
+    }
 
-        receiveCapabilitiesLookupResults(result);
+    _lookupTimer.cancel();
+    boost::apply_visitor([this](auto& future) { processLookupResult(std::move(future)); },
+                         finishedFuture);
+    onAttemptFinished();
+}
 
+void Arbitrator::onLookupTimerExpired(const boost::system::error_code& errorCode,
+                                      std::uint64_t attemptId)
+{
+    if (errorCode == boost::asio::error::operation_aborted) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(_pendingFutureMutex);
+        if (!_lookupPending || attemptId != _attemptId) {
+            return;
+        }
+        // a late reply of this lookup will be ignored
+        boost::apply_visitor([](auto& future) { future.reset(); }, _pendingFuture);
+        _lookupPending = false;
+    }
+
+    handleLookupError(exceptions::JoynrTimeOutException("Request did not finish in time"));
+    onAttemptFinished();
+}
+
+void Arbitrator::processLookupResult(
+        std::shared_ptr<joynr::Future<joynr::types::DiscoveryEntryWithMetaInfo>> future)
+{
+    try {
+        types::DiscoveryEntryWithMetaInfo fixedParticipantResult;
+        future->get(fixedParticipantResult);
+        // _filterByVersionAndArbitrationStrategy allows to determine whether the
+        // GuidedProxyBuilder is used. false => GuidedProxyBuilder
+        if (_filterByVersionAndArbitrationStrategy &&
+            fixedParticipantResult.getInterfaceName() != _interfaceName) {
+            _arbitrationFailedForever = true;
+            std::stringstream msg;
+            msg << "incompatible interface returned, expected: " << _interfaceName
+                << " actual: " << fixedParticipantResult.getInterfaceName();
+            throw exceptions::DiscoveryException(msg.str());
+        }
+        receiveCapabilitiesLookupResults({fixedParticipantResult});
     } catch (const exceptions::JoynrException& e) {
-        std::string errorMsg =
-                "Unable to lookup provider (" +
-                (isArbitrationStrategyFixedParticipant
-                         ? ("participantId: " + fixedParticipantId)
-                         : ("domain: [" +
-                            (_domains.empty() ? std::string("EMPTY") : _serializedDomainsList) +
-                            "], interface: " + _interfaceName)) +
-                (_gbids.empty() ? "" : ", GBIDs: " + _gbidString) + ") from discovery. ";
-        if (exceptions::ApplicationException::TYPE_NAME() == e.getTypeName()) {
-            const exceptions::ApplicationException& applicationException =
-                    static_cast<const exceptions::ApplicationException&>(e);
-            auto error = applicationException.getError<types::DiscoveryError::Enum>();
-            switch (error) {
-            case types::DiscoveryError::NO_ENTRY_FOR_PARTICIPANT:
-            // fall through
-            case types::DiscoveryError::NO_ENTRY_FOR_SELECTED_BACKENDS: {
-                _discoveredIncompatibleVersions.clear();
-                errorMsg += "DiscoveryError: " + types::DiscoveryError::getLiteral(error);
-                JOYNR_LOG_INFO(logger(), errorMsg + ", continuing.");
-                break;
-            }
-            case types::DiscoveryError::UNKNOWN_GBID:
-            // fall through to default
-            case types::DiscoveryError::INVALID_GBID:
-            // fall through to default
-            case types::DiscoveryError::INTERNAL_ERROR:
-            // fall through to default
-            default:
-                _discoveredIncompatibleVersions.clear();
-                errorMsg += "DiscoveryError: " + types::DiscoveryError::getLiteral(error);
-                JOYNR_LOG_ERROR(logger(), errorMsg + ", giving up.");
-                _arbitrationFailedForever = true;
-                break;
-            }
-        } else {
-            errorMsg += "JoynrException: " + e.getMessage();
-            JOYNR_LOG_ERROR(logger(),
-                            _arbitrationFailedForever ? errorMsg + ", giving up."
-                                                      : errorMsg + ", continuing.");
+        handleLookupError(e);
+    }
+}
+
+void Arbitrator::processLookupResult(
+        std::shared_ptr<joynr::Future<std::vector<joynr::types::DiscoveryEntryWithMetaInfo>>>
+                future)
+{
+    try {
+        std::vector<joynr::types::DiscoveryEntryWithMetaInfo> result;
+        future->get(result);
+        receiveCapabilitiesLookupResults(result);
+    } catch (const exceptions::JoynrException& e) {
+        handleLookupError(e);
+    }
+}
+
+void Arbitrator::handleLookupError(const exceptions::JoynrException& e)
+{
+    const bool isArbitrationStrategyFixedParticipant =
+            _discoveryQos.getArbitrationStrategy() ==
+            DiscoveryQos::ArbitrationStrategy::FIXED_PARTICIPANT;
+    std::string errorMsg =
+            "Unable to lookup provider (" +
+            (isArbitrationStrategyFixedParticipant
+                     ? ("participantId: " +
+                        _discoveryQos.getCustomParameter("fixedParticipantId").getValue())
+                     : ("domain: [" +
+                        (_domains.empty() ? std::string("EMPTY") : _serializedDomainsList) +
+                        "], interface: " + _interfaceName)) +
+            (_gbids.empty() ? "" : ", GBIDs: " + _gbidString) + ") from discovery. ";
+    if (exceptions::ApplicationException::TYPE_NAME() == e.getTypeName()) {
+        const exceptions::ApplicationException& applicationException =
+                static_cast<const exceptions::ApplicationException&>(e);
+        auto error = applicationException.getError<types::DiscoveryError::Enum>();
+        switch (error) {
+        case types::DiscoveryError::NO_ENTRY_FOR_PARTICIPANT:
+        // fall through
+        case types::DiscoveryError::NO_ENTRY_FOR_SELECTED_BACKENDS: {
+            _discoveredIncompatibleVersions.clear();
+            errorMsg += "DiscoveryError: " + types::DiscoveryError::getLiteral(error);
+            JOYNR_LOG_INFO(logger(), errorMsg + ", continuing.");
+            break;
         }
-        _arbitrationError.setMessage(errorMsg);
-        validatePendingFuture();
+        case types::DiscoveryError::UNKNOWN_GBID:
+        // fall through to default
+        case types::DiscoveryError::INVALID_GBID:
+        // fall through to default
+        case types::DiscoveryError::INTERNAL_ERROR:
+        // fall through to default
+        default:
+            _discoveredIncompatibleVersions.clear();
+            errorMsg += "DiscoveryError: " + types::DiscoveryError::getLiteral(error);
+            JOYNR_LOG_ERROR(logger(), errorMsg + ", giving up.");
+            _arbitrationFailedForever = true;
+            break;
+        }
+    } else {
+        errorMsg += "JoynrException: " + e.getMessage();
+        JOYNR_LOG_ERROR(logger(),
+                        _arbitrationFailedForever ? errorMsg + ", giving up."
+                                                  : errorMsg + ", continuing.");
     }
-    assertNoPendingFuture();
+    _arbitrationError.setMessage(errorMsg);
 }
 
 void Arbitrator::receiveCapabilitiesLookupResults(
@@ -457,12 +611,8 @@ void Arbitrator::receiveCapabilitiesLookupResults(
     if (!selectedDiscoveryEntries.empty()) {
         joynr::ArbitrationResult arbitrationResult =
                 joynr::ArbitrationResult(selectedDiscoveryEntries);
-        if (_onSuccessCallback) {
-            std::call_once(_onceFlag, _onSuccessCallback, arbitrationResult);
-            _onSuccessCallback = nullptr;
-            _onErrorCallback = nullptr;
-        }
         _arbitrationFinished = true;
+        notifyArbitrationSuccess(arbitrationResult);
     }
 }
 
@@ -30,6 +30,7 @@ namespace joynr
 {
 
 std::shared_ptr<Arbitrator> ArbitratorFactory::createArbitrator(
+        boost::asio::io_service& ioService,
         const std::string& domain,
         const std::string& interfaceName,
         const joynr::types::Version& interfaceVersion,
@@ -66,7 +67,8 @@ std::shared_ptr<Arbitrator> ArbitratorFactory::createArbitrator(
     default:
         throw exceptions::DiscoveryException("Arbitrator creation failed: Invalid strategy!");
     }
-    return std::make_shared<Arbitrator>(domain,
+    return std::make_shared<Arbitrator>(ioService,
+                                        domain,
                                         interfaceName,
                                         interfaceVersion,
                                         discoveryProxy,
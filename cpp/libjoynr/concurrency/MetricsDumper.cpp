@@ -0,0 +1,95 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/MetricsDumper.h"
+
+#include <stdexcept>
+
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
+
+#include "joynr/Metrics.h"
+#include "joynr/Util.h"
+
+namespace joynr
+{
+
+MetricsDumper::MetricsDumper(boost::asio::io_service& ioService,
+                             const std::string& fileName,
+                             std::chrono::milliseconds dumpInterval)
+        : _dumpTimer(ioService), _fileName(fileName), _dumpInterval(dumpInterval), _isStopped(false)
+{
+}
+
+MetricsDumper::~MetricsDumper()
+{
+    _dumpTimer.cancel();
+}
+
+void MetricsDumper::start()
+{
+    JOYNR_LOG_INFO(logger(),
+                   "Dumping metrics every {}ms to {}",
+                   _dumpInterval.count(),
+                   _fileName);
+    scheduleDump();
+}
+
+void MetricsDumper::stop()
+{
+    if (_isStopped.exchange(true)) {
+        return;
+    }
+    _dumpTimer.cancel();
+    dump();
+}
+
+void MetricsDumper::scheduleDump()
+{
+    _dumpTimer.expiresFromNow(_dumpInterval);
+    _dumpTimer.asyncWait([thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
+                                 const boost::system::error_code& errorCode) {
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            thisSharedPtr->onDumpTimerExpired(errorCode);
+        }
+    });
+}
+
+void MetricsDumper::onDumpTimerExpired(const boost::system::error_code& errorCode)
+{
+    if (errorCode == boost::asio::error::operation_aborted || _isStopped) {
+        return;
+    }
+    if (errorCode) {
+        JOYNR_LOG_ERROR(logger(), "Failed to schedule metrics dump: {}", errorCode.message());
+        return;
+    }
+    dump();
+    scheduleDump();
+}
+
+void MetricsDumper::dump()
+{
+    try {
+        metrics::MetricsRegistry::instance().dumpToFile(_fileName);
+    } catch (const std::runtime_error& e) {
+        JOYNR_LOG_ERROR(logger(), "Failed to dump metrics to {}: {}", _fileName, e.what());
+    }
+}
+
+} // namespace joynr
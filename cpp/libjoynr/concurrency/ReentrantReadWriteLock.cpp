@@ -0,0 +1,135 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/ReentrantReadWriteLock.h"
+
+#include <cassert>
+
+namespace joynr
+{
+
+namespace
+{
+
+// number of shared locks held by the current thread, on any ReentrantReadWriteLock
+thread_local std::size_t sharedLocksHeldByThread = 0;
+
+} // namespace
+
+ReentrantReadWriteLock::ReentrantReadWriteLock()
+        : _mutex(), _condition(), _writer(), _writerDepth(0), _readers(0), _waitingWriters(0)
+{
+}
+
+void ReentrantReadWriteLock::lock()
+{
+    const std::thread::id self = std::this_thread::get_id();
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_writerDepth > 0 && _writer == self) {
+        ++_writerDepth;
+        return;
+    }
+    ++_waitingWriters;
+    _condition.wait(lock, [this]() { return _writerDepth == 0 && _readers == 0; });
+    --_waitingWriters;
+    _writer = self;
+    _writerDepth = 1;
+}
+
+bool ReentrantReadWriteLock::try_lock()
+{
+    const std::thread::id self = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_writerDepth > 0 && _writer == self) {
+        ++_writerDepth;
+        return true;
+    }
+    if (_writerDepth > 0 || _readers > 0) {
+        return false;
+    }
+    _writer = self;
+    _writerDepth = 1;
+    return true;
+}
+
+void ReentrantReadWriteLock::unlock()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    assert(_writerDepth > 0 && _writer == std::this_thread::get_id());
+    if (--_writerDepth == 0) {
+        _writer = std::thread::id();
+        _condition.notify_all();
+    }
+}
+
+void ReentrantReadWriteLock::lock_shared()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_writerDepth > 0 && _writer == std::this_thread::get_id()) {
+        // the exclusive owner already has shared access
+        ++_writerDepth;
+        return;
+    }
+    if (sharedLocksHeldByThread > 0) {
+        _condition.wait(lock, [this]() { return _writerDepth == 0; });
+    } else {
+        _condition.wait(lock, [this]() { return _writerDepth == 0 && _waitingWriters == 0; });
+    }
+    ++_readers;
+    ++sharedLocksHeldByThread;
+}
+
+bool ReentrantReadWriteLock::try_lock_shared()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_writerDepth > 0 && _writer == std::this_thread::get_id()) {
+        ++_writerDepth;
+        return true;
+    }
+    if (_writerDepth > 0 || (_waitingWriters > 0 && sharedLocksHeldByThread == 0)) {
+        return false;
+    }
+    ++_readers;
+    ++sharedLocksHeldByThread;
+    return true;
+}
+
+void ReentrantReadWriteLock::unlock_shared()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_writerDepth > 0 && _writer == std::this_thread::get_id()) {
+        if (--_writerDepth == 0) {
+            _writer = std::thread::id();
+            _condition.notify_all();
+        }
+        return;
+    }
+    assert(_readers > 0 && sharedLocksHeldByThread > 0);
+    --sharedLocksHeldByThread;
+    if (--_readers == 0) {
+        _condition.notify_all();
+    }
+}
+
+bool ReentrantReadWriteLock::isLockedExclusivelyByCurrentThread() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _writerDepth > 0 && _writer == std::this_thread::get_id();
+}
+
+} // namespace joynr
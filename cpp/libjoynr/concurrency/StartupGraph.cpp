@@ -0,0 +1,216 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/StartupGraph.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace joynr
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+double toMilliseconds(std::chrono::microseconds duration)
+{
+    return static_cast<double>(duration.count()) / 1000.0;
+}
+
+} // namespace
+
+StartupGraph::StartupGraph(const std::string& name)
+        : _name(name), _steps(), _timings(), _totalDuration(0)
+{
+}
+
+void StartupGraph::addStep(const std::string& name,
+                           const std::vector<std::string>& dependencies,
+                           std::function<void()> step)
+{
+    const auto sameName = [&name](const Step& existingStep) { return existingStep.name == name; };
+    if (std::any_of(_steps.cbegin(), _steps.cend(), sameName)) {
+        throw std::invalid_argument(_name + ": duplicate startup step " + name);
+    }
+    _steps.push_back(Step{name, dependencies, std::move(step)});
+}
+
+std::vector<std::vector<std::size_t>> StartupGraph::resolveDependents() const
+{
+    std::unordered_map<std::string, std::size_t> indices;
+    for (std::size_t i = 0; i < _steps.size(); ++i) {
+        indices.emplace(_steps[i].name, i);
+    }
+
+    std::vector<std::vector<std::size_t>> dependents(_steps.size());
+    std::vector<std::size_t> pendingDependencies(_steps.size(), 0);
+    for (std::size_t i = 0; i < _steps.size(); ++i) {
+        for (const auto& dependency : _steps[i].dependencies) {
+            const auto found = indices.find(dependency);
+            if (found == indices.cend()) {
+                throw std::invalid_argument(_name + ": startup step " + _steps[i].name +
+                                            " depends on unknown step " + dependency);
+            }
+            dependents[found->second].push_back(i);
+            ++pendingDependencies[i];
+        }
+    }
+
+    // a topological sort which does not reach every step reveals a cycle
+    std::deque<std::size_t> ready;
+    for (std::size_t i = 0; i < _steps.size(); ++i) {
+        if (pendingDependencies[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+    std::size_t numberOfSortedSteps = 0;
+    while (!ready.empty()) {
+        const std::size_t index = ready.front();
+        ready.pop_front();
+        ++numberOfSortedSteps;
+        for (const std::size_t dependent : dependents[index]) {
+            if (--pendingDependencies[dependent] == 0) {
+                ready.push_back(dependent);
+            }
+        }
+    }
+    if (numberOfSortedSteps != _steps.size()) {
+        throw std::invalid_argument(_name + ": startup steps have cyclic dependencies");
+    }
+    return dependents;
+}
+
+void StartupGraph::run(std::size_t maxParallelism)
+{
+    const std::vector<std::vector<std::size_t>> dependents = resolveDependents();
+
+    std::vector<std::size_t> pendingDependencies(_steps.size(), 0);
+    std::deque<std::size_t> ready;
+    for (std::size_t i = 0; i < _steps.size(); ++i) {
+        pendingDependencies[i] = _steps[i].dependencies.size();
+        if (pendingDependencies[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    _timings.clear();
+    _timings.reserve(_steps.size());
+    std::mutex mutex;
+    std::condition_variable stepFinished;
+    std::size_t numberOfFinishedSteps = 0;
+    std::exception_ptr firstError;
+    const Clock::time_point runStart = Clock::now();
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            stepFinished.wait(lock, [&]() {
+                return !ready.empty() || firstError || numberOfFinishedSteps == _steps.size();
+            });
+            if (firstError || ready.empty()) {
+                return;
+            }
+            const std::size_t index = ready.front();
+            ready.pop_front();
+            lock.unlock();
+
+            std::exception_ptr error;
+            const Clock::time_point stepStart = Clock::now();
+            try {
+                _steps[index].work();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            const Clock::time_point stepEnd = Clock::now();
+
+            lock.lock();
+            _timings.push_back(StepTiming{
+                    _steps[index].name,
+                    std::chrono::duration_cast<std::chrono::microseconds>(stepStart - runStart),
+                    std::chrono::duration_cast<std::chrono::microseconds>(stepEnd - stepStart)});
+            if (error) {
+                JOYNR_LOG_ERROR(logger(), "{}: startup step {} failed", _name, _steps[index].name);
+                if (!firstError) {
+                    firstError = error;
+                }
+            } else {
+                ++numberOfFinishedSteps;
+                for (const std::size_t dependent : dependents[index]) {
+                    if (--pendingDependencies[dependent] == 0) {
+                        ready.push_back(dependent);
+                    }
+                }
+            }
+            stepFinished.notify_all();
+        }
+    };
+
+    const std::size_t numberOfThreads =
+            std::max<std::size_t>(1, std::min(maxParallelism, _steps.size()));
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (std::size_t i = 1; i < numberOfThreads; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    _totalDuration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - runStart);
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+const std::vector<StartupGraph::StepTiming>& StartupGraph::getTimings() const
+{
+    return _timings;
+}
+
+std::chrono::microseconds StartupGraph::getTotalDuration() const
+{
+    return _totalDuration;
+}
+
+std::string StartupGraph::getTimingReport() const
+{
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(1) << _name << " took "
+           << toMilliseconds(_totalDuration) << "ms:";
+    const char* separator = " ";
+    for (const auto& timing : _timings) {
+        report << separator << timing.name << " " << toMilliseconds(timing.duration) << "ms (+"
+               << toMilliseconds(timing.startOffset) << "ms)";
+        separator = ", ";
+    }
+    return report.str();
+}
+
+} // namespace joynr
@@ -0,0 +1,83 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef METRICSDUMPER_H
+#define METRICSDUMPER_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "joynr/BoostIoserviceForwardDecl.h"
+#include "joynr/JoynrExport.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+#include "joynr/SteadyTimer.h"
+
+namespace boost
+{
+namespace system
+{
+class error_code;
+} // namespace system
+} // namespace boost
+
+namespace joynr
+{
+
+/**
+ * @brief Periodically writes the content of the MetricsRegistry as JSON to a file.
+ */
+class JOYNR_EXPORT MetricsDumper : public std::enable_shared_from_this<MetricsDumper>
+{
+public:
+    MetricsDumper(boost::asio::io_service& ioService,
+                  const std::string& fileName,
+                  std::chrono::milliseconds dumpInterval);
+    ~MetricsDumper();
+
+    /**
+     * @brief Starts the periodic dump.
+     * @note Must be called after constructor is called
+     * since it requires shared_ptr to own object
+     */
+    void start();
+
+    /**
+     * @brief Stops the periodic dump and writes the metrics a last time
+     */
+    void stop();
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(MetricsDumper);
+    ADD_LOGGER(MetricsDumper)
+
+    void scheduleDump();
+    void onDumpTimerExpired(const boost::system::error_code& errorCode);
+    void dump();
+
+    SteadyTimer _dumpTimer;
+    const std::string _fileName;
+    const std::chrono::milliseconds _dumpInterval;
+    std::atomic<bool> _isStopped;
+};
+
+} // namespace joynr
+
+#endif // METRICSDUMPER_H
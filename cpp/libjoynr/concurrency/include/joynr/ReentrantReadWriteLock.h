@@ -0,0 +1,85 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef REENTRANTREADWRITELOCK_H
+#define REENTRANTREADWRITELOCK_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+/**
+ * @brief Reader/writer lock whose exclusive ownership is reentrant.
+ *
+ * Any number of threads may hold the lock shared at the same time. The thread
+ * holding the lock exclusively may lock it again, exclusively or shared, without
+ * blocking; such nested acquisitions are released in any order. This allows code
+ * holding the exclusive lock to call functions that only need shared access.
+ *
+ * Waiting writers are preferred over new readers so that a steady stream of
+ * lookups cannot starve writers. Threads which already hold a shared lock are
+ * exempt from this, hence nested shared acquisitions do not deadlock.
+ * Upgrading a shared lock to an exclusive lock is not supported.
+ *
+ * Satisfies the Lockable and SharedLockable requirements, i.e. it can be used
+ * with std::unique_lock and std::shared_lock.
+ */
+class JOYNR_EXPORT ReentrantReadWriteLock
+{
+public:
+    ReentrantReadWriteLock();
+    ~ReentrantReadWriteLock() = default;
+
+    void lock();
+    bool try_lock();
+    void unlock();
+
+    void lock_shared();
+    bool try_lock_shared();
+    void unlock_shared();
+
+    /**
+     * @return true if the calling thread holds the lock exclusively
+     */
+    bool isLockedExclusivelyByCurrentThread() const;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(ReentrantReadWriteLock);
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    std::thread::id _writer;
+    std::size_t _writerDepth;
+    std::size_t _readers;
+    std::size_t _waitingWriters;
+};
+
+using ReentrantReadLocker = std::shared_lock<ReentrantReadWriteLock>;
+using ReentrantWriteLocker = std::unique_lock<ReentrantReadWriteLock>;
+
+} // namespace joynr
+
+#endif // REENTRANTREADWRITELOCK_H
@@ -0,0 +1,113 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef STARTUPGRAPH_H
+#define STARTUPGRAPH_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+/**
+ * @brief Runs named initialization steps as a dependency graph.
+ *
+ * Every step is started as soon as all steps it depends on have finished, so
+ * independent steps (e.g. loading different persistence files) run concurrently.
+ * The duration of every step is recorded for a timing report.
+ */
+class JOYNR_EXPORT StartupGraph
+{
+public:
+    struct StepTiming {
+        std::string name;
+        /*! time between the start of run() and the start of the step */
+        std::chrono::microseconds startOffset;
+        std::chrono::microseconds duration;
+    };
+
+    explicit StartupGraph(const std::string& name);
+
+    /**
+     * @brief Adds a step to the graph
+     * @param name Unique name of the step
+     * @param dependencies Names of the steps which must have finished before this step starts.
+     * They may be added after this step.
+     * @param step The work to be done
+     */
+    void addStep(const std::string& name,
+                 const std::vector<std::string>& dependencies,
+                 std::function<void()> step);
+
+    /**
+     * @brief Runs all steps and returns when they have finished.
+     *
+     * The calling thread takes part in running the steps, hence a maxParallelism
+     * of 1 runs all steps sequentially on the calling thread in a valid order.
+     * If a step throws, no further steps are started and the exception of the
+     * first failed step is rethrown once the steps still running have finished.
+     *
+     * @param maxParallelism Maximum number of steps running at the same time
+     * @throw std::invalid_argument if a dependency is unknown or the dependencies are cyclic
+     */
+    void run(std::size_t maxParallelism);
+
+    /**
+     * @return the timings of the steps of the last run in order of completion
+     */
+    const std::vector<StepTiming>& getTimings() const;
+
+    /**
+     * @return the wall clock duration of the last run
+     */
+    std::chrono::microseconds getTotalDuration() const;
+
+    /**
+     * @return a human readable one line summary of the last run
+     */
+    std::string getTimingReport() const;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(StartupGraph);
+    ADD_LOGGER(StartupGraph)
+
+    struct Step {
+        std::string name;
+        std::vector<std::string> dependencies;
+        std::function<void()> work;
+    };
+
+    std::vector<std::vector<std::size_t>> resolveDependents() const;
+
+    const std::string _name;
+    std::vector<Step> _steps;
+    std::vector<StepTiming> _timings;
+    std::chrono::microseconds _totalDuration;
+};
+
+} // namespace joynr
+
+#endif // STARTUPGRAPH_H
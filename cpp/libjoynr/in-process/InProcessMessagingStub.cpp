@@ -22,6 +22,7 @@
 #include <utility>
 
 #include "InProcessMessagingSkeleton.h"
+#include "joynr/Metrics.h"
 
 namespace joynr
 {
@@ -35,6 +36,9 @@ void InProcessMessagingStub::transmit(
         std::shared_ptr<ImmutableMessage> message,
         const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure)
 {
+    static const std::shared_ptr<metrics::Histogram> sendLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("transport.inprocess.send.latencyUs");
+    metrics::ScopedLatencyRecorder sendLatencyRecorder(*sendLatencyHistogram);
     assert(_skeleton != nullptr);
     _skeleton->transmit(std::move(message), onFailure);
 }
@@ -32,6 +32,8 @@ class ISubscriptionManager;
 class PublicationManager;
 class IReplyCaller;
 class MessagingQos;
+class OneWayRequest;
+class Request;
 class RequestCaller;
 
 class IDispatcher
@@ -47,6 +49,18 @@ public:
     virtual void removeRequestCaller(const std::string& participantId) = 0;
     virtual void receive(std::shared_ptr<ImmutableMessage> message) = 0;
 
+    /*
+     * Hands a request for a provider registered in the same runtime to the dispatcher without
+     * serializing it. The reply is passed to the reply caller registered for the requestReplyId.
+     */
+    virtual void dispatchInProcessRequest(const std::string& senderParticipantId,
+                                          const std::string& receiverParticipantId,
+                                          const MessagingQos& qos,
+                                          Request&& request) = 0;
+    virtual void dispatchInProcessOneWayRequest(const std::string& receiverParticipantId,
+                                                const MessagingQos& qos,
+                                                OneWayRequest&& request) = 0;
+
     virtual void registerSubscriptionManager(
             std::shared_ptr<ISubscriptionManager> subscriptionManager) = 0;
     virtual void registerPublicationManager(
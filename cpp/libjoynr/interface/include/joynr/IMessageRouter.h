@@ -87,6 +87,12 @@ public:
             std::shared_ptr<const joynr::system::RoutingTypes::Address> address) = 0;
 
     virtual void setToKnown(const std::string& participantId) = 0;
+
+    /*
+     * Returns true if messages to the given participant are delivered to a provider living in
+     * the same runtime, i.e. requests may be handed to the dispatcher without serialization.
+     */
+    virtual bool canDispatchInProcess(const std::string& participantId) = 0;
 };
 
 } // namespace joynr
@@ -86,6 +86,22 @@ public:
                              std::shared_ptr<IReplyCaller> callback,
                              bool isLocalMessage) = 0;
 
+    /*
+     * Hands a request to the dispatcher without serializing it if the provider is registered
+     * in the same runtime. Returns false and leaves the request untouched otherwise; the caller
+     * is then expected to use sendRequest.
+     */
+    virtual bool sendInProcessRequest(const std::string& senderParticipantId,
+                                      const std::string& receiverParticipantId,
+                                      const MessagingQos& qos,
+                                      Request& request,
+                                      std::shared_ptr<IReplyCaller> callback) = 0;
+
+    virtual bool sendInProcessOneWayRequest(const std::string& senderParticipantId,
+                                            const std::string& receiverParticipantId,
+                                            const MessagingQos& qos,
+                                            OneWayRequest& request) = 0;
+
     /*
      * Prepares and sends a single message
      */
@@ -40,8 +40,31 @@ public:
     virtual bool isReponsibleFor(std::shared_ptr<const joynr::system::RoutingTypes::Address>) = 0;
     virtual bool isAvailable() = 0;
 
+    /**
+     * @brief Transports which are able to pause single destinations, e.g. because of
+     * backpressure of a slow consumer, override this method. By default the availability of the
+     * whole transport applies to all destinations.
+     * @return true if messages can be sent to the given destination
+     */
+    virtual bool isAvailableFor(
+            std::shared_ptr<const joynr::system::RoutingTypes::Address> /*destAddress*/)
+    {
+        return isAvailable();
+    }
+
     virtual void setAvailabilityChangedCallback(
             std::function<void(bool)> availabilityChangedCallback) = 0;
+
+    /**
+     * @brief Transports which pause single destinations (see isAvailableFor) call this callback
+     * with the address of a destination which can be sent to again. By default the callback is
+     * never called.
+     */
+    virtual void setDestinationAvailableCallback(
+            std::function<void(std::shared_ptr<const joynr::system::RoutingTypes::Address>)>
+            /*destinationAvailableCallback*/)
+    {
+    }
 };
 } // namespace joynr
 
@@ -43,6 +43,13 @@ class JOYNR_EXPORT IUdsSender
 public:
     using SendFailed = std::function<void(const exceptions::JoynrRuntimeException&)>;
 
+    /**
+     * @brief Order in which queued messages are written to the socket. Messages of higher
+     * priority overtake queued messages of lower priority, messages of the same priority are
+     * sent in FIFO order.
+     */
+    enum class Priority : unsigned char { HIGH, NORMAL, LOW };
+
     /**
      * @brief Destructor
      */
@@ -51,8 +58,12 @@ public:
     /**
      * @brief Send a message asynchronously via UNIX domain sockets
      * @param message Message to be sent
+     * @param onFailure Called if the message could not be sent
+     * @param priority Priority of the message in the sending queue
      */
-    virtual void send(const smrf::ByteArrayView& message, const SendFailed& onFailure) = 0;
+    virtual void send(const smrf::ByteArrayView& message,
+                      const SendFailed& onFailure,
+                      Priority priority) = 0;
 };
 
 } // namespace joynr
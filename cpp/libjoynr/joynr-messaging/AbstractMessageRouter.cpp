@@ -36,13 +36,17 @@
 #include "joynr/ImmutableMessage.h"
 #include "joynr/InProcessMessagingAddress.h"
 #include "joynr/Message.h"
+#include "joynr/MessageTracer.h"
 #include "joynr/MessageQueue.h"
 #include "joynr/MessagingQos.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastReceiverDirectory.h"
+#include "joynr/PoolAllocator.h"
 #include "joynr/Reply.h"
 #include "joynr/Request.h"
 #include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/TimePoint.h"
+#include "joynr/TrackingInfo.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/serializer/Serializer.h"
@@ -88,8 +92,22 @@ AbstractMessageRouter::AbstractMessageRouter(
           _maxAclRetryIntervalMs(
                   60 * 60 *
                   1000), // Max retry value is empirical and should practically fit many use-case
-          _messageCleaningCycleCounter(0)
-{
+          _messageCleaningCycleCounter(0),
+          _routedMessagesCounter(
+                  metrics::MetricsRegistry::instance().getCounter("router.routedMessages")),
+          _routeLatencyHistogram(
+                  metrics::MetricsRegistry::instance().getHistogram("router.route.latencyUs")),
+          _inProcessDirectDispatch(messagingSettings.getInProcessDirectDispatch())
+{
+    if (_messageQueue) {
+        _messageQueue->setQueueLengthGauge(
+                metrics::MetricsRegistry::instance().getGauge("router.messageQueue.length"));
+    }
+    if (_transportNotAvailableQueue) {
+        _transportNotAvailableQueue->setQueueLengthGauge(
+                metrics::MetricsRegistry::instance().getGauge(
+                        "router.transportNotAvailableQueue.length"));
+    }
 }
 
 AbstractMessageRouter::~AbstractMessageRouter()
@@ -214,7 +232,7 @@ void AbstractMessageRouter::checkExpiryDate(const ImmutableMessage& message)
         const std::string errorMessage =
                 fmt::format("Received expired message (now={}). Dropping the message {}",
                             now.toMilliseconds(),
-                            message.getTrackingInfo());
+                            TrackingInfo(message));
         JOYNR_LOG_WARN(logger(), errorMessage);
         throw exceptions::JoynrMessageNotSentException(errorMessage);
     }
@@ -224,7 +242,10 @@ void AbstractMessageRouter::route(std::shared_ptr<ImmutableMessage> message, std
 {
     assert(_messagingStubFactory);
     assert(message);
+    JOYNR_TRACE_MESSAGE(ROUTER_ENTRY, message->getId());
+    metrics::ScopedLatencyRecorder routeLatencyRecorder(*_routeLatencyHistogram);
     _numberOfRoutedMessages++;
+    _routedMessagesCounter->increment();
     checkExpiryDate(*message);
     routeInternal(std::move(message), tryCount);
 }
@@ -365,13 +386,13 @@ void AbstractMessageRouter::scheduleMessage(
     for (const auto& transportStatus : _transportStatuses) {
         if (transportStatus->isReponsibleFor(destAddress)) {
             std::deque<std::shared_ptr<ImmutableMessage>> droppedMessagesToBeReplied;
-            if (!transportStatus->isAvailable()) {
+            if (!transportStatus->isAvailableFor(destAddress)) {
                 // We need to lock the mutex to ensure that the queue isn't processed right now.
                 std::lock_guard<std::mutex> lock(_transportAvailabilityMutex);
-                if (!transportStatus->isAvailable()) {
+                if (!transportStatus->isAvailableFor(destAddress)) {
                     JOYNR_LOG_TRACE(logger(),
                                     "Transport not available. Message queued: {}",
-                                    message->getTrackingInfo());
+                                    TrackingInfo(*message));
 
                     droppedMessagesToBeReplied = _transportNotAvailableQueue->queueMessage(
                             transportStatus, std::move(message));
@@ -391,12 +412,14 @@ void AbstractMessageRouter::scheduleMessage(
 
     auto stub = _messagingStubFactory->create(destAddress);
     if (stub) {
-        _messageScheduler->schedule(std::make_shared<MessageRunnable>(std::move(message),
-                                                                      std::move(stub),
-                                                                      std::move(destAddress),
-                                                                      shared_from_this(),
-                                                                      tryCount),
-                                    delay);
+        JOYNR_TRACE_MESSAGE(SCHEDULED, message->getId());
+        _messageScheduler->schedule(
+                util::makePooledShared<MessageRunnable>(std::move(message),
+                                                        std::move(stub),
+                                                        std::move(destAddress),
+                                                        shared_from_this(),
+                                                        tryCount),
+                delay);
     } else {
         if (message->getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
             // do not queue a multicast message since it would get stored under
@@ -406,7 +429,7 @@ void AbstractMessageRouter::scheduleMessage(
                             "Multicast message {} could not be sent to recipient, {}. Stub "
                             "creation failed. => Discarding "
                             "message.",
-                            message->getTrackingInfo(),
+                            TrackingInfo(*message),
                             destAddress->toString());
             removeUnreachableMulticastReceivers(
                     message->getRecipient(), destAddress, message->getSender());
@@ -415,7 +438,7 @@ void AbstractMessageRouter::scheduleMessage(
                             "Publication message {} could not be sent to recipient, {}. Stub "
                             "creation failed. => Discarding "
                             "message & attempting to stop publication.",
-                            message->getTrackingInfo(),
+                            TrackingInfo(*message),
                             destAddress->toString());
             stopSubscription(message);
         } else {
@@ -423,7 +446,7 @@ void AbstractMessageRouter::scheduleMessage(
                            "Message {} could not be sent to recipient, {}. Stub "
                            "creation failed. => Queueing "
                            "message.",
-                           message->getTrackingInfo(),
+                           TrackingInfo(*message),
                            destAddress->toString());
             ReadLocker lock(_messageQueueRetryLock);
 
@@ -458,6 +481,38 @@ void AbstractMessageRouter::activateRoutingTableCleanerTimer()
             });
 }
 
+class AbstractMessageRouter::RescheduleQueuedMessagesRunnable : public Runnable
+{
+public:
+    RescheduleQueuedMessagesRunnable(
+            std::weak_ptr<AbstractMessageRouter> messageRouter,
+            std::shared_ptr<ITransportStatus> transportStatus,
+            std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress)
+            : Runnable(),
+              _messageRouter(std::move(messageRouter)),
+              _transportStatus(std::move(transportStatus)),
+              _destAddress(std::move(destAddress))
+    {
+    }
+
+    void shutdown() override
+    {
+    }
+
+    void run() override
+    {
+        if (auto messageRouter = _messageRouter.lock()) {
+            messageRouter->rescheduleQueuedMessagesForTransport(_transportStatus, _destAddress);
+        }
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(RescheduleQueuedMessagesRunnable);
+    std::weak_ptr<AbstractMessageRouter> _messageRouter;
+    std::shared_ptr<ITransportStatus> _transportStatus;
+    std::shared_ptr<const joynr::system::RoutingTypes::Address> _destAddress;
+};
+
 void AbstractMessageRouter::registerTransportStatusCallbacks()
 {
     for (auto& transportStatus : _transportStatuses) {
@@ -468,29 +523,68 @@ void AbstractMessageRouter::registerTransportStatusCallbacks()
                     if (auto thisSharedPtr = thisWeakPtr.lock()) {
                         if (isAvailable) {
                             if (auto transportStatusSharedPtr = transportStatusWeakPtr.lock()) {
-                                thisSharedPtr->rescheduleQueuedMessagesForTransport(
-                                        transportStatusSharedPtr);
+                                thisSharedPtr->_messageScheduler->execute(
+                                        std::make_shared<RescheduleQueuedMessagesRunnable>(
+                                                thisWeakPtr, transportStatusSharedPtr, nullptr));
                             }
                         }
                     }
                 });
+        transportStatus->setDestinationAvailableCallback(
+                [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+                 transportStatusWeakPtr = joynr::util::as_weak_ptr(transportStatus)](
+                        std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress) {
+                    if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                        if (auto transportStatusSharedPtr = transportStatusWeakPtr.lock()) {
+                            thisSharedPtr->_messageScheduler->execute(
+                                    std::make_shared<RescheduleQueuedMessagesRunnable>(
+                                            thisWeakPtr,
+                                            transportStatusSharedPtr,
+                                            std::move(destAddress)));
+                        }
+                    }
+                });
     }
 }
 
 void AbstractMessageRouter::rescheduleQueuedMessagesForTransport(
-        std::shared_ptr<ITransportStatus> transportStatus)
+        std::shared_ptr<ITransportStatus> transportStatus,
+        std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress)
 {
     // We need to lock the mutex to prevent other threads from adding new content for the queue
-    // while we process it.
-    std::lock_guard<std::mutex> lock(_transportAvailabilityMutex);
-    while (auto nextImmutableMessage =
-                   _transportNotAvailableQueue->getNextMessageFor(transportStatus)) {
+    // while we take it. The messages are routed after releasing the lock, since messages for
+    // destinations which are still not available (e.g. a paused UDS client) are queued again.
+    std::vector<std::shared_ptr<ImmutableMessage>> queuedMessages;
+    {
+        ReadLocker messageQueueRetryReadLock(_messageQueueRetryLock);
+        std::lock_guard<std::mutex> lock(_transportAvailabilityMutex);
+        std::vector<std::shared_ptr<ImmutableMessage>> messagesForOtherDestinations;
+        while (auto nextImmutableMessage =
+                       _transportNotAvailableQueue->getNextMessageFor(transportStatus)) {
+            if (destAddress) {
+                const AddressUnorderedSet addresses =
+                        getDestinationAddresses(*nextImmutableMessage, messageQueueRetryReadLock);
+                if (addresses.find(destAddress) == addresses.cend()) {
+                    messagesForOtherDestinations.push_back(std::move(nextImmutableMessage));
+                    continue;
+                }
+            }
+            queuedMessages.push_back(std::move(nextImmutableMessage));
+        }
+        // Messages for other destinations, e.g. UDS clients which are still paused, are put back
+        // in their original order without being routed. The queue held them before, hence none
+        // of them is dropped.
+        for (auto& message : messagesForOtherDestinations) {
+            _transportNotAvailableQueue->queueMessage(transportStatus, std::move(message));
+        }
+    }
+    for (const auto& nextImmutableMessage : queuedMessages) {
         try {
             route(nextImmutableMessage);
         } catch (const exceptions::JoynrRuntimeException& e) {
             JOYNR_LOG_DEBUG(logger(),
                             "could not route queued message {} due to '{}'",
-                            nextImmutableMessage->getTrackingInfo(),
+                            TrackingInfo(*nextImmutableMessage),
                             e.getMessage());
         }
     }
@@ -543,7 +637,7 @@ void AbstractMessageRouter::queueMessage(std::shared_ptr<ImmutableMessage> messa
 {
     assert(messageQueueRetryReadLock.owns_lock());
     std::ignore = messageQueueRetryReadLock;
-    JOYNR_LOG_TRACE(logger(), "message queued: {}", message->getTrackingInfo());
+    JOYNR_LOG_TRACE(logger(), "message queued: {}", TrackingInfo(*message));
     std::string recipient = message->getRecipient();
     auto droppedMessagesToBeReplied =
             _messageQueue->queueMessage(std::move(recipient), std::move(message));
@@ -664,6 +758,17 @@ void AbstractMessageRouter::stopSubscription(std::shared_ptr<ImmutableMessage> m
     std::ignore = message;
 }
 
+bool AbstractMessageRouter::canDispatchInProcess(const std::string& participantId)
+{
+    if (!_inProcessDirectDispatch || _isShuttingDown) {
+        return false;
+    }
+    const boost::optional<routingtable::RoutingEntry> routingEntry =
+            getRoutingEntry(participantId);
+    return routingEntry && dynamic_cast<const InProcessMessagingAddress*>(
+                                   routingEntry->address.get()) != nullptr;
+}
+
 boost::optional<routingtable::RoutingEntry> AbstractMessageRouter::getRoutingEntry(
         const std::string& participantId)
 {
@@ -712,7 +817,7 @@ void MessageRunnable::run()
                     JOYNR_LOG_TRACE(logger(),
                                     "Rescheduling message after error: message {}, new delay {}ms, "
                                     "reason: {}",
-                                    message->getTrackingInfo(),
+                                    TrackingInfo(*message),
                                     delay.count(),
                                     e.getMessage());
                     messageRouterSharedPtr->scheduleMessage(
@@ -721,12 +826,12 @@ void MessageRunnable::run()
                     JOYNR_LOG_ERROR(logger(),
                                     "Message {} could not be sent! reason: messageRouter "
                                     "not available",
-                                    message->getTrackingInfo());
+                                    TrackingInfo(*message));
                 }
             } catch (const std::bad_cast&) {
                 JOYNR_LOG_ERROR(logger(),
                                 "Message {} could not be sent! reason: {}",
-                                message->getTrackingInfo(),
+                                TrackingInfo(*message),
                                 e.getMessage());
             }
         };
@@ -736,18 +841,19 @@ void MessageRunnable::run()
             JOYNR_LOG_ERROR(logger(),
                             "Message {} could not be sent! reason: messageRouter "
                             "not available",
-                            _message->getTrackingInfo());
+                            TrackingInfo(*_message));
             return;
         }
 
         if (messageRouterSharedPtr->canMessageBeTransmitted(_message)) {
+            JOYNR_TRACE_MESSAGE(TRANSPORT_SEND, _message->getId());
             _messagingStub->transmit(_message, onFailure);
         } else {
             messageRouterSharedPtr->sendMessage(_message, _destAddress, _tryCount);
         }
 
     } else {
-        JOYNR_LOG_ERROR(logger(), "Message {} expired: dropping!", _message->getTrackingInfo());
+        JOYNR_LOG_ERROR(logger(), "Message {} expired: dropping!", TrackingInfo(*_message));
     }
 }
 
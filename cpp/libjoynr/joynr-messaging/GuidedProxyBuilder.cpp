@@ -23,6 +23,7 @@ namespace joynr
 
 GuidedProxyBuilder::GuidedProxyBuilder(
         std::weak_ptr<JoynrRuntimeImpl> runtime,
+        boost::asio::io_service& ioService,
         ProxyFactory& proxyFactory,
         std::weak_ptr<joynr::system::IDiscoveryAsync> discoveryProxy,
         const std::string& domain,
@@ -31,6 +32,7 @@ GuidedProxyBuilder::GuidedProxyBuilder(
         MessagingSettings& messagingSettings,
         std::string interfaceName)
         : _runtime(std::move(runtime)),
+          _ioService(ioService),
           _proxyFactory(proxyFactory),
           _discoveryProxy(discoveryProxy),
           _dispatcherAddress(dispatcherAddress),
@@ -162,7 +164,8 @@ std::shared_ptr<joynr::Future<joynr::DiscoveryResult>> GuidedProxyBuilder::disco
     };
 
     // Create arbitrator
-    _arbitrator = ArbitratorFactory::createArbitrator(_domain,
+    _arbitrator = ArbitratorFactory::createArbitrator(_ioService,
+                                                      _domain,
                                                       _interfaceName,
                                                       joynr::types::Version(),
                                                       _discoveryProxy,
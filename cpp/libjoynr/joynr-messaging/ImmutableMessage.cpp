@@ -26,6 +26,7 @@
 #include "boost/algorithm/string.hpp"
 
 #include "joynr/Message.h"
+#include "joynr/TrackingInfo.h"
 
 namespace joynr
 {
@@ -263,14 +264,7 @@ void ImmutableMessage::setAccessControlChecked()
 
 std::string ImmutableMessage::getTrackingInfo() const
 {
-    auto requestReplyId = getOptionalHeaderByKey(Message::CUSTOM_HEADER_PREFIX() +
-                                                 Message::CUSTOM_HEADER_REQUEST_REPLY_ID());
-    std::string trackingInfo = "messageId: " + getId() + ", type: " + getType() +
-                               ", sender: " + getSender() + ", recipient: " + getRecipient() +
-                               (requestReplyId ? ", requestReplyId: " + *requestReplyId : "") +
-                               ", expiryDate: " + std::to_string(getExpiryDate().toMilliseconds()) +
-                               ", size: " + std::to_string(getMessageSize());
-    return trackingInfo;
+    return fmt::format("{}", TrackingInfo(*this));
 }
 
 } // namespace joynr
@@ -18,8 +18,10 @@
  */
 #include "joynr/LibJoynrMessageRouter.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
+#include <iterator>
 #include <limits>
 
 #include <boost/asio/io_service.hpp>
@@ -33,6 +35,7 @@
 #include "joynr/RoutingTable.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
+#include "joynr/exceptions/MethodInvocationException.h"
 #include "joynr/system/RoutingProxy.h"
 #include "joynr/system/RoutingTypes/Address.h"
 #include "joynr/system/RoutingTypes/MqttAddress.h"
@@ -72,10 +75,17 @@ LibJoynrMessageRouter::LibJoynrMessageRouter(
           _parentAddress(nullptr),
           _incomingAddress(incomingAddress),
           _runningParentResolves(),
+          _pendingParentResolves(),
+          _parentResolveRequestsInFlight(0),
           _parentResolveMutex(),
+          _pendingParentAdds(),
+          _parentAddRequestsInFlight(0),
+          _parentAddMutex(),
+          _parentSupportsBatchRequests(true),
           _parentClusterControllerReplyToAddressMutex(),
           _parentClusterControllerReplyToAddress(),
-          _DEFAULT_IS_GLOBALLY_VISIBLE(false)
+          _DEFAULT_IS_GLOBALLY_VISIBLE(false),
+          _MAX_PARENT_REQUESTS_IN_FLIGHT(4)
 {
     _printRoutedMessages = false;
 }
@@ -83,6 +93,14 @@ LibJoynrMessageRouter::LibJoynrMessageRouter(
 void LibJoynrMessageRouter::shutdown()
 {
     AbstractMessageRouter::shutdown();
+    {
+        std::lock_guard<std::mutex> lock(_parentAddMutex);
+        _pendingParentAdds.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(_parentResolveMutex);
+        _pendingParentResolves.clear();
+    }
     _parentRouter.reset();
     _parentAddress.reset();
 }
@@ -102,6 +120,7 @@ void LibJoynrMessageRouter::setParentRouter(
 {
     assert(_parentAddress);
     this->_parentRouter = std::move(parentRouter);
+    _parentSupportsBatchRequests = true;
 
     // add the next hop to parent router
     // this is necessary because during normal registration, the parent proxy is not yet set
@@ -161,73 +180,16 @@ void LibJoynrMessageRouter::routeInternal(std::shared_ptr<ImmutableMessage> mess
                 }
 
                 _runningParentResolves.insert(destinationPartId);
+                if (_parentResolveRequestsInFlight >= _MAX_PARENT_REQUESTS_IN_FLIGHT) {
+                    // resolved together with all other pending participants
+                    // as soon as one of the running requests has finished
+                    _pendingParentResolves.push_back(destinationPartId);
+                    return;
+                }
+                ++_parentResolveRequestsInFlight;
                 parentResolveLock.unlock();
 
-                std::function<void(const bool&)> onSuccess =
-                        [destinationPartId,
-                         thisWeakPtr = joynr::util::as_weak_ptr(
-                                 std::dynamic_pointer_cast<LibJoynrMessageRouter>(
-                                         shared_from_this()))](const bool& resolved) {
-                            if (auto thisSharedPtr = thisWeakPtr.lock()) {
-                                if (resolved) {
-                                    JOYNR_LOG_INFO(logger(),
-                                                   "Got destination address for participant {}",
-                                                   destinationPartId);
-                                    WriteLocker lock1(thisSharedPtr->_messageQueueRetryLock);
-                                    // save next hop in the routing table
-                                    constexpr std::int64_t expiryDateMs =
-                                            std::numeric_limits<std::int64_t>::max();
-                                    const bool isSticky = false;
-                                    bool addToRoutingTableSuccessful =
-                                            thisSharedPtr->addToRoutingTable(
-                                                    destinationPartId,
-                                                    thisSharedPtr->_DEFAULT_IS_GLOBALLY_VISIBLE,
-                                                    thisSharedPtr->_parentAddress,
-                                                    expiryDateMs,
-                                                    isSticky);
-                                    if (addToRoutingTableSuccessful) {
-                                        thisSharedPtr->sendQueuedMessages(
-                                                destinationPartId,
-                                                thisSharedPtr->_parentAddress,
-                                                std::move(lock1));
-                                    } else {
-                                        JOYNR_LOG_ERROR(
-                                                logger(),
-                                                "Failed to add participant {} to routing table",
-                                                destinationPartId);
-                                    }
-                                } else {
-                                    JOYNR_LOG_ERROR(logger(),
-                                                    "Failed to resolve next hop for participant {}",
-                                                    destinationPartId);
-                                }
-                                thisSharedPtr->removeRunningParentResolvers(destinationPartId);
-                            } else {
-                                JOYNR_LOG_ERROR(
-                                        logger(),
-                                        "Failed to resolve next hop for participant {} because "
-                                        "LibJoynrMessageRouter is no longer available",
-                                        destinationPartId);
-                            }
-                        };
-
-                std::function<void(const joynr::exceptions::JoynrRuntimeException& error)> onError =
-                        [destinationPartId,
-                         thisWeakPtr = joynr::util::as_weak_ptr(
-                                 std::dynamic_pointer_cast<LibJoynrMessageRouter>(
-                                         shared_from_this()))](
-                                const joynr::exceptions::JoynrRuntimeException& error) {
-                            if (auto thisSharedPtr = thisWeakPtr.lock()) {
-                                JOYNR_LOG_ERROR(logger(),
-                                                "Failed to resolve next hop for participant {}: {}",
-                                                destinationPartId,
-                                                error.getMessage());
-                                thisSharedPtr->removeRunningParentResolvers(destinationPartId);
-                            }
-                        };
-
-                _parentRouter->resolveNextHopAsync(
-                        destinationPartId, std::move(onSuccess), std::move(onError));
+                resolveNextHopsAtParent({destinationPartId});
             }
             return;
         }
@@ -283,6 +245,39 @@ void LibJoynrMessageRouter::addNextHopToParent(
         return;
     }
 
+    if (!canBatchNextHopsAtParent()) {
+        sendNextHopToParent(
+                participantId, isGloballyVisible, std::move(onSuccess), std::move(onError));
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_parentAddMutex);
+        if (_parentAddRequestsInFlight >= _MAX_PARENT_REQUESTS_IN_FLIGHT) {
+            // sent together with all other pending entries
+            // as soon as one of the running requests has finished
+            _pendingParentAdds.push_back(PendingParentAdd{std::move(participantId),
+                                                          isGloballyVisible,
+                                                          std::move(onSuccess),
+                                                          std::move(onError)});
+            return;
+        }
+        ++_parentAddRequestsInFlight;
+    }
+    std::vector<PendingParentAdd> pendingAdds;
+    pendingAdds.push_back(PendingParentAdd{std::move(participantId),
+                                           isGloballyVisible,
+                                           std::move(onSuccess),
+                                           std::move(onError)});
+    sendNextHopsToParent(std::move(pendingAdds));
+}
+
+void LibJoynrMessageRouter::sendNextHopToParent(
+        const std::string& participantId,
+        bool isGloballyVisible,
+        std::function<void(void)> onSuccess,
+        std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
+{
     std::function<void(const exceptions::JoynrException&)> onErrorWrapper =
             [onError](const exceptions::JoynrException& error) {
                 if (onError) {
@@ -343,6 +338,383 @@ void LibJoynrMessageRouter::addNextHopToParent(
     }
 }
 
+bool LibJoynrMessageRouter::canBatchNextHopsAtParent() const
+{
+    if (!_parentSupportsBatchRequests) {
+        return false;
+    }
+    // addNextHops is only offered for the client addresses of the parent's
+    // WebSocket and UDS servers
+    return dynamic_cast<const joynr::system::RoutingTypes::WebSocketClientAddress*>(
+                   _incomingAddress.get()) != nullptr ||
+           dynamic_cast<const joynr::system::RoutingTypes::UdsClientAddress*>(
+                   _incomingAddress.get()) != nullptr;
+}
+
+void LibJoynrMessageRouter::sendNextHopsToParent(std::vector<PendingParentAdd> pendingAdds)
+{
+    assert(!pendingAdds.empty());
+    if (pendingAdds.size() == 1) {
+        PendingParentAdd& pendingAdd = pendingAdds.front();
+        std::function<void()> onSuccess =
+                [thisWeakPtr = joynr::util::as_weak_ptr(
+                         std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this())),
+                 onAddSuccess = std::move(pendingAdd.onSuccess)]() {
+                    if (onAddSuccess) {
+                        onAddSuccess();
+                    }
+                    if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                        thisSharedPtr->onParentAddRequestFinished();
+                    }
+                };
+        std::function<void(const exceptions::ProviderRuntimeException&)> onError =
+                [thisWeakPtr = joynr::util::as_weak_ptr(
+                         std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this())),
+                 onAddError = std::move(pendingAdd.onError)](
+                        const exceptions::ProviderRuntimeException& error) {
+                    if (onAddError) {
+                        onAddError(error);
+                    }
+                    if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                        thisSharedPtr->onParentAddRequestFinished();
+                    }
+                };
+        sendNextHopToParent(pendingAdd.participantId,
+                            pendingAdd.isGloballyVisible,
+                            std::move(onSuccess),
+                            std::move(onError));
+        return;
+    }
+    if (!_parentSupportsBatchRequests) {
+        sendNextHopsToParentOneByOne(std::move(pendingAdds));
+        return;
+    }
+
+    std::vector<std::string> participantIds;
+    participantIds.reserve(pendingAdds.size());
+    for (const PendingParentAdd& pendingAdd : pendingAdds) {
+        participantIds.push_back(pendingAdd.participantId);
+    }
+    const bool isGloballyVisible = pendingAdds.front().isGloballyVisible;
+    auto sharedPendingAdds =
+            std::make_shared<const std::vector<PendingParentAdd>>(std::move(pendingAdds));
+
+    std::function<void()> onSuccess =
+            [thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this())),
+             sharedPendingAdds]() {
+                for (const PendingParentAdd& pendingAdd : *sharedPendingAdds) {
+                    if (pendingAdd.onSuccess) {
+                        pendingAdd.onSuccess();
+                    }
+                }
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->onParentAddRequestFinished();
+                }
+            };
+    std::function<void(const exceptions::JoynrRuntimeException&)> onError =
+            [thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this())),
+             sharedPendingAdds](const exceptions::JoynrRuntimeException& error) {
+                auto thisSharedPtr = thisWeakPtr.lock();
+                if (thisSharedPtr && thisSharedPtr->onParentBatchRequestFailed(error)) {
+                    // the slot of this request is released once all single requests finished
+                    thisSharedPtr->sendNextHopsToParentOneByOne(*sharedPendingAdds);
+                    return;
+                }
+                JOYNR_LOG_TRACE(logger(),
+                                "parentRouter->addNextHopsAsync failed for {} participants: {}",
+                                sharedPendingAdds->size(),
+                                error.getMessage());
+                for (const PendingParentAdd& pendingAdd : *sharedPendingAdds) {
+                    if (pendingAdd.onError) {
+                        pendingAdd.onError(
+                                joynr::exceptions::ProviderRuntimeException(error.getMessage()));
+                    }
+                }
+                if (thisSharedPtr) {
+                    thisSharedPtr->onParentAddRequestFinished();
+                }
+            };
+
+    JOYNR_LOG_DEBUG(logger(),
+                    "Adding {} next hops to parent router in a single request",
+                    participantIds.size());
+    if (auto webSocketClientAddress = std::dynamic_pointer_cast<
+                const joynr::system::RoutingTypes::WebSocketClientAddress>(_incomingAddress)) {
+        _parentRouter->addNextHopsAsync(participantIds,
+                                        *webSocketClientAddress,
+                                        isGloballyVisible,
+                                        std::move(onSuccess),
+                                        std::move(onError));
+    } else if (auto udsClientAddress = std::dynamic_pointer_cast<
+                       const joynr::system::RoutingTypes::UdsClientAddress>(_incomingAddress)) {
+        _parentRouter->addNextHopsAsync(participantIds,
+                                        *udsClientAddress,
+                                        isGloballyVisible,
+                                        std::move(onSuccess),
+                                        std::move(onError));
+    } else {
+        assert(false && "addNextHops must only be used for batchable incoming addresses");
+    }
+}
+
+void LibJoynrMessageRouter::sendNextHopsToParentOneByOne(std::vector<PendingParentAdd> pendingAdds)
+{
+    // all single requests together use the request slot of the batch
+    auto remainingRequests = std::make_shared<std::atomic<std::size_t>>(pendingAdds.size());
+    auto onRequestFinished = [thisWeakPtr = joynr::util::as_weak_ptr(
+                                      std::dynamic_pointer_cast<LibJoynrMessageRouter>(
+                                              shared_from_this())),
+                              remainingRequests]() {
+        if (--(*remainingRequests) > 0) {
+            return;
+        }
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            thisSharedPtr->onParentAddRequestFinished();
+        }
+    };
+    for (PendingParentAdd& pendingAdd : pendingAdds) {
+        std::function<void()> onSuccess = [onAddSuccess = std::move(pendingAdd.onSuccess),
+                                           onRequestFinished]() {
+            if (onAddSuccess) {
+                onAddSuccess();
+            }
+            onRequestFinished();
+        };
+        std::function<void(const exceptions::ProviderRuntimeException&)> onError =
+                [onAddError = std::move(pendingAdd.onError),
+                 onRequestFinished](const exceptions::ProviderRuntimeException& error) {
+                    if (onAddError) {
+                        onAddError(error);
+                    }
+                    onRequestFinished();
+                };
+        sendNextHopToParent(pendingAdd.participantId,
+                            pendingAdd.isGloballyVisible,
+                            std::move(onSuccess),
+                            std::move(onError));
+    }
+}
+
+bool LibJoynrMessageRouter::onParentBatchRequestFailed(
+        const exceptions::JoynrRuntimeException& error)
+{
+    // parents without addNextHops and resolveNextHops reply with a MethodInvocationException
+    if (error.getTypeName() != exceptions::MethodInvocationException::TYPE_NAME()) {
+        return false;
+    }
+    if (_parentSupportsBatchRequests.exchange(false)) {
+        JOYNR_LOG_INFO(logger(),
+                       "Parent router does not support batch requests, falling back to single "
+                       "addNextHop and resolveNextHop requests: {}",
+                       error.getMessage());
+    }
+    return true;
+}
+
+void LibJoynrMessageRouter::onParentAddRequestFinished()
+{
+    std::vector<PendingParentAdd> pendingAdds;
+    {
+        std::lock_guard<std::mutex> lock(_parentAddMutex);
+        if (_pendingParentAdds.empty() || !_parentRouter) {
+            --_parentAddRequestsInFlight;
+            return;
+        }
+        // reuse the slot of the finished request for all pending entries
+        // sharing the visibility of the oldest one
+        const bool isGloballyVisible = _pendingParentAdds.front().isGloballyVisible;
+        auto sameVisibilityEnd = std::stable_partition(
+                _pendingParentAdds.begin(),
+                _pendingParentAdds.end(),
+                [isGloballyVisible](const PendingParentAdd& pendingAdd) {
+                    return pendingAdd.isGloballyVisible == isGloballyVisible;
+                });
+        pendingAdds.assign(std::make_move_iterator(_pendingParentAdds.begin()),
+                           std::make_move_iterator(sameVisibilityEnd));
+        _pendingParentAdds.erase(_pendingParentAdds.begin(), sameVisibilityEnd);
+    }
+    sendNextHopsToParent(std::move(pendingAdds));
+}
+
+void LibJoynrMessageRouter::resolveNextHopsAtParent(std::vector<std::string> participantIds)
+{
+    assert(!participantIds.empty());
+    if (participantIds.size() == 1) {
+        resolveNextHopAtParent(
+                participantIds.front(),
+                [thisWeakPtr = joynr::util::as_weak_ptr(
+                         std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this()))]() {
+                    if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                        thisSharedPtr->onParentResolveRequestFinished();
+                    }
+                });
+        return;
+    }
+    if (!_parentSupportsBatchRequests) {
+        resolveNextHopsAtParentOneByOne(participantIds);
+        return;
+    }
+
+    auto sharedParticipantIds =
+            std::make_shared<const std::vector<std::string>>(std::move(participantIds));
+    std::function<void(const std::vector<bool>&)> onSuccess =
+            [sharedParticipantIds,
+             thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this()))](
+                    const std::vector<bool>& resolved) {
+                auto thisSharedPtr = thisWeakPtr.lock();
+                if (!thisSharedPtr) {
+                    JOYNR_LOG_ERROR(logger(),
+                                    "Failed to resolve next hops for {} participants because "
+                                    "LibJoynrMessageRouter is no longer available",
+                                    sharedParticipantIds->size());
+                    return;
+                }
+                if (resolved.size() != sharedParticipantIds->size()) {
+                    const std::string errorMessage =
+                            "unexpected number of results: " + std::to_string(resolved.size());
+                    for (const std::string& participantId : *sharedParticipantIds) {
+                        thisSharedPtr->onParentResolveFailed(participantId, errorMessage);
+                    }
+                } else {
+                    for (std::size_t i = 0; i < resolved.size(); ++i) {
+                        thisSharedPtr->onParentNextHopResolved(
+                                (*sharedParticipantIds)[i], resolved[i]);
+                    }
+                }
+                thisSharedPtr->onParentResolveRequestFinished();
+            };
+    std::function<void(const joynr::exceptions::JoynrRuntimeException&)> onError =
+            [sharedParticipantIds,
+             thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this()))](
+                    const joynr::exceptions::JoynrRuntimeException& error) {
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    if (thisSharedPtr->onParentBatchRequestFailed(error)) {
+                        thisSharedPtr->resolveNextHopsAtParentOneByOne(*sharedParticipantIds);
+                        return;
+                    }
+                    for (const std::string& participantId : *sharedParticipantIds) {
+                        thisSharedPtr->onParentResolveFailed(participantId, error.getMessage());
+                    }
+                    thisSharedPtr->onParentResolveRequestFinished();
+                }
+            };
+
+    JOYNR_LOG_DEBUG(logger(),
+                    "Resolving {} next hops at parent router in a single request",
+                    sharedParticipantIds->size());
+    _parentRouter->resolveNextHopsAsync(
+            *sharedParticipantIds, std::move(onSuccess), std::move(onError));
+}
+
+void LibJoynrMessageRouter::resolveNextHopAtParent(const std::string& participantId,
+                                                   std::function<void()> onRequestFinished)
+{
+    std::function<void(const bool&)> onSuccess =
+            [participantId,
+             onRequestFinished,
+             thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this()))](
+                    const bool& resolved) {
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->onParentNextHopResolved(participantId, resolved);
+                    onRequestFinished();
+                } else {
+                    JOYNR_LOG_ERROR(logger(),
+                                    "Failed to resolve next hop for participant {} because "
+                                    "LibJoynrMessageRouter is no longer available",
+                                    participantId);
+                }
+            };
+    std::function<void(const joynr::exceptions::JoynrRuntimeException&)> onError =
+            [participantId,
+             onRequestFinished,
+             thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<LibJoynrMessageRouter>(shared_from_this()))](
+                    const joynr::exceptions::JoynrRuntimeException& error) {
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->onParentResolveFailed(participantId, error.getMessage());
+                    onRequestFinished();
+                }
+            };
+    _parentRouter->resolveNextHopAsync(participantId, std::move(onSuccess), std::move(onError));
+}
+
+void LibJoynrMessageRouter::resolveNextHopsAtParentOneByOne(
+        const std::vector<std::string>& participantIds)
+{
+    // all single requests together use the request slot of the batch
+    auto remainingRequests = std::make_shared<std::atomic<std::size_t>>(participantIds.size());
+    auto onRequestFinished = [thisWeakPtr = joynr::util::as_weak_ptr(
+                                      std::dynamic_pointer_cast<LibJoynrMessageRouter>(
+                                              shared_from_this())),
+                              remainingRequests]() {
+        if (--(*remainingRequests) > 0) {
+            return;
+        }
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            thisSharedPtr->onParentResolveRequestFinished();
+        }
+    };
+    for (const std::string& participantId : participantIds) {
+        resolveNextHopAtParent(participantId, onRequestFinished);
+    }
+}
+
+void LibJoynrMessageRouter::onParentResolveRequestFinished()
+{
+    std::vector<std::string> participantIds;
+    {
+        std::lock_guard<std::mutex> lock(_parentResolveMutex);
+        if (_pendingParentResolves.empty() || !_parentRouter) {
+            --_parentResolveRequestsInFlight;
+            return;
+        }
+        // reuse the slot of the finished request for all pending participants
+        participantIds.swap(_pendingParentResolves);
+    }
+    resolveNextHopsAtParent(std::move(participantIds));
+}
+
+void LibJoynrMessageRouter::onParentNextHopResolved(const std::string& participantId,
+                                                    bool resolved)
+{
+    if (resolved) {
+        JOYNR_LOG_INFO(logger(), "Got destination address for participant {}", participantId);
+        WriteLocker lock(_messageQueueRetryLock);
+        // save next hop in the routing table
+        constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+        const bool isSticky = false;
+        bool addToRoutingTableSuccessful = addToRoutingTable(participantId,
+                                                            _DEFAULT_IS_GLOBALLY_VISIBLE,
+                                                            _parentAddress,
+                                                            expiryDateMs,
+                                                            isSticky);
+        if (addToRoutingTableSuccessful) {
+            sendQueuedMessages(participantId, _parentAddress, std::move(lock));
+        } else {
+            JOYNR_LOG_ERROR(
+                    logger(), "Failed to add participant {} to routing table", participantId);
+        }
+    } else {
+        JOYNR_LOG_ERROR(logger(), "Failed to resolve next hop for participant {}", participantId);
+    }
+    removeRunningParentResolvers(participantId);
+}
+
+void LibJoynrMessageRouter::onParentResolveFailed(const std::string& participantId,
+                                                  const std::string& errorMessage)
+{
+    JOYNR_LOG_ERROR(logger(),
+                    "Failed to resolve next hop for participant {}: {}",
+                    participantId,
+                    errorMessage);
+    removeRunningParentResolvers(participantId);
+}
+
 bool LibJoynrMessageRouter::isValidForRoutingTable(
         std::shared_ptr<const joynr::system::RoutingTypes::Address> address)
 {
@@ -462,6 +834,29 @@ void LibJoynrMessageRouter::removeNextHop(
         _routingTable.remove(participantId);
     }
 
+    // a registration still waiting to be sent must not reach the parent after the removal
+    std::vector<PendingParentAdd> supersededAdds;
+    {
+        std::lock_guard<std::mutex> lock(_parentAddMutex);
+        auto supersededBegin = std::stable_partition(
+                _pendingParentAdds.begin(),
+                _pendingParentAdds.end(),
+                [&participantId](const PendingParentAdd& pendingAdd) {
+                    return pendingAdd.participantId != participantId;
+                });
+        supersededAdds.assign(std::make_move_iterator(supersededBegin),
+                              std::make_move_iterator(_pendingParentAdds.end()));
+        _pendingParentAdds.erase(supersededBegin, _pendingParentAdds.end());
+    }
+    for (const PendingParentAdd& supersededAdd : supersededAdds) {
+        // the registration never reached the parent, hence it is reported as cancelled
+        if (supersededAdd.onError) {
+            supersededAdd.onError(exceptions::ProviderRuntimeException(
+                    "addNextHop for participant " + participantId +
+                    " cancelled by removeNextHop before it was sent to the parent router"));
+        }
+    }
+
     if (!isParentMessageRouterSet()) {
         if (onError) {
             onError(exceptions::ProviderRuntimeException(
@@ -0,0 +1,362 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/MessageQueueSpillFile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#include <smrf/ByteVector.h>
+
+#include "joynr/ImmutableMessage.h"
+#include "joynr/TrackingInfo.h"
+#include "joynr/exceptions/JoynrException.h"
+
+namespace joynr
+{
+
+namespace
+{
+
+// record layout: flags (1 byte), creator length (4 bytes), creator, serialized message
+constexpr std::uint8_t FLAG_RECEIVED_FROM_GLOBAL = 0x01;
+constexpr std::uint8_t FLAG_ACCESS_CONTROL_CHECKED = 0x02;
+constexpr std::size_t RECORD_HEADER_LENGTH = sizeof(std::uint8_t) + sizeof(std::uint32_t);
+// released space below this size is not worth a compaction unless the file has a size limit
+constexpr std::uint64_t COMPACTION_MIN_RELEASED_BYTES = 1024 * 1024;
+const std::ios::openmode FILE_MODE = std::ios::in | std::ios::out | std::ios::binary;
+
+} // namespace
+
+MessageQueueSpillFile::MessageQueueSpillFile(const std::string& fileName,
+                                             std::uint64_t limitBytes)
+        : _fileName(fileName),
+          _limitBytes(limitBytes),
+          _mutex(),
+          _file(),
+          _writeOffset(0),
+          _liveBytes(0),
+          _nextRecordId(0),
+          _records(),
+          _fileGeneration(0),
+          _isCompactionRequested(false),
+          _isShuttingDown(false),
+          _compactionRequested(),
+          _compactionThread()
+{
+    open(FILE_MODE | std::ios::trunc);
+    if (!_file.is_open()) {
+        throw exceptions::JoynrRuntimeException("Could not open message queue spill file " +
+                                                _fileName + ": " + std::strerror(errno));
+    }
+    _compactionThread = std::thread(&MessageQueueSpillFile::runCompactions, this);
+    JOYNR_LOG_INFO(logger(), "Spilling messages exceeding the queue limits to {}", _fileName);
+}
+
+MessageQueueSpillFile::~MessageQueueSpillFile()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isShuttingDown = true;
+    }
+    _compactionRequested.notify_one();
+    _compactionThread.join();
+    _file.close();
+    std::remove(_fileName.c_str());
+}
+
+bool MessageQueueSpillFile::append(const ImmutableMessage& message, Record& record)
+{
+    const smrf::ByteVector& serializedMessage = message.getSerializedMessage();
+    const std::string& creator = message.getCreator();
+    const std::uint64_t recordSize =
+            RECORD_HEADER_LENGTH + creator.size() + serializedMessage.size();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_limitBytes > 0 && _writeOffset + recordSize > _limitBytes) {
+        if (_liveBytes + recordSize <= _limitBytes) {
+            // fits once the released space has been reclaimed
+            requestCompaction();
+        }
+        JOYNR_LOG_WARN(logger(),
+                       "Cannot spill message {}: spill file {} reached its limit of {} bytes",
+                       TrackingInfo(message),
+                       _fileName,
+                       _limitBytes);
+        return false;
+    }
+
+    std::uint8_t flags = 0;
+    if (message.isReceivedFromGlobal()) {
+        flags |= FLAG_RECEIVED_FROM_GLOBAL;
+    }
+    if (message.isAccessControlChecked()) {
+        flags |= FLAG_ACCESS_CONTROL_CHECKED;
+    }
+    const auto creatorLength = static_cast<std::uint32_t>(creator.size());
+
+    _file.seekp(static_cast<std::streamoff>(_writeOffset));
+    _file.write(reinterpret_cast<const char*>(&flags), sizeof(flags));
+    _file.write(reinterpret_cast<const char*>(&creatorLength), sizeof(creatorLength));
+    _file.write(creator.data(), static_cast<std::streamsize>(creator.size()));
+    _file.write(reinterpret_cast<const char*>(serializedMessage.data()),
+                static_cast<std::streamsize>(serializedMessage.size()));
+    if (!_file) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Cannot spill message {}: writing to {} failed",
+                        TrackingInfo(message),
+                        _fileName);
+        _file.clear();
+        return false;
+    }
+
+    record.id = _nextRecordId++;
+    _records.emplace(record.id, Location{_writeOffset, recordSize});
+    _writeOffset += recordSize;
+    _liveBytes += recordSize;
+    return true;
+}
+
+std::shared_ptr<ImmutableMessage> MessageQueueSpillFile::take(const Record& record)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto found = _records.find(record.id);
+    if (found == _records.cend()) {
+        JOYNR_LOG_ERROR(logger(), "Spilled message {} not found in {}", record.id, _fileName);
+        return nullptr;
+    }
+    const Location location = found->second;
+    std::uint8_t flags = 0;
+    std::uint32_t creatorLength = 0;
+    _file.seekg(static_cast<std::streamoff>(location.offset));
+    _file.read(reinterpret_cast<char*>(&flags), sizeof(flags));
+    _file.read(reinterpret_cast<char*>(&creatorLength), sizeof(creatorLength));
+    std::shared_ptr<ImmutableMessage> message;
+    if (_file && RECORD_HEADER_LENGTH + creatorLength <= location.size) {
+        std::string creator(creatorLength, '\0');
+        _file.read(&creator[0], static_cast<std::streamsize>(creatorLength));
+        smrf::ByteVector serializedMessage(location.size - RECORD_HEADER_LENGTH - creatorLength);
+        _file.read(reinterpret_cast<char*>(serializedMessage.data()),
+                   static_cast<std::streamsize>(serializedMessage.size()));
+        if (_file) {
+            try {
+                message = std::make_shared<ImmutableMessage>(std::move(serializedMessage));
+                message->setCreator(std::move(creator));
+                message->setReceivedFromGlobal((flags & FLAG_RECEIVED_FROM_GLOBAL) != 0);
+                if ((flags & FLAG_ACCESS_CONTROL_CHECKED) != 0) {
+                    message->setAccessControlChecked();
+                }
+            } catch (const std::exception& e) {
+                JOYNR_LOG_ERROR(logger(),
+                                "Cannot restore spilled message at offset {}: {}",
+                                location.offset,
+                                e.what());
+                message.reset();
+            }
+        }
+    }
+    if (!_file) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Cannot read spilled message at offset {} from {}",
+                        location.offset,
+                        _fileName);
+        _file.clear();
+    }
+    release(record.id);
+    return message;
+}
+
+void MessageQueueSpillFile::discard(const Record& record)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    release(record.id);
+}
+
+std::uint64_t MessageQueueSpillFile::getSizeBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _writeOffset;
+}
+
+std::size_t MessageQueueSpillFile::getNumberOfRecords() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _records.size();
+}
+
+const std::string& MessageQueueSpillFile::getFileName() const
+{
+    return _fileName;
+}
+
+void MessageQueueSpillFile::open(std::ios::openmode mode)
+{
+    _file.open(_fileName, mode);
+}
+
+void MessageQueueSpillFile::release(std::uint64_t id)
+{
+    // _mutex must have been acquired earlier
+    const auto found = _records.find(id);
+    if (found == _records.end()) {
+        return;
+    }
+    _liveBytes -= found->second.size;
+    _records.erase(found);
+    if (_records.empty()) {
+        if (_writeOffset > 0) {
+            // all records have been consumed, start over with an empty file
+            _file.close();
+            open(FILE_MODE | std::ios::trunc);
+            _writeOffset = 0;
+            _fileGeneration++;
+        }
+        return;
+    }
+    if (isCompactionWanted()) {
+        requestCompaction();
+    }
+}
+
+bool MessageQueueSpillFile::isCompactionWanted() const
+{
+    // _mutex must have been acquired earlier
+    const std::uint64_t releasedBytes = _writeOffset - _liveBytes;
+    if (_limitBytes > 0 && releasedBytes > 0 && releasedBytes >= _limitBytes / 4) {
+        // keeps space for further appends, the copied bytes are at most three times
+        // the bytes released since the last compaction
+        return true;
+    }
+    // the copied live records are fewer bytes than the ones released since the
+    // last compaction, so the copying is amortized by the preceding releases
+    return releasedBytes >= COMPACTION_MIN_RELEASED_BYTES && releasedBytes > _liveBytes;
+}
+
+void MessageQueueSpillFile::requestCompaction()
+{
+    // _mutex must have been acquired earlier
+    if (!_isCompactionRequested) {
+        _isCompactionRequested = true;
+        _compactionRequested.notify_one();
+    }
+}
+
+void MessageQueueSpillFile::runCompactions()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _compactionRequested.wait(
+                lock, [this]() { return _isCompactionRequested || _isShuttingDown; });
+        if (_isShuttingDown) {
+            return;
+        }
+        _isCompactionRequested = false;
+        if (!_records.empty() && _writeOffset > _liveBytes) {
+            compact(lock);
+        }
+    }
+}
+
+bool MessageQueueSpillFile::compact(std::unique_lock<std::mutex>& lock)
+{
+    // lock must hold _mutex, it is released while the records are copied
+    std::vector<std::pair<std::uint64_t, Location>> snapshot(_records.cbegin(), _records.cend());
+    std::sort(snapshot.begin(), snapshot.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.offset < rhs.second.offset;
+    });
+    const std::uint64_t snapshotEnd = _writeOffset;
+    const std::uint64_t generation = _fileGeneration;
+    const std::uint64_t sizeBefore = _writeOffset;
+    _file.flush();
+    _file.clear();
+    lock.unlock();
+
+    // The bytes below snapshotEnd are not written again before the file is truncated or
+    // replaced, which increments _fileGeneration. Records released meanwhile are copied
+    // anyway and remain released space in the compacted file.
+    const std::string compactedFileName = _fileName + ".compacted";
+    std::ifstream source(_fileName, std::ios::in | std::ios::binary);
+    std::ofstream compactedFile(
+            compactedFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    std::unordered_map<std::uint64_t, std::uint64_t> compactedOffsets;
+    std::uint64_t compactedSize = 0;
+    std::vector<char> buffer;
+    for (const auto& record : snapshot) {
+        if (!source || !compactedFile) {
+            break;
+        }
+        buffer.resize(record.second.size);
+        source.seekg(static_cast<std::streamoff>(record.second.offset));
+        source.read(buffer.data(), static_cast<std::streamsize>(record.second.size));
+        compactedFile.write(buffer.data(), static_cast<std::streamsize>(record.second.size));
+        compactedOffsets.emplace(record.first, compactedSize);
+        compactedSize += record.second.size;
+    }
+    bool compacted = source && compactedFile;
+    source.close();
+
+    lock.lock();
+    compacted = compacted && generation == _fileGeneration && !_isShuttingDown;
+    if (compacted && _writeOffset > snapshotEnd) {
+        // records appended during the copy
+        buffer.resize(_writeOffset - snapshotEnd);
+        _file.seekg(static_cast<std::streamoff>(snapshotEnd));
+        _file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        compactedFile.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        compacted = _file && compactedFile;
+        _file.clear();
+    }
+    compactedFile.close();
+    if (compacted) {
+        _file.close();
+        compacted = std::rename(compactedFileName.c_str(), _fileName.c_str()) == 0;
+        // reopens the original file if the rename failed
+        open(FILE_MODE);
+    }
+    if (!compacted) {
+        if (generation == _fileGeneration && !_isShuttingDown) {
+            JOYNR_LOG_ERROR(logger(), "Cannot compact spill file {}", _fileName);
+        }
+        std::remove(compactedFileName.c_str());
+        return false;
+    }
+
+    for (auto& record : _records) {
+        Location& location = record.second;
+        if (location.offset >= snapshotEnd) {
+            location.offset = location.offset - snapshotEnd + compactedSize;
+        } else {
+            location.offset = compactedOffsets.at(record.first);
+        }
+    }
+    _writeOffset = _writeOffset - snapshotEnd + compactedSize;
+    _fileGeneration++;
+    JOYNR_LOG_DEBUG(logger(),
+                    "Compacted spill file {} from {} to {} bytes",
+                    _fileName,
+                    sizeBefore,
+                    _writeOffset);
+    return true;
+}
+
+} // namespace joynr
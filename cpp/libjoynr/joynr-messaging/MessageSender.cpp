@@ -96,6 +96,55 @@ void MessageSender::sendRequest(const std::string& senderParticipantId,
     _messageRouter->route(message.getImmutableMessage());
 }
 
+bool MessageSender::sendInProcessRequest(const std::string& senderParticipantId,
+                                         const std::string& receiverParticipantId,
+                                         const MessagingQos& qos,
+                                         Request& request,
+                                         std::shared_ptr<IReplyCaller> callback)
+{
+    auto dispatcherSharedPtr = _dispatcher.lock();
+    assert(_messageRouter);
+    if (dispatcherSharedPtr == nullptr ||
+        !_messageRouter->canDispatchInProcess(receiverParticipantId)) {
+        return false;
+    }
+
+    JOYNR_LOG_DEBUG(logger(),
+                    "Dispatch Request in-process: method: {}, requestReplyId: {}, "
+                    "proxy participantId: {}, provider participantId: {}",
+                    request.getMethodName(),
+                    request.getRequestReplyId(),
+                    senderParticipantId,
+                    receiverParticipantId);
+    dispatcherSharedPtr->addReplyCaller(request.getRequestReplyId(), std::move(callback), qos);
+    dispatcherSharedPtr->dispatchInProcessRequest(
+            senderParticipantId, receiverParticipantId, qos, std::move(request));
+    return true;
+}
+
+bool MessageSender::sendInProcessOneWayRequest(const std::string& senderParticipantId,
+                                               const std::string& receiverParticipantId,
+                                               const MessagingQos& qos,
+                                               OneWayRequest& request)
+{
+    auto dispatcherSharedPtr = _dispatcher.lock();
+    assert(_messageRouter);
+    if (dispatcherSharedPtr == nullptr ||
+        !_messageRouter->canDispatchInProcess(receiverParticipantId)) {
+        return false;
+    }
+
+    JOYNR_LOG_DEBUG(logger(),
+                    "Dispatch OneWayRequest in-process: method: {}, proxy participantId: {}, "
+                    "provider participantId: {}",
+                    request.getMethodName(),
+                    senderParticipantId,
+                    receiverParticipantId);
+    dispatcherSharedPtr->dispatchInProcessOneWayRequest(
+            receiverParticipantId, qos, std::move(request));
+    return true;
+}
+
 void MessageSender::sendOneWayRequest(const std::string& senderParticipantId,
                                       const std::string& receiverParticipantId,
                                       const MessagingQos& qos,
@@ -270,6 +270,79 @@ bool MessagingSettings::DEFAULT_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS()
     return value;
 }
 
+const std::string& MessagingSettings::SETTING_METRICS_DUMP_FILENAME()
+{
+    static const std::string value("messaging/metrics-dump-file");
+    return value;
+}
+
+const std::string& MessagingSettings::SETTING_METRICS_DUMP_INTERVAL_MS()
+{
+    static const std::string value("messaging/metrics-dump-interval-ms");
+    return value;
+}
+
+const std::string& MessagingSettings::SETTING_MESSAGE_TRACE_FILENAME()
+{
+    static const std::string value("messaging/message-trace-file");
+    return value;
+}
+
+const std::string& MessagingSettings::SETTING_MESSAGE_TRACE_FORMAT()
+{
+    static const std::string value("messaging/message-trace-format");
+    return value;
+}
+
+const std::string& MessagingSettings::SETTING_MESSAGE_TRACE_BUFFER_SIZE()
+{
+    static const std::string value("messaging/message-trace-buffer-size");
+    return value;
+}
+
+const std::string& MessagingSettings::SETTING_IN_PROCESS_DIRECT_DISPATCH()
+{
+    static const std::string value("messaging/in-process-direct-dispatch");
+    return value;
+}
+
+const std::string& MessagingSettings::DEFAULT_MESSAGE_TRACE_FILENAME()
+{
+    // empty file name disables message tracing
+    static const std::string value("");
+    return value;
+}
+
+const std::string& MessagingSettings::DEFAULT_MESSAGE_TRACE_FORMAT()
+{
+    static const std::string value("chrome");
+    return value;
+}
+
+std::uint64_t MessagingSettings::DEFAULT_MESSAGE_TRACE_BUFFER_SIZE()
+{
+    // number of trace records kept per thread
+    return 8192;
+}
+
+bool MessagingSettings::DEFAULT_IN_PROCESS_DIRECT_DISPATCH()
+{
+    return true;
+}
+
+const std::string& MessagingSettings::DEFAULT_METRICS_DUMP_FILENAME()
+{
+    // empty file name disables the metrics dump
+    static const std::string value("");
+    return value;
+}
+
+std::int64_t MessagingSettings::DEFAULT_METRICS_DUMP_INTERVAL_MS()
+{
+    // 10 seconds
+    return (10 * 1000);
+}
+
 const std::string& MessagingSettings::SETTING_TTL_UPLIFT_MS()
 {
     static const std::string value("messaging/ttl-uplift-ms");
@@ -507,6 +580,66 @@ void MessagingSettings::setDiscardUnroutableRepliesAndPublications(
                   discardUnRoutableRepliesAndPublications);
 }
 
+std::string MessagingSettings::getMetricsDumpFilename() const
+{
+    return _settings.get<std::string>(SETTING_METRICS_DUMP_FILENAME());
+}
+
+void MessagingSettings::setMetricsDumpFilename(const std::string& metricsDumpFilename)
+{
+    _settings.set(SETTING_METRICS_DUMP_FILENAME(), metricsDumpFilename);
+}
+
+std::int64_t MessagingSettings::getMetricsDumpIntervalMs() const
+{
+    return _settings.get<std::int64_t>(SETTING_METRICS_DUMP_INTERVAL_MS());
+}
+
+void MessagingSettings::setMetricsDumpIntervalMs(std::int64_t metricsDumpIntervalMs)
+{
+    _settings.set(SETTING_METRICS_DUMP_INTERVAL_MS(), metricsDumpIntervalMs);
+}
+
+std::string MessagingSettings::getMessageTraceFilename() const
+{
+    return _settings.get<std::string>(SETTING_MESSAGE_TRACE_FILENAME());
+}
+
+void MessagingSettings::setMessageTraceFilename(const std::string& messageTraceFilename)
+{
+    _settings.set(SETTING_MESSAGE_TRACE_FILENAME(), messageTraceFilename);
+}
+
+std::string MessagingSettings::getMessageTraceFormat() const
+{
+    return _settings.get<std::string>(SETTING_MESSAGE_TRACE_FORMAT());
+}
+
+void MessagingSettings::setMessageTraceFormat(const std::string& messageTraceFormat)
+{
+    _settings.set(SETTING_MESSAGE_TRACE_FORMAT(), messageTraceFormat);
+}
+
+std::uint64_t MessagingSettings::getMessageTraceBufferSize() const
+{
+    return _settings.get<std::uint64_t>(SETTING_MESSAGE_TRACE_BUFFER_SIZE());
+}
+
+void MessagingSettings::setMessageTraceBufferSize(std::uint64_t messageTraceBufferSize)
+{
+    _settings.set(SETTING_MESSAGE_TRACE_BUFFER_SIZE(), messageTraceBufferSize);
+}
+
+bool MessagingSettings::getInProcessDirectDispatch() const
+{
+    return _settings.get<bool>(SETTING_IN_PROCESS_DIRECT_DISPATCH());
+}
+
+void MessagingSettings::setInProcessDirectDispatch(const bool& enable)
+{
+    _settings.set(SETTING_IN_PROCESS_DIRECT_DISPATCH(), enable);
+}
+
 bool MessagingSettings::contains(const std::string& key) const
 {
     return _settings.contains(key);
@@ -578,6 +711,24 @@ void MessagingSettings::checkSettings()
         _settings.set(SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS(),
                       DEFAULT_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS());
     }
+    if (!_settings.contains(SETTING_METRICS_DUMP_FILENAME())) {
+        _settings.set(SETTING_METRICS_DUMP_FILENAME(), DEFAULT_METRICS_DUMP_FILENAME());
+    }
+    if (!_settings.contains(SETTING_METRICS_DUMP_INTERVAL_MS())) {
+        _settings.set(SETTING_METRICS_DUMP_INTERVAL_MS(), DEFAULT_METRICS_DUMP_INTERVAL_MS());
+    }
+    if (!_settings.contains(SETTING_MESSAGE_TRACE_FILENAME())) {
+        _settings.set(SETTING_MESSAGE_TRACE_FILENAME(), DEFAULT_MESSAGE_TRACE_FILENAME());
+    }
+    if (!_settings.contains(SETTING_MESSAGE_TRACE_FORMAT())) {
+        _settings.set(SETTING_MESSAGE_TRACE_FORMAT(), DEFAULT_MESSAGE_TRACE_FORMAT());
+    }
+    if (!_settings.contains(SETTING_MESSAGE_TRACE_BUFFER_SIZE())) {
+        _settings.set(SETTING_MESSAGE_TRACE_BUFFER_SIZE(), DEFAULT_MESSAGE_TRACE_BUFFER_SIZE());
+    }
+    if (!_settings.contains(SETTING_IN_PROCESS_DIRECT_DISPATCH())) {
+        _settings.set(SETTING_IN_PROCESS_DIRECT_DISPATCH(), DEFAULT_IN_PROCESS_DIRECT_DISPATCH());
+    }
 
     if (!checkMultipleBackendsSettings()) {
         const std::string message =
@@ -770,6 +921,30 @@ void MessagingSettings::printSettings() const
             "SETTING: {} = {}",
             SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS(),
             _settings.get<std::string>(SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS()));
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_METRICS_DUMP_FILENAME(),
+                   _settings.get<std::string>(SETTING_METRICS_DUMP_FILENAME()));
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_METRICS_DUMP_INTERVAL_MS(),
+                   _settings.get<std::int64_t>(SETTING_METRICS_DUMP_INTERVAL_MS()));
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MESSAGE_TRACE_FILENAME(),
+                   _settings.get<std::string>(SETTING_MESSAGE_TRACE_FILENAME()));
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MESSAGE_TRACE_FORMAT(),
+                   _settings.get<std::string>(SETTING_MESSAGE_TRACE_FORMAT()));
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MESSAGE_TRACE_BUFFER_SIZE(),
+                   _settings.get<std::uint64_t>(SETTING_MESSAGE_TRACE_BUFFER_SIZE()));
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_IN_PROCESS_DIRECT_DISPATCH(),
+                   _settings.get<std::string>(SETTING_IN_PROCESS_DIRECT_DISPATCH()));
     printAdditionalBackendsSettings();
 }
 
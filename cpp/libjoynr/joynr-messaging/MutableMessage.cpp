@@ -62,6 +62,7 @@ std::unique_ptr<ImmutableMessage> MutableMessage::getImmutableMessage() const
 
     // key-value pair headers
     std::unordered_map<std::string, std::string> keyValuePairHeaders;
+    keyValuePairHeaders.reserve(4 + customHeaders.size());
     keyValuePairHeaders.insert({Message::HEADER_TYPE(), type});
     keyValuePairHeaders.insert({Message::HEADER_ID(), id});
 
@@ -26,6 +26,7 @@
 #include "joynr/BroadcastSubscriptionRequest.h"
 #include "joynr/IPlatformSecurityManager.h"
 #include "joynr/Message.h"
+#include "joynr/MessageTracer.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingQosEffort.h"
 #include "joynr/MulticastPublication.h"
@@ -227,6 +228,8 @@ void MutableMessageFactory::initMsg(MutableMessage& msg,
     // set flags
     msg.setEncrypt(qos.getEncrypt());
     msg.setCompress(qos.getCompress());
+
+    JOYNR_TRACE_MESSAGE(CREATED, msg.getId());
 }
 
 } // namespace joynr
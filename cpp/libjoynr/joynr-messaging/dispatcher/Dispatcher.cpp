@@ -30,6 +30,8 @@
 #include "joynr/ISubscriptionManager.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/InterfaceRegistrar.h"
+#include "joynr/MessageTracer.h"
+#include "joynr/Metrics.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingQosEffort.h"
 #include "joynr/MulticastPublication.h"
@@ -50,6 +52,7 @@
 #include "joynr/serializer/Serializer.h"
 #include "joynr/types/Version.h"
 
+#include "InProcessRequestRunnable.h"
 #include "ReceivedMessageRunnable.h"
 
 namespace joynr
@@ -67,7 +70,9 @@ Dispatcher::Dispatcher(std::shared_ptr<IMessageSender> messageSender,
           _handleReceivedMessageThreadPool(std::make_shared<ThreadPool>("Dispatcher", 1)),
           _subscriptionHandlingMutex(),
           _isShuttingDown(false),
-          _isShuttingDownLock()
+          _isShuttingDownLock(),
+          _inProcessRequestsCounter(
+                  metrics::MetricsRegistry::instance().getCounter("dispatcher.inProcessRequests"))
 {
     _handleReceivedMessageThreadPool->init();
 }
@@ -159,6 +164,7 @@ void Dispatcher::receive(std::shared_ptr<ImmutableMessage> message)
         return;
     }
     JOYNR_LOG_TRACE(logger(), "received message: {}", message->toLogMessage());
+    JOYNR_TRACE_MESSAGE(RECEIVED, message->getId());
     // we only support non-encrypted messages for now
     assert(!message->isEncrypted());
     std::shared_ptr<ReceivedMessageRunnable> receivedMessageRunnable =
@@ -166,6 +172,53 @@ void Dispatcher::receive(std::shared_ptr<ImmutableMessage> message)
     _handleReceivedMessageThreadPool->execute(receivedMessageRunnable);
 }
 
+void Dispatcher::dispatchInProcessRequest(const std::string& senderParticipantId,
+                                          const std::string& receiverParticipantId,
+                                          const MessagingQos& qos,
+                                          Request&& request)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(),
+                        "dispatchInProcessRequest requestReplyId= {} cancelled, shutting down",
+                        request.getRequestReplyId());
+        return;
+    }
+    JOYNR_LOG_TRACE(logger(),
+                    "dispatching in-process request: method {}, requestReplyId {}, receiverId {}",
+                    request.getMethodName(),
+                    request.getRequestReplyId(),
+                    receiverParticipantId);
+    _inProcessRequestsCounter->increment();
+    _handleReceivedMessageThreadPool->execute(std::make_shared<InProcessRequestRunnable>(
+            senderParticipantId,
+            receiverParticipantId,
+            TimePoint::fromRelativeMs(static_cast<std::int64_t>(qos.getTtl())),
+            std::move(request),
+            shared_from_this()));
+}
+
+void Dispatcher::dispatchInProcessOneWayRequest(const std::string& receiverParticipantId,
+                                                const MessagingQos& qos,
+                                                OneWayRequest&& request)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(), "dispatchInProcessOneWayRequest cancelled, shutting down");
+        return;
+    }
+    JOYNR_LOG_TRACE(logger(),
+                    "dispatching in-process one-way request: method {}, receiverId {}",
+                    request.getMethodName(),
+                    receiverParticipantId);
+    _inProcessRequestsCounter->increment();
+    _handleReceivedMessageThreadPool->execute(std::make_shared<InProcessRequestRunnable>(
+            receiverParticipantId,
+            TimePoint::fromRelativeMs(static_cast<std::int64_t>(qos.getTtl())),
+            std::move(request),
+            shared_from_this()));
+}
+
 void Dispatcher::handleRequestReceived(std::shared_ptr<ImmutableMessage> message)
 {
     ReadLocker locker(_isShuttingDownLock);
@@ -369,6 +422,144 @@ void Dispatcher::handleReplyReceived(std::shared_ptr<ImmutableMessage> message)
     caller->execute(std::move(reply));
 }
 
+void Dispatcher::handleInProcessRequest(const std::string& senderParticipantId,
+                                        const std::string& receiverParticipantId,
+                                        const TimePoint& requestExpiryDate,
+                                        Request& request)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(), "handleInProcessRequest cancelled, shutting down");
+        return;
+    }
+
+    std::shared_ptr<RequestCaller> caller = _requestCallerDirectory.lookup(receiverParticipantId);
+    if (!caller) {
+        JOYNR_LOG_ERROR(
+                logger(),
+                "caller not found in the RequestCallerDirectory for receiverId {}, ignoring",
+                receiverParticipantId);
+        return;
+    }
+
+    const std::string& interfaceName = caller->getInterfaceName();
+    std::shared_ptr<IRequestInterpreter> requestInterpreter =
+            InterfaceRegistrar::instance().getRequestInterpreter(
+                    interfaceName + std::to_string(caller->getProviderVersion().getMajorVersion()));
+    if (!requestInterpreter) {
+        JOYNR_LOG_ERROR(logger(), "requestInterpreter not found for interface {}", interfaceName);
+        return;
+    }
+
+    const std::string& requestReplyId = request.getRequestReplyId();
+    JOYNR_LOG_TRACE(logger(),
+                    "handling in-process request: requestReplyId {}, senderId {}, receiverId {}",
+                    requestReplyId,
+                    senderParticipantId,
+                    receiverParticipantId);
+
+    auto onSuccess = [requestReplyId,
+                      requestExpiryDate,
+                      thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
+                             Reply&& reply) mutable {
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            JOYNR_LOG_TRACE(logger(),
+                            "Got in-process reply from RequestInterpreter for requestReplyId {}",
+                            requestReplyId);
+            reply.setRequestReplyId(std::move(requestReplyId));
+            thisSharedPtr->dispatchInProcessReply(std::move(reply), requestExpiryDate);
+        }
+    };
+
+    auto onError = [requestReplyId,
+                    requestExpiryDate,
+                    thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
+                           const std::shared_ptr<exceptions::JoynrException>& exception) mutable {
+        assert(exception);
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            JOYNR_LOG_WARN(logger(),
+                           "Got error '{}' from RequestInterpreter for requestReplyId {}",
+                           exception->getMessage(),
+                           requestReplyId);
+            Reply reply;
+            reply.setRequestReplyId(std::move(requestReplyId));
+            reply.setError(exception);
+            thisSharedPtr->dispatchInProcessReply(std::move(reply), requestExpiryDate);
+        }
+    };
+    locker.unlock();
+
+    requestInterpreter->execute(
+            std::move(caller), request, std::move(onSuccess), std::move(onError));
+}
+
+void Dispatcher::handleInProcessOneWayRequest(const std::string& receiverParticipantId,
+                                              OneWayRequest& request)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(), "handleInProcessOneWayRequest cancelled, shutting down");
+        return;
+    }
+
+    std::shared_ptr<RequestCaller> caller = _requestCallerDirectory.lookup(receiverParticipantId);
+    if (!caller) {
+        JOYNR_LOG_ERROR(
+                logger(),
+                "caller not found in the RequestCallerDirectory for receiverId {}, ignoring",
+                receiverParticipantId);
+        return;
+    }
+
+    const std::string& interfaceName = caller->getInterfaceName();
+    std::shared_ptr<IRequestInterpreter> requestInterpreter =
+            InterfaceRegistrar::instance().getRequestInterpreter(
+                    interfaceName + std::to_string(caller->getProviderVersion().getMajorVersion()));
+    if (!requestInterpreter) {
+        JOYNR_LOG_ERROR(logger(),
+                        "requestInterpreter not found for receiverId {}, ignoring",
+                        interfaceName);
+        return;
+    }
+    locker.unlock();
+
+    requestInterpreter->execute(std::move(caller), request);
+}
+
+void Dispatcher::dispatchInProcessReply(Reply&& reply, const TimePoint& replyExpiryDate)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(), "dispatchInProcessReply cancelled, shutting down");
+        return;
+    }
+    // replies are handled on the dispatcher thread like received reply messages, the provider
+    // may call onSuccess/onError from any thread
+    _handleReceivedMessageThreadPool->execute(std::make_shared<InProcessReplyRunnable>(
+            std::move(reply), replyExpiryDate, shared_from_this()));
+}
+
+void Dispatcher::handleInProcessReply(Reply&& reply)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(), "handleInProcessReply cancelled, shutting down");
+        return;
+    }
+    const std::string& requestReplyId = reply.getRequestReplyId();
+    std::shared_ptr<IReplyCaller> caller = _replyCallerDirectory.take(requestReplyId);
+    if (!caller) {
+        // the ReplyCallerDirectory removes callers whose lifetime exceeded the TTL
+        JOYNR_LOG_WARN(logger(),
+                       "caller not found in the ReplyCallerDirectory for requestid {}, ignoring",
+                       requestReplyId);
+        return;
+    }
+    locker.unlock();
+
+    caller->execute(std::move(reply));
+}
+
 void Dispatcher::handleSubscriptionRequestReceived(std::shared_ptr<ImmutableMessage> message)
 {
     ReadLocker locker(_isShuttingDownLock);
@@ -0,0 +1,128 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "InProcessRequestRunnable.h"
+
+#include <utility>
+
+#include "joynr/CallContext.h"
+#include "joynr/CallContextStorage.h"
+#include "joynr/Dispatcher.h"
+
+namespace joynr
+{
+
+InProcessRequestRunnable::InProcessRequestRunnable(std::string senderParticipantId,
+                                                   std::string receiverParticipantId,
+                                                   const TimePoint& expiryDate,
+                                                   Request&& request,
+                                                   std::weak_ptr<Dispatcher> dispatcher)
+        : Runnable(),
+          ObjectWithDecayTime(expiryDate),
+          _senderParticipantId(std::move(senderParticipantId)),
+          _receiverParticipantId(std::move(receiverParticipantId)),
+          _request(std::make_unique<Request>(std::move(request))),
+          _oneWayRequest(),
+          _dispatcher(std::move(dispatcher)),
+          _creationTime(metrics::Clock::now())
+{
+}
+
+InProcessRequestRunnable::InProcessRequestRunnable(std::string receiverParticipantId,
+                                                   const TimePoint& expiryDate,
+                                                   OneWayRequest&& request,
+                                                   std::weak_ptr<Dispatcher> dispatcher)
+        : Runnable(),
+          ObjectWithDecayTime(expiryDate),
+          _senderParticipantId(),
+          _receiverParticipantId(std::move(receiverParticipantId)),
+          _request(),
+          _oneWayRequest(std::make_unique<OneWayRequest>(std::move(request))),
+          _dispatcher(std::move(dispatcher)),
+          _creationTime(metrics::Clock::now())
+{
+}
+
+void InProcessRequestRunnable::shutdown()
+{
+}
+
+void InProcessRequestRunnable::run()
+{
+    static const std::shared_ptr<metrics::Histogram> waitLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("dispatcher.wait.latencyUs");
+    static const std::shared_ptr<metrics::Histogram> runLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("dispatcher.run.latencyUs");
+    waitLatencyHistogram->recordElapsedSince(_creationTime);
+    metrics::ScopedLatencyRecorder runLatencyRecorder(*runLatencyHistogram);
+
+    if (isExpired()) {
+        JOYNR_LOG_DEBUG(logger(),
+                        "Dropping in-process request to {}, because it is expired",
+                        _receiverParticipantId);
+        return;
+    }
+
+    auto dispatcherSharedPtr = _dispatcher.lock();
+    if (!dispatcherSharedPtr) {
+        JOYNR_LOG_DEBUG(logger(), "Dropping in-process request, because dispatcher not available");
+        return;
+    }
+
+    // requests from proxies in the same runtime do not carry a creator
+    CallContextStorage::set(CallContext());
+
+    if (_request) {
+        dispatcherSharedPtr->handleInProcessRequest(
+                _senderParticipantId, _receiverParticipantId, getDecayTime(), *_request);
+    } else {
+        dispatcherSharedPtr->handleInProcessOneWayRequest(_receiverParticipantId, *_oneWayRequest);
+    }
+
+    CallContextStorage::invalidate();
+}
+
+InProcessReplyRunnable::InProcessReplyRunnable(Reply&& reply,
+                                               const TimePoint& expiryDate,
+                                               std::weak_ptr<Dispatcher> dispatcher)
+        : Runnable(),
+          ObjectWithDecayTime(expiryDate),
+          _reply(std::move(reply)),
+          _dispatcher(std::move(dispatcher))
+{
+}
+
+void InProcessReplyRunnable::shutdown()
+{
+}
+
+void InProcessReplyRunnable::run()
+{
+    if (isExpired()) {
+        JOYNR_LOG_DEBUG(logger(),
+                        "Dropping in-process reply for requestReplyId {}, because it is expired",
+                        _reply.getRequestReplyId());
+        return;
+    }
+
+    if (auto dispatcherSharedPtr = _dispatcher.lock()) {
+        dispatcherSharedPtr->handleInProcessReply(std::move(_reply));
+    }
+}
+
+} // namespace joynr
@@ -0,0 +1,97 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef INPROCESSREQUESTRUNNABLE_H
+#define INPROCESSREQUESTRUNNABLE_H
+
+#include <memory>
+#include <string>
+
+#include "joynr/Logger.h"
+#include "joynr/Metrics.h"
+#include "joynr/ObjectWithDecayTime.h"
+#include "joynr/OneWayRequest.h"
+#include "joynr/PrivateCopyAssign.h"
+#include "joynr/Reply.h"
+#include "joynr/Request.h"
+#include "joynr/Runnable.h"
+#include "joynr/TimePoint.h"
+
+namespace joynr
+{
+
+class Dispatcher;
+
+/**
+ * InProcessRequestRunnable is used to handle a request for a provider registered in the same
+ * runtime via the ThreadPool of the Dispatcher. The typed request is passed to the
+ * RequestInterpreter without being serialized.
+ */
+class InProcessRequestRunnable : public Runnable, public ObjectWithDecayTime
+{
+public:
+    InProcessRequestRunnable(std::string senderParticipantId,
+                             std::string receiverParticipantId,
+                             const TimePoint& expiryDate,
+                             Request&& request,
+                             std::weak_ptr<Dispatcher> dispatcher);
+    InProcessRequestRunnable(std::string receiverParticipantId,
+                             const TimePoint& expiryDate,
+                             OneWayRequest&& request,
+                             std::weak_ptr<Dispatcher> dispatcher);
+    ~InProcessRequestRunnable() override = default;
+
+    void shutdown() override;
+    void run() override;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(InProcessRequestRunnable);
+    const std::string _senderParticipantId;
+    const std::string _receiverParticipantId;
+    // exactly one of both is set
+    std::unique_ptr<Request> _request;
+    std::unique_ptr<OneWayRequest> _oneWayRequest;
+    std::weak_ptr<Dispatcher> _dispatcher;
+    const metrics::Clock::time_point _creationTime;
+    ADD_LOGGER(InProcessRequestRunnable)
+};
+
+/**
+ * InProcessReplyRunnable passes the typed reply of an in-process request to the ReplyCaller
+ * via the ThreadPool of the Dispatcher.
+ */
+class InProcessReplyRunnable : public Runnable, public ObjectWithDecayTime
+{
+public:
+    InProcessReplyRunnable(Reply&& reply,
+                           const TimePoint& expiryDate,
+                           std::weak_ptr<Dispatcher> dispatcher);
+    ~InProcessReplyRunnable() override = default;
+
+    void shutdown() override;
+    void run() override;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(InProcessReplyRunnable);
+    Reply _reply;
+    std::weak_ptr<Dispatcher> _dispatcher;
+    ADD_LOGGER(InProcessReplyRunnable)
+};
+
+} // namespace joynr
+#endif // INPROCESSREQUESTRUNNABLE_H
@@ -26,6 +26,7 @@
 #include "joynr/Dispatcher.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Message.h"
+#include "joynr/MessageTracer.h"
 
 namespace joynr
 {
@@ -35,7 +36,8 @@ ReceivedMessageRunnable::ReceivedMessageRunnable(std::shared_ptr<ImmutableMessag
         : Runnable(),
           ObjectWithDecayTime(message->getExpiryDate()),
           _message(std::move(message)),
-          _dispatcher(dispatcher)
+          _dispatcher(dispatcher),
+          _creationTime(metrics::Clock::now())
 {
     JOYNR_LOG_TRACE(logger(),
                     "Creating ReceivedMessageRunnable for message: {}",
@@ -48,6 +50,13 @@ void ReceivedMessageRunnable::shutdown()
 
 void ReceivedMessageRunnable::run()
 {
+    static const std::shared_ptr<metrics::Histogram> waitLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("dispatcher.wait.latencyUs");
+    static const std::shared_ptr<metrics::Histogram> runLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("dispatcher.run.latencyUs");
+    waitLatencyHistogram->recordElapsedSince(_creationTime);
+    metrics::ScopedLatencyRecorder runLatencyRecorder(*runLatencyHistogram);
+
     if (!_message) {
         return;
     }
@@ -77,6 +86,11 @@ void ReceivedMessageRunnable::run()
     callContext.setPrincipal(_message->getCreator());
     CallContextStorage::set(std::move(callContext));
 
+    // the message is handed over to the dispatcher, keep it for tracing the end of dispatching
+    std::shared_ptr<ImmutableMessage> tracedMessage =
+            tracing::MessageTracer::isEnabled() ? _message : nullptr;
+    JOYNR_TRACE_MESSAGE(DISPATCH_START, _message->getId());
+
     if (messageType == Message::VALUE_MESSAGE_TYPE_REQUEST()) {
         dispatcherSharedPtr->handleRequestReceived(std::move(_message));
     } else if (messageType == Message::VALUE_MESSAGE_TYPE_REPLY()) {
@@ -101,6 +115,10 @@ void ReceivedMessageRunnable::run()
         JOYNR_LOG_ERROR(logger(), "unknown message type: {}", messageType);
     }
 
+    if (tracedMessage) {
+        JOYNR_TRACE_MESSAGE(DISPATCH_END, tracedMessage->getId());
+    }
+
     CallContextStorage::invalidate();
     JOYNR_LOG_TRACE(logger(), "Invalidating call context.");
 }
@@ -22,6 +22,7 @@
 #include <memory>
 
 #include "joynr/Logger.h"
+#include "joynr/Metrics.h"
 #include "joynr/ObjectWithDecayTime.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/Runnable.h"
@@ -51,6 +52,7 @@ private:
     DISALLOW_COPY_AND_ASSIGN(ReceivedMessageRunnable);
     std::shared_ptr<ImmutableMessage> _message;
     std::weak_ptr<Dispatcher> _dispatcher;
+    const metrics::Clock::time_point _creationTime;
     ADD_LOGGER(ReceivedMessageRunnable)
 };
 
@@ -66,6 +66,12 @@ class ITransportStatus;
 class ImmutableMessage;
 class ThreadPoolDelayedScheduler;
 
+namespace metrics
+{
+class Counter;
+class Histogram;
+} // namespace metrics
+
 /**
  * Common implementation of functionalities of a message router object.
  */
@@ -80,6 +86,7 @@ public:
                                std::shared_ptr<const joynr::system::RoutingTypes::Address> address,
                                bool isGloballyVisible);
     virtual void setToKnown(const std::string& participantId) override;
+    bool canDispatchInProcess(const std::string& participantId) override;
 
     virtual void init();
     std::uint64_t getNumberOfRoutedMessages() const;
@@ -167,7 +174,13 @@ protected:
     void activateMessageCleanerTimer();
     void activateRoutingTableCleanerTimer();
     void registerTransportStatusCallbacks();
-    void rescheduleQueuedMessagesForTransport(std::shared_ptr<ITransportStatus> transportStatus);
+    /**
+     * Routes the messages which have been queued because the transport was not available. If
+     * destAddress is given, only the messages for this destination are routed.
+     */
+    void rescheduleQueuedMessagesForTransport(
+            std::shared_ptr<ITransportStatus> transportStatus,
+            std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress = nullptr);
     void onMessageCleanerTimerExpired(std::shared_ptr<AbstractMessageRouter> thisSharedptr,
                                       const boost::system::error_code& errorCode);
     void onRoutingTableCleanerTimerExpired(const boost::system::error_code& errorCode);
@@ -225,12 +238,19 @@ private:
     DISALLOW_COPY_AND_ASSIGN(AbstractMessageRouter);
     ADD_LOGGER(AbstractMessageRouter)
 
+    // Reschedules queued messages on the message scheduler, transports signal their availability
+    // from their own I/O threads
+    class RescheduleQueuedMessagesRunnable;
+
     void checkExpiryDate(const ImmutableMessage& message);
     AddressUnorderedSet lookupAddresses(const std::unordered_set<std::string>& participantIds);
     std::atomic<bool> _isShuttingDown;
     std::atomic<std::uint64_t> _numberOfRoutedMessages;
     const std::uint64_t _maxAclRetryIntervalMs;
     std::uint32_t _messageCleaningCycleCounter;
+    std::shared_ptr<metrics::Counter> _routedMessagesCounter;
+    std::shared_ptr<metrics::Histogram> _routeLatencyHistogram;
+    const bool _inProcessDirectDispatch;
 };
 
 /**
@@ -39,9 +39,18 @@ class IReplyCaller;
 class ISubscriptionManager;
 class ImmutableMessage;
 class MessagingQos;
+class OneWayRequest;
 class PublicationManager;
+class Reply;
+class Request;
 class RequestCaller;
 class ThreadPool;
+class TimePoint;
+
+namespace metrics
+{
+class Counter;
+} // namespace metrics
 
 class JOYNR_EXPORT Dispatcher : public std::enable_shared_from_this<Dispatcher>, public IDispatcher
 {
@@ -62,6 +71,15 @@ public:
 
     void receive(std::shared_ptr<ImmutableMessage> message) override;
 
+    void dispatchInProcessRequest(const std::string& senderParticipantId,
+                                  const std::string& receiverParticipantId,
+                                  const MessagingQos& qos,
+                                  Request&& request) override;
+
+    void dispatchInProcessOneWayRequest(const std::string& receiverParticipantId,
+                                        const MessagingQos& qos,
+                                        OneWayRequest&& request) override;
+
     void registerSubscriptionManager(
             std::shared_ptr<ISubscriptionManager> subscriptionManager) override;
 
@@ -81,6 +99,15 @@ private:
     void handleSubscriptionReplyReceived(std::shared_ptr<ImmutableMessage> message);
     void handleMulticastSubscriptionRequestReceived(std::shared_ptr<ImmutableMessage> message);
 
+    void handleInProcessRequest(const std::string& senderParticipantId,
+                                const std::string& receiverParticipantId,
+                                const TimePoint& requestExpiryDate,
+                                Request& request);
+    void handleInProcessOneWayRequest(const std::string& receiverParticipantId,
+                                      OneWayRequest& request);
+    void dispatchInProcessReply(Reply&& reply, const TimePoint& replyExpiryDate);
+    void handleInProcessReply(Reply&& reply);
+
 private:
     DISALLOW_COPY_AND_ASSIGN(Dispatcher);
     std::shared_ptr<IMessageSender> _messageSender;
@@ -93,8 +120,11 @@ private:
     std::mutex _subscriptionHandlingMutex;
     bool _isShuttingDown;
     ReadWriteLock _isShuttingDownLock;
+    std::shared_ptr<metrics::Counter> _inProcessRequestsCounter;
 
     friend class ReceivedMessageRunnable;
+    friend class InProcessRequestRunnable;
+    friend class InProcessReplyRunnable;
 };
 
 } // namespace joynr
@@ -21,6 +21,7 @@
 
 #include "joynr/Arbitrator.h"
 #include "joynr/ArbitratorFactory.h"
+#include "joynr/BoostIoserviceForwardDecl.h"
 #include "joynr/DiscoveryQos.h"
 #include "joynr/DiscoveryResult.h"
 #include "joynr/Logger.h"
@@ -39,6 +40,7 @@ class GuidedProxyBuilder : public IProxyBuilderBase,
 public:
     GuidedProxyBuilder(
             std::weak_ptr<JoynrRuntimeImpl> runtime,
+            boost::asio::io_service& ioService,
             ProxyFactory& proxyFactory,
             std::weak_ptr<joynr::system::IDiscoveryAsync> discoveryProxy,
             const std::string& domain,
@@ -75,6 +77,7 @@ private:
 
     // NOTE: necessary for ProxyBuilder creation
     std::weak_ptr<JoynrRuntimeImpl> _runtime;
+    boost::asio::io_service& _ioService;
     ProxyFactory& _proxyFactory;
     std::weak_ptr<joynr::system::IDiscoveryAsync> _discoveryProxy;
     std::shared_ptr<const joynr::system::RoutingTypes::Address> _dispatcherAddress;
@@ -142,6 +145,7 @@ std::shared_ptr<TProxy> GuidedProxyBuilder::buildProxy(const std::string& partic
     std::vector<joynr::types::DiscoveryEntryWithMetaInfo> discoveryEntries{discoveryEntry};
     ArbitrationResult arbitrationResult = ArbitrationResult(discoveryEntries);
     auto proxyBuilder = std::make_shared<ProxyBuilder<TProxy>>(_runtime,
+                                                               _ioService,
                                                                _proxyFactory,
                                                                _discoveryProxy,
                                                                _domain,
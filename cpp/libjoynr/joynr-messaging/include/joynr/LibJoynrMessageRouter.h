@@ -20,6 +20,8 @@
 #ifndef CHILDMESSAGEROUTER_H
 #define CHILDMESSAGEROUTER_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -149,12 +151,39 @@ private:
                      std::shared_ptr<const system::RoutingTypes::Address> destAddress,
                      std::uint32_t tryCount = 0) final;
 
+    /*
+     * A next hop registration which waits for a free request slot towards the parent router
+     */
+    struct PendingParentAdd {
+        std::string participantId;
+        bool isGloballyVisible;
+        std::function<void()> onSuccess;
+        std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError;
+    };
+
     bool isParentMessageRouterSet();
     void addNextHopToParent(std::string participantId,
                             bool isGloballyVisible,
                             std::function<void(void)> onSuccess = nullptr,
                             std::function<void(const joynr::exceptions::ProviderRuntimeException&)>
                                     onError = nullptr);
+    void sendNextHopToParent(const std::string& participantId,
+                             bool isGloballyVisible,
+                             std::function<void(void)> onSuccess,
+                             std::function<void(const joynr::exceptions::ProviderRuntimeException&)>
+                                     onError);
+    bool canBatchNextHopsAtParent() const;
+    void sendNextHopsToParent(std::vector<PendingParentAdd> pendingAdds);
+    void sendNextHopsToParentOneByOne(std::vector<PendingParentAdd> pendingAdds);
+    void onParentAddRequestFinished();
+    void resolveNextHopsAtParent(std::vector<std::string> participantIds);
+    void resolveNextHopAtParent(const std::string& participantId,
+                                std::function<void()> onRequestFinished);
+    void resolveNextHopsAtParentOneByOne(const std::vector<std::string>& participantIds);
+    bool onParentBatchRequestFailed(const exceptions::JoynrRuntimeException& error);
+    void onParentResolveRequestFinished();
+    void onParentNextHopResolved(const std::string& participantId, bool resolved);
+    void onParentResolveFailed(const std::string& participantId, const std::string& errorMessage);
     bool isValidForRoutingTable(
             std::shared_ptr<const joynr::system::RoutingTypes::Address> address) final;
     bool allowRoutingEntryUpdate(const routingtable::RoutingEntry& oldEntry,
@@ -164,7 +193,15 @@ private:
     std::shared_ptr<const joynr::system::RoutingTypes::Address> _parentAddress;
     std::shared_ptr<const joynr::system::RoutingTypes::Address> _incomingAddress;
     std::unordered_set<std::string> _runningParentResolves;
+    std::vector<std::string> _pendingParentResolves;
+    std::size_t _parentResolveRequestsInFlight;
     mutable std::mutex _parentResolveMutex;
+    std::vector<PendingParentAdd> _pendingParentAdds;
+    std::size_t _parentAddRequestsInFlight;
+    std::mutex _parentAddMutex;
+    // cleared once the parent has rejected addNextHops or resolveNextHops, e.g. because it
+    // runs an older version of the Routing interface
+    std::atomic<bool> _parentSupportsBatchRequests;
 
     bool canMessageBeTransmitted(std::shared_ptr<ImmutableMessage> message) const final;
 
@@ -173,6 +210,8 @@ private:
     std::mutex _parentClusterControllerReplyToAddressMutex;
     std::string _parentClusterControllerReplyToAddress;
     const bool _DEFAULT_IS_GLOBALLY_VISIBLE;
+    // further requests are coalesced until one of the running requests has finished
+    const std::size_t _MAX_PARENT_REQUESTS_IN_FLIGHT;
 };
 
 } // namespace joynr
@@ -20,47 +20,76 @@
 #define MESSAGEQUEUE_H
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
-
-#include <boost/multi_index/composite_key.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <unordered_map>
+#include <vector>
 
 #include "joynr/ImmutableMessage.h"
 #include "joynr/JoynrExport.h"
 #include "joynr/Logger.h"
+#include "joynr/MessageQueueSpillFile.h"
+#include "joynr/Metrics.h"
+#include "joynr/PoolAllocator.h"
 #include "joynr/PrivateCopyAssign.h"
+#include "joynr/TrackingInfo.h"
 
 namespace joynr
 {
 
-namespace messagequeuetags
-{
-struct key;
-struct ttlAbsolute;
-struct key_and_ttlAbsolute;
-} // namespace messagequeuetags
-
+/**
+ * @brief Queue for messages which cannot be routed yet, grouped by a key
+ * (e.g. the recipient participantId or the transport status).
+ *
+ * Messages of the same key are kept in a FIFO list, so enqueueing, dequeueing and
+ * counting the messages of a key is O(1). Each key additionally keeps its messages
+ * ordered by expiry date, so the message with the lowest TTL of a key is evicted in
+ * O(log n) when the per key limit is reached. The keys are distributed over
+ * NUMBER_OF_STRIPES stripes, each protected by its own mutex, so that operations
+ * on different keys usually do not contend.
+ *
+ * Every stripe references its messages from a min-heap ordered by expiry date, which
+ * is used to remove outdated messages and, once the global limits are reached, to find
+ * the message with the lowest TTL of all stripes. Messages which leave the queue by
+ * other means are removed from the heap lazily.
+ *
+ * Length and size of the queue are tracked globally. Under concurrent access the
+ * limits may be exceeded temporarily by the number of concurrently queueing threads.
+ *
+ * If a spill file is set, messages evicted because of the global message or byte
+ * limit are written to the spill file instead of being dropped. Their place in the
+ * queue of their key is kept, so they are read back in order by getNextMessageFor()
+ * once the key becomes routable again. Spilled messages do not count against the
+ * limits; they are dropped only if the spill file is full or when they expire.
+ */
 template <typename T>
 class JOYNR_EXPORT MessageQueue
 {
 public:
+    static constexpr std::size_t NUMBER_OF_STRIPES = 16;
+
     MessageQueue(std::uint64_t messageQueueLimit = 0,
                  std::uint64_t perKeyMessageQueueLimit = 0,
                  std::uint64_t messageQueueLimitBytes = 0)
-            : _queue(),
-              _queueMutex(),
+            : _stripes(),
               _messageQueueLimit(messageQueueLimit),
               _messageQueueLimitBytes(messageQueueLimitBytes),
               _perKeyMessageQueueLimit(perKeyMessageQueueLimit),
-              _queueSizeBytes(0)
+              _queueLength(0),
+              _queueSizeBytes(0),
+              _spilledQueueLength(0),
+              _nextSequenceNumber(0),
+              _queueLengthGauge(nullptr),
+              _spillFile(nullptr)
     {
     }
 
@@ -68,114 +97,180 @@ public:
     {
     }
 
+    /**
+     * @return the number of queued messages including the spilled messages
+     */
     virtual std::size_t getQueueLength() const
     {
-        std::lock_guard<std::mutex> lock(_queueMutex);
-        return getQueueLengthUnlocked();
+        return _queueLength.load() + _spilledQueueLength.load();
     }
 
+    /**
+     * @return the size of the messages which are held in memory
+     */
     virtual std::size_t getQueueSizeBytes() const
     {
-        std::lock_guard<std::mutex> lock(_queueMutex);
-        return _queueSizeBytes;
+        return static_cast<std::size_t>(_queueSizeBytes.load());
+    }
+
+    std::size_t getSpilledQueueLength() const
+    {
+        return _spilledQueueLength.load();
+    }
+
+    /**
+     * @brief Sets the file to which messages are spilled when the queue limits are reached
+     * @note Must be called before the queue is accessed concurrently
+     */
+    void setSpillFile(std::shared_ptr<MessageQueueSpillFile> spillFile)
+    {
+        _spillFile = std::move(spillFile);
+    }
+
+    /**
+     * @brief Sets a gauge which is kept up to date with the number of queued messages
+     * @note Must be called before the queue is accessed concurrently
+     */
+    void setQueueLengthGauge(std::shared_ptr<metrics::Gauge> queueLengthGauge)
+    {
+        _queueLengthGauge = std::move(queueLengthGauge);
+        updateQueueLengthGauge();
     }
 
     virtual std::deque<std::shared_ptr<ImmutableMessage>> queueMessage(
             const T key,
             std::shared_ptr<ImmutableMessage> message)
     {
+        std::deque<std::shared_ptr<ImmutableMessage>> droppedMessagesToBeReplied{};
+        const std::uint64_t messageSize = message->getMessageSize();
 
-        MessageQueueItem item;
-        item._key = std::move(key);
-        item._ttlAbsolute = message->getExpiryDate();
-        item._message = std::move(message);
+        if (_messageQueueLimitBytes > 0 && messageSize > _messageQueueLimitBytes) {
+            JOYNR_LOG_WARN(logger(),
+                           "queueMessage: messageSize exceeds messageQueueLimitBytes {}, "
+                           "discarding message {}; queueSize(bytes) = {}, "
+                           "#msgs = {}",
+                           _messageQueueLimitBytes,
+                           TrackingInfo(*message),
+                           getQueueSizeBytes(),
+                           getQueueLength());
+            droppedMessagesToBeReplied.push_front(std::move(message));
+            return droppedMessagesToBeReplied;
+        }
 
-        std::deque<std::shared_ptr<ImmutableMessage>> droppedMessagesToBeReplied{};
-        // scope protected by the mutex
-        {
-            std::lock_guard<std::mutex> lock(_queueMutex);
-            ensureFreeQueueSlot(item._key, droppedMessagesToBeReplied);
-            if (!ensureFreeQueueBytes(
-                        item._message->getMessageSize(), droppedMessagesToBeReplied)) {
+        auto item = util::makePooledShared<MessageQueueItem>();
+        item->_key = std::move(key);
+        item->_ttlAbsolute = message->getExpiryDate();
+        item->_sequenceNumber = _nextSequenceNumber++;
+        item->_message = std::move(message);
 
-                if (item._message->getMessageSize() > _messageQueueLimitBytes) {
-                    droppedMessagesToBeReplied.push_front(item._message);
-                }
+        Stripe& stripe = getStripe(item->_key);
+        const bool perKeyQueueLimitActive = _messageQueueLimit > 0 && _perKeyMessageQueueLimit > 0;
+        if (perKeyQueueLimitActive) {
+            // freeing a slot of the key first avoids evicting a message of another key
+            std::lock_guard<std::mutex> lock(stripe._mutex);
+            ensureFreePerKeyQueueSlot(stripe, item->_key, droppedMessagesToBeReplied);
+        }
+        // no stripe mutex may be held while evicting messages of arbitrary keys
+        ensureFreeQueueSlot(droppedMessagesToBeReplied);
+        ensureFreeQueueBytes(messageSize, droppedMessagesToBeReplied);
 
-                JOYNR_LOG_WARN(logger(),
-                               "queueMessage: messageSize exceeds messageQueueLimitBytes {}, "
-                               "discarding message {}; queueSize(bytes) = {}, "
-                               "#msgs = {}",
-                               _messageQueueLimitBytes,
-                               item._message->getTrackingInfo(),
-                               _queueSizeBytes,
-                               getQueueLengthUnlocked());
-                return droppedMessagesToBeReplied;
+        {
+            std::lock_guard<std::mutex> lock(stripe._mutex);
+            if (perKeyQueueLimitActive) {
+                // concurrent inserts for the same key may have used the slot freed above,
+                // hence the limit is enforced again under the lock of the insert
+                ensureFreePerKeyQueueSlot(stripe, item->_key, droppedMessagesToBeReplied);
             }
-            _queueSizeBytes += item._message->getMessageSize();
-            std::string trackingInfo = item._message->getTrackingInfo();
-            _queue.insert(std::move(item));
+            auto& keyQueue = stripe._keyQueues[item->_key];
+            item->_position = keyQueue._items.insert(keyQueue._items.end(), item);
+            item->_expiryPosition = keyQueue._itemsByExpiry.insert(item).first;
+            item->_isQueued = true;
+            ++stripe._queueLength;
+            ++_queueLength;
+            _queueSizeBytes += messageSize;
+            pushToExpiryHeap(stripe._expiryHeap, item, stripe._queueLength, isInMemory);
             JOYNR_LOG_TRACE(logger(),
                             "queueMessage: message {}, new queueSize(bytes) = {}, #msgs = {}",
-                            trackingInfo,
-                            _queueSizeBytes,
-                            getQueueLengthUnlocked());
+                            TrackingInfo(*item->_message),
+                            getQueueSizeBytes(),
+                            getQueueLength());
         }
+        updateQueueLengthGauge();
         return droppedMessagesToBeReplied;
     }
 
     virtual std::shared_ptr<ImmutableMessage> getNextMessageFor(const T& key)
     {
-        std::lock_guard<std::mutex> lock(_queueMutex);
-        auto& keyIndex = boost::multi_index::get<messagequeuetags::key>(_queue);
-
-        auto queueElement = keyIndex.find(key);
-        if (queueElement != keyIndex.cend()) {
-            auto message = std::move(queueElement->_message);
-            _queueSizeBytes -= message->getMessageSize();
-            _queue.erase(queueElement);
-            JOYNR_LOG_TRACE(logger(),
-                            "getNextMessageFor: message {}, new "
-                            "queueSize(bytes) = {}, #msgs = {}",
-                            message->getTrackingInfo(),
-                            _queueSizeBytes,
-                            getQueueLengthUnlocked());
-            return message;
+        std::shared_ptr<ImmutableMessage> message;
+        Stripe& stripe = getStripe(key);
+        {
+            std::lock_guard<std::mutex> lock(stripe._mutex);
+            while (!message) {
+                auto keyQueue = stripe._keyQueues.find(key);
+                if (keyQueue == stripe._keyQueues.end()) {
+                    break;
+                }
+                const bool isSpilled = keyQueue->second._items.front()->_isSpilled;
+                message = removeItem(stripe, keyQueue->second._items.front());
+                if (isSpilled && message && message->getExpiryDate() < TimePoint::now()) {
+                    JOYNR_LOG_INFO(logger(),
+                                   "getNextMessageFor: Erasing expired spilled message {}",
+                                   TrackingInfo(*message));
+                    message.reset();
+                }
+            }
+            if (message) {
+                JOYNR_LOG_TRACE(logger(),
+                                "getNextMessageFor: message {}, new "
+                                "queueSize(bytes) = {}, #msgs = {}",
+                                TrackingInfo(*message),
+                                getQueueSizeBytes(),
+                                getQueueLength());
+            }
         }
-        return nullptr;
+        updateQueueLengthGauge();
+        return message;
     }
 
     virtual void removeOutdatedMessages()
     {
-        std::lock_guard<std::mutex> lock(_queueMutex);
+        const TimePoint now = TimePoint::now();
         int numberOfErasedMessages = 0;
         std::size_t erasedBytes = 0;
-
-        if (_queue.empty()) {
-            return;
-        }
-
-        auto& ttlIndex = boost::multi_index::get<messagequeuetags::ttlAbsolute>(_queue);
-        auto onePastOutdatedMsgIt = ttlIndex.lower_bound(TimePoint::now());
-
-        for (auto it = ttlIndex.begin(); it != onePastOutdatedMsgIt; ++it) {
-            std::size_t msgSize = it->_message->getMessageSize();
-            JOYNR_LOG_INFO(logger(),
-                           "removeOutdatedMessages: Erasing expired message {}",
-                           it->_message->getTrackingInfo());
-            _queueSizeBytes -= msgSize;
-            erasedBytes += msgSize;
-            numberOfErasedMessages++;
+        for (Stripe& stripe : _stripes) {
+            std::lock_guard<std::mutex> lock(stripe._mutex);
+            while (!stripe._expiryHeap.empty() && stripe._expiryHeap.front()->_ttlAbsolute < now) {
+                auto item = popFromExpiryHeap(stripe._expiryHeap);
+                if (!isInMemory(*item)) {
+                    continue;
+                }
+                JOYNR_LOG_INFO(logger(),
+                               "removeOutdatedMessages: Erasing expired message {}",
+                               TrackingInfo(*item->_message));
+                erasedBytes += item->_message->getMessageSize();
+                numberOfErasedMessages++;
+                removeItem(stripe, item);
+            }
+            while (!stripe._spilledExpiryHeap.empty() &&
+                   stripe._spilledExpiryHeap.front()->_ttlAbsolute < now) {
+                auto item = popFromExpiryHeap(stripe._spilledExpiryHeap);
+                if (!isSpilled(*item)) {
+                    continue;
+                }
+                // the message is not read back just to log it
+                numberOfErasedMessages++;
+                removeItem(stripe, item, false);
+            }
         }
-        ttlIndex.erase(ttlIndex.begin(), onePastOutdatedMsgIt);
         if (numberOfErasedMessages) {
+            updateQueueLengthGauge();
             JOYNR_LOG_INFO(logger(),
                            "removeOutdatedMessages: Erased {} messages of size {}, new "
                            "queueSize(bytes) = {}, #msgs = {}",
                            numberOfErasedMessages,
                            erasedBytes,
-                           _queueSizeBytes,
-                           getQueueLengthUnlocked());
+                           getQueueSizeBytes(),
+                           getQueueLength());
         }
     }
 
@@ -183,97 +278,244 @@ protected:
     DISALLOW_COPY_AND_ASSIGN(MessageQueue);
     ADD_LOGGER(MessageQueue);
 
+    struct MessageQueueItem;
+
+    struct ExpiresEarlier {
+        bool operator()(const std::shared_ptr<MessageQueueItem>& lhs,
+                        const std::shared_ptr<MessageQueueItem>& rhs) const
+        {
+            return expiresEarlier(lhs, rhs);
+        }
+    };
+
+    struct KeyQueue {
+        // FIFO order
+        std::list<std::shared_ptr<MessageQueueItem>> _items;
+        // the same messages ordered by expiry date
+        std::set<std::shared_ptr<MessageQueueItem>, ExpiresEarlier> _itemsByExpiry;
+    };
+
     struct MessageQueueItem {
+        // _key, _ttlAbsolute and _sequenceNumber are immutable while the item is queued
         T _key;
         TimePoint _ttlAbsolute;
+        std::uint64_t _sequenceNumber;
+        // all other members are protected by the mutex of the stripe of _key
         std::shared_ptr<ImmutableMessage> _message;
+        typename std::list<std::shared_ptr<MessageQueueItem>>::iterator _position;
+        typename std::set<std::shared_ptr<MessageQueueItem>, ExpiresEarlier>::iterator
+                _expiryPosition;
+        MessageQueueSpillFile::Record _spillRecord;
+        bool _isQueued{false};
+        // if set, _message has been moved to the spill file
+        bool _isSpilled{false};
     };
 
-    using QueueMultiIndexContainer = boost::multi_index_container<
-            MessageQueueItem,
-            boost::multi_index::indexed_by<
-                    boost::multi_index::hashed_non_unique<
-                            boost::multi_index::tag<messagequeuetags::key>,
-                            BOOST_MULTI_INDEX_MEMBER(MessageQueueItem, T, _key)>,
-                    boost::multi_index::ordered_non_unique<
-                            boost::multi_index::tag<messagequeuetags::ttlAbsolute>,
-                            BOOST_MULTI_INDEX_MEMBER(MessageQueueItem, TimePoint, _ttlAbsolute)>,
-                    boost::multi_index::ordered_non_unique<
-                            boost::multi_index::tag<messagequeuetags::key_and_ttlAbsolute>,
-                            boost::multi_index::composite_key<
-                                    MessageQueueItem,
-                                    boost::multi_index::
-                                            member<MessageQueueItem, T, &MessageQueueItem::_key>,
-                                    BOOST_MULTI_INDEX_MEMBER(MessageQueueItem,
-                                                             TimePoint,
-                                                             _ttlAbsolute)>>>>;
-
-    QueueMultiIndexContainer _queue;
-    mutable std::mutex _queueMutex;
+    struct Stripe {
+        std::mutex _mutex;
+        std::unordered_map<T, KeyQueue> _keyQueues;
+        // min-heaps ordered by expiry date of the messages held in memory and of the
+        // spilled messages of this stripe, including entries of removed messages
+        std::vector<std::shared_ptr<MessageQueueItem>> _expiryHeap;
+        std::vector<std::shared_ptr<MessageQueueItem>> _spilledExpiryHeap;
+        std::size_t _queueLength{0};
+        std::size_t _spilledQueueLength{0};
+    };
 
 private:
+    // the expiry heap is rebuilt when it contains more than this factor times the
+    // number of queued messages (plus a fixed slack to avoid rebuilding small heaps)
+    static constexpr std::size_t EXPIRY_HEAP_COMPACTION_FACTOR = 2;
+    static constexpr std::size_t EXPIRY_HEAP_COMPACTION_SLACK = 1024;
+
+    std::array<Stripe, NUMBER_OF_STRIPES> _stripes;
     const std::uint64_t _messageQueueLimit;
     const std::uint64_t _messageQueueLimitBytes;
     const std::uint64_t _perKeyMessageQueueLimit;
-    std::uint64_t _queueSizeBytes;
+    std::atomic<std::size_t> _queueLength;
+    std::atomic<std::uint64_t> _queueSizeBytes;
+    std::atomic<std::size_t> _spilledQueueLength;
+    std::atomic<std::uint64_t> _nextSequenceNumber;
+    std::shared_ptr<metrics::Gauge> _queueLengthGauge;
+    std::shared_ptr<MessageQueueSpillFile> _spillFile;
+
+    static bool expiresEarlier(const std::shared_ptr<MessageQueueItem>& lhs,
+                               const std::shared_ptr<MessageQueueItem>& rhs)
+    {
+        if (lhs->_ttlAbsolute == rhs->_ttlAbsolute) {
+            return lhs->_sequenceNumber < rhs->_sequenceNumber;
+        }
+        return lhs->_ttlAbsolute < rhs->_ttlAbsolute;
+    }
+
+    static bool expiresLater(const std::shared_ptr<MessageQueueItem>& lhs,
+                             const std::shared_ptr<MessageQueueItem>& rhs)
+    {
+        return expiresEarlier(rhs, lhs);
+    }
+
+    Stripe& getStripe(const T& key)
+    {
+        return _stripes[std::hash<T>()(key) % NUMBER_OF_STRIPES];
+    }
 
-    std::size_t getQueueLengthUnlocked() const
+    void updateQueueLengthGauge()
     {
-        return boost::multi_index::get<messagequeuetags::key>(_queue).size();
+        if (_queueLengthGauge) {
+            _queueLengthGauge->set(static_cast<std::int64_t>(getQueueLength()));
+        }
     }
 
-    bool ensureFreeQueueBytes(
+    static bool isInMemory(const MessageQueueItem& item)
+    {
+        return item._isQueued && !item._isSpilled;
+    }
+
+    static bool isSpilled(const MessageQueueItem& item)
+    {
+        return item._isQueued && item._isSpilled;
+    }
+
+    static void pushToExpiryHeap(std::vector<std::shared_ptr<MessageQueueItem>>& heap,
+                                 std::shared_ptr<MessageQueueItem> item,
+                                 std::size_t numberOfItems,
+                                 bool (*isValid)(const MessageQueueItem&))
+    {
+        // stripe mutex must have been acquired earlier
+        heap.push_back(std::move(item));
+        std::push_heap(heap.begin(), heap.end(), expiresLater);
+
+        if (heap.size() > EXPIRY_HEAP_COMPACTION_FACTOR * numberOfItems +
+                                  EXPIRY_HEAP_COMPACTION_SLACK) {
+            // entries of removed messages are dropped
+            auto firstRemoved = std::partition(
+                    heap.begin(),
+                    heap.end(),
+                    [isValid](const std::shared_ptr<MessageQueueItem>& entry) {
+                        return isValid(*entry);
+                    });
+            heap.erase(firstRemoved, heap.end());
+            std::make_heap(heap.begin(), heap.end(), expiresLater);
+        }
+    }
+
+    static std::shared_ptr<MessageQueueItem> popFromExpiryHeap(
+            std::vector<std::shared_ptr<MessageQueueItem>>& heap)
+    {
+        // stripe mutex must have been acquired earlier
+        std::pop_heap(heap.begin(), heap.end(), expiresLater);
+        std::shared_ptr<MessageQueueItem> item = std::move(heap.back());
+        heap.pop_back();
+        return item;
+    }
+
+    std::shared_ptr<ImmutableMessage> removeItem(Stripe& stripe,
+                                                 std::shared_ptr<MessageQueueItem> item,
+                                                 bool restoreSpilledMessage = true)
+    {
+        // stripe mutex must have been acquired earlier. Returns nullptr if the message
+        // was spilled and could not be (or was not to be) restored.
+        assert(item->_isQueued);
+        auto keyQueue = stripe._keyQueues.find(item->_key);
+        assert(keyQueue != stripe._keyQueues.end());
+        keyQueue->second._items.erase(item->_position);
+        keyQueue->second._itemsByExpiry.erase(item->_expiryPosition);
+        if (keyQueue->second._items.empty()) {
+            stripe._keyQueues.erase(keyQueue);
+        }
+        item->_isQueued = false;
+        std::shared_ptr<ImmutableMessage> message;
+        if (item->_isSpilled) {
+            if (restoreSpilledMessage) {
+                message = _spillFile->take(item->_spillRecord);
+            } else {
+                _spillFile->discard(item->_spillRecord);
+            }
+            item->_isSpilled = false;
+            --stripe._spilledQueueLength;
+            --_spilledQueueLength;
+            return message;
+        }
+        message = std::move(item->_message);
+        --stripe._queueLength;
+        --_queueLength;
+        _queueSizeBytes -= message->getMessageSize();
+        return message;
+    }
+
+    bool spillItem(Stripe& stripe, std::shared_ptr<MessageQueueItem> item)
+    {
+        // stripe mutex must have been acquired earlier
+        assert(item->_isQueued && !item->_isSpilled);
+        if (!_spillFile || !_spillFile->append(*item->_message, item->_spillRecord)) {
+            return false;
+        }
+        JOYNR_LOG_DEBUG(logger(),
+                        "Spilled message {} to {} since either generic queue limit of "
+                        "{} messages or {} bytes was reached",
+                        TrackingInfo(*item->_message),
+                        _spillFile->getFileName(),
+                        _messageQueueLimit,
+                        _messageQueueLimitBytes);
+        item->_isSpilled = true;
+        const std::uint64_t messageSize = item->_message->getMessageSize();
+        item->_message.reset();
+        --stripe._queueLength;
+        --_queueLength;
+        _queueSizeBytes -= messageSize;
+        ++stripe._spilledQueueLength;
+        ++_spilledQueueLength;
+        pushToExpiryHeap(stripe._spilledExpiryHeap,
+                         std::move(item),
+                         stripe._spilledQueueLength,
+                         MessageQueue::isSpilled);
+        return true;
+    }
+
+    void ensureFreeQueueBytes(
             const std::uint64_t messageLength,
             std::deque<std::shared_ptr<ImmutableMessage>>& droppedMessagesToBeReplied)
     {
-        // queueMutex must have been acquired earlier
+        // no stripe mutex must be held by the caller
         const bool queueLimitBytesActive = _messageQueueLimitBytes > 0;
         if (!queueLimitBytesActive) {
-            return true;
-        }
-
-        if (messageLength > _messageQueueLimitBytes) {
-            return false;
+            return;
         }
 
-        while (_queueSizeBytes + messageLength > _messageQueueLimitBytes) {
-            removeMessageWithLeastTtl(droppedMessagesToBeReplied);
+        while (_queueSizeBytes.load() + messageLength > _messageQueueLimitBytes) {
+            if (!removeMessageWithLeastTtl(droppedMessagesToBeReplied)) {
+                return;
+            }
         }
-        return true;
     }
 
     void ensureFreeQueueSlot(
-            const T& key,
             std::deque<std::shared_ptr<ImmutableMessage>>& droppedMessagesToBeReplied)
     {
-        // queueMutex must have been acquired earlier
+        // no stripe mutex must be held by the caller
         const bool queueLimitActive = _messageQueueLimit > 0;
         if (!queueLimitActive) {
             return;
         }
 
-        const bool perKeyQueueLimitActive = _perKeyMessageQueueLimit > 0;
-        if (perKeyQueueLimitActive) {
-            ensureFreePerKeyQueueSlot(key, droppedMessagesToBeReplied);
-        }
-
-        while (getQueueLengthUnlocked() >= _messageQueueLimit) {
-            removeMessageWithLeastTtl(droppedMessagesToBeReplied);
+        while (_queueLength.load() >= _messageQueueLimit) {
+            if (!removeMessageWithLeastTtl(droppedMessagesToBeReplied)) {
+                return;
+            }
         }
     }
 
     void ensureFreePerKeyQueueSlot(
+            Stripe& stripe,
             const T& key,
             std::deque<std::shared_ptr<ImmutableMessage>>& droppedMessagesToBeReplied)
     {
-        // queueMutex must have been locked already
+        // stripe mutex must have been locked already
         assert(_perKeyMessageQueueLimit > 0);
 
-        auto& keyAndTtlIndex =
-                boost::multi_index::get<messagequeuetags::key_and_ttlAbsolute>(_queue);
-        auto range = keyAndTtlIndex.equal_range(key);
+        auto keyQueue = stripe._keyQueues.find(key);
         const std::size_t numEntriesForKey =
-                static_cast<std::size_t>(std::distance(range.first, range.second));
+                keyQueue == stripe._keyQueues.end() ? 0 : keyQueue->second._items.size();
 
         JOYNR_LOG_TRACE(logger(),
                         "ensureFreePerKeyQueueSlot: numEntriesForKey = {}, perKeyMessageQueueLimit "
@@ -282,42 +524,67 @@ private:
                         _perKeyMessageQueueLimit);
 
         if (numEntriesForKey >= _perKeyMessageQueueLimit) {
+            auto itemWithLowestTtl = *keyQueue->second._itemsByExpiry.cbegin();
+            auto message = removeItem(stripe, itemWithLowestTtl);
+            if (!message) {
+                return;
+            }
             JOYNR_LOG_WARN(logger(),
                            "Erasing message {} since key based queue limit of "
                            "{} was reached",
-                           range.first->_message->getTrackingInfo(),
+                           TrackingInfo(*message),
                            _perKeyMessageQueueLimit);
-            _queueSizeBytes -= range.first->_message->getMessageSize();
-            droppedMessagesToBeReplied.push_front(range.first->_message);
-            keyAndTtlIndex.erase(range.first);
+            droppedMessagesToBeReplied.push_front(std::move(message));
         }
     }
 
-    void removeMessageWithLeastTtl(
+    bool removeMessageWithLeastTtl(
             std::deque<std::shared_ptr<ImmutableMessage>>& droppedMessagesToBeReplied)
     {
-        // queueMutex must have been locked already
-        if (_queue.empty()) {
-            return;
-        }
+        // no stripe mutex must be held by the caller
+        while (true) {
+            std::shared_ptr<MessageQueueItem> msgWithLowestTtl;
+            Stripe* stripeOfMsgWithLowestTtl = nullptr;
+            for (Stripe& stripe : _stripes) {
+                std::lock_guard<std::mutex> lock(stripe._mutex);
+                while (!stripe._expiryHeap.empty() && !isInMemory(*stripe._expiryHeap.front())) {
+                    // already dequeued or spilled, lazily removed from the heap
+                    popFromExpiryHeap(stripe._expiryHeap);
+                }
+                if (!stripe._expiryHeap.empty() &&
+                    (!msgWithLowestTtl ||
+                     expiresEarlier(stripe._expiryHeap.front(), msgWithLowestTtl))) {
+                    msgWithLowestTtl = stripe._expiryHeap.front();
+                    stripeOfMsgWithLowestTtl = &stripe;
+                }
+            }
+            if (!msgWithLowestTtl) {
+                return false;
+            }
+
+            Stripe& stripe = *stripeOfMsgWithLowestTtl;
+            std::lock_guard<std::mutex> lock(stripe._mutex);
+            if (!isInMemory(*msgWithLowestTtl)) {
+                // dequeued or spilled concurrently
+                continue;
+            }
+            if (spillItem(stripe, msgWithLowestTtl)) {
+                return true;
+            }
 
-        const std::size_t queueLength = getQueueLengthUnlocked();
-        auto& ttlIndex = boost::multi_index::get<messagequeuetags::ttlAbsolute>(_queue);
-        auto msgWithLowestTtl = ttlIndex.cbegin();
-        assert(msgWithLowestTtl != ttlIndex.cend());
-
-        JOYNR_LOG_WARN(logger(),
-                       "Erasing message {} since either generic queue limit of "
-                       "{} messages or {} bytes was reached, #msgs = {}, queueSize(bytes) = {}",
-                       msgWithLowestTtl->_message->getTrackingInfo(),
-                       _messageQueueLimit,
-                       _messageQueueLimitBytes,
-                       queueLength,
-                       _queueSizeBytes);
-
-        _queueSizeBytes -= msgWithLowestTtl->_message->getMessageSize();
-        droppedMessagesToBeReplied.push_front(msgWithLowestTtl->_message);
-        ttlIndex.erase(msgWithLowestTtl);
+            JOYNR_LOG_WARN(logger(),
+                           "Erasing message {} since either generic queue limit of "
+                           "{} messages or {} bytes was reached, #msgs = {}, "
+                           "queueSize(bytes) = {}",
+                           TrackingInfo(*msgWithLowestTtl->_message),
+                           _messageQueueLimit,
+                           _messageQueueLimitBytes,
+                           getQueueLength(),
+                           getQueueSizeBytes());
+
+            droppedMessagesToBeReplied.push_front(removeItem(stripe, msgWithLowestTtl));
+            return true;
+        }
     }
 };
 } // namespace joynr
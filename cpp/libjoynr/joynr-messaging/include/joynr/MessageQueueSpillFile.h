@@ -0,0 +1,132 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef MESSAGEQUEUESPILLFILE_H
+#define MESSAGEQUEUESPILLFILE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+class ImmutableMessage;
+
+/**
+ * @brief Append-only file which holds messages evicted from a MessageQueue
+ * until they can be delivered.
+ *
+ * Every message is written as a record which can be read back exactly once.
+ * The space of consumed records is not reused individually; instead the file is
+ * truncated as soon as all records written so far have been released, and it is
+ * compacted by copying the live records to a new file once the released records
+ * occupy more space than the live ones (or a quarter of the size limit).
+ * Compaction runs on a thread of its own and copies the records without holding
+ * the lock of the file, so append, take and discard do not wait for it; an append
+ * which only fits after the compaction fails until the compaction has finished.
+ * The file only lives as long as the MessageQueueSpillFile object, its content
+ * does not survive a restart of the process.
+ */
+class JOYNR_EXPORT MessageQueueSpillFile
+{
+public:
+    /**
+     * @brief Handle of a spilled message, stays valid when the file is compacted
+     */
+    struct Record {
+        std::uint64_t id = 0;
+    };
+
+    /**
+     * @param fileName name of the file, an existing file will be truncated
+     * @param limitBytes maximum size of the file, 0 means unlimited
+     * @throw JoynrRuntimeException if the file cannot be opened
+     */
+    MessageQueueSpillFile(const std::string& fileName, std::uint64_t limitBytes);
+    ~MessageQueueSpillFile();
+
+    /**
+     * @brief Appends the message including its runtime state (creator,
+     * received from global, access control checked)
+     * @return false if the size limit would be exceeded or writing failed
+     */
+    bool append(const ImmutableMessage& message, Record& record);
+
+    /**
+     * @brief Reads the message of the record and releases the record
+     * @return the message or nullptr if it could not be read
+     */
+    std::shared_ptr<ImmutableMessage> take(const Record& record);
+
+    /**
+     * @brief Releases the record without reading its message
+     */
+    void discard(const Record& record);
+
+    std::uint64_t getSizeBytes() const;
+    std::size_t getNumberOfRecords() const;
+    const std::string& getFileName() const;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(MessageQueueSpillFile);
+    ADD_LOGGER(MessageQueueSpillFile)
+
+    struct Location {
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+
+    void open(std::ios::openmode mode);
+    void release(std::uint64_t id);
+    bool isCompactionWanted() const;
+    void requestCompaction();
+    void runCompactions();
+    bool compact(std::unique_lock<std::mutex>& lock);
+
+    const std::string _fileName;
+    const std::uint64_t _limitBytes;
+    mutable std::mutex _mutex;
+    std::fstream _file;
+    std::uint64_t _writeOffset;
+    // sum of the sizes of the live records, the rest up to _writeOffset is released space
+    std::uint64_t _liveBytes;
+    std::uint64_t _nextRecordId;
+    std::unordered_map<std::uint64_t, Location> _records;
+    // incremented whenever the file is truncated or replaced, a compaction which
+    // copied records of an older generation is discarded
+    std::uint64_t _fileGeneration;
+    bool _isCompactionRequested;
+    bool _isShuttingDown;
+    std::condition_variable _compactionRequested;
+    std::thread _compactionThread;
+};
+
+} // namespace joynr
+
+#endif // MESSAGEQUEUESPILLFILE_H
@@ -95,6 +95,17 @@ public:
                      const Request& request,
                      std::shared_ptr<IReplyCaller> callback,
                      bool isLocalMessage) override;
+
+    bool sendInProcessRequest(const std::string& senderParticipantId,
+                              const std::string& receiverParticipantId,
+                              const MessagingQos& qos,
+                              Request& request,
+                              std::shared_ptr<IReplyCaller> callback) override;
+
+    bool sendInProcessOneWayRequest(const std::string& senderParticipantId,
+                                    const std::string& receiverParticipantId,
+                                    const MessagingQos& qos,
+                                    OneWayRequest& request) override;
     /*
      * Prepares and sends a single message
      */
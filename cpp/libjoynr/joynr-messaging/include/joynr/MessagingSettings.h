@@ -68,6 +68,13 @@ public:
 
     static const std::string& SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS();
 
+    static const std::string& SETTING_METRICS_DUMP_FILENAME();
+    static const std::string& SETTING_METRICS_DUMP_INTERVAL_MS();
+    static const std::string& SETTING_MESSAGE_TRACE_FILENAME();
+    static const std::string& SETTING_MESSAGE_TRACE_FORMAT();
+    static const std::string& SETTING_MESSAGE_TRACE_BUFFER_SIZE();
+    static const std::string& SETTING_IN_PROCESS_DIRECT_DISPATCH();
+
     /**
      * @brief SETTING_MAXIMUM_TTL_MS The key used in settings to identifiy the maximum allowed value
      * of the time-to-live joynr message header.
@@ -87,6 +94,12 @@ public:
     static std::int64_t DEFAULT_ROUTING_TABLE_CLEANUP_INTERVAL_MS();
     static std::uint64_t DEFAULT_TTL_UPLIFT_MS();
     static bool DEFAULT_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS();
+    static const std::string& DEFAULT_METRICS_DUMP_FILENAME();
+    static std::int64_t DEFAULT_METRICS_DUMP_INTERVAL_MS();
+    static const std::string& DEFAULT_MESSAGE_TRACE_FILENAME();
+    static const std::string& DEFAULT_MESSAGE_TRACE_FORMAT();
+    static std::uint64_t DEFAULT_MESSAGE_TRACE_BUFFER_SIZE();
+    static bool DEFAULT_IN_PROCESS_DIRECT_DISPATCH();
 
     /**
      * @brief DEFAULT_MAXIMUM_TTL_MS
@@ -166,6 +179,40 @@ public:
     void setDiscardUnroutableRepliesAndPublications(
             const bool& discardUnroutableRepliesAndPublications);
 
+    /**
+     * @brief getMetricsDumpFilename Get the name of the file the runtime metrics are
+     * periodically written to as JSON.
+     *
+     * @return the file name, an empty string if the periodic metrics dump is disabled.
+     */
+    std::string getMetricsDumpFilename() const;
+    void setMetricsDumpFilename(const std::string& metricsDumpFilename);
+    std::int64_t getMetricsDumpIntervalMs() const;
+    void setMetricsDumpIntervalMs(std::int64_t metricsDumpIntervalMs);
+
+    /**
+     * @brief getMessageTraceFilename Get the name of the file the message lifecycle trace
+     * is written to on shutdown.
+     *
+     * @return the file name, an empty string if message tracing is disabled.
+     */
+    std::string getMessageTraceFilename() const;
+    void setMessageTraceFilename(const std::string& messageTraceFilename);
+    /**
+     * @return the format of the message trace file, either "chrome" or "binary"
+     */
+    std::string getMessageTraceFormat() const;
+    void setMessageTraceFormat(const std::string& messageTraceFormat);
+    std::uint64_t getMessageTraceBufferSize() const;
+    void setMessageTraceBufferSize(std::uint64_t messageTraceBufferSize);
+
+    /**
+     * @brief getInProcessDirectDispatch Whether requests to providers registered in the same
+     * runtime are handed to the dispatcher as typed objects instead of serialized messages.
+     */
+    bool getInProcessDirectDispatch() const;
+    void setInProcessDirectDispatch(const bool& enable);
+
     bool contains(const std::string& key) const;
 
     bool settingsContainMultipleBackendsConfiguration() const;
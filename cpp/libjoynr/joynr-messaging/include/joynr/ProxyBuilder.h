@@ -66,6 +66,7 @@ class ProxyBuilder : public IProxyBuilder<T>, public std::enable_shared_from_thi
 public:
     /**
      * @brief Constructor
+     * @param ioService The io_service used to schedule arbitration retries
      * @param proxyFactory Pointer to proxy factory object
      * @param discoveryProxy weak ptr to IDiscoverySync object
      * @param domain The provider domain
@@ -74,6 +75,7 @@ public:
      * @param messagingSettings Reference to the messaging settings object
      */
     ProxyBuilder(std::weak_ptr<JoynrRuntimeImpl> _runtime,
+                 boost::asio::io_service& ioService,
                  ProxyFactory& _proxyFactory,
                  std::weak_ptr<joynr::system::IDiscoveryAsync> _discoveryProxy,
                  const std::string& _domain,
@@ -177,6 +179,7 @@ private:
     DISALLOW_COPY_AND_ASSIGN(ProxyBuilder);
 
     std::weak_ptr<JoynrRuntimeImpl> _runtime;
+    boost::asio::io_service& _ioService;
     ProxyFactory& _proxyFactory;
     std::weak_ptr<joynr::system::IDiscoveryAsync> _discoveryProxy;
     std::uint32_t _arbitratorId;
@@ -208,6 +211,7 @@ private:
 template <class T>
 ProxyBuilder<T>::ProxyBuilder(
         std::weak_ptr<JoynrRuntimeImpl> runtime,
+        boost::asio::io_service& ioService,
         ProxyFactory& proxyFactory,
         std::weak_ptr<system::IDiscoveryAsync> discoveryProxy,
         const std::string& domain,
@@ -215,6 +219,7 @@ ProxyBuilder<T>::ProxyBuilder(
         std::shared_ptr<IMessageRouter> messageRouter,
         MessagingSettings& messagingSettings)
         : _runtime(std::move(runtime)),
+          _ioService(ioService),
           _proxyFactory(proxyFactory),
           _discoveryProxy(discoveryProxy),
           _arbitratorId(0),
@@ -365,8 +370,13 @@ void ProxyBuilder<T>::buildAsync(
                         currentArbitratorId);
     };
 
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, T::INTERFACE_NAME(), interfaceVersion, _discoveryProxy, _discoveryQos, _gbids);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_ioService,
+                                                          _domain,
+                                                          T::INTERFACE_NAME(),
+                                                          interfaceVersion,
+                                                          _discoveryProxy,
+                                                          _discoveryQos,
+                                                          _gbids);
     arbitrator->startArbitration(std::move(arbitrationSucceeds), std::move(arbitrationFails));
     _arbitrators[currentArbitratorId] = std::move(arbitrator);
     JOYNR_LOG_TRACE(logger(),
@@ -399,9 +409,8 @@ void ProxyBuilder<T>::reapFinishedArbitrators()
 
         auto arbitrator = _arbitrators.at(id);
 
-        // attempt to stop arbitrator; this could theoretically fail if the stop is attempted from
-        // within the arbitrator thread since a thread cannot join itself. In that case we would
-        // receive an execption; the arbitrator is then not erased and put back into queue for later
+        // stop the finished arbitrator; this only cancels its timers and does not block. Should
+        // it nevertheless throw, the arbitrator is not erased and put back into queue for later
         // handling. It is unclear whether this case can ever occur, so code is just here for
         // safety.
         try {
@@ -0,0 +1,103 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef TRACKINGINFO_H
+#define TRACKINGINFO_H
+
+#include <string>
+#include <unordered_map>
+
+#include <spdlog/fmt/fmt.h>
+
+#include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
+
+namespace joynr
+{
+
+/**
+ * @brief Lightweight view which formats the tracking info of a message only when
+ * it is actually written.
+ *
+ * Pass it as log argument instead of ImmutableMessage::getTrackingInfo(), e.g.
+ * JOYNR_LOG_DEBUG(logger(), "routing message {}", TrackingInfo(*message));
+ * If the log level is disabled, no string is built at all. Otherwise the fields
+ * are written directly into the log buffer without intermediate concatenations.
+ *
+ * The referenced message must outlive the TrackingInfo object, i.e. do not store
+ * it or capture it in asynchronous callbacks.
+ */
+class TrackingInfo
+{
+public:
+    explicit TrackingInfo(const ImmutableMessage& message) : _message(message)
+    {
+    }
+
+    const ImmutableMessage& getMessage() const
+    {
+        return _message;
+    }
+
+private:
+    const ImmutableMessage& _message;
+};
+
+} // namespace joynr
+
+namespace fmt
+{
+
+template <>
+struct formatter<joynr::TrackingInfo> {
+    template <typename ParseContext>
+    constexpr auto parse(ParseContext& ctx) -> decltype(ctx.begin())
+    {
+        return ctx.begin();
+    }
+
+    template <typename FormatContext>
+    auto format(const joynr::TrackingInfo& trackingInfo, FormatContext& ctx) const
+            -> decltype(ctx.out())
+    {
+        static const std::string requestReplyIdKey =
+                joynr::Message::CUSTOM_HEADER_PREFIX() +
+                joynr::Message::CUSTOM_HEADER_REQUEST_REPLY_ID();
+
+        const joynr::ImmutableMessage& message = trackingInfo.getMessage();
+        auto out = format_to(ctx.out(),
+                             "messageId: {}, type: {}, sender: {}, recipient: {}",
+                             message.getId(),
+                             message.getType(),
+                             message.getSender(),
+                             message.getRecipient());
+        const auto& headers = message.getHeaders();
+        auto requestReplyId = headers.find(requestReplyIdKey);
+        if (requestReplyId != headers.cend()) {
+            out = format_to(out, ", requestReplyId: {}", requestReplyId->second);
+        }
+        return format_to(out,
+                         ", expiryDate: {}, size: {}",
+                         message.getExpiryDate().toMilliseconds(),
+                         message.getMessageSize());
+    }
+};
+
+} // namespace fmt
+
+#endif // TRACKINGINFO_H
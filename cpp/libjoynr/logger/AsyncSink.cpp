@@ -0,0 +1,309 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/AsyncSink.h"
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/pattern_formatter.h>
+
+namespace joynr
+{
+
+namespace
+{
+
+std::size_t roundUpToPowerOfTwo(std::size_t value)
+{
+    std::size_t capacity = 2;
+    while (capacity < value) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+} // namespace
+
+constexpr std::uint64_t AsyncSink::SAMPLE_RATE;
+
+AsyncSink::AsyncSink(std::vector<spdlog::sink_ptr> sinks,
+                     std::size_t queueSize,
+                     OverflowPolicy overflowPolicy)
+        : _sinks(std::move(sinks)),
+          _overflowPolicy(overflowPolicy),
+          _mask(roundUpToPowerOfTwo(queueSize) - 1),
+          _cells(new Cell[_mask + 1]),
+          _enqueuePos(0),
+          _dequeuePos(0),
+          _numberOfSampledMessages(0),
+          _numberOfDroppedMessages(0),
+          _numberOfReportedDroppedMessages(0),
+          _isConsumerSleeping(false),
+          _mutex(),
+          _consumerCondition(),
+          _flushCondition(),
+          _pendingFormatter(),
+          _requestedFlushes(0),
+          _completedFlushes(0),
+          _isStopped(false),
+          _consumerThread()
+{
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    _consumerThread = std::thread(&AsyncSink::run, this);
+}
+
+AsyncSink::~AsyncSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopped = true;
+    }
+    _consumerCondition.notify_one();
+    _consumerThread.join();
+}
+
+void AsyncSink::log(const spdlog::details::log_msg& msg)
+{
+    if (!isAccepted(msg.level)) {
+        _numberOfDroppedMessages.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    while (!tryEnqueue(msg)) {
+        if (msg.level < spdlog::level::err && _overflowPolicy != OverflowPolicy::Block) {
+            _numberOfDroppedMessages.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        wakeUpConsumer();
+        std::this_thread::yield();
+    }
+    wakeUpConsumer();
+}
+
+void AsyncSink::flush()
+{
+    const std::size_t target = _enqueuePos.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (std::this_thread::get_id() == _consumerThread.get_id()) {
+        return;
+    }
+    // a message which was claimed but not yet written by its producer might not have been
+    // consumed when the flush was performed, hence repeat until the target has been reached
+    do {
+        const std::uint64_t flushId = ++_requestedFlushes;
+        _consumerCondition.notify_one();
+        _flushCondition.wait(
+                lock, [this, flushId]() { return _isStopped || _completedFlushes >= flushId; });
+    } while (!_isStopped && _dequeuePos.load(std::memory_order_acquire) < target);
+}
+
+void AsyncSink::set_pattern(const std::string& pattern)
+{
+    set_formatter(std::unique_ptr<spdlog::formatter>(new spdlog::pattern_formatter(pattern)));
+}
+
+void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingFormatter = std::move(sinkFormatter);
+    }
+    _consumerCondition.notify_one();
+}
+
+std::size_t AsyncSink::getCapacity() const
+{
+    return _mask + 1;
+}
+
+std::uint64_t AsyncSink::getNumberOfDroppedMessages() const
+{
+    return _numberOfDroppedMessages.load(std::memory_order_relaxed);
+}
+
+bool AsyncSink::isAccepted(spdlog::level::level_enum level)
+{
+    if (_overflowPolicy != OverflowPolicy::Sample || level >= spdlog::level::warn) {
+        return true;
+    }
+    const std::size_t size = _enqueuePos.load(std::memory_order_relaxed) -
+                             _dequeuePos.load(std::memory_order_relaxed);
+    if (size <= getCapacity() / 2) {
+        return true;
+    }
+    return _numberOfSampledMessages.fetch_add(1, std::memory_order_relaxed) % SAMPLE_RATE == 0;
+}
+
+bool AsyncSink::tryEnqueue(const spdlog::details::log_msg& msg)
+{
+    // bounded MPMC queue as described by Dmitry Vyukov: the sequence of a cell tells
+    // whether it is free for the producer claiming position pos (sequence == pos) or
+    // ready for the consumer (sequence == pos + 1)
+    Cell* cell = nullptr;
+    std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        cell = &_cells[pos & _mask];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    // assign() reuses the capacity of the strings from previous rounds
+    cell->loggerName.assign(msg.logger_name.data(), msg.logger_name.size());
+    cell->level = msg.level;
+    cell->time = msg.time;
+    cell->threadId = msg.thread_id;
+    cell->payload.assign(msg.payload.data(), msg.payload.size());
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+void AsyncSink::wakeUpConsumer()
+{
+    // pairs with the fence in run() so that either the consumer sees the new message
+    // or the producer sees the consumer sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_isConsumerSleeping.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _consumerCondition.notify_one();
+    }
+}
+
+bool AsyncSink::isMessageAvailable() const
+{
+    const std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+    return _cells[pos & _mask].sequence.load(std::memory_order_acquire) == pos + 1;
+}
+
+std::size_t AsyncSink::drain()
+{
+    std::size_t numberOfMessages = 0;
+    std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = _cells[pos & _mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+        spdlog::details::log_msg msg(spdlog::source_loc{},
+                                     spdlog::string_view_t(cell.loggerName),
+                                     cell.level,
+                                     spdlog::string_view_t(cell.payload));
+        msg.time = cell.time;
+        msg.thread_id = cell.threadId;
+        writeToSinks(msg);
+
+        cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+        ++pos;
+        _dequeuePos.store(pos, std::memory_order_release);
+        ++numberOfMessages;
+    }
+    reportDroppedMessages();
+    return numberOfMessages;
+}
+
+bool AsyncSink::hasPendingRequests() const
+{
+    return _pendingFormatter || _completedFlushes < _requestedFlushes;
+}
+
+void AsyncSink::handlePendingRequests()
+{
+    if (_pendingFormatter) {
+        for (const auto& sink : _sinks) {
+            sink->set_formatter(_pendingFormatter->clone());
+        }
+        _pendingFormatter.reset();
+    }
+    if (_completedFlushes < _requestedFlushes) {
+        for (const auto& sink : _sinks) {
+            sink->flush();
+        }
+        _completedFlushes = _requestedFlushes;
+        _flushCondition.notify_all();
+    }
+}
+
+void AsyncSink::run()
+{
+    for (;;) {
+        const std::size_t numberOfMessages = drain();
+        std::unique_lock<std::mutex> lock(_mutex);
+        handlePendingRequests();
+        if (numberOfMessages > 0) {
+            continue;
+        }
+        if (_isStopped) {
+            if (isMessageAvailable()) {
+                continue;
+            }
+            break;
+        }
+
+        _isConsumerSleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // the timeout only guards against producers which are preempted between
+        // claiming and writing a cell; they do not notify again
+        _consumerCondition.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+            return _isStopped || hasPendingRequests() || isMessageAvailable();
+        });
+        _isConsumerSleeping.store(false, std::memory_order_relaxed);
+    }
+    for (const auto& sink : _sinks) {
+        sink->flush();
+    }
+    _flushCondition.notify_all();
+}
+
+void AsyncSink::reportDroppedMessages()
+{
+    const std::uint64_t numberOfDroppedMessages =
+            _numberOfDroppedMessages.load(std::memory_order_relaxed);
+    if (numberOfDroppedMessages == _numberOfReportedDroppedMessages) {
+        return;
+    }
+    const std::string payload =
+            fmt::format("{} log messages dropped because the log queue was full",
+                        numberOfDroppedMessages - _numberOfReportedDroppedMessages);
+    spdlog::details::log_msg msg(
+            spdlog::source_loc{}, "AsyncSink", spdlog::level::warn, spdlog::string_view_t(payload));
+    writeToSinks(msg);
+    _numberOfReportedDroppedMessages = numberOfDroppedMessages;
+}
+
+void AsyncSink::writeToSinks(const spdlog::details::log_msg& msg)
+{
+    for (const auto& sink : _sinks) {
+        if (sink->should_log(msg.level)) {
+            sink->log(msg);
+        }
+    }
+}
+
+} // namespace joynr
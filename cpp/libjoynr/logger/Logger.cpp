@@ -20,8 +20,72 @@
 
 #include <array>
 #include <cstdlib>
+#include <stdexcept>
 #include <tuple>
 
+#include "joynr/AsyncSink.h"
+
+namespace
+{
+
+std::vector<spdlog::sink_ptr> createSynchronousSinks()
+{
+    std::vector<spdlog::sink_ptr> sinks;
+
+#ifdef JOYNR_ENABLE_STDOUT_LOGGING
+    auto sink1 = std::make_shared<spdlog::sinks::stdout_sink_mt>();
+    sink1->set_level(spdlog::level::trace);
+    sinks.push_back(sink1);
+#endif // JOYNR_ENABLE_STDOUT_LOGGING
+
+#ifdef JOYNR_ENABLE_DLT_LOGGING
+    auto sink2 = std::make_shared<joynr::DltSink>();
+    sink2->set_level(spdlog::level::trace);
+    sinks.push_back(sink2);
+#endif // JOYNR_ENABLE_DLT_LOGGING
+
+    return sinks;
+}
+
+struct AsyncSinkInitializer {
+    AsyncSinkInitializer() : asyncSink()
+    {
+        const char* queueSizeEnv = std::getenv("JOYNR_LOG_ASYNC_QUEUE_SIZE");
+        if (queueSizeEnv == nullptr) {
+            return;
+        }
+        std::size_t queueSize = 0;
+        try {
+            queueSize = std::stoul(std::string(queueSizeEnv, strnlen(queueSizeEnv, 20UL)));
+        } catch (const std::logic_error&) {
+            return;
+        }
+        if (queueSize == 0) {
+            return;
+        }
+
+        joynr::AsyncSink::OverflowPolicy overflowPolicy = joynr::AsyncSink::OverflowPolicy::Drop;
+        const char* overflowPolicyEnv = std::getenv("JOYNR_LOG_ASYNC_OVERFLOW_POLICY");
+        if (overflowPolicyEnv != nullptr) {
+            const std::string overflowPolicyName(
+                    overflowPolicyEnv, strnlen(overflowPolicyEnv, 10UL));
+            if (overflowPolicyName == "BLOCK") {
+                overflowPolicy = joynr::AsyncSink::OverflowPolicy::Block;
+            } else if (overflowPolicyName == "SAMPLE") {
+                overflowPolicy = joynr::AsyncSink::OverflowPolicy::Sample;
+            }
+        }
+
+        asyncSink = std::make_shared<joynr::AsyncSink>(
+                createSynchronousSinks(), queueSize, overflowPolicy);
+        asyncSink->set_level(spdlog::level::trace);
+    }
+
+    std::shared_ptr<joynr::AsyncSink> asyncSink;
+};
+
+} // namespace
+
 joynr::LogLevelInitializer::LogLevelInitializer()
 {
     const std::array<std::tuple<std::string, spdlog::level::level_enum, joynr::LogLevel>, 6>
@@ -64,3 +128,12 @@ joynr::LogLevelInitializer::LogLevelInitializer()
         }
     }
 }
+
+std::vector<spdlog::sink_ptr> joynr::Logger::createSinks()
+{
+    static AsyncSinkInitializer asyncSinkInitializer;
+    if (asyncSinkInitializer.asyncSink) {
+        return {asyncSinkInitializer.asyncSink};
+    }
+    return createSynchronousSinks();
+}
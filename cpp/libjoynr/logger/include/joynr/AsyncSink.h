@@ -0,0 +1,140 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef ASYNCSINK_H
+#define ASYNCSINK_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <spdlog/sinks/sink.h>
+
+namespace joynr
+{
+
+/**
+ * @brief spdlog sink which moves formatting and I/O of log messages to a background thread.
+ *
+ * Log messages are copied into a bounded lock-free ring buffer by the logging threads and
+ * written to the wrapped (synchronous) sinks by a single consumer thread. The wrapped sinks
+ * are only accessed by the consumer thread, including pattern changes and flushes.
+ *
+ * The OverflowPolicy decides what happens if the ring buffer is full. Messages of level
+ * error and above are never dropped, the logging thread waits for free space instead.
+ */
+class AsyncSink : public spdlog::sinks::sink
+{
+public:
+    enum class OverflowPolicy {
+        // discard the message
+        Drop,
+        // wait until the consumer thread frees space
+        Block,
+        // once the buffer is more than half full, only keep every SAMPLE_RATEth message
+        // below level warn, drop all of them if the buffer is full
+        Sample
+    };
+
+    static constexpr std::uint64_t SAMPLE_RATE = 16;
+
+    AsyncSink(std::vector<spdlog::sink_ptr> sinks,
+              std::size_t queueSize,
+              OverflowPolicy overflowPolicy);
+    ~AsyncSink() override;
+
+    void log(const spdlog::details::log_msg& msg) override;
+
+    /**
+     * @brief Waits until all messages logged before the call have been written
+     * and flushes the wrapped sinks.
+     */
+    void flush() override;
+    void set_pattern(const std::string& pattern) override;
+    void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+    std::size_t getCapacity() const;
+    std::uint64_t getNumberOfDroppedMessages() const;
+
+private:
+    AsyncSink(const AsyncSink&) = delete;
+    AsyncSink& operator=(const AsyncSink&) = delete;
+
+    struct Cell {
+        Cell()
+                : sequence(0),
+                  loggerName(),
+                  level(spdlog::level::trace),
+                  time(),
+                  threadId(0),
+                  payload()
+        {
+        }
+
+        std::atomic<std::size_t> sequence;
+        std::string loggerName;
+        spdlog::level::level_enum level;
+        spdlog::log_clock::time_point time;
+        std::size_t threadId;
+        std::string payload;
+    };
+
+    bool isAccepted(spdlog::level::level_enum level);
+    bool tryEnqueue(const spdlog::details::log_msg& msg);
+    void wakeUpConsumer();
+    bool isMessageAvailable() const;
+    std::size_t drain();
+    bool hasPendingRequests() const;
+    void handlePendingRequests();
+    void run();
+    void reportDroppedMessages();
+    void writeToSinks(const spdlog::details::log_msg& msg);
+
+    const std::vector<spdlog::sink_ptr> _sinks;
+    const OverflowPolicy _overflowPolicy;
+    const std::size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+
+    alignas(64) std::atomic<std::size_t> _enqueuePos;
+    alignas(64) std::atomic<std::size_t> _dequeuePos;
+    alignas(64) std::atomic<std::uint64_t> _numberOfSampledMessages;
+    std::atomic<std::uint64_t> _numberOfDroppedMessages;
+    std::uint64_t _numberOfReportedDroppedMessages;
+
+    std::atomic<bool> _isConsumerSleeping;
+    std::mutex _mutex;
+    std::condition_variable _consumerCondition;
+    std::condition_variable _flushCondition;
+    std::unique_ptr<spdlog::formatter> _pendingFormatter;
+    std::uint64_t _requestedFlushes;
+    std::uint64_t _completedFlushes;
+    bool _isStopped;
+    std::thread _consumerThread;
+};
+
+} // namespace joynr
+
+#endif // ASYNCSINK_H
@@ -151,19 +151,7 @@ struct Logger {
         static LogLevelInitializer logLevelInitializer;
         level = logLevelInitializer.level;
         spdlogLevel = logLevelInitializer.spdlogLevel;
-        std::vector<spdlog::sink_ptr> sinks;
-
-#ifdef JOYNR_ENABLE_STDOUT_LOGGING
-        auto sink1 = std::make_shared<spdlog::sinks::stdout_sink_mt>();
-        sink1->set_level(spdlog::level::trace);
-        sinks.push_back(sink1);
-#endif // JOYNR_ENABLE_STDOUT_LOGGING
-
-#ifdef JOYNR_ENABLE_DLT_LOGGING
-        auto sink2 = std::make_shared<joynr::DltSink>();
-        sink2->set_level(spdlog::level::trace);
-        sinks.push_back(sink2);
-#endif // JOYNR_ENABLE_DLT_LOGGING
+        std::vector<spdlog::sink_ptr> sinks = createSinks();
 
         spdlog = std::make_shared<spdlog::logger>(prefix, begin(sinks), end(sinks));
         spdlog->set_pattern(
@@ -171,6 +159,16 @@ struct Logger {
         spdlog->set_level(spdlogLevel);
     }
 
+    /**
+     * @brief Creates the sinks of a new logger.
+     *
+     * If JOYNR_LOG_ASYNC_QUEUE_SIZE is set to a positive value, all loggers share a single
+     * AsyncSink with a ring buffer of (at least) that many messages. Its overflow policy is
+     * taken from JOYNR_LOG_ASYNC_OVERFLOW_POLICY (DROP, BLOCK or SAMPLE, default DROP).
+     * Otherwise every logger writes synchronously to its own sinks.
+     */
+    static std::vector<spdlog::sink_ptr> createSinks();
+
     template <typename Parent>
     static std::string getPrefix()
     {
@@ -28,6 +28,7 @@
 
 #include "UdsFrameBufferV1.h"
 #include "UdsSendQueue.h"
+#include "UdsSharedMemoryRingBuffer.h"
 
 namespace joynr
 {
@@ -42,11 +43,21 @@ UdsClient::UdsClient(
           _connectedCallback{[]() {}},
           _disconnectedCallback{[]() {}},
           _receivedCallback{[](smrf::ByteVector&&) {}},
+          _backpressureCallback{[](bool) {}},
           _address{settings.createClientMessagingAddress()},
           _connectSleepTime{settings.getConnectSleepTimeMs()},
-          _sendQueue(
-                  std::make_unique<UdsSendQueue<UdsFrameBufferV1>>(settings.getSendingQueueSize())),
+          _sendQueue(std::make_unique<UdsSendQueue<UdsFrameBufferV1>>(
+                  settings.getSendingQueueSize(),
+                  [this](bool isPaused) { _backpressureCallback(isPaused); })),
           _readBuffer(std::make_unique<UdsFrameBufferV1>()),
+          _sharedMemorySize(settings.getSharedMemorySize()),
+          _sharedMemoryWriter(),
+          _sharedMemoryUnreadMessages(),
+          _isSharedMemorySignalPosted(false),
+          _socketMessagesInFlight(0),
+          _socketMessagesQueued(0),
+          _sharedMemoryWriterMutex(),
+          _sharedMemoryReader(),
           _endpoint(settings.getSocketPath()),
           _ioContext(_threadsPerConnection),
           _socket(_ioContext),
@@ -56,7 +67,9 @@ UdsClient::UdsClient(
           _worker()
 {
     try {
-        _sendQueue->pushBack(UdsFrameBufferV1(_address));
+        _sendQueue->pushBack(UdsFrameBufferV1(_address, _sharedMemorySize > 0),
+                             nullptr,
+                             IUdsSender::Priority::HIGH);
     } catch (const std::exception& e) {
         doHandleFatalError("Failed to insert INIT message to queue.", e);
     }
@@ -93,6 +106,13 @@ void UdsClient::setReceiveCallback(const Received& callback)
     }
 }
 
+void UdsClient::setBackpressureCallback(const Backpressure& callback)
+{
+    if (callback) {
+        _backpressureCallback = callback;
+    }
+}
+
 void UdsClient::start()
 {
     if (_worker.valid()) {
@@ -169,6 +189,7 @@ void UdsClient::run()
     if (State::CONNECTED == _state.load()) {
         doHandleFatalError("State machine stopped unexpectedly");
     }
+    doNotifyUnreadSharedMemoryMessages("Connection closed.");
     try {
         _disconnectedCallback();
     } catch (const std::exception& e) {
@@ -230,7 +251,16 @@ void UdsClient::doReadBody() noexcept
                                         readFailure.message());
                     } else {
                         try {
-                            _receivedCallback(_readBuffer->readMessage());
+                            if (_readBuffer->isSharedMemorySignal()) {
+                                doReadSharedMemory(_readBuffer->readSharedMemorySignal());
+                            } else if (_readBuffer->isSharedMemoryInit()) {
+                                _sharedMemoryReader = UdsSharedMemoryRingBuffer::open(
+                                        _readBuffer->readSharedMemoryInit());
+                                // the server supports shared memory, answer with our own
+                                doCreateSharedMemoryWriter();
+                            } else {
+                                _receivedCallback(_readBuffer->readMessage());
+                            }
                             doReadHeader();
                         } catch (const std::exception& e) {
                             doHandleFatalError("Failed to process message-frame", e);
@@ -242,12 +272,18 @@ void UdsClient::doReadBody() noexcept
     }
 }
 
-void UdsClient::send(const smrf::ByteArrayView& msg, const IUdsSender::SendFailed& callback)
+void UdsClient::send(const smrf::ByteArrayView& msg,
+                     const IUdsSender::SendFailed& callback,
+                     IUdsSender::Priority priority)
 {
+    if (sendViaSharedMemory(msg, callback)) {
+        return;
+    }
     try {
-        _ioContext.post([this, frame = UdsFrameBufferV1(msg), callback]() mutable {
+        _ioContext.post([this, frame = UdsFrameBufferV1(msg), callback, priority]() mutable {
             try {
-                if (_sendQueue->pushBack(std::move(frame), callback)) {
+                _socketMessagesQueued++;
+                if (_sendQueue->pushBack(std::move(frame), callback, priority)) {
                     doWrite();
                 }
             } catch (const std::exception& e) {
@@ -267,10 +303,160 @@ void UdsClient::doWrite() noexcept
                              [this](boost::system::error_code writeFailed, std::size_t /*length*/) {
                                  if (_sendQueue->popFrontOnSuccess(writeFailed)) {
                                      doWrite();
+                                 } else if (!writeFailed) {
+                                     doReleaseSocketMessages();
                                  }
                              });
 }
 
+void UdsClient::doReleaseSocketMessages() noexcept
+{
+    // All queued messages have been written to the socket, following messages cannot overtake
+    // them via shared memory anymore
+    std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+    _socketMessagesInFlight -= _socketMessagesQueued;
+    _socketMessagesQueued = 0;
+}
+
+void UdsClient::doCreateSharedMemoryWriter() noexcept
+{
+    if (_sharedMemorySize == 0 || _sharedMemoryWriter) {
+        return;
+    }
+    try {
+        auto sharedMemoryWriter = UdsSharedMemoryRingBuffer::create(_sharedMemorySize);
+        const bool isWriteRequired = _sendQueue->pushBack(
+                UdsFrameBufferV1::createSharedMemoryInit(sharedMemoryWriter->getName()),
+                nullptr,
+                IUdsSender::Priority::HIGH);
+        {
+            // Messages can be written to the shared memory as soon as it has been announced;
+            // publish the writer before the announcement reaches the server
+            std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+            _sharedMemoryWriter = std::move(sharedMemoryWriter);
+        }
+        if (isWriteRequired) {
+            doWrite();
+        }
+    } catch (const std::exception& e) {
+        JOYNR_LOG_WARN(logger(),
+                       "{} cannot use shared memory, sending all messages via socket: {}",
+                       _address.getId(),
+                       e.what());
+    }
+}
+
+bool UdsClient::sendViaSharedMemory(const smrf::ByteArrayView& msg,
+                                    const IUdsSender::SendFailed& callback)
+{
+    bool isSignalRequired = false;
+    {
+        std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+        // Stay on the socket until the messages sent via socket have been written, otherwise
+        // the signal frame would overtake them
+        if (_socketMessagesInFlight > 0 || !_sharedMemoryWriter ||
+            !_sharedMemoryWriter->tryWrite(msg)) {
+            // Shared memory not negotiated, message too large or ring buffer full, fall back to
+            // socket
+            _socketMessagesInFlight++;
+            return false;
+        }
+        const std::uint64_t readPosition = _sharedMemoryWriter->getReadPosition();
+        while (!_sharedMemoryUnreadMessages.empty() &&
+               _sharedMemoryUnreadMessages.front().first <= readPosition) {
+            _sharedMemoryUnreadMessages.pop_front();
+        }
+        if (callback) {
+            _sharedMemoryUnreadMessages.emplace_back(
+                    _sharedMemoryWriter->getWritePosition(), callback);
+        }
+        // One signal covers all messages written until it is queued
+        isSignalRequired = !_isSharedMemorySignalPosted;
+        _isSharedMemorySignalPosted = true;
+    }
+    if (isSignalRequired) {
+        _ioContext.post([this]() { doSignalSharedMemory(); });
+    }
+    return true;
+}
+
+void UdsClient::doSignalSharedMemory() noexcept
+{
+    std::uint64_t writePosition;
+    {
+        std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+        _isSharedMemorySignalPosted = false;
+        if (!_sharedMemoryWriter) {
+            return;
+        }
+        writePosition = _sharedMemoryWriter->getWritePosition();
+    }
+    try {
+        auto onSignalFailed = [this](const exceptions::JoynrRuntimeException&) {
+            // The messages remain in the shared memory, the server has to be signaled again
+            const State state = _state.load();
+            if (State::START == state || State::CONNECTED == state) {
+                _ioContext.post([this]() { doSignalSharedMemory(); });
+            }
+        };
+        // Queued in front of messages sent via socket afterwards, which must not overtake the
+        // messages in the shared memory
+        if (_sendQueue->pushBack(UdsFrameBufferV1::createSharedMemorySignal(writePosition),
+                                 onSignalFailed,
+                                 IUdsSender::Priority::HIGH)) {
+            doWrite();
+        }
+    } catch (const std::exception& e) {
+        doHandleFatalError("Failed to queue shared memory signal", e);
+    }
+}
+
+void UdsClient::doNotifyUnreadSharedMemoryMessages(const std::string& errorMessage) noexcept
+{
+    std::deque<std::pair<std::uint64_t, IUdsSender::SendFailed>> unreadMessages;
+    {
+        std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+        if (!_sharedMemoryWriter) {
+            return;
+        }
+        const std::uint64_t readPosition = _sharedMemoryWriter->getReadPosition();
+        for (auto& unreadMessage : _sharedMemoryUnreadMessages) {
+            if (unreadMessage.first > readPosition) {
+                unreadMessages.push_back(std::move(unreadMessage));
+            }
+        }
+        _sharedMemoryUnreadMessages.clear();
+        // Messages sent afterwards fall back to the socket queue
+        _sharedMemoryWriter.reset();
+    }
+    const joynr::exceptions::JoynrDelayMessageException error(errorMessage);
+    for (const auto& unreadMessage : unreadMessages) {
+        try {
+            unreadMessage.second(error);
+        } catch (const std::exception& e) {
+            JOYNR_LOG_ERROR(logger(),
+                            "{} failed to process send-failure: {}",
+                            _address.getId(),
+                            e.what());
+        }
+    }
+}
+
+void UdsClient::doReadSharedMemory(std::uint64_t writePosition)
+{
+    if (!_sharedMemoryReader) {
+        throw exceptions::JoynrRuntimeException(
+                "Shared memory signaled before it has been announced.");
+    }
+    // Messages written after the signal are read with the signal that follows the frames sent
+    // via socket in the meantime
+    smrf::ByteVector message;
+    while (_sharedMemoryReader->tryRead(message, writePosition)) {
+        _receivedCallback(std::move(message));
+        message = smrf::ByteVector();
+    }
+}
+
 void UdsClient::doHandleFatalError(const std::string& errorMessage,
                                    const std::exception& error) noexcept
 {
@@ -19,6 +19,7 @@
 
 #include "UdsFrameBufferV1.h"
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -27,6 +28,9 @@ namespace joynr
 
 constexpr UdsFrameBufferV1::Cookie UdsFrameBufferV1::_initMagicCookie;
 constexpr UdsFrameBufferV1::Cookie UdsFrameBufferV1::_msgMagicCookie;
+constexpr UdsFrameBufferV1::Cookie UdsFrameBufferV1::_sharedMemoryInitMagicCookie;
+constexpr UdsFrameBufferV1::Cookie UdsFrameBufferV1::_sharedMemorySignalMagicCookie;
+constexpr char UdsFrameBufferV1::_sharedMemoryCapability[];
 
 UdsFrameBufferV1::UdsFrameBufferV1() noexcept : _isValid{false}, _buffer(empty())
 {
@@ -52,13 +56,34 @@ UdsFrameBufferV1::UdsFrameBufferV1(const smrf::ByteArrayView& view) : UdsFrameBu
 }
 
 UdsFrameBufferV1::UdsFrameBufferV1(
-        const joynr::system::RoutingTypes::UdsClientAddress& clientAddress)
-        : UdsFrameBufferV1(smrf::ByteArrayView(serializeClientAddress(clientAddress)))
+        const joynr::system::RoutingTypes::UdsClientAddress& clientAddress,
+        bool supportsSharedMemory)
+        : UdsFrameBufferV1(smrf::ByteArrayView(
+                  serializeClientAddress(clientAddress, supportsSharedMemory)))
 {
     writeMagicCookie(_initMagicCookie);
     _isValid = true;
 }
 
+UdsFrameBufferV1 UdsFrameBufferV1::createSharedMemoryInit(const std::string& sharedMemoryName)
+{
+    const smrf::ByteVector name(sharedMemoryName.begin(), sharedMemoryName.end());
+    UdsFrameBufferV1 frame{smrf::ByteArrayView(name)};
+    frame.writeMagicCookie(_sharedMemoryInitMagicCookie);
+    return frame;
+}
+
+UdsFrameBufferV1 UdsFrameBufferV1::createSharedMemorySignal(std::uint64_t writePosition)
+{
+    // network byte-order like the body length
+    const std::uint64_t networkByteOrder = boost::endian::native_to_big(writePosition);
+    const auto positionBytes = reinterpret_cast<const smrf::Byte*>(&networkByteOrder);
+    const smrf::ByteVector position(positionBytes, positionBytes + sizeof(networkByteOrder));
+    UdsFrameBufferV1 frame{smrf::ByteArrayView(position)};
+    frame.writeMagicCookie(_sharedMemorySignalMagicCookie);
+    return frame;
+}
+
 boost::asio::const_buffers_1 UdsFrameBufferV1::raw() const noexcept
 {
     return boost::asio::const_buffers_1(_buffer.data(), _buffer.size());
@@ -87,9 +112,24 @@ smrf::ByteVector UdsFrameBufferV1::readMessage()
 }
 
 joynr::system::RoutingTypes::UdsClientAddress UdsFrameBufferV1::readInit()
+{
+    bool supportsSharedMemory;
+    return readInit(supportsSharedMemory);
+}
+
+joynr::system::RoutingTypes::UdsClientAddress UdsFrameBufferV1::readInit(
+        bool& supportsSharedMemory)
 {
     checkMagicCookie(_initMagicCookie);
     _buffer.erase(_buffer.begin(), _buffer.begin() + _headerSize);
+    // the capability is appended right before the closing brace of the JSON object
+    const std::string capability = std::string(_sharedMemoryCapability) + "}";
+    supportsSharedMemory =
+            _buffer.size() >= capability.size() &&
+            std::equal(capability.cbegin(), capability.cend(), _buffer.cend() - capability.size());
+    if (supportsSharedMemory) {
+        _buffer.erase(_buffer.cend() - capability.size(), _buffer.cend() - 1);
+    }
     std::shared_ptr<joynr::system::RoutingTypes::UdsClientAddress> clientAddress;
     const smrf::ByteArrayView initMessage(_buffer);
     try {
@@ -103,4 +143,36 @@ joynr::system::RoutingTypes::UdsClientAddress UdsFrameBufferV1::readInit()
     return *clientAddress;
 }
 
+bool UdsFrameBufferV1::isSharedMemoryInit() const noexcept
+{
+    return hasMagicCookie(_sharedMemoryInitMagicCookie);
+}
+
+bool UdsFrameBufferV1::isSharedMemorySignal() const noexcept
+{
+    return hasMagicCookie(_sharedMemorySignalMagicCookie);
+}
+
+std::string UdsFrameBufferV1::readSharedMemoryInit()
+{
+    checkMagicCookie(_sharedMemoryInitMagicCookie);
+    std::string sharedMemoryName(_buffer.begin() + _headerSize, _buffer.end());
+    _buffer = empty();
+    return sharedMemoryName;
+}
+
+std::uint64_t UdsFrameBufferV1::readSharedMemorySignal()
+{
+    checkMagicCookie(_sharedMemorySignalMagicCookie);
+    std::uint64_t networkByteOrder;
+    if (_buffer.size() != _headerSize + sizeof(networkByteOrder)) {
+        _buffer = empty(); // Assure valid state of buffer
+        throw joynr::exceptions::JoynrRuntimeException(
+                "UDS shared-memory-signal frame has invalid body length.");
+    }
+    std::memcpy(&networkByteOrder, _buffer.data() + _headerSize, sizeof(networkByteOrder));
+    _buffer = empty();
+    return boost::endian::big_to_native(networkByteOrder);
+}
+
 } // namespace joynr
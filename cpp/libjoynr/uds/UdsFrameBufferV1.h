@@ -51,6 +51,19 @@ public:
     /** Magic cookie precedes every message-frame */
     static constexpr Cookie _msgMagicCookie = {'M', 'J', 'M', '1'};
 
+    /** Magic cookie precedes the frame announcing the sender's shared memory ring buffer */
+    static constexpr Cookie _sharedMemoryInitMagicCookie = {'M', 'J', 'S', '1'};
+
+    /** Magic cookie precedes the frame signaling new messages in the shared memory */
+    static constexpr Cookie _sharedMemorySignalMagicCookie = {'M', 'J', 'W', '1'};
+
+    /**
+     * Appended to the JSON object of the init-frame by clients which understand the shared memory
+     * frames (MJS1/MJW1). Peers without shared memory support ignore the unknown member, hence
+     * shared memory frames are only ever sent to peers which announced the support.
+     */
+    static constexpr char _sharedMemoryCapability[] = ",\"sharedMemory\":true";
+
     /** Body length field follows the magic cookie (though UDS is used, the encoding is network
      * byte-order!) */
     using BodyLength = uint32_t;
@@ -69,10 +82,25 @@ public:
     /**
      * Constructs init-frame buffer
      * @param clientAddress Address used for unique identification of the client
+     * @param supportsSharedMemory Announces that the client accepts shared memory frames
      * @throws JoynrRuntimeException if address cannot be serialized.
      * @throws JoynrRuntimeException if buffer for address cannot be allocated.
      */
-    explicit UdsFrameBufferV1(const joynr::system::RoutingTypes::UdsClientAddress& clientAddress);
+    explicit UdsFrameBufferV1(const joynr::system::RoutingTypes::UdsClientAddress& clientAddress,
+                              bool supportsSharedMemory = false);
+
+    /**
+     * Constructs shared-memory-init frame buffer
+     * @param sharedMemoryName Name of the shared memory ring buffer written by the sender
+     * @throws JoynrRuntimeException if buffer for name cannot be allocated.
+     */
+    static UdsFrameBufferV1 createSharedMemoryInit(const std::string& sharedMemoryName);
+
+    /**
+     * Constructs shared-memory-signal frame buffer
+     * @param writePosition Position in the shared memory up to which the receiver shall read
+     */
+    static UdsFrameBufferV1 createSharedMemorySignal(std::uint64_t writePosition);
 
     /** @return True if buffer contains valid message. */
     inline explicit operator bool() const noexcept
@@ -107,12 +135,44 @@ public:
      */
     joynr::system::RoutingTypes::UdsClientAddress readInit();
 
+    /**
+     * Read init-body from buffer and resets the buffer for the next frame.
+     * @param supportsSharedMemory Set to true if the client announced shared memory support
+     * @return Address in frame
+     * @throws JoynrRuntimeException if address cannot be decoded from frame.
+     */
+    joynr::system::RoutingTypes::UdsClientAddress readInit(bool& supportsSharedMemory);
+
+    /** @return True if the header read into the buffer belongs to a shared-memory-init frame. */
+    bool isSharedMemoryInit() const noexcept;
+
+    /** @return True if the header read into the buffer belongs to a shared-memory-signal frame. */
+    bool isSharedMemorySignal() const noexcept;
+
+    /**
+     * Read shared-memory-init body from buffer and resets the buffer for the next frame.
+     * @return Name of the shared memory ring buffer of the sender
+     * @throws JoynrRuntimeException if frame is not a shared-memory-init frame.
+     */
+    std::string readSharedMemoryInit();
+
+    /**
+     * Read shared-memory-signal body from buffer and resets the buffer for the next frame.
+     * @return Position in the shared memory of the sender up to which messages shall be read
+     * @throws JoynrRuntimeException if frame is not a valid shared-memory-signal frame.
+     */
+    std::uint64_t readSharedMemorySignal();
+
 private:
     static inline smrf::ByteVector serializeClientAddress(
-            const joynr::system::RoutingTypes::UdsClientAddress& clientAddress)
+            const joynr::system::RoutingTypes::UdsClientAddress& clientAddress,
+            bool supportsSharedMemory)
     {
         try {
-            const auto serialized = serializer::serializeToJson(clientAddress);
+            auto serialized = serializer::serializeToJson(clientAddress);
+            if (supportsSharedMemory && !serialized.empty() && serialized.back() == '}') {
+                serialized.insert(serialized.size() - 1, _sharedMemoryCapability);
+            }
             return smrf::ByteVector(serialized.begin(), serialized.end());
         } catch (const std::exception& e) {
             throw joynr::exceptions::JoynrRuntimeException("Failed to serialize client address " +
@@ -133,6 +193,11 @@ private:
         std::memcpy(_buffer.data(), cookie.data(), _cookieSize);
     }
 
+    inline bool hasMagicCookie(const Cookie& cookie) const noexcept
+    {
+        return 0 == std::memcmp(_buffer.data(), cookie.data(), _cookieSize);
+    }
+
     inline void checkMagicCookie(const Cookie& cookie,
                                  std::size_t numberOfBytesToCheck = _cookieSize)
     {
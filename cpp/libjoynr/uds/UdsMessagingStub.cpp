@@ -22,11 +22,36 @@
 
 #include "joynr/IUdsSender.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
+#include "joynr/Metrics.h"
+#include "joynr/TrackingInfo.h"
 #include "joynr/exceptions/JoynrException.h"
 
 namespace joynr
 {
 
+namespace
+{
+
+// Replies unblock waiting callers, hence they overtake requests and bulk publications in the
+// sending queue. Subscription stops keep the priority of requests so that they cannot overtake
+// the subscription request they refer to.
+IUdsSender::Priority getSendingPriority(const ImmutableMessage& message)
+{
+    const std::string& type = message.getType();
+    if (type == Message::VALUE_MESSAGE_TYPE_REPLY() ||
+        type == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY()) {
+        return IUdsSender::Priority::HIGH;
+    }
+    if (type == Message::VALUE_MESSAGE_TYPE_PUBLICATION() ||
+        type == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+        return IUdsSender::Priority::LOW;
+    }
+    return IUdsSender::Priority::NORMAL;
+}
+
+} // namespace
+
 UdsMessagingStub::UdsMessagingStub(std::shared_ptr<IUdsSender> udsSender)
         : _udsSender(std::move(udsSender))
 {
@@ -36,13 +61,16 @@ void UdsMessagingStub::transmit(
         std::shared_ptr<ImmutableMessage> message,
         const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure)
 {
+    static const std::shared_ptr<metrics::Histogram> sendLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("transport.uds.send.latencyUs");
+    metrics::ScopedLatencyRecorder sendLatencyRecorder(*sendLatencyHistogram);
     if (logger().getLogLevel() == LogLevel::Debug) {
-        JOYNR_LOG_DEBUG(logger(), ">>> OUTGOING >>> {}", message->getTrackingInfo());
+        JOYNR_LOG_DEBUG(logger(), ">>> OUTGOING >>> {}", TrackingInfo(*message));
     } else {
         JOYNR_LOG_TRACE(logger(), ">>> OUTGOING >>> {}", message->toLogMessage());
     }
     const smrf::ByteArrayView serializedMessageView(message->getSerializedMessage());
-    _udsSender->send(std::move(serializedMessageView), std::move(onFailure));
+    _udsSender->send(std::move(serializedMessageView), onFailure, getSendingPriority(*message));
 }
 
 } // namespace joynr
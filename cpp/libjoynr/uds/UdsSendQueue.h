@@ -19,7 +19,10 @@
 #ifndef UDSSENDQUEUE_H
 #define UDSSENDQUEUE_H
 
+#include <algorithm>
 #include <deque>
+#include <functional>
+#include <iterator>
 #include <utility>
 
 #include <boost/asio.hpp>
@@ -32,7 +35,15 @@ namespace joynr
 {
 
 /**
- * @brief Size limited FIFO queue for sending UDS frames using state machine
+ * @brief Size limited priority queue for sending UDS frames using state machine
+ *
+ * Frames of higher priority are inserted in front of queued frames of lower priority, frames of
+ * the same priority are kept in FIFO order. The queue applies backpressure with hysteresis: if
+ * the number of queued frames reaches the high watermark (3/4 of the maximum size) the
+ * backpressure callback is called with true, and with false as soon as the queue has been
+ * drained down to the low watermark (1/4 of the maximum size). The remaining capacity above the
+ * high watermark absorbs messages which are already in flight when the user pauses. A maximum
+ * size of zero is treated as one.
  *
  * The boolean return values are e.g. true if a new state shall be inserted to
  * corresponding user state machine.
@@ -41,34 +52,63 @@ template <typename FRAME>
 class UdsSendQueue
 {
 public:
-    explicit UdsSendQueue(const std::size_t& maxSize) noexcept
-            : _maxSize{maxSize}, _entryInSendingBuffer{emptyEntry()}
+    using BackpressureChanged = std::function<void(bool isPaused)>;
+
+    explicit UdsSendQueue(const std::size_t& maxSize,
+                          BackpressureChanged backpressureCallback = nullptr) noexcept
+            : _maxSize{std::max<std::size_t>(maxSize, 1)},
+              _highWatermark{_maxSize - _maxSize / 4},
+              _lowWatermark{_maxSize / 4},
+              _isPaused{false},
+              _backpressureCallback{std::move(backpressureCallback)},
+              _entryInSendingBuffer{emptyEntry()}
     {
     }
 
     /**
-     * Adds a new entry to the end of the queue.
-     * If the maximum size is reached, the current entries are removed, and for each entry the send
-     * failure callback is executed.
+     * Inserts a new entry behind all queued entries of the same or higher priority.
+     * If the maximum size is reached, the queued entry of the lowest priority is removed in favor
+     * of an entry of higher priority. Otherwise the new entry is rejected. In both cases the send
+     * failure callback of the dropped entry is executed.
      * @param frame Frame to send, byte array will be consumed by call
-     * @param callback Callback executed if frame has not been sent and the queue limit is reached.
+     * @param callback Callback executed if frame has not been sent and the queue limit is reached
+     * (may be empty).
+     * @param priority Priority of the frame
      * @return True if the queue was empty before the insertion of the new entry.
      */
     bool pushBack(
             FRAME&& frame,
             const IUdsSender::SendFailed& callback =
-                    [](const joynr::exceptions::JoynrRuntimeException&) {})
+                    [](const joynr::exceptions::JoynrRuntimeException&) {},
+            IUdsSender::Priority priority = IUdsSender::Priority::NORMAL)
     {
         const auto previousSize = _buffer.size();
         if (_maxSize <= previousSize) {
             const auto errorMsg =
-                    boost::format(
-                            "Sending queue size %d exceeded. Rescheduling all queued messages.") %
+                    boost::format("Sending queue size %d exceeded. Rescheduling message.") %
                     _maxSize;
-            emptyQueueAndNotify(true, errorMsg.str());
+            const joynr::exceptions::JoynrDelayMessageException error(errorMsg.str());
+            if (_buffer.back().priority <= priority) {
+                if (callback) {
+                    callback(error);
+                }
+                return false;
+            }
+            _buffer.back().onFailure(error);
+            _buffer.pop_back();
         }
-        _buffer.push_back(Entry(std::move(frame), callback));
-        return (previousSize == 0) && !_entryInSendingBuffer.first;
+        auto position = _buffer.end();
+        while (position != _buffer.begin() && std::prev(position)->priority > priority) {
+            --position;
+        }
+        _buffer.insert(position,
+                       Entry{std::move(frame),
+                             callback ? callback : IUdsSender::SendFailed(&ignoreSendFailure),
+                             priority});
+        if (!_isPaused && _buffer.size() >= _highWatermark) {
+            setPaused(true);
+        }
+        return (previousSize == 0) && !_entryInSendingBuffer.frame;
     }
 
     /**
@@ -77,14 +117,14 @@ public:
      */
     boost::asio::const_buffers_1 showFront() noexcept
     {
-        if (!_entryInSendingBuffer.first) {
+        if (!_entryInSendingBuffer.frame) {
             if (_buffer.empty()) {
                 return boost::asio::const_buffers_1(boost::asio::const_buffer());
             }
             _entryInSendingBuffer = std::move(_buffer.front());
             _buffer.pop_front();
         }
-        return _entryInSendingBuffer.first.raw();
+        return _entryInSendingBuffer.frame.raw();
     }
 
     /**
@@ -94,10 +134,13 @@ public:
      */
     bool popFrontOnSuccess(const boost::system::error_code& sentFailed) noexcept
     {
-        if ((!_entryInSendingBuffer.first) || sentFailed) {
+        if ((!_entryInSendingBuffer.frame) || sentFailed) {
             return false;
         }
         _entryInSendingBuffer = emptyEntry();
+        if (_isPaused && _buffer.size() <= _lowWatermark) {
+            setPaused(false);
+        }
         return !_buffer.empty();
     }
 
@@ -106,36 +149,65 @@ public:
      * @param errorMessage Human readable reason
      */
     void emptyQueueAndNotify(const std::string& errorMessage)
-    {
-        emptyQueueAndNotify(false, errorMessage);
-    }
-
-private:
-    void emptyQueueAndNotify(const bool queueFull, const std::string& errorMessage)
     {
         const joynr::exceptions::JoynrDelayMessageException error(errorMessage);
-        if (_entryInSendingBuffer.first && !queueFull) {
+        if (_entryInSendingBuffer.frame) {
             // In this stage it can be safely assumed, that the sending is failed or will fail.
-            _entryInSendingBuffer.second(error);
+            _entryInSendingBuffer.onFailure(error);
             // Release resources which might be attached to function and prevent sending message
             // again.
-            _entryInSendingBuffer.second = [](const joynr::exceptions::JoynrRuntimeException&) {};
+            _entryInSendingBuffer.onFailure = &ignoreSendFailure;
             // The message itself must not be touched since it might be accessed by the socket
             // writer.
         }
         for (const auto& entry : _buffer) {
-            entry.second(error);
+            entry.onFailure(error);
         }
         _buffer.clear();
+        if (_isPaused) {
+            setPaused(false);
+        }
+    }
+
+    /** @return True if the high watermark has been reached and the low watermark not yet */
+    bool isPaused() const noexcept
+    {
+        return _isPaused;
+    }
+
+private:
+    struct Entry {
+        FRAME frame;
+        IUdsSender::SendFailed onFailure;
+        IUdsSender::Priority priority;
+    };
+
+    void setPaused(bool isPaused) noexcept
+    {
+        _isPaused = isPaused;
+        if (_backpressureCallback) {
+            try {
+                _backpressureCallback(isPaused);
+            } catch (const std::exception&) {
+                // backpressure is a hint only, failing to propagate it must not affect sending
+            }
+        }
+    }
+
+    static void ignoreSendFailure(const joynr::exceptions::JoynrRuntimeException&)
+    {
     }
 
-    using Entry = std::pair<FRAME, IUdsSender::SendFailed>;
     static inline Entry emptyEntry()
     {
-        return Entry{FRAME(), [](const joynr::exceptions::JoynrRuntimeException&) {}};
+        return Entry{FRAME(), &ignoreSendFailure, IUdsSender::Priority::NORMAL};
     }
     std::deque<Entry> _buffer;
     std::size_t _maxSize;
+    std::size_t _highWatermark;
+    std::size_t _lowWatermark;
+    bool _isPaused;
+    BackpressureChanged _backpressureCallback;
     Entry _entryInSendingBuffer;
 };
 
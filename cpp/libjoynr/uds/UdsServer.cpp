@@ -29,6 +29,7 @@
 
 #include "UdsFrameBufferV1.h"
 #include "UdsSendQueue.h"
+#include "UdsSharedMemoryRingBuffer.h"
 
 namespace joynr
 {
@@ -44,6 +45,7 @@ UdsServer::UdsServer(const UdsSettings& settings)
           _acceptorMutex()
 {
     _remoteConfig._maxSendQueueSize = settings.getSendingQueueSize();
+    _remoteConfig._sharedMemorySize = settings.getSharedMemorySize();
 }
 
 UdsServer::~UdsServer()
@@ -85,6 +87,13 @@ void UdsServer::setReceiveCallback(const Received& callback)
     }
 }
 
+void UdsServer::setBackpressureCallback(const Backpressure& callback)
+{
+    if (callback) {
+        _remoteConfig._backpressureCallback = callback;
+    }
+}
+
 void UdsServer::start()
 {
     if (_started.exchange(true)) {
@@ -155,10 +164,21 @@ UdsServer::Connection::Connection(std::shared_ptr<boost::asio::io_service>& ioCo
           _connectedCallback{config._connectedCallback},
           _disconnectedCallback{config._disconnectedCallback},
           _receivedCallback{config._receivedCallback},
+          _backpressureCallback{config._backpressureCallback},
           _isClosed{false},
           _username("connection not established"),
-          _sendQueue(std::make_unique<UdsSendQueue<UdsFrameBufferV1>>(config._maxSendQueueSize)),
-          _readBuffer(std::make_unique<UdsFrameBufferV1>())
+          _sendQueue(std::make_unique<UdsSendQueue<UdsFrameBufferV1>>(
+                  config._maxSendQueueSize,
+                  [this](bool isPaused) { _backpressureCallback(_address, isPaused); })),
+          _readBuffer(std::make_unique<UdsFrameBufferV1>()),
+          _sharedMemorySize(config._sharedMemorySize),
+          _sharedMemoryWriter(),
+          _sharedMemoryUnreadMessages(),
+          _isSharedMemorySignalPosted(false),
+          _socketMessagesInFlight(0),
+          _socketMessagesQueued(0),
+          _sharedMemoryWriterMutex(),
+          _sharedMemoryReader()
 {
 }
 
@@ -208,7 +228,8 @@ UdsServer::uds::socket& UdsServer::Connection::getSocket()
 }
 
 void UdsServer::Connection::send(const smrf::ByteArrayView& msg,
-                                 const IUdsSender::SendFailed& callback)
+                                 const IUdsSender::SendFailed& callback,
+                                 IUdsSender::Priority priority)
 {
     if (_isClosed.load()) {
         throw std::runtime_error("Connection already closed.");
@@ -221,18 +242,24 @@ void UdsServer::Connection::send(const smrf::ByteArrayView& msg,
                        getUserName());
         return;
     }
+    if (sendViaSharedMemory(msg, callback, *ioContext)) {
+        return;
+    }
     try {
         // UdsFrameBufferV1 first since it can cause exception
-        ioContext->post(
-                [frame = UdsFrameBufferV1(msg), self = shared_from_this(), callback]() mutable {
-                    try {
-                        if (self->_sendQueue->pushBack(std::move(frame), callback)) {
-                            self->doWrite();
-                        }
-                    } catch (const std::exception& e) {
-                        self->doClose("Failed to insert new message", e);
-                    }
-                });
+        ioContext->post([frame = UdsFrameBufferV1(msg),
+                         self = shared_from_this(),
+                         callback,
+                         priority]() mutable {
+            try {
+                self->_socketMessagesQueued++;
+                if (self->_sendQueue->pushBack(std::move(frame), callback, priority)) {
+                    self->doWrite();
+                }
+            } catch (const std::exception& e) {
+                self->doClose("Failed to insert new message", e);
+            }
+        });
     } catch (const joynr::exceptions::JoynrRuntimeException& e) {
         // In case generation of frame buffer failed, close connection
         ioContext->post([self = shared_from_this(), e]() mutable {
@@ -283,12 +310,17 @@ void UdsServer::Connection::doReadInitBody() noexcept
                     if (self->doCheck(readFailure)) {
                         try {
                             self->_username = self->getUserName();
-                            self->_address = self->_readBuffer->readInit();
+                            bool supportsSharedMemory = false;
+                            self->_address = self->_readBuffer->readInit(supportsSharedMemory);
                             JOYNR_LOG_INFO(
                                     logger(),
                                     "Initialize connection for client with User / ID: {} / {}",
                                     self->_username,
                                     self->_address.getId());
+                            if (supportsSharedMemory) {
+                                // clients without shared memory support would reject the frames
+                                self->doCreateSharedMemoryWriter();
+                            }
                             self->_connectedCallback(self->_address,
                                                      std::make_unique<UdsServer::UdsSender>(
                                                              std::weak_ptr<Connection>(self)));
@@ -325,9 +357,17 @@ void UdsServer::Connection::doReadBody() noexcept
                         boost::system::error_code readFailure, std::size_t /*length*/) {
                     if (self->doCheck(readFailure)) {
                         try {
-                            self->_receivedCallback(self->_address,
-                                                    self->_readBuffer->readMessage(),
-                                                    self->_username);
+                            if (self->_readBuffer->isSharedMemorySignal()) {
+                                self->doReadSharedMemory(
+                                        self->_readBuffer->readSharedMemorySignal());
+                            } else if (self->_readBuffer->isSharedMemoryInit()) {
+                                self->_sharedMemoryReader = UdsSharedMemoryRingBuffer::open(
+                                        self->_readBuffer->readSharedMemoryInit());
+                            } else {
+                                self->_receivedCallback(self->_address,
+                                                        self->_readBuffer->readMessage(),
+                                                        self->_username);
+                            }
                         } catch (const std::exception& e) {
                             self->doClose("Failed to process message", e);
                         }
@@ -348,11 +388,166 @@ void UdsServer::Connection::doWrite() noexcept
                                  if (self->doCheck(writeFailed)) {
                                      if (self->_sendQueue->popFrontOnSuccess(writeFailed)) {
                                          self->doWrite();
+                                     } else {
+                                         self->doReleaseSocketMessages();
                                      }
                                  }
                              });
 }
 
+void UdsServer::Connection::doReleaseSocketMessages() noexcept
+{
+    // All queued messages have been written to the socket, following messages cannot overtake
+    // them via shared memory anymore
+    std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+    _socketMessagesInFlight -= _socketMessagesQueued;
+    _socketMessagesQueued = 0;
+}
+
+void UdsServer::Connection::doCreateSharedMemoryWriter() noexcept
+{
+    if (_sharedMemorySize == 0) {
+        return;
+    }
+    try {
+        auto sharedMemoryWriter = UdsSharedMemoryRingBuffer::create(_sharedMemorySize);
+        const bool isWriteRequired = _sendQueue->pushBack(
+                UdsFrameBufferV1::createSharedMemoryInit(sharedMemoryWriter->getName()),
+                nullptr,
+                IUdsSender::Priority::HIGH);
+        {
+            // Messages can be written to the shared memory as soon as it has been announced;
+            // publish the writer before the announcement reaches the client
+            std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+            _sharedMemoryWriter = std::move(sharedMemoryWriter);
+        }
+        if (isWriteRequired) {
+            doWrite();
+        }
+    } catch (const std::exception& e) {
+        JOYNR_LOG_WARN(logger(),
+                       "Cannot use shared memory for {}, sending all messages via socket: {}",
+                       _address.getId(),
+                       e.what());
+    }
+}
+
+bool UdsServer::Connection::sendViaSharedMemory(const smrf::ByteArrayView& msg,
+                                                const IUdsSender::SendFailed& callback,
+                                                boost::asio::io_service& ioContext)
+{
+    bool isSignalRequired = false;
+    {
+        std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+        // Stay on the socket until the messages sent via socket have been written, otherwise
+        // the signal frame would overtake them
+        if (_socketMessagesInFlight > 0 || !_sharedMemoryWriter ||
+            !_sharedMemoryWriter->tryWrite(msg)) {
+            // Shared memory disabled, message too large or ring buffer full, fall back to socket
+            _socketMessagesInFlight++;
+            return false;
+        }
+        const std::uint64_t readPosition = _sharedMemoryWriter->getReadPosition();
+        while (!_sharedMemoryUnreadMessages.empty() &&
+               _sharedMemoryUnreadMessages.front().first <= readPosition) {
+            _sharedMemoryUnreadMessages.pop_front();
+        }
+        if (callback) {
+            _sharedMemoryUnreadMessages.emplace_back(
+                    _sharedMemoryWriter->getWritePosition(), callback);
+        }
+        // One signal covers all messages written until it is queued
+        isSignalRequired = !_isSharedMemorySignalPosted;
+        _isSharedMemorySignalPosted = true;
+    }
+    if (isSignalRequired) {
+        ioContext.post([self = shared_from_this()]() { self->doSignalSharedMemory(); });
+    }
+    return true;
+}
+
+void UdsServer::Connection::doSignalSharedMemory() noexcept
+{
+    if (_isClosed.load()) {
+        return;
+    }
+    std::uint64_t writePosition;
+    {
+        std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+        _isSharedMemorySignalPosted = false;
+        if (!_sharedMemoryWriter) {
+            return;
+        }
+        writePosition = _sharedMemoryWriter->getWritePosition();
+    }
+    try {
+        auto onSignalFailed = [thisWeakPtr = std::weak_ptr<Connection>(shared_from_this())](
+                                      const exceptions::JoynrRuntimeException&) {
+            // The messages remain in the shared memory, the client has to be signaled again
+            auto self = thisWeakPtr.lock();
+            if (!self || self->_isClosed.load()) {
+                return;
+            }
+            if (auto ioContext = self->_ioContext.lock()) {
+                ioContext->post([self]() { self->doSignalSharedMemory(); });
+            }
+        };
+        // Queued in front of messages sent via socket afterwards, which must not overtake the
+        // messages in the shared memory
+        if (_sendQueue->pushBack(UdsFrameBufferV1::createSharedMemorySignal(writePosition),
+                                 onSignalFailed,
+                                 IUdsSender::Priority::HIGH)) {
+            doWrite();
+        }
+    } catch (const std::exception& e) {
+        doClose("Failed to insert shared memory signal", e);
+    }
+}
+
+void UdsServer::Connection::doReadSharedMemory(std::uint64_t writePosition)
+{
+    if (!_sharedMemoryReader) {
+        throw exceptions::JoynrRuntimeException(
+                "Shared memory signaled before it has been announced.");
+    }
+    // Messages written after the signal are read with the signal that follows the frames sent
+    // via socket in the meantime
+    smrf::ByteVector message;
+    while (_sharedMemoryReader->tryRead(message, writePosition)) {
+        _receivedCallback(_address, std::move(message), _username);
+        message = smrf::ByteVector();
+    }
+}
+
+void UdsServer::Connection::doNotifyUnreadSharedMemoryMessages(
+        const std::string& errorMessage) noexcept
+{
+    std::deque<std::pair<std::uint64_t, IUdsSender::SendFailed>> unreadMessages;
+    {
+        std::lock_guard<std::mutex> writerLock(_sharedMemoryWriterMutex);
+        if (!_sharedMemoryWriter) {
+            return;
+        }
+        const std::uint64_t readPosition = _sharedMemoryWriter->getReadPosition();
+        for (auto& unreadMessage : _sharedMemoryUnreadMessages) {
+            if (unreadMessage.first > readPosition) {
+                unreadMessages.push_back(std::move(unreadMessage));
+            }
+        }
+        _sharedMemoryUnreadMessages.clear();
+        // Messages sent concurrently fall back to the closed socket
+        _sharedMemoryWriter.reset();
+    }
+    const joynr::exceptions::JoynrDelayMessageException error(errorMessage);
+    for (const auto& unreadMessage : unreadMessages) {
+        try {
+            unreadMessage.second(error);
+        } catch (const std::exception& e) {
+            JOYNR_LOG_ERROR(logger(), "Failed to process send-failure: {}", e.what());
+        }
+    }
+}
+
 bool UdsServer::Connection::doCheck(const boost::system::error_code& error) noexcept
 {
     if (error) {
@@ -395,6 +590,7 @@ void UdsServer::Connection::doClose() noexcept
         } catch (const std::exception& e) {
             JOYNR_LOG_ERROR(logger(), "Failed to process send-failure: {}", e.what());
         }
+        doNotifyUnreadSharedMemoryMessages("Connection closed.");
     }
 }
 
@@ -415,14 +611,15 @@ UdsServer::UdsSender::~UdsSender()
 }
 
 void UdsServer::UdsSender::send(const smrf::ByteArrayView& msg,
-                                const IUdsSender::SendFailed& callback)
+                                const IUdsSender::SendFailed& callback,
+                                IUdsSender::Priority priority)
 {
     auto connection = _connection.lock();
     auto safeCallback =
             callback ? callback : [](const joynr::exceptions::JoynrRuntimeException&) {};
     try {
         if (connection) {
-            connection->send(msg, safeCallback);
+            connection->send(msg, safeCallback, priority);
         } else {
             throw std::runtime_error("Connection already closed.");
         }
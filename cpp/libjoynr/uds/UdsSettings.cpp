@@ -59,6 +59,10 @@ void UdsSettings::checkSettings()
     if (!_settings.contains(SETTING_SENDING_QUEUE_SIZE())) {
         setSendingQueueSize(DEFAULT_SENDING_QUEUE_SIZE());
     }
+
+    if (!_settings.contains(SETTING_SHARED_MEMORY_SIZE())) {
+        setSharedMemorySize(DEFAULT_SHARED_MEMORY_SIZE());
+    }
 }
 
 const std::string& UdsSettings::SETTING_SOCKET_PATH()
@@ -158,6 +162,39 @@ void UdsSettings::setSendingQueueSize(const std::size_t& queueSize)
     _settings.set(UdsSettings::SETTING_SENDING_QUEUE_SIZE(), std::to_string(queueSize));
 }
 
+const std::string& UdsSettings::SETTING_SHARED_MEMORY_SIZE()
+{
+    static const std::string value("uds/shared-memory-size");
+    return value;
+}
+
+const std::size_t& UdsSettings::DEFAULT_SHARED_MEMORY_SIZE()
+{
+    static const std::size_t value{0};
+    return value;
+}
+
+std::size_t UdsSettings::getSharedMemorySize() const
+{
+    const auto sharedMemorySizeStr =
+            _settings.get<std::string>(UdsSettings::SETTING_SHARED_MEMORY_SIZE());
+    try {
+        return std::stoul(sharedMemorySizeStr);
+    } catch (const std::logic_error& ex) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Cannot parse {} value '{}'. Exception: {}",
+                        UdsSettings::SETTING_SHARED_MEMORY_SIZE(),
+                        sharedMemorySizeStr,
+                        ex.what());
+    }
+    return DEFAULT_SHARED_MEMORY_SIZE();
+}
+
+void UdsSettings::setSharedMemorySize(const std::size_t& sharedMemorySize)
+{
+    _settings.set(UdsSettings::SETTING_SHARED_MEMORY_SIZE(), std::to_string(sharedMemorySize));
+}
+
 joynr::system::RoutingTypes::UdsAddress UdsSettings::createClusterControllerMessagingAddress() const
 {
     return system::RoutingTypes::UdsAddress(getSocketPath());
@@ -194,6 +231,11 @@ void UdsSettings::printSettings() const
                    "SETTING: {} = {}",
                    SETTING_SENDING_QUEUE_SIZE(),
                    _settings.get<std::string>(SETTING_SENDING_QUEUE_SIZE()));
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_SHARED_MEMORY_SIZE(),
+                   _settings.get<std::string>(SETTING_SHARED_MEMORY_SIZE()));
 }
 
 } // namespace joynr
@@ -0,0 +1,269 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "UdsSharedMemoryRingBuffer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "joynr/Util.h"
+#include "joynr/exceptions/JoynrException.h"
+
+namespace joynr
+{
+
+namespace
+{
+constexpr std::uint32_t sharedMemoryMagic = 0x4d4a5231; // "MJR1"
+const std::string sharedMemoryNamePrefix("/joynr-uds-");
+
+std::string errnoToString(int error)
+{
+    return std::string(std::strerror(error));
+}
+} // namespace
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_LONG_LOCK_FREE == 2 &&
+                      ATOMIC_INT_LOCK_FREE == 2,
+              "Shared memory ring buffer requires address-free atomics.");
+
+// Positions are monotonically increasing byte counters, the index into the data area is
+// position % capacity. Writer and reader positions are placed on separate cache lines.
+struct UdsSharedMemoryRingBuffer::Header {
+    std::uint32_t magic;
+    std::uint32_t reserved;
+    std::uint64_t capacity;
+    alignas(64) std::atomic<std::uint64_t> writePosition;
+    alignas(64) std::atomic<std::uint64_t> readPosition;
+};
+
+UdsSharedMemoryRingBuffer::UdsSharedMemoryRingBuffer(const std::string& name,
+                                                     void* mapping,
+                                                     std::size_t mappingSize,
+                                                     bool isWriter) noexcept
+        : _name(name),
+          _mapping(mapping),
+          _mappingSize(mappingSize),
+          _header(static_cast<Header*>(mapping)),
+          _data(static_cast<smrf::Byte*>(mapping) + sizeof(Header)),
+          _capacity(mappingSize - sizeof(Header)),
+          _isWriter(isWriter)
+{
+}
+
+UdsSharedMemoryRingBuffer::~UdsSharedMemoryRingBuffer()
+{
+    munmap(_mapping, _mappingSize);
+    if (_isWriter) {
+        // The reader removes the name after opening, this only cleans up unused segments
+        shm_unlink(_name.c_str());
+    }
+}
+
+std::size_t UdsSharedMemoryRingBuffer::getMappingSize(std::size_t capacity) noexcept
+{
+    return sizeof(Header) + capacity;
+}
+
+std::unique_ptr<UdsSharedMemoryRingBuffer> UdsSharedMemoryRingBuffer::create(
+        std::size_t capacity)
+{
+    if (capacity <= sizeof(Length) ||
+        capacity > std::numeric_limits<std::size_t>::max() - sizeof(Header)) {
+        throw exceptions::JoynrRuntimeException("Invalid shared memory capacity " +
+                                                std::to_string(capacity));
+    }
+    const std::string name = sharedMemoryNamePrefix + util::createUuid();
+    const std::size_t mappingSize = getMappingSize(capacity);
+
+    // only accessible by processes of the same user
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        throw exceptions::JoynrRuntimeException("Failed to create shared memory " + name + ": " +
+                                                errnoToString(errno));
+    }
+    if (ftruncate(fd, static_cast<off_t>(mappingSize)) != 0) {
+        const int error = errno;
+        close(fd);
+        shm_unlink(name.c_str());
+        throw exceptions::JoynrRuntimeException("Failed to resize shared memory " + name + ": " +
+                                                errnoToString(error));
+    }
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int error = errno;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        throw exceptions::JoynrRuntimeException("Failed to map shared memory " + name + ": " +
+                                                errnoToString(error));
+    }
+
+    // the segment is zero-initialized by ftruncate
+    auto header = new (mapping) Header();
+    header->magic = sharedMemoryMagic;
+    header->capacity = capacity;
+    header->writePosition.store(0, std::memory_order_relaxed);
+    header->readPosition.store(0, std::memory_order_release);
+
+    JOYNR_LOG_DEBUG(logger(), "Created shared memory {} with capacity {}", name, capacity);
+    return std::unique_ptr<UdsSharedMemoryRingBuffer>(
+            new UdsSharedMemoryRingBuffer(name, mapping, mappingSize, true));
+}
+
+std::unique_ptr<UdsSharedMemoryRingBuffer> UdsSharedMemoryRingBuffer::open(
+        const std::string& name)
+{
+    // do not allow the peer to make us map arbitrary segments
+    if (name.compare(0, sharedMemoryNamePrefix.size(), sharedMemoryNamePrefix) != 0 ||
+        name.find('/', 1) != std::string::npos) {
+        throw exceptions::JoynrRuntimeException("Invalid shared memory name " + name);
+    }
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw exceptions::JoynrRuntimeException("Failed to open shared memory " + name + ": " +
+                                                errnoToString(errno));
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        throw exceptions::JoynrRuntimeException("Invalid size of shared memory " + name);
+    }
+    const auto mappingSize = static_cast<std::size_t>(status.st_size);
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int error = errno;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        throw exceptions::JoynrRuntimeException("Failed to map shared memory " + name + ": " +
+                                                errnoToString(error));
+    }
+    // the name is not needed anymore, the memory is released when both sides unmapped it
+    shm_unlink(name.c_str());
+
+    std::unique_ptr<UdsSharedMemoryRingBuffer> ringBuffer(
+            new UdsSharedMemoryRingBuffer(name, mapping, mappingSize, false));
+    const Header* header = ringBuffer->_header;
+    if (header->magic != sharedMemoryMagic || header->capacity != ringBuffer->_capacity) {
+        throw exceptions::JoynrRuntimeException("Shared memory " + name +
+                                                " does not contain a valid ring buffer.");
+    }
+    JOYNR_LOG_DEBUG(logger(),
+                    "Opened shared memory {} with capacity {}",
+                    name,
+                    ringBuffer->_capacity);
+    return ringBuffer;
+}
+
+const std::string& UdsSharedMemoryRingBuffer::getName() const noexcept
+{
+    return _name;
+}
+
+std::size_t UdsSharedMemoryRingBuffer::getCapacity() const noexcept
+{
+    return _capacity;
+}
+
+bool UdsSharedMemoryRingBuffer::tryWrite(const smrf::ByteArrayView& message) noexcept
+{
+    const std::size_t messageSize = message.size();
+    if (messageSize > std::numeric_limits<Length>::max() ||
+        messageSize > _capacity - sizeof(Length)) {
+        return false;
+    }
+    const std::uint64_t writePosition = _header->writePosition.load(std::memory_order_relaxed);
+    const std::uint64_t readPosition = _header->readPosition.load(std::memory_order_acquire);
+    const std::uint64_t freeSpace = _capacity - (writePosition - readPosition);
+    if (sizeof(Length) + messageSize > freeSpace) {
+        return false;
+    }
+    const auto length = static_cast<Length>(messageSize);
+    copyToData(writePosition, reinterpret_cast<const smrf::Byte*>(&length), sizeof(Length));
+    if (messageSize > 0) {
+        copyToData(writePosition + sizeof(Length), message.data(), messageSize);
+    }
+    _header->writePosition.store(
+            writePosition + sizeof(Length) + messageSize, std::memory_order_release);
+    return true;
+}
+
+std::uint64_t UdsSharedMemoryRingBuffer::getWritePosition() const noexcept
+{
+    return _header->writePosition.load(std::memory_order_acquire);
+}
+
+std::uint64_t UdsSharedMemoryRingBuffer::getReadPosition() const noexcept
+{
+    return _header->readPosition.load(std::memory_order_acquire);
+}
+
+bool UdsSharedMemoryRingBuffer::tryRead(smrf::ByteVector& message, std::uint64_t endPosition)
+{
+    const std::uint64_t readPosition = _header->readPosition.load(std::memory_order_relaxed);
+    if (endPosition <= readPosition) {
+        return false;
+    }
+    const std::uint64_t writePosition = _header->writePosition.load(std::memory_order_acquire);
+    // the writer is not trusted, validate everything before accessing the data
+    const std::uint64_t usedSpace = endPosition - readPosition;
+    if (endPosition > writePosition || usedSpace > _capacity || usedSpace < sizeof(Length)) {
+        throw exceptions::JoynrRuntimeException("Shared memory " + _name + " is corrupted.");
+    }
+    Length length;
+    copyFromData(readPosition, reinterpret_cast<smrf::Byte*>(&length), sizeof(Length));
+    if (length > usedSpace - sizeof(Length)) {
+        throw exceptions::JoynrRuntimeException("Shared memory " + _name +
+                                                " contains invalid message length " +
+                                                std::to_string(length));
+    }
+    message.resize(length);
+    if (length > 0) {
+        copyFromData(readPosition + sizeof(Length), message.data(), length);
+    }
+    _header->readPosition.store(readPosition + sizeof(Length) + length, std::memory_order_release);
+    return true;
+}
+
+void UdsSharedMemoryRingBuffer::copyToData(std::uint64_t position,
+                                           const smrf::Byte* source,
+                                           std::size_t size) noexcept
+{
+    const auto offset = static_cast<std::size_t>(position % _capacity);
+    const std::size_t firstPart = std::min(size, _capacity - offset);
+    std::memcpy(_data + offset, source, firstPart);
+    std::memcpy(_data, source + firstPart, size - firstPart);
+}
+
+void UdsSharedMemoryRingBuffer::copyFromData(std::uint64_t position,
+                                             smrf::Byte* destination,
+                                             std::size_t size) const noexcept
+{
+    const auto offset = static_cast<std::size_t>(position % _capacity);
+    const std::size_t firstPart = std::min(size, _capacity - offset);
+    std::memcpy(destination, _data + offset, firstPart);
+    std::memcpy(destination + firstPart, _data, size - firstPart);
+}
+
+} // namespace joynr
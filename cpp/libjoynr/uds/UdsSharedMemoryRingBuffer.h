@@ -0,0 +1,129 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef UDSSHAREDMEMORYRINGBUFFER_H
+#define UDSSHAREDMEMORYRINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <smrf/ByteArrayView.h>
+#include <smrf/ByteVector.h>
+
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+/**
+ * @brief Single-producer/single-consumer ring buffer in POSIX shared memory.
+ *
+ * Used to transfer messages between co-located processes without copying them through the
+ * kernel. The UDS connection is still used for setup and signaling: the writer announces the
+ * segment name by a shared-memory-init frame and sends signal frames carrying its write position.
+ * The reader only reads up to the position of the signal it received, hence messages in the
+ * shared memory keep their order relative to the frames on the socket.
+ *
+ * Every message is stored as native 32 bit length followed by the payload; both may wrap around
+ * the end of the data area. The writer (creator) and the reader (opener) must each be used by a
+ * single thread at a time.
+ */
+class UdsSharedMemoryRingBuffer
+{
+public:
+    /**
+     * Creates and maps a new shared memory segment which is written by the calling process.
+     * @param capacity Size of the data area [bytes]
+     * @throws JoynrRuntimeException if the segment cannot be created
+     */
+    static std::unique_ptr<UdsSharedMemoryRingBuffer> create(std::size_t capacity);
+
+    /**
+     * Maps the segment created by the peer which is read by the calling process. The name of
+     * the segment is removed afterwards; the memory is released as soon as both sides unmapped it.
+     * @param name Name of the segment as announced by the writer
+     * @throws JoynrRuntimeException if the segment cannot be opened or is not a valid ring buffer
+     */
+    static std::unique_ptr<UdsSharedMemoryRingBuffer> open(const std::string& name);
+
+    ~UdsSharedMemoryRingBuffer();
+
+    DISALLOW_COPY_AND_ASSIGN(UdsSharedMemoryRingBuffer);
+
+    const std::string& getName() const noexcept;
+
+    /** @return Size of the data area [bytes] */
+    std::size_t getCapacity() const noexcept;
+
+    /**
+     * Appends a message (writer only).
+     * @return False if the message does not fit into the remaining space, nothing is written then.
+     */
+    bool tryWrite(const smrf::ByteArrayView& message) noexcept;
+
+    /**
+     * @return Total number of bytes written so far, i.e. the position after the last message.
+     * A message has been read by the peer once getReadPosition() reached its end position.
+     */
+    std::uint64_t getWritePosition() const noexcept;
+
+    /** @return Total number of bytes read by the reader so far */
+    std::uint64_t getReadPosition() const noexcept;
+
+    /**
+     * Removes the oldest message (reader only).
+     * @param message Receives the message
+     * @param endPosition Write position announced by the writer, messages behind it are not read
+     * @return False if all messages up to the end position have been read
+     * @throws JoynrRuntimeException if the content of the buffer is corrupted
+     */
+    bool tryRead(smrf::ByteVector& message, std::uint64_t endPosition);
+
+private:
+    struct Header;
+    using Length = std::uint32_t;
+
+    UdsSharedMemoryRingBuffer(const std::string& name,
+                              void* mapping,
+                              std::size_t mappingSize,
+                              bool isWriter) noexcept;
+
+    void copyToData(std::uint64_t position, const smrf::Byte* source, std::size_t size) noexcept;
+    void copyFromData(std::uint64_t position, smrf::Byte* destination, std::size_t size) const
+            noexcept;
+
+    static std::size_t getMappingSize(std::size_t capacity) noexcept;
+
+    const std::string _name;
+    void* _mapping;
+    const std::size_t _mappingSize;
+    Header* _header;
+    smrf::Byte* _data;
+    std::size_t _capacity;
+    const bool _isWriter;
+
+    ADD_LOGGER(UdsSharedMemoryRingBuffer)
+};
+
+} // namespace joynr
+
+#endif // UDSSHAREDMEMORYRINGBUFFER_H
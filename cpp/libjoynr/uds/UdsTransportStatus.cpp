@@ -0,0 +1,129 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "UdsTransportStatus.h"
+
+#include <tuple>
+#include <utility>
+
+#include "joynr/system/RoutingTypes/Address.h"
+
+namespace joynr
+{
+
+UdsTransportStatus::UdsTransportStatus()
+        : ITransportStatus(),
+          _mutex(),
+          _pausedServers(),
+          _pausedClients(),
+          _numberOfPausedDestinations(0),
+          _destinationAvailableCallback()
+{
+}
+
+bool UdsTransportStatus::isReponsibleFor(
+        std::shared_ptr<const joynr::system::RoutingTypes::Address> address)
+{
+    return dynamic_cast<const system::RoutingTypes::UdsAddress*>(address.get()) != nullptr ||
+           dynamic_cast<const system::RoutingTypes::UdsClientAddress*>(address.get()) != nullptr;
+}
+
+bool UdsTransportStatus::isAvailable()
+{
+    return _numberOfPausedDestinations.load() == 0;
+}
+
+bool UdsTransportStatus::isAvailableFor(
+        std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress)
+{
+    if (_numberOfPausedDestinations.load() == 0) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (auto clientAddress =
+                dynamic_cast<const system::RoutingTypes::UdsClientAddress*>(destAddress.get())) {
+        return _pausedClients.find(*clientAddress) == _pausedClients.cend();
+    }
+    if (auto serverAddress =
+                dynamic_cast<const system::RoutingTypes::UdsAddress*>(destAddress.get())) {
+        return _pausedServers.find(*serverAddress) == _pausedServers.cend();
+    }
+    return true;
+}
+
+void UdsTransportStatus::setAvailabilityChangedCallback(
+        std::function<void(bool)> availabilityChangedCallback)
+{
+    std::ignore = availabilityChangedCallback;
+}
+
+void UdsTransportStatus::setDestinationAvailableCallback(
+        std::function<void(std::shared_ptr<const joynr::system::RoutingTypes::Address>)>
+                destinationAvailableCallback)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _destinationAvailableCallback = std::move(destinationAvailableCallback);
+}
+
+void UdsTransportStatus::onBackpressureChanged(
+        const system::RoutingTypes::UdsClientAddress& address,
+        bool isPaused)
+{
+    updatePausedDestinations(_pausedClients, address, isPaused);
+}
+
+void UdsTransportStatus::onBackpressureChanged(const system::RoutingTypes::UdsAddress& address,
+                                               bool isPaused)
+{
+    updatePausedDestinations(_pausedServers, address, isPaused);
+}
+
+template <typename ADDRESS>
+void UdsTransportStatus::updatePausedDestinations(std::unordered_set<ADDRESS>& pausedDestinations,
+                                                  const ADDRESS& address,
+                                                  bool isPaused)
+{
+    std::function<void(std::shared_ptr<const joynr::system::RoutingTypes::Address>)>
+            destinationAvailableCallback;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (isPaused) {
+            if (!pausedDestinations.insert(address).second) {
+                return;
+            }
+            ++_numberOfPausedDestinations;
+        } else {
+            if (pausedDestinations.erase(address) == 0) {
+                return;
+            }
+            --_numberOfPausedDestinations;
+        }
+        destinationAvailableCallback = _destinationAvailableCallback;
+    }
+    JOYNR_LOG_DEBUG(logger(),
+                    "{} sending to {} because of backpressure",
+                    isPaused ? "Pausing" : "Resuming",
+                    address.toString());
+    // The state is updated before the callback is executed, otherwise messages for the resumed
+    // destination could be queued again by the message router
+    if (!isPaused && destinationAvailableCallback) {
+        destinationAvailableCallback(std::make_shared<const ADDRESS>(address));
+    }
+}
+
+} // namespace joynr
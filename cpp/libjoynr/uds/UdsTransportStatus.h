@@ -0,0 +1,109 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef UDSTRANSPORTSTATUS_H
+#define UDSTRANSPORTSTATUS_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include "joynr/ITransportStatus.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+#include "joynr/system/RoutingTypes/UdsAddress.h"
+#include "joynr/system/RoutingTypes/UdsClientAddress.h"
+
+namespace joynr
+{
+
+/**
+ * @class UdsTransportStatus
+ * @brief Propagates the backpressure of the UDS sending queues to the message router.
+ *
+ * A destination is paused as soon as its sending queue reaches the high watermark. The message
+ * router then keeps messages for this destination in its transport queue instead of scheduling
+ * them. Once the sending queue has been drained to the low watermark, the destination available
+ * callback is called with its address and the router reschedules the messages of this
+ * destination only.
+ */
+class UdsTransportStatus : public ITransportStatus
+{
+public:
+    UdsTransportStatus();
+    ~UdsTransportStatus() override = default;
+
+    bool isReponsibleFor(
+            std::shared_ptr<const joynr::system::RoutingTypes::Address> address) override;
+
+    /** @return true if no destination is paused */
+    bool isAvailable() override;
+    bool isAvailableFor(
+            std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress) override;
+
+    /**
+     * @brief The callback is never called: pausing a destination does not affect the others,
+     * hence the transport as a whole does not change its availability.
+     */
+    void setAvailabilityChangedCallback(
+            std::function<void(bool)> availabilityChangedCallback) override;
+
+    void setDestinationAvailableCallback(
+            std::function<void(std::shared_ptr<const joynr::system::RoutingTypes::Address>)>
+                    destinationAvailableCallback) override;
+
+    /**
+     * @brief Called by the UDS server if the sending queue of a client crosses a watermark
+     * @param address Address of the client
+     * @param isPaused true if the high watermark has been reached, false if the sending queue has
+     * been drained to the low watermark
+     */
+    void onBackpressureChanged(const system::RoutingTypes::UdsClientAddress& address,
+                               bool isPaused);
+
+    /**
+     * @brief Called by the UDS client if the sending queue to the server crosses a watermark
+     * @param address Address of the server
+     * @param isPaused see above
+     */
+    void onBackpressureChanged(const system::RoutingTypes::UdsAddress& address, bool isPaused);
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(UdsTransportStatus);
+
+    template <typename ADDRESS>
+    void updatePausedDestinations(std::unordered_set<ADDRESS>& pausedDestinations,
+                                  const ADDRESS& address,
+                                  bool isPaused);
+
+    std::mutex _mutex;
+    std::unordered_set<system::RoutingTypes::UdsAddress> _pausedServers;
+    std::unordered_set<system::RoutingTypes::UdsClientAddress> _pausedClients;
+    // Allows to skip the lookup while no destination is paused
+    std::atomic<std::size_t> _numberOfPausedDestinations;
+    std::function<void(std::shared_ptr<const joynr::system::RoutingTypes::Address>)>
+            _destinationAvailableCallback;
+
+    ADD_LOGGER(UdsTransportStatus)
+};
+
+} // namespace joynr
+
+#endif // UDSTRANSPORTSTATUS_H
@@ -21,10 +21,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include <boost/asio.hpp>
 
@@ -46,6 +49,7 @@ class JoynrRuntimeException;
 } // namespace exceptions
 
 class UdsFrameBufferV1;
+class UdsSharedMemoryRingBuffer;
 
 template <typename FRAME>
 class UdsSendQueue;
@@ -56,6 +60,7 @@ public:
     using Connected = std::function<void()>;
     using Disconnected = std::function<void()>;
     using Received = std::function<void(smrf::ByteVector&&)>;
+    using Backpressure = std::function<void(bool isPaused)>;
 
     explicit UdsClient(const UdsSettings& settings,
                        const std::function<void(const exceptions::JoynrRuntimeException&)>&
@@ -89,6 +94,14 @@ public:
      */
     void setReceiveCallback(const Received& callback);
 
+    /**
+     * Called if the sending queue reaches its high watermark (isPaused is true) and if it has been
+     * drained to its low watermark afterwards (isPaused is false). The callback is executed by
+     * the internal I/O thread.
+     * @param callback Callback
+     */
+    void setBackpressureCallback(const Backpressure& callback);
+
     /** Starts the UDS client asynchronously and triggers the connected callback as soon as the
      * connection has been established. */
     void start();
@@ -102,7 +115,9 @@ public:
      */
     void shutdown() noexcept;
 
-    void send(const smrf::ByteArrayView& msg, const IUdsSender::SendFailed& callback) override;
+    void send(const smrf::ByteArrayView& msg,
+              const IUdsSender::SendFailed& callback,
+              IUdsSender::Priority priority) override;
 
 private:
     // Internal worker thread
@@ -114,6 +129,13 @@ private:
     void doReadBody() noexcept;
     void doWriteInit() noexcept;
     void doWrite() noexcept;
+    void doReleaseSocketMessages() noexcept;
+    void doCreateSharedMemoryWriter() noexcept;
+    bool sendViaSharedMemory(const smrf::ByteArrayView& msg,
+                             const IUdsSender::SendFailed& callback);
+    void doSignalSharedMemory() noexcept;
+    void doNotifyUnreadSharedMemoryMessages(const std::string& errorMessage) noexcept;
+    void doReadSharedMemory(std::uint64_t writePosition);
     void doHandleFatalError(const std::string& errorMessage, const std::exception& error) noexcept;
     void doHandleFatalError(const std::string& errorMessage) noexcept;
 
@@ -124,6 +146,7 @@ private:
     Connected _connectedCallback;
     Disconnected _disconnectedCallback;
     Received _receivedCallback;
+    Backpressure _backpressureCallback;
     system::RoutingTypes::UdsClientAddress _address;
     std::chrono::milliseconds _connectSleepTime;
 
@@ -131,6 +154,24 @@ private:
     std::unique_ptr<UdsSendQueue<UdsFrameBufferV1>> _sendQueue;
     std::unique_ptr<UdsFrameBufferV1> _readBuffer;
 
+    // Optional shared memory transport, the reader is only accessed by the I/O thread. The writer
+    // is created when the server announces its ring buffer, i.e. once both sides support it.
+    const std::size_t _sharedMemorySize;
+    std::unique_ptr<UdsSharedMemoryRingBuffer> _sharedMemoryWriter;
+    // Failure callbacks of messages in the shared memory not read by the server yet, with the
+    // write position after the message; protected by _sharedMemoryWriterMutex
+    std::deque<std::pair<std::uint64_t, IUdsSender::SendFailed>> _sharedMemoryUnreadMessages;
+    // A signal frame has been posted to the I/O thread but not queued yet; protected by
+    // _sharedMemoryWriterMutex
+    bool _isSharedMemorySignalPosted;
+    // Messages passed to the socket and not yet written since the send queue was empty last;
+    // protected by _sharedMemoryWriterMutex. The shared memory is only used if there are none.
+    std::size_t _socketMessagesInFlight;
+    // Part of _socketMessagesInFlight already inserted into the send queue; I/O thread only
+    std::size_t _socketMessagesQueued;
+    std::mutex _sharedMemoryWriterMutex;
+    std::unique_ptr<UdsSharedMemoryRingBuffer> _sharedMemoryReader;
+
     boost::asio::local::stream_protocol::endpoint _endpoint;
     boost::asio::io_service _ioContext;
     boost::asio::local::stream_protocol::socket _socket;
@@ -20,10 +20,13 @@
 #define UDSSERVER_H
 
 #include <atomic>
+#include <cstdint>
+#include <deque>
 #include <future>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include <boost/asio.hpp>
 
@@ -42,6 +45,7 @@ class JoynrRuntimeException;
 } // namespace exceptions
 
 class UdsFrameBufferV1;
+class UdsSharedMemoryRingBuffer;
 
 template <typename FRAME>
 class UdsSendQueue;
@@ -64,6 +68,8 @@ public:
     using Received = std::function<void(const system::RoutingTypes::UdsClientAddress&,
                                         smrf::ByteVector&&,
                                         const std::string&)>;
+    using Backpressure =
+            std::function<void(const system::RoutingTypes::UdsClientAddress&, bool isPaused)>;
 
     explicit UdsServer(const UdsSettings& settings);
     ~UdsServer();
@@ -94,6 +100,15 @@ public:
      */
     void setReceiveCallback(const Received& callback);
 
+    /**
+     * @brief Sets callback for the backpressure of a client connection. It is called with isPaused
+     * set to true if the sending queue of the connection reaches its high watermark, and with
+     * isPaused set to false if the queue has been drained to its low watermark or the connection
+     * has been closed.
+     * @param callback Callback
+     */
+    void setBackpressureCallback(const Backpressure& callback);
+
     /** Opens an UNIX domain socket asynchronously and starts the IO thread pool. */
     void start();
 
@@ -102,12 +117,15 @@ private:
     // Default config basically does nothing, everything is just eaten
     struct ConnectionConfig {
         std::size_t _maxSendQueueSize = 0;
+        std::size_t _sharedMemorySize = 0;
         Connected _connectedCallback = [](const system::RoutingTypes::UdsClientAddress&,
                                           std::shared_ptr<IUdsSender>) {};
         Disconnected _disconnectedCallback = [](const system::RoutingTypes::UdsClientAddress&) {};
         Received _receivedCallback = [](const system::RoutingTypes::UdsClientAddress&,
                                         smrf::ByteVector&&,
                                         const std::string&) {};
+        Backpressure _backpressureCallback = [](const system::RoutingTypes::UdsClientAddress&,
+                                                bool) {};
     };
 
     // Connection to remote client
@@ -128,7 +146,9 @@ private:
 
         uds::socket& getSocket();
 
-        void send(const smrf::ByteArrayView& msg, const IUdsSender::SendFailed& callback);
+        void send(const smrf::ByteArrayView& msg,
+                  const IUdsSender::SendFailed& callback,
+                  IUdsSender::Priority priority);
 
         void shutdown();
 
@@ -141,6 +161,14 @@ private:
         void doReadHeader() noexcept;
         void doReadBody() noexcept;
         void doWrite() noexcept;
+        void doReleaseSocketMessages() noexcept;
+        void doCreateSharedMemoryWriter() noexcept;
+        bool sendViaSharedMemory(const smrf::ByteArrayView& msg,
+                                 const IUdsSender::SendFailed& callback,
+                                 boost::asio::io_service& ioContext);
+        void doSignalSharedMemory() noexcept;
+        void doNotifyUnreadSharedMemoryMessages(const std::string& errorMessage) noexcept;
+        void doReadSharedMemory(std::uint64_t writePosition);
         bool doCheck(const boost::system::error_code& ec) noexcept;
         void doClose(const std::string& errorMessage, const std::exception& error) noexcept;
         void doClose(const std::string& errorMessage) noexcept;
@@ -151,6 +179,7 @@ private:
         Connected _connectedCallback;
         Disconnected _disconnectedCallback;
         Received _receivedCallback;
+        Backpressure _backpressureCallback;
 
         std::atomic_bool _isClosed;
 
@@ -162,6 +191,24 @@ private:
         std::unique_ptr<UdsSendQueue<UdsFrameBufferV1>> _sendQueue;
         std::unique_ptr<UdsFrameBufferV1> _readBuffer;
 
+        // Optional shared memory transport, the reader is only accessed by the read-strand
+        std::size_t _sharedMemorySize;
+        std::unique_ptr<UdsSharedMemoryRingBuffer> _sharedMemoryWriter;
+        // Failure callbacks of messages in the shared memory not read by the client yet, with the
+        // write position after the message; protected by _sharedMemoryWriterMutex
+        std::deque<std::pair<std::uint64_t, IUdsSender::SendFailed>> _sharedMemoryUnreadMessages;
+        // A signal frame has been posted to the I/O context but not queued yet; protected by
+        // _sharedMemoryWriterMutex
+        bool _isSharedMemorySignalPosted;
+        // Messages passed to the socket and not yet written since the send queue was empty
+        // last; protected by _sharedMemoryWriterMutex. The shared memory is only used if there
+        // are none.
+        std::size_t _socketMessagesInFlight;
+        // Part of _socketMessagesInFlight already inserted into the send queue; I/O context only
+        std::size_t _socketMessagesQueued;
+        std::mutex _sharedMemoryWriterMutex;
+        std::unique_ptr<UdsSharedMemoryRingBuffer> _sharedMemoryReader;
+
         ADD_LOGGER(Connection)
     };
 
@@ -171,7 +218,9 @@ private:
     public:
         UdsSender(std::weak_ptr<Connection> connection);
         virtual ~UdsSender();
-        void send(const smrf::ByteArrayView& msg, const IUdsSender::SendFailed& callback) override;
+        void send(const smrf::ByteArrayView& msg,
+                  const IUdsSender::SendFailed& callback,
+                  IUdsSender::Priority priority) override;
 
     private:
         std::weak_ptr<Connection> _connection;
@@ -82,6 +82,18 @@ public:
     std::size_t getSendingQueueSize() const;
     void setSendingQueueSize(const std::size_t& queueSize);
 
+    static const std::string& SETTING_SHARED_MEMORY_SIZE();
+    static const std::size_t& DEFAULT_SHARED_MEMORY_SIZE();
+    /**
+     * @brief Get size of the shared memory ring buffer used for sending messages to the peer.
+     * Zero disables the shared memory transport and all messages are sent via the socket. It is
+     * only used if the client announces it in its init-frame and the server has it enabled as
+     * well, hence peers without shared memory support keep working.
+     * @return Size [bytes]
+     */
+    std::size_t getSharedMemorySize() const;
+    void setSharedMemorySize(const std::size_t& sharedMemorySize);
+
     void printSettings() const;
 
     bool contains(const std::string& key) const;
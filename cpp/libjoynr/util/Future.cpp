@@ -28,9 +28,10 @@ namespace exceptions
 {
 std::exception_ptr convertToExceptionPtr(const JoynrException& error);
 std::exception_ptr createJoynrTimeOutException(const std::string& message);
+std::shared_ptr<JoynrException> convertToJoynrException(std::exception_ptr eptr);
 } // namespace exceptions
 
-FutureBase::FutureBase() : _status(StatusCodeEnum::IN_PROGRESS)
+FutureBase::FutureBase() : _status(StatusCodeEnum::IN_PROGRESS), _error(), _continuations()
 {
 }
 
@@ -76,17 +77,92 @@ bool FutureBase::isOk() const
 void FutureBase::onError(std::shared_ptr<exceptions::JoynrException> error)
 {
     JOYNR_LOG_TRACE(logger(), "onError has been invoked");
-    const std::lock_guard<std::mutex> lock{_statusMutex};
-    try {
-        storeException(convertToExceptionPtr(*error));
-        _status = StatusCodeEnum::ERROR;
-    } catch (const std::future_error& e) {
-        JOYNR_LOG_ERROR(logger(),
-                        "While calling onError: future_error caught: {}"
-                        " [_status = {}]",
-                        e.what(),
-                        _status);
+    ContinuationList continuations;
+    {
+        const std::lock_guard<std::mutex> lock{_statusMutex};
+        try {
+            storeException(convertToExceptionPtr(*error));
+            _status = StatusCodeEnum::ERROR;
+            _error = error;
+            continuations = takeContinuations();
+        } catch (const std::future_error& e) {
+            JOYNR_LOG_ERROR(logger(),
+                            "While calling onError: future_error caught: {}"
+                            " [_status = {}]",
+                            e.what(),
+                            _status);
+        }
+    }
+    runContinuations(std::move(continuations), error);
+}
+
+void FutureBase::addContinuation(Continuation continuation, Executor executor)
+{
+    std::shared_ptr<exceptions::JoynrException> error;
+    {
+        const std::lock_guard<std::mutex> lock{_statusMutex};
+        if (!isCompleted()) {
+            _continuations.emplace_back(std::move(continuation), std::move(executor));
+            return;
+        }
+        error = _error;
+    }
+    ContinuationList continuations;
+    continuations.emplace_back(std::move(continuation), std::move(executor));
+    runContinuations(std::move(continuations), error);
+}
+
+void FutureBase::addErrorContinuation(
+        std::function<void(const exceptions::JoynrException&)> continuation,
+        Executor executor)
+{
+    addContinuation(
+            [continuation = std::move(continuation)](
+                    const std::shared_ptr<exceptions::JoynrException>& error) {
+                if (error) {
+                    continuation(*error);
+                }
+            },
+            std::move(executor));
+}
+
+FutureBase::ContinuationList FutureBase::takeContinuations()
+{
+    ContinuationList continuations;
+    continuations.swap(_continuations);
+    return continuations;
+}
+
+void FutureBase::runContinuations(ContinuationList continuations,
+                                  const std::shared_ptr<exceptions::JoynrException>& error)
+{
+    for (auto& continuationAndExecutor : continuations) {
+        auto& continuation = continuationAndExecutor.first;
+        auto& executor = continuationAndExecutor.second;
+        if (!continuation) {
+            continue;
+        }
+        if (executor) {
+            executor([continuation = std::move(continuation), error]() { continuation(error); });
+            continue;
+        }
+        try {
+            continuation(error);
+        } catch (const std::exception& e) {
+            // do not skip the remaining continuations
+            JOYNR_LOG_ERROR(logger(), "Continuation of future threw exception: {}", e.what());
+        }
     }
 }
 
+std::shared_ptr<exceptions::JoynrException> FutureBase::currentExceptionAsJoynrException()
+{
+    return exceptions::convertToJoynrException(std::current_exception());
+}
+
+bool FutureBase::isCompleted() const
+{
+    return _status == StatusCodeEnum::SUCCESS || _status == StatusCodeEnum::ERROR;
+}
+
 } // namespace joynr
@@ -0,0 +1,247 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/MessageTracer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include "joynr/Util.h"
+
+namespace joynr
+{
+namespace tracing
+{
+
+namespace
+{
+
+void appendJsonString(std::ostringstream& stream, const std::string& value)
+{
+    stream << '"';
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            stream << '\\';
+        }
+        stream << c;
+    }
+    stream << '"';
+}
+
+template <typename T>
+void appendBinary(std::string& buffer, const T& value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // namespace
+
+const char* getTracePointName(TracePoint tracePoint)
+{
+    switch (tracePoint) {
+    case TracePoint::CREATED:
+        return "CREATED";
+    case TracePoint::ROUTER_ENTRY:
+        return "ROUTER_ENTRY";
+    case TracePoint::ACL_DONE:
+        return "ACL_DONE";
+    case TracePoint::SCHEDULED:
+        return "SCHEDULED";
+    case TracePoint::TRANSPORT_SEND:
+        return "TRANSPORT_SEND";
+    case TracePoint::RECEIVED:
+        return "RECEIVED";
+    case TracePoint::DISPATCH_START:
+        return "DISPATCH_START";
+    case TracePoint::DISPATCH_END:
+        return "DISPATCH_END";
+    }
+    return "UNKNOWN";
+}
+
+//------ MessageTracer::RingBuffer -------------------------------------------
+
+class MessageTracer::RingBuffer
+{
+public:
+    RingBuffer(std::uint32_t threadIndex, std::size_t capacity)
+            : _mutex(), _threadIndex(threadIndex), _records(capacity), _next(0), _size(0)
+    {
+    }
+
+    void record(TracePoint tracePoint, const std::string& messageId)
+    {
+        const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch());
+        // the mutex is only contended while the buffers are flushed
+        std::lock_guard<std::mutex> lock(_mutex);
+        TraceRecord& traceRecord = _records[_next];
+        traceRecord.timestampNs = static_cast<std::uint64_t>(timestamp.count());
+        traceRecord.threadIndex = _threadIndex;
+        traceRecord.tracePoint = tracePoint;
+        const std::size_t maxMessageIdLength = TraceRecord::MAX_MESSAGE_ID_LENGTH;
+        const std::size_t messageIdLength = std::min(messageId.size(), maxMessageIdLength);
+        traceRecord.messageIdLength = static_cast<std::uint8_t>(messageIdLength);
+        std::memcpy(traceRecord.messageId.data(), messageId.data(), messageIdLength);
+
+        _next = (_next + 1) % _records.size();
+        _size = std::min(_size + 1, _records.size());
+    }
+
+    void appendRecordsTo(std::vector<TraceRecord>& records) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const std::size_t first = (_next + _records.size() - _size) % _records.size();
+        for (std::size_t i = 0; i < _size; ++i) {
+            records.push_back(_records[(first + i) % _records.size()]);
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _next = 0;
+        _size = 0;
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(RingBuffer);
+
+    mutable std::mutex _mutex;
+    const std::uint32_t _threadIndex;
+    std::vector<TraceRecord> _records;
+    std::size_t _next;
+    std::size_t _size;
+};
+
+//------ MessageTracer -------------------------------------------------------
+
+std::atomic<bool> MessageTracer::_isEnabled(false);
+
+MessageTracer::MessageTracer()
+        : _ringBufferCapacity(DEFAULT_RING_BUFFER_CAPACITY), _ringBuffersMutex(), _ringBuffers()
+{
+}
+
+MessageTracer& MessageTracer::instance()
+{
+    static MessageTracer messageTracer;
+    return messageTracer;
+}
+
+void MessageTracer::enable(std::size_t ringBufferCapacity)
+{
+    _ringBufferCapacity = std::max(ringBufferCapacity, std::size_t(1));
+    _isEnabled.store(true, std::memory_order_relaxed);
+}
+
+void MessageTracer::disable()
+{
+    _isEnabled.store(false, std::memory_order_relaxed);
+}
+
+MessageTracer::RingBuffer& MessageTracer::getRingBufferOfCurrentThread()
+{
+    static thread_local std::shared_ptr<RingBuffer> ringBuffer;
+    if (!ringBuffer) {
+        std::lock_guard<std::mutex> lock(_ringBuffersMutex);
+        ringBuffer = std::make_shared<RingBuffer>(
+                static_cast<std::uint32_t>(_ringBuffers.size()), _ringBufferCapacity.load());
+        // the tracer keeps the buffer, so records of terminated threads are not lost
+        _ringBuffers.push_back(ringBuffer);
+    }
+    return *ringBuffer;
+}
+
+void MessageTracer::record(TracePoint tracePoint, const std::string& messageId)
+{
+    getRingBufferOfCurrentThread().record(tracePoint, messageId);
+}
+
+std::vector<TraceRecord> MessageTracer::getRecords() const
+{
+    std::vector<TraceRecord> records;
+    {
+        std::lock_guard<std::mutex> lock(_ringBuffersMutex);
+        for (const auto& ringBuffer : _ringBuffers) {
+            ringBuffer->appendRecordsTo(records);
+        }
+    }
+    std::stable_sort(records.begin(),
+                     records.end(),
+                     [](const TraceRecord& lhs, const TraceRecord& rhs) {
+                         return lhs.timestampNs < rhs.timestampNs;
+                     });
+    return records;
+}
+
+void MessageTracer::clear()
+{
+    std::lock_guard<std::mutex> lock(_ringBuffersMutex);
+    for (auto& ringBuffer : _ringBuffers) {
+        ringBuffer->clear();
+    }
+}
+
+void MessageTracer::flushToFile(const std::string& fileName, Format format)
+{
+    const std::vector<TraceRecord> records = getRecords();
+    clear();
+    const std::string content =
+            (format == Format::BINARY) ? toBinary(records) : toChromeTrace(records);
+    util::saveStringToFile(fileName, content);
+}
+
+std::string MessageTracer::toChromeTrace(const std::vector<TraceRecord>& records)
+{
+    std::ostringstream json;
+    json << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    const char* separator = "";
+    for (const TraceRecord& traceRecord : records) {
+        // timestamps of the trace event format are given in microseconds
+        json << separator << "{\"name\":\"" << getTracePointName(traceRecord.tracePoint)
+             << "\",\"cat\":\"joynr.message\",\"ph\":\"n\",\"pid\":1,\"tid\":"
+             << traceRecord.threadIndex << ",\"ts\":" << traceRecord.timestampNs / 1000 << '.'
+             << traceRecord.timestampNs % 1000 / 100 << traceRecord.timestampNs % 100 / 10
+             << traceRecord.timestampNs % 10 << ",\"id\":";
+        appendJsonString(json, traceRecord.getMessageId());
+        json << '}';
+        separator = ",";
+    }
+    json << "]}";
+    return json.str();
+}
+
+std::string MessageTracer::toBinary(const std::vector<TraceRecord>& records)
+{
+    static constexpr std::uint16_t formatVersion = 1;
+    std::string buffer("JTRC");
+    appendBinary(buffer, formatVersion);
+    for (const TraceRecord& traceRecord : records) {
+        appendBinary(buffer, traceRecord.timestampNs);
+        appendBinary(buffer, traceRecord.threadIndex);
+        appendBinary(buffer, static_cast<std::uint8_t>(traceRecord.tracePoint));
+        appendBinary(buffer, traceRecord.messageIdLength);
+        buffer.append(traceRecord.messageId.data(), traceRecord.messageIdLength);
+    }
+    return buffer;
+}
+
+} // namespace tracing
+} // namespace joynr
@@ -0,0 +1,332 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/Metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include "joynr/TimePoint.h"
+#include "joynr/Util.h"
+
+namespace joynr
+{
+namespace metrics
+{
+
+namespace
+{
+
+std::size_t getMostSignificantBit(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(63 - __builtin_clzll(value));
+#else
+    std::size_t msb = 0;
+    while (value >>= 1) {
+        ++msb;
+    }
+    return msb;
+#endif
+}
+
+void appendJsonString(std::ostringstream& stream, const std::string& value)
+{
+    stream << '"';
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            stream << '\\';
+        }
+        stream << c;
+    }
+    stream << '"';
+}
+
+std::uint64_t getValueAtPercentile(
+        const std::array<std::uint64_t, Histogram::NUMBER_OF_BUCKETS>& buckets,
+        std::uint64_t totalCount,
+        std::uint64_t max,
+        double percentile)
+{
+    if (totalCount == 0) {
+        return 0;
+    }
+    const auto countAtPercentile = static_cast<std::uint64_t>(
+            std::ceil(percentile / 100.0 * static_cast<double>(totalCount)));
+    std::uint64_t cumulativeCount = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        cumulativeCount += buckets[i];
+        if (cumulativeCount >= countAtPercentile && cumulativeCount > 0) {
+            return std::min(Histogram::getBucketUpperBound(i), max);
+        }
+    }
+    return max;
+}
+
+} // namespace
+
+//------ Counter -------------------------------------------------------------
+
+Counter::Counter() : _shards()
+{
+    reset();
+}
+
+std::uint64_t Counter::getValue() const
+{
+    std::uint64_t sum = 0;
+    for (const auto& shard : _shards) {
+        sum += shard.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+void Counter::reset()
+{
+    for (auto& shard : _shards) {
+        shard.value.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t Counter::getShardIndex()
+{
+    static std::atomic<std::size_t> nextShardIndex(0);
+    static thread_local const std::size_t shardIndex =
+            nextShardIndex.fetch_add(1, std::memory_order_relaxed) % NUMBER_OF_SHARDS;
+    return shardIndex;
+}
+
+//------ Histogram -----------------------------------------------------------
+
+Histogram::Histogram() : _buckets(), _sum(0), _min(0), _max(0)
+{
+    reset();
+}
+
+std::size_t Histogram::getBucketIndex(std::uint64_t value)
+{
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<std::size_t>(value);
+    }
+    constexpr std::size_t halfSubBucketCount = SUB_BUCKET_COUNT / 2;
+    const std::size_t msb = getMostSignificantBit(value);
+    const std::size_t shift = msb - (SUB_BUCKET_BITS - 1);
+    const auto subBucket = static_cast<std::size_t>(value >> shift) - halfSubBucketCount;
+    return SUB_BUCKET_COUNT + (msb - SUB_BUCKET_BITS) * halfSubBucketCount + subBucket;
+}
+
+std::uint64_t Histogram::getBucketLowerBound(std::size_t bucketIndex)
+{
+    if (bucketIndex < SUB_BUCKET_COUNT) {
+        return bucketIndex;
+    }
+    constexpr std::size_t halfSubBucketCount = SUB_BUCKET_COUNT / 2;
+    const std::size_t offset = bucketIndex - SUB_BUCKET_COUNT;
+    const std::size_t msb = offset / halfSubBucketCount + SUB_BUCKET_BITS;
+    const std::uint64_t subBucket = offset % halfSubBucketCount + halfSubBucketCount;
+    return subBucket << (msb - (SUB_BUCKET_BITS - 1));
+}
+
+std::uint64_t Histogram::getBucketUpperBound(std::size_t bucketIndex)
+{
+    if (bucketIndex < SUB_BUCKET_COUNT) {
+        return bucketIndex;
+    }
+    constexpr std::size_t halfSubBucketCount = SUB_BUCKET_COUNT / 2;
+    const std::size_t msb = (bucketIndex - SUB_BUCKET_COUNT) / halfSubBucketCount + SUB_BUCKET_BITS;
+    const std::uint64_t bucketWidth = std::uint64_t(1) << (msb - (SUB_BUCKET_BITS - 1));
+    return getBucketLowerBound(bucketIndex) + (bucketWidth - 1);
+}
+
+void Histogram::record(std::uint64_t value)
+{
+    _buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+
+    std::uint64_t currentMin = _min.load(std::memory_order_relaxed);
+    while (value < currentMin &&
+           !_min.compare_exchange_weak(currentMin, value, std::memory_order_relaxed)) {
+    }
+    std::uint64_t currentMax = _max.load(std::memory_order_relaxed);
+    while (value > currentMax &&
+           !_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+    }
+}
+
+HistogramSnapshot Histogram::getSnapshot() const
+{
+    // the snapshot is not atomic as a whole; concurrently recorded values
+    // may be partially contained which is acceptable for monitoring purposes
+    std::array<std::uint64_t, NUMBER_OF_BUCKETS> buckets;
+    std::uint64_t bucketCount = 0;
+    for (std::size_t i = 0; i < NUMBER_OF_BUCKETS; ++i) {
+        buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+        bucketCount += buckets[i];
+    }
+
+    HistogramSnapshot snapshot;
+    snapshot.count = bucketCount;
+    if (bucketCount == 0) {
+        return snapshot;
+    }
+    snapshot.sum = _sum.load(std::memory_order_relaxed);
+    snapshot.min = _min.load(std::memory_order_relaxed);
+    snapshot.max = _max.load(std::memory_order_relaxed);
+    snapshot.p50 = getValueAtPercentile(buckets, bucketCount, snapshot.max, 50.0);
+    snapshot.p90 = getValueAtPercentile(buckets, bucketCount, snapshot.max, 90.0);
+    snapshot.p99 = getValueAtPercentile(buckets, bucketCount, snapshot.max, 99.0);
+    snapshot.p999 = getValueAtPercentile(buckets, bucketCount, snapshot.max, 99.9);
+    return snapshot;
+}
+
+void Histogram::reset()
+{
+    for (auto& bucket : _buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    _sum.store(0, std::memory_order_relaxed);
+    _min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+//------ MetricsRegistry -----------------------------------------------------
+
+MetricsRegistry::MetricsRegistry() : _mutex(), _counters(), _gauges(), _histograms()
+{
+}
+
+MetricsRegistry& MetricsRegistry::instance()
+{
+    static MetricsRegistry metricsRegistry;
+    return metricsRegistry;
+}
+
+std::shared_ptr<Counter> MetricsRegistry::getCounter(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& counter = _counters[name];
+    if (!counter) {
+        counter = std::make_shared<Counter>();
+    }
+    return counter;
+}
+
+std::shared_ptr<Gauge> MetricsRegistry::getGauge(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& gauge = _gauges[name];
+    if (!gauge) {
+        gauge = std::make_shared<Gauge>();
+    }
+    return gauge;
+}
+
+std::shared_ptr<Histogram> MetricsRegistry::getHistogram(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& histogram = _histograms[name];
+    if (!histogram) {
+        histogram = std::make_shared<Histogram>();
+    }
+    return histogram;
+}
+
+std::uint64_t MetricsRegistry::getCounterValue(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto counter = _counters.find(name);
+    return counter == _counters.cend() ? 0 : counter->second->getValue();
+}
+
+std::int64_t MetricsRegistry::getGaugeValue(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto gauge = _gauges.find(name);
+    return gauge == _gauges.cend() ? 0 : gauge->second->getValue();
+}
+
+HistogramSnapshot MetricsRegistry::getHistogramSnapshot(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto histogram = _histograms.find(name);
+    return histogram == _histograms.cend() ? HistogramSnapshot() : histogram->second->getSnapshot();
+}
+
+std::string MetricsRegistry::getMetricsAsJson() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::ostringstream json;
+    json << "{\"timestampMs\":" << TimePoint::now().toMilliseconds();
+
+    json << ",\"counters\":{";
+    const char* separator = "";
+    for (const auto& counter : _counters) {
+        json << separator;
+        appendJsonString(json, counter.first);
+        json << ':' << counter.second->getValue();
+        separator = ",";
+    }
+
+    json << "},\"gauges\":{";
+    separator = "";
+    for (const auto& gauge : _gauges) {
+        json << separator;
+        appendJsonString(json, gauge.first);
+        json << ':' << gauge.second->getValue();
+        separator = ",";
+    }
+
+    json << "},\"histograms\":{";
+    separator = "";
+    for (const auto& histogram : _histograms) {
+        const HistogramSnapshot snapshot = histogram.second->getSnapshot();
+        json << separator;
+        appendJsonString(json, histogram.first);
+        json << ":{\"count\":" << snapshot.count << ",\"sum\":" << snapshot.sum
+             << ",\"min\":" << snapshot.min << ",\"max\":" << snapshot.max
+             << ",\"p50\":" << snapshot.p50 << ",\"p90\":" << snapshot.p90
+             << ",\"p99\":" << snapshot.p99 << ",\"p999\":" << snapshot.p999 << '}';
+        separator = ",";
+    }
+    json << "}}";
+    return json.str();
+}
+
+void MetricsRegistry::dumpToFile(const std::string& fileName) const
+{
+    util::saveStringToFile(fileName, getMetricsAsJson());
+}
+
+void MetricsRegistry::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& counter : _counters) {
+        counter.second->reset();
+    }
+    for (auto& gauge : _gauges) {
+        gauge.second->set(0);
+    }
+    for (auto& histogram : _histograms) {
+        histogram.second->reset();
+    }
+}
+
+} // namespace metrics
+} // namespace joynr
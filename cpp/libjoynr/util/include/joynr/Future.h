@@ -20,13 +20,17 @@
 #define FUTURE_H
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "joynr/Logger.h"
 #include "joynr/PrivateCopyAssign.h"
@@ -40,9 +44,20 @@ namespace exceptions
 class JoynrException;
 } // namespace exceptions
 
+template <class... Ts>
+class Future;
+
 class FutureBase
 {
 public:
+    /**
+     * @brief Runs the given task, e.g. by posting it to a thread pool or an io_service.
+     *
+     * Continuations registered without executor are run inline: either in the thread which
+     * completes the future or, if the future has already completed, in the registering thread.
+     */
+    using Executor = std::function<void(std::function<void()>)>;
+
     virtual ~FutureBase();
 
     /**
@@ -81,6 +96,13 @@ public:
     void onError(std::shared_ptr<exceptions::JoynrException> error);
 
 protected:
+    /**
+     * @brief Continuation which is invoked once the future has completed; the error is
+     * empty if the operation has been successful.
+     */
+    using Continuation = std::function<void(const std::shared_ptr<exceptions::JoynrException>&)>;
+    using ContinuationList = std::vector<std::pair<Continuation, Executor>>;
+
     FutureBase();
 
     virtual void storeException(std::exception_ptr eptr) = 0;
@@ -89,12 +111,74 @@ protected:
 
     virtual void waitForFuture() = 0;
 
+    /**
+     * @brief Registers a continuation which is run as soon as the future has completed,
+     * or immediately if it has already completed.
+     */
+    void addContinuation(Continuation continuation, Executor executor);
+
+    void addErrorContinuation(std::function<void(const exceptions::JoynrException&)> continuation,
+                              Executor executor);
+
+    /**
+     * @brief Completes the future returned by then() with the result of the continuation, or
+     * with its exception converted to a JoynrException.
+     */
+    template <typename Result, typename Function>
+    static void completeWith(Future<Result>& future, Function& function)
+    {
+        completeWith(future, function, std::is_void<Result>{});
+    }
+
+    static std::shared_ptr<exceptions::JoynrException> currentExceptionAsJoynrException();
+
+    template <typename Result, typename Function>
+    static void completeWith(Future<Result>& future, Function& function, std::false_type)
+    {
+        std::shared_ptr<exceptions::JoynrException> error;
+        try {
+            future.onSuccess(function());
+        } catch (...) {
+            error = currentExceptionAsJoynrException();
+        }
+        if (error) {
+            future.onError(std::move(error));
+        }
+    }
+
+    template <typename Result, typename Function>
+    static void completeWith(Future<Result>& future, Function& function, std::true_type)
+    {
+        try {
+            function();
+        } catch (...) {
+            future.onError(currentExceptionAsJoynrException());
+            return;
+        }
+        future.onSuccess();
+    }
+
+    /**
+     * @brief Removes all registered continuations. Must be called while holding _statusMutex
+     * after the future has completed; the returned continuations have to be run afterwards
+     * without holding the lock.
+     */
+    ContinuationList takeContinuations();
+
+    void runContinuations(ContinuationList continuations,
+                          const std::shared_ptr<exceptions::JoynrException>& error);
+
     ADD_LOGGER(FutureBase)
     mutable std::mutex _statusMutex;
     StatusCodeEnum _status;
 
 private:
     DISALLOW_COPY_AND_ASSIGN(FutureBase);
+
+    bool isCompleted() const;
+
+    std::shared_ptr<exceptions::JoynrException> _error;
+    ContinuationList _continuations;
 };
 
 // -------------------------------------------------------------------------------------------------
@@ -159,19 +243,81 @@ public:
     void onSuccess(Ts... results)
     {
         JOYNR_LOG_TRACE(logger(), "onSuccess has been invoked");
-        const std::lock_guard<std::mutex> lock{_statusMutex};
-        try {
-            _resultPromise.set_value(std::make_tuple(std::move(results)...));
-            _status = StatusCodeEnum::SUCCESS;
-        } catch (const std::future_error& e) {
-            JOYNR_LOG_ERROR(logger(),
-                            "While calling onError: future_error caught: {} [_status = {}]",
-                            e.what(),
-                            _status);
+        ContinuationList continuations;
+        {
+            const std::lock_guard<std::mutex> lock{_statusMutex};
+            try {
+                _resultPromise.set_value(std::make_tuple(std::move(results)...));
+                _status = StatusCodeEnum::SUCCESS;
+                continuations = takeContinuations();
+            } catch (const std::future_error& e) {
+                JOYNR_LOG_ERROR(logger(),
+                                "While calling onError: future_error caught: {} [_status = {}]",
+                                e.what(),
+                                _status);
+            }
         }
+        runContinuations(std::move(continuations), nullptr);
+    }
+
+    using FutureBase::onError;
+
+    /**
+     * @brief Registers a continuation which is invoked with the results once the operation
+     * has finished successfully. This does not block and does not require a waiting thread.
+     *
+     * @param continuation Invoked with the typed return values of the request
+     * @param executor Runs the continuation; if empty, the continuation is run inline
+     * @return Future for the return value of the continuation. It fails with the error of this
+     * future, or with the exception thrown by the continuation.
+     */
+    template <typename Function,
+              typename Result = decltype(std::declval<Function&>()(std::declval<const Ts&>()...))>
+    std::shared_ptr<Future<Result>> then(Function continuation, Executor executor = nullptr)
+    {
+        auto nextFuture = std::make_shared<Future<Result>>();
+        addContinuation(
+                [resultFuture = _resultFuture, continuation = std::move(continuation), nextFuture](
+                        const std::shared_ptr<exceptions::JoynrException>& error) mutable {
+                    if (error) {
+                        nextFuture->onError(error);
+                        return;
+                    }
+                    auto invokeContinuation = [&resultFuture, &continuation]() {
+                        return invokeWithResults(continuation,
+                                                 resultFuture.get(),
+                                                 std::index_sequence_for<Ts...>{});
+                    };
+                    completeWith(*nextFuture, invokeContinuation);
+                },
+                std::move(executor));
+        return nextFuture;
+    }
+
+    /**
+     * @brief Registers a continuation which is invoked once the operation has failed.
+     * This does not block and does not require a waiting thread.
+     *
+     * @param continuation Invoked with the JoynrException describing the failure
+     * @param executor Runs the continuation; if empty, the continuation is run inline
+     */
+    void catchError(std::function<void(const exceptions::JoynrException&)> continuation,
+                    Executor executor = nullptr)
+    {
+        addErrorContinuation(std::move(continuation), std::move(executor));
     }
 
 private:
+    using ResultTuple = std::tuple<Ts...>;
+
+    template <typename Function, std::size_t... Indices>
+    static auto invokeWithResults(Function& continuation,
+                                  const ResultTuple& results,
+                                  std::index_sequence<Indices...>)
+    {
+        return continuation(std::get<Indices>(results)...);
+    }
+
     void storeException(std::exception_ptr eptr) override
     {
         _resultPromise.set_exception(std::move(eptr));
@@ -187,8 +333,6 @@ private:
         _resultFuture.wait();
     }
 
-    using ResultTuple = std::tuple<Ts...>;
-
     std::promise<ResultTuple> _resultPromise;
     std::shared_future<ResultTuple> _resultFuture{_resultPromise.get_future()};
 };
@@ -238,16 +382,62 @@ public:
     void onSuccess()
     {
         JOYNR_LOG_TRACE(logger(), "onSuccess has been invoked");
-        const std::lock_guard<std::mutex> lock{_statusMutex};
-        try {
-            _resultPromise.set_value();
-            _status = StatusCodeEnum::SUCCESS;
-        } catch (const std::future_error& e) {
-            JOYNR_LOG_ERROR(logger(),
-                            "While calling onError: future_error caught: {} [_status = {}]",
-                            e.what(),
-                            _status);
+        ContinuationList continuations;
+        {
+            const std::lock_guard<std::mutex> lock{_statusMutex};
+            try {
+                _resultPromise.set_value();
+                _status = StatusCodeEnum::SUCCESS;
+                continuations = takeContinuations();
+            } catch (const std::future_error& e) {
+                JOYNR_LOG_ERROR(logger(),
+                                "While calling onError: future_error caught: {} [_status = {}]",
+                                e.what(),
+                                _status);
+            }
         }
+        runContinuations(std::move(continuations), nullptr);
+    }
+
+    using FutureBase::onError;
+
+    /**
+     * @brief Registers a continuation which is invoked once the operation has finished
+     * successfully. This does not block and does not require a waiting thread.
+     *
+     * @param continuation Invoked after successful completion
+     * @param executor Runs the continuation; if empty, the continuation is run inline
+     * @return Future for the return value of the continuation. It fails with the error of this
+     * future, or with the exception thrown by the continuation.
+     */
+    template <typename Function, typename Result = decltype(std::declval<Function&>()())>
+    std::shared_ptr<Future<Result>> then(Function continuation, Executor executor = nullptr)
+    {
+        auto nextFuture = std::make_shared<Future<Result>>();
+        addContinuation(
+                [continuation = std::move(continuation), nextFuture](
+                        const std::shared_ptr<exceptions::JoynrException>& error) mutable {
+                    if (error) {
+                        nextFuture->onError(error);
+                        return;
+                    }
+                    completeWith(*nextFuture, continuation);
+                },
+                std::move(executor));
+        return nextFuture;
+    }
+
+    /**
+     * @brief Registers a continuation which is invoked once the operation has failed.
+     * This does not block and does not require a waiting thread.
+     *
+     * @param continuation Invoked with the JoynrException describing the failure
+     * @param executor Runs the continuation; if empty, the continuation is run inline
+     */
+    void catchError(std::function<void(const exceptions::JoynrException&)> continuation,
+                    Executor executor = nullptr)
+    {
+        addErrorContinuation(std::move(continuation), std::move(executor));
     }
 
 private:
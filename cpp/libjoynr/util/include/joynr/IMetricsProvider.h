@@ -0,0 +1,79 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef IMETRICSPROVIDER_H
+#define IMETRICSPROVIDER_H
+
+#include <cstdint>
+#include <string>
+
+namespace joynr
+{
+namespace metrics
+{
+
+/**
+ * @brief Point-in-time view of a latency histogram. All values are given in
+ * the unit the histogram was recorded in (microseconds for all built-in metrics).
+ */
+struct HistogramSnapshot {
+    std::uint64_t count = 0;
+    std::uint64_t sum = 0;
+    std::uint64_t min = 0;
+    std::uint64_t max = 0;
+    std::uint64_t p50 = 0;
+    std::uint64_t p90 = 0;
+    std::uint64_t p99 = 0;
+    std::uint64_t p999 = 0;
+};
+
+} // namespace metrics
+
+/**
+ * @brief Local (in-process) read access to the runtime metrics of libjoynr.
+ */
+class IMetricsProvider
+{
+public:
+    virtual ~IMetricsProvider() = default;
+
+    /**
+     * @return the value of the counter with the given name, 0 if it does not exist
+     */
+    virtual std::uint64_t getCounterValue(const std::string& name) const = 0;
+
+    /**
+     * @return the value of the gauge with the given name, 0 if it does not exist
+     */
+    virtual std::int64_t getGaugeValue(const std::string& name) const = 0;
+
+    /**
+     * @return a snapshot of the histogram with the given name, an empty snapshot
+     * if it does not exist
+     */
+    virtual metrics::HistogramSnapshot getHistogramSnapshot(const std::string& name) const = 0;
+
+    /**
+     * @return all registered metrics serialized as a JSON object
+     */
+    virtual std::string getMetricsAsJson() const = 0;
+};
+
+} // namespace joynr
+
+#endif // IMETRICSPROVIDER_H
@@ -0,0 +1,173 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef MESSAGETRACER_H
+#define MESSAGETRACER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/PrivateCopyAssign.h"
+
+/**
+ * Records a lifecycle event of the message with the given id if message tracing is enabled.
+ * The message id expression is only evaluated if tracing is enabled at runtime.
+ * Defining JOYNR_DISABLE_MESSAGE_TRACING removes all trace points at compile time.
+ */
+#ifdef JOYNR_DISABLE_MESSAGE_TRACING
+#define JOYNR_TRACE_MESSAGE(tracePoint, messageId)                                                 \
+    do {                                                                                           \
+    } while (false)
+#else
+#define JOYNR_TRACE_MESSAGE(tracePoint, messageId)                                                 \
+    do {                                                                                           \
+        if (joynr::tracing::MessageTracer::isEnabled()) {                                          \
+            joynr::tracing::MessageTracer::instance().record(                                      \
+                    joynr::tracing::TracePoint::tracePoint, messageId);                            \
+        }                                                                                          \
+    } while (false)
+#endif // JOYNR_DISABLE_MESSAGE_TRACING
+
+namespace joynr
+{
+namespace tracing
+{
+
+/**
+ * @brief Fixed points in the lifecycle of a message
+ */
+enum class TracePoint : std::uint8_t {
+    CREATED = 0,
+    ROUTER_ENTRY,
+    ACL_DONE,
+    SCHEDULED,
+    TRANSPORT_SEND,
+    RECEIVED,
+    DISPATCH_START,
+    DISPATCH_END
+};
+
+const char* getTracePointName(TracePoint tracePoint);
+
+/**
+ * @brief A single recorded lifecycle event
+ */
+struct TraceRecord {
+    static constexpr std::size_t MAX_MESSAGE_ID_LENGTH = 63;
+
+    // nanoseconds of std::chrono::steady_clock
+    std::uint64_t timestampNs;
+    std::uint32_t threadIndex;
+    TracePoint tracePoint;
+    std::uint8_t messageIdLength;
+    std::array<char, MAX_MESSAGE_ID_LENGTH> messageId;
+
+    std::string getMessageId() const
+    {
+        return std::string(messageId.data(), messageIdLength);
+    }
+};
+
+/**
+ * @brief Records message lifecycle events into per-thread ring buffers.
+ *
+ * Every thread writes into its own fixed size ring buffer, so recording does
+ * not contend with other threads and does not allocate once the buffer of the
+ * thread has been created. If a ring buffer is full, the oldest records of
+ * that thread are overwritten.
+ *
+ * Tracing is disabled by default. While disabled, a trace point costs a
+ * single relaxed atomic load.
+ */
+class JOYNR_EXPORT MessageTracer
+{
+public:
+    enum class Format { CHROME_TRACE, BINARY };
+
+    static constexpr std::size_t DEFAULT_RING_BUFFER_CAPACITY = 8192;
+
+    /**
+     * This class is currently implemented as a singleton
+     */
+    static MessageTracer& instance();
+
+    static bool isEnabled()
+    {
+        return _isEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enables tracing
+     * @param ringBufferCapacity the number of records kept per thread; only applied to
+     * ring buffers of threads which did not record anything yet
+     */
+    void enable(std::size_t ringBufferCapacity = DEFAULT_RING_BUFFER_CAPACITY);
+    void disable();
+
+    void record(TracePoint tracePoint, const std::string& messageId);
+
+    /**
+     * @return the content of all ring buffers ordered by timestamp
+     */
+    std::vector<TraceRecord> getRecords() const;
+
+    /**
+     * @brief Writes all recorded events to the given file and clears the ring buffers
+     *
+     * CHROME_TRACE writes the JSON trace event format which can be loaded by
+     * chrome://tracing or Perfetto. Events of the same message share the same
+     * async event id, i.e. the message id.
+     *
+     * BINARY writes a compact format: the magic "JTRC", a format version (uint16)
+     * followed by the records, each consisting of timestampNs (uint64), threadIndex
+     * (uint32), tracePoint (uint8), messageIdLength (uint8) and the message id
+     * without terminating zero. All integers are stored in host byte order.
+     */
+    void flushToFile(const std::string& fileName, Format format);
+
+    static std::string toChromeTrace(const std::vector<TraceRecord>& records);
+    static std::string toBinary(const std::vector<TraceRecord>& records);
+
+    void clear();
+
+private:
+    class RingBuffer;
+
+    MessageTracer();
+    DISALLOW_COPY_AND_ASSIGN(MessageTracer);
+
+    RingBuffer& getRingBufferOfCurrentThread();
+
+    static std::atomic<bool> _isEnabled;
+    std::atomic<std::size_t> _ringBufferCapacity;
+    mutable std::mutex _ringBuffersMutex;
+    std::vector<std::shared_ptr<RingBuffer>> _ringBuffers;
+};
+
+} // namespace tracing
+} // namespace joynr
+
+#endif // MESSAGETRACER_H
@@ -0,0 +1,228 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "joynr/IMetricsProvider.h"
+#include "joynr/JoynrExport.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+namespace metrics
+{
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Monotonically increasing counter.
+ *
+ * The value is split into several cache line aligned shards. Each thread
+ * always increments the same shard, so concurrent increments from different
+ * threads do not contend on the same cache line. Reading sums up all shards.
+ */
+class JOYNR_EXPORT Counter
+{
+public:
+    Counter();
+
+    void increment(std::uint64_t delta = 1)
+    {
+        _shards[getShardIndex()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    std::uint64_t getValue() const;
+    void reset();
+
+    static constexpr std::size_t NUMBER_OF_SHARDS = 16;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(Counter);
+
+    struct alignas(64) Shard {
+        std::atomic<std::uint64_t> value;
+    };
+
+    static std::size_t getShardIndex();
+
+    std::array<Shard, NUMBER_OF_SHARDS> _shards;
+};
+
+/**
+ * @brief Value which can go up and down, e.g. the length of a queue.
+ */
+class JOYNR_EXPORT Gauge
+{
+public:
+    Gauge() : _value(0)
+    {
+    }
+
+    void set(std::int64_t value)
+    {
+        _value.store(value, std::memory_order_relaxed);
+    }
+
+    void increment(std::int64_t delta = 1)
+    {
+        _value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    void decrement(std::int64_t delta = 1)
+    {
+        _value.fetch_sub(delta, std::memory_order_relaxed);
+    }
+
+    std::int64_t getValue() const
+    {
+        return _value.load(std::memory_order_relaxed);
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(Gauge);
+    std::atomic<std::int64_t> _value;
+};
+
+/**
+ * @brief Lock-free histogram with logarithmic buckets (HDR-style).
+ *
+ * Values below SUB_BUCKET_COUNT are recorded exactly. Larger values are
+ * recorded into buckets whose width doubles with every power of two, each power
+ * of two being split into SUB_BUCKET_COUNT / 2 linear sub-buckets. This keeps
+ * the relative error of reported percentiles below 12.5% over the whole
+ * 64 bit value range with a fixed amount of memory.
+ */
+class JOYNR_EXPORT Histogram
+{
+public:
+    static constexpr std::size_t SUB_BUCKET_BITS = 4;
+    static constexpr std::size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr std::size_t NUMBER_OF_BUCKETS =
+            SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS) * (SUB_BUCKET_COUNT / 2);
+
+    Histogram();
+
+    void record(std::uint64_t value);
+
+    /**
+     * @brief Records the time elapsed since start in microseconds
+     */
+    void recordElapsedSince(const Clock::time_point& start)
+    {
+        const auto elapsed =
+                std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+        record(elapsed.count() > 0 ? static_cast<std::uint64_t>(elapsed.count()) : 0);
+    }
+
+    HistogramSnapshot getSnapshot() const;
+    void reset();
+
+    static std::size_t getBucketIndex(std::uint64_t value);
+    static std::uint64_t getBucketLowerBound(std::size_t bucketIndex);
+    static std::uint64_t getBucketUpperBound(std::size_t bucketIndex);
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(Histogram);
+
+    std::array<std::atomic<std::uint64_t>, NUMBER_OF_BUCKETS> _buckets;
+    std::atomic<std::uint64_t> _sum;
+    std::atomic<std::uint64_t> _min;
+    std::atomic<std::uint64_t> _max;
+};
+
+/**
+ * @brief Records the lifetime of the object into a histogram in microseconds
+ */
+class ScopedLatencyRecorder
+{
+public:
+    explicit ScopedLatencyRecorder(Histogram& histogram)
+            : _histogram(histogram), _start(Clock::now())
+    {
+    }
+
+    ~ScopedLatencyRecorder()
+    {
+        _histogram.recordElapsedSince(_start);
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(ScopedLatencyRecorder);
+    Histogram& _histogram;
+    const Clock::time_point _start;
+};
+
+/**
+ * @brief Process wide registry of named metrics.
+ *
+ * Metrics are created on first access and live as long as the process. Looking
+ * up a metric requires a lock, hence callers on hot paths are expected to look
+ * up their metrics once and keep the returned pointer.
+ */
+class JOYNR_EXPORT MetricsRegistry : public IMetricsProvider
+{
+public:
+    /**
+     * This class is currently implemented as a singleton
+     */
+    static MetricsRegistry& instance();
+
+    std::shared_ptr<Counter> getCounter(const std::string& name);
+    std::shared_ptr<Gauge> getGauge(const std::string& name);
+    std::shared_ptr<Histogram> getHistogram(const std::string& name);
+
+    std::uint64_t getCounterValue(const std::string& name) const override;
+    std::int64_t getGaugeValue(const std::string& name) const override;
+    HistogramSnapshot getHistogramSnapshot(const std::string& name) const override;
+    std::string getMetricsAsJson() const override;
+
+    /**
+     * @brief Writes getMetricsAsJson() to the given file, replacing its content
+     */
+    void dumpToFile(const std::string& fileName) const;
+
+    /**
+     * Reset the values of all registered metrics - for use in tests
+     */
+    void reset();
+
+private:
+    MetricsRegistry();
+    DISALLOW_COPY_AND_ASSIGN(MetricsRegistry);
+
+    mutable std::mutex _mutex;
+    std::map<std::string, std::shared_ptr<Counter>> _counters;
+    std::map<std::string, std::shared_ptr<Gauge>> _gauges;
+    std::map<std::string, std::shared_ptr<Histogram>> _histograms;
+};
+
+} // namespace metrics
+} // namespace joynr
+
+#endif // METRICS_H
@@ -0,0 +1,258 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef POOLALLOCATOR_H
+#define POOLALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+namespace util
+{
+
+/**
+ * @brief Process wide pool of memory blocks of a fixed size.
+ *
+ * Released blocks are kept in a bounded free list and handed out again by the
+ * next allocation. Objects which are created and destroyed for every routed
+ * message thus stop going through the general purpose heap once the message
+ * rate is stable, which reduces allocator contention and heap fragmentation in
+ * long running processes. Blocks beyond MAX_FREE_BLOCKS are returned to the heap.
+ *
+ * Every thread keeps up to MAX_CACHED_BLOCKS released blocks in a cache of its own
+ * and exchanges them with the shared free list in batches of TRANSFER_BATCH_SIZE,
+ * so that most allocations and releases do not take the lock. The cache of a thread
+ * is returned to the shared free list when the thread exits.
+ */
+template <std::size_t BlockSize>
+class BlockPool
+{
+public:
+    static constexpr std::size_t MAX_FREE_BLOCKS = 4096;
+    static constexpr std::size_t MAX_CACHED_BLOCKS = 64;
+    static constexpr std::size_t TRANSFER_BATCH_SIZE = MAX_CACHED_BLOCKS / 2;
+
+    static BlockPool& instance()
+    {
+        // intentionally leaked: pooled objects may still be released during static destruction
+        static BlockPool* pool = new BlockPool();
+        return *pool;
+    }
+
+    void* allocate()
+    {
+        if (!isThreadCacheDestroyed()) {
+            ThreadCache& cache = getThreadCache();
+            if (cache._numberOfBlocks == 0) {
+                takeFreeBlocks(cache);
+            }
+            if (cache._numberOfBlocks > 0) {
+                return cache._blocks[--cache._numberOfBlocks];
+            }
+        }
+        return ::operator new(BlockSize);
+    }
+
+    void deallocate(void* block) noexcept
+    {
+        if (isThreadCacheDestroyed()) {
+            // released while the thread exits, after its cache has been destroyed
+            returnFreeBlocks(&block, 1);
+            return;
+        }
+        ThreadCache& cache = getThreadCache();
+        if (cache._numberOfBlocks == MAX_CACHED_BLOCKS) {
+            cache._numberOfBlocks -= TRANSFER_BATCH_SIZE;
+            returnFreeBlocks(cache._blocks + cache._numberOfBlocks, TRANSFER_BATCH_SIZE);
+        }
+        cache._blocks[cache._numberOfBlocks++] = block;
+    }
+
+    /**
+     * @return number of blocks in the shared free list, blocks cached by threads are not counted
+     */
+    std::size_t getNumberOfFreeBlocks() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _freeBlocks.size();
+    }
+
+    /**
+     * @return number of blocks cached by the calling thread
+     */
+    std::size_t getNumberOfCachedBlocks() const
+    {
+        return isThreadCacheDestroyed() ? 0 : getThreadCache()._numberOfBlocks;
+    }
+
+private:
+    struct ThreadCache {
+        ThreadCache() : _blocks(), _numberOfBlocks(0)
+        {
+        }
+
+        ~ThreadCache()
+        {
+            instance().returnFreeBlocks(_blocks, _numberOfBlocks);
+            isThreadCacheDestroyed() = true;
+        }
+
+        DISALLOW_COPY_AND_ASSIGN(ThreadCache);
+
+        void* _blocks[MAX_CACHED_BLOCKS];
+        std::size_t _numberOfBlocks;
+    };
+
+    BlockPool() : _mutex(), _freeBlocks()
+    {
+        // never reallocate while holding the lock; push_back in deallocate cannot throw
+        _freeBlocks.reserve(MAX_FREE_BLOCKS);
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(BlockPool);
+
+    static ThreadCache& getThreadCache()
+    {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+
+    static bool& isThreadCacheDestroyed()
+    {
+        // trivially destructible, hence still valid after the cache has been destroyed
+        static thread_local bool isDestroyed = false;
+        return isDestroyed;
+    }
+
+    void takeFreeBlocks(ThreadCache& cache)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        while (cache._numberOfBlocks < TRANSFER_BATCH_SIZE && !_freeBlocks.empty()) {
+            cache._blocks[cache._numberOfBlocks++] = _freeBlocks.back();
+            _freeBlocks.pop_back();
+        }
+    }
+
+    void returnFreeBlocks(void* const* blocks, std::size_t numberOfBlocks) noexcept
+    {
+        std::size_t numberOfReturnedBlocks = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            while (numberOfReturnedBlocks < numberOfBlocks &&
+                   _freeBlocks.size() < MAX_FREE_BLOCKS) {
+                _freeBlocks.push_back(blocks[numberOfReturnedBlocks++]);
+            }
+        }
+        for (std::size_t i = numberOfReturnedBlocks; i < numberOfBlocks; ++i) {
+            ::operator delete(blocks[i]);
+        }
+    }
+
+    mutable std::mutex _mutex;
+    std::vector<void*> _freeBlocks;
+};
+
+template <std::size_t BlockSize>
+constexpr std::size_t BlockPool<BlockSize>::MAX_FREE_BLOCKS;
+
+template <std::size_t BlockSize>
+constexpr std::size_t BlockPool<BlockSize>::MAX_CACHED_BLOCKS;
+
+template <std::size_t BlockSize>
+constexpr std::size_t BlockPool<BlockSize>::TRANSFER_BATCH_SIZE;
+
+/**
+ * @brief Allocator serving single objects from the BlockPool matching their size.
+ *
+ * Sizes are rounded up to the fundamental alignment so that types of similar size
+ * share a pool. Arrays are allocated from the heap.
+ */
+template <typename T>
+class PoolAllocator
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+public:
+    using value_type = T;
+
+    static constexpr std::size_t getBlockSize()
+    {
+        return (sizeof(T) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) *
+               alignof(std::max_align_t);
+    }
+
+    using Pool = BlockPool<getBlockSize()>;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(Pool::instance().allocate());
+    }
+
+    void deallocate(T* pointer, std::size_t n) noexcept
+    {
+        if (n != 1) {
+            ::operator delete(pointer);
+            return;
+        }
+        Pool::instance().deallocate(pointer);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) noexcept
+{
+    return false;
+}
+
+/**
+ * @brief Like std::make_shared, but object and control block come from a BlockPool
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> makePooledShared(Args&&... args)
+{
+    return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+} // namespace util
+} // namespace joynr
+
+#endif // POOLALLOCATOR_H
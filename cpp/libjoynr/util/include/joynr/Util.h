@@ -20,6 +20,7 @@
 #define UTIL_H
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <ios>
 #include <iterator>
@@ -124,6 +125,34 @@ void appendStringToFile(const std::string& fileName,
  */
 std::string createUuid();
 
+/**
+ * @brief Computes the 64 bit FNV-1a hash of a method name.
+ *
+ * Being constexpr, the hash of a string literal can be used as case label. Generated
+ * RequestInterpreters use it to dispatch an incoming request with a single switch
+ * instead of comparing the method name against every method of the interface.
+ */
+constexpr std::uint64_t getMethodNameHash(const char* name, std::size_t length)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(name[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+template <std::size_t N>
+constexpr std::uint64_t getMethodNameHash(const char (&name)[N])
+{
+    return getMethodNameHash(name, N - 1);
+}
+
+inline std::uint64_t getMethodNameHash(const std::string& name)
+{
+    return getMethodNameHash(name.data(), name.size());
+}
+
 template <typename T>
 std::set<T> vectorToSet(const std::vector<T>& v)
 {
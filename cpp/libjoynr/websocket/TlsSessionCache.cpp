@@ -0,0 +1,205 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/TlsSessionCache.h"
+
+#include <tuple>
+
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
+
+namespace joynr
+{
+
+namespace
+{
+void freeExData(void* parent, void* ptr, CRYPTO_EX_DATA* ad, int idx, long argl, void* argp)
+{
+    std::ignore = parent;
+    std::ignore = ad;
+    std::ignore = idx;
+    std::ignore = argl;
+    std::ignore = argp;
+    delete static_cast<std::shared_ptr<TlsSessionCache>*>(ptr);
+}
+
+std::string getFingerprint(const std::string& credentials)
+{
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLength = 0;
+    if (EVP_Digest(credentials.data(),
+                   credentials.size(),
+                   digest,
+                   &digestLength,
+                   EVP_sha256(),
+                   nullptr) != 1) {
+        // never matches a fingerprint, i.e. sessions are not resumed across contexts
+        return std::string();
+    }
+    return std::string(reinterpret_cast<const char*>(digest), digestLength);
+}
+} // namespace
+
+TlsSessionCache::TlsSessionCache(const std::string& metricsPrefix)
+        : _mutex(),
+          _session(nullptr),
+          _credentialsFingerprint(),
+          _isHandshakeInProgress(false),
+          _handshakeStart(),
+          _handshakeLatency(metrics::MetricsRegistry::instance().getHistogram(
+                  metricsPrefix + ".handshake.latencyUs")),
+          _fullHandshakes(
+                  metrics::MetricsRegistry::instance().getCounter(metricsPrefix + ".handshake.full")),
+          _resumedHandshakes(metrics::MetricsRegistry::instance().getCounter(
+                  metricsPrefix + ".handshake.resumed"))
+{
+}
+
+TlsSessionCache::~TlsSessionCache()
+{
+    clear();
+}
+
+int TlsSessionCache::getExDataIndex()
+{
+    static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, freeExData);
+    return index;
+}
+
+void TlsSessionCache::attachTo(ssl_ctx_st* context, const std::string& credentials)
+{
+    if (context == nullptr) {
+        return;
+    }
+    const std::string credentialsFingerprint = getFingerprint(credentials);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (credentialsFingerprint.empty() || credentialsFingerprint != _credentialsFingerprint) {
+            if (_session != nullptr) {
+                JOYNR_LOG_DEBUG(logger(), "TLS credentials changed, dropping cached session");
+                SSL_SESSION_free(_session);
+                _session = nullptr;
+            }
+            _credentialsFingerprint = credentialsFingerprint;
+        }
+    }
+    auto* self = new std::shared_ptr<TlsSessionCache>(shared_from_this());
+    if (SSL_CTX_set_ex_data(context, getExDataIndex(), self) != 1) {
+        JOYNR_LOG_ERROR(logger(), "Unable to attach TLS session cache, sessions are not resumed");
+        delete self;
+        return;
+    }
+    // sessions are only kept in this cache, the internal cache of the context is server side
+    SSL_CTX_set_session_cache_mode(
+            context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(context, &TlsSessionCache::onNewSession);
+    SSL_CTX_set_info_callback(context, &TlsSessionCache::onInfo);
+}
+
+bool TlsSessionCache::hasSession() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _session != nullptr;
+}
+
+void TlsSessionCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_session != nullptr) {
+        SSL_SESSION_free(_session);
+        _session = nullptr;
+    }
+}
+
+std::shared_ptr<TlsSessionCache> TlsSessionCache::fromSsl(const ssl_st* ssl)
+{
+    const auto* self = static_cast<std::shared_ptr<TlsSessionCache>*>(
+            SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), getExDataIndex()));
+    return self ? *self : nullptr;
+}
+
+int TlsSessionCache::onNewSession(ssl_st* ssl, ssl_session_st* session)
+{
+    if (auto cache = fromSsl(ssl)) {
+        cache->storeSession(session);
+        // the cache took over the reference of the session
+        return 1;
+    }
+    return 0;
+}
+
+void TlsSessionCache::onInfo(const ssl_st* ssl, int where, int ret)
+{
+    std::ignore = ret;
+    if ((where & (SSL_CB_HANDSHAKE_START | SSL_CB_HANDSHAKE_DONE)) == 0) {
+        return;
+    }
+    auto cache = fromSsl(ssl);
+    if (!cache) {
+        return;
+    }
+    if (where & SSL_CB_HANDSHAKE_START) {
+        // the session must be offered before the ClientHello is written, which happens right
+        // after this callback. There is no other hook for connections created by mosquitto.
+        cache->onHandshakeStart(const_cast<ssl_st*>(ssl));
+    } else {
+        cache->onHandshakeDone(ssl);
+    }
+}
+
+void TlsSessionCache::storeSession(ssl_session_st* session)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_session != nullptr) {
+        SSL_SESSION_free(_session);
+    }
+    _session = session;
+}
+
+void TlsSessionCache::onHandshakeStart(ssl_st* ssl)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isHandshakeInProgress = true;
+    _handshakeStart = metrics::Clock::now();
+    if (_session != nullptr && SSL_get_session(ssl) == nullptr) {
+        if (SSL_set_session(ssl, _session) != 1) {
+            JOYNR_LOG_WARN(logger(), "Unable to offer cached TLS session, doing full handshake");
+        }
+    }
+}
+
+void TlsSessionCache::onHandshakeDone(const ssl_st* ssl)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    // post handshake messages (e.g. TLS 1.3 session tickets) may report a completed handshake
+    // again, only the initial handshake is measured
+    if (!_isHandshakeInProgress) {
+        return;
+    }
+    _isHandshakeInProgress = false;
+    _handshakeLatency->recordElapsedSince(_handshakeStart);
+    if (SSL_session_reused(const_cast<ssl_st*>(ssl)) == 1) {
+        _resumedHandshakes->increment();
+        JOYNR_LOG_TRACE(logger(), "TLS session resumed");
+    } else {
+        _fullHandshakes->increment();
+        JOYNR_LOG_TRACE(logger(), "full TLS handshake done");
+    }
+}
+
+} // namespace joynr
@@ -28,6 +28,8 @@
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Message.h"
+#include "joynr/PoolAllocator.h"
+#include "joynr/TrackingInfo.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/serializer/Serializer.h"
 
@@ -58,7 +60,7 @@ void WebSocketLibJoynrMessagingSkeleton::onMessageReceived(smrf::ByteVector&& me
     // deserialize message and transmit
     std::shared_ptr<ImmutableMessage> immutableMessage;
     try {
-        immutableMessage = std::make_shared<ImmutableMessage>(std::move(message));
+        immutableMessage = util::makePooledShared<ImmutableMessage>(std::move(message));
     } catch (const smrf::EncodingException& e) {
         JOYNR_LOG_ERROR(logger(), "Unable to deserialize message - error: {}", e.what());
         return;
@@ -72,7 +74,7 @@ void WebSocketLibJoynrMessagingSkeleton::onMessageReceived(smrf::ByteVector&& me
     }
 
     if (logger().getLogLevel() == LogLevel::Debug) {
-        JOYNR_LOG_DEBUG(logger(), "<<< INCOMING <<< {}", immutableMessage->getTrackingInfo());
+        JOYNR_LOG_DEBUG(logger(), "<<< INCOMING <<< {}", TrackingInfo(*immutableMessage));
     } else {
         JOYNR_LOG_TRACE(logger(), "<<< INCOMING <<< {}", immutableMessage->toLogMessage());
     }
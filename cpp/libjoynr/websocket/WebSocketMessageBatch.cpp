@@ -0,0 +1,68 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "WebSocketMessageBatch.h"
+
+#include <cstdint>
+
+namespace joynr
+{
+
+constexpr std::size_t WebSocketMessageBatch::SIZE_PREFIX_LENGTH;
+
+const std::string& WebSocketMessageBatch::SUBPROTOCOL()
+{
+    static const std::string value("joynr-smrf-batch");
+    return value;
+}
+
+void WebSocketMessageBatch::append(std::string& frame, const smrf::ByteArrayView& message)
+{
+    const auto size = static_cast<std::uint32_t>(message.size());
+    const char sizePrefix[SIZE_PREFIX_LENGTH] = {static_cast<char>((size >> 24) & 0xFF),
+                                                 static_cast<char>((size >> 16) & 0xFF),
+                                                 static_cast<char>((size >> 8) & 0xFF),
+                                                 static_cast<char>(size & 0xFF)};
+    frame.append(sizePrefix, SIZE_PREFIX_LENGTH);
+    frame.append(reinterpret_cast<const char*>(message.data()), message.size());
+}
+
+bool WebSocketMessageBatch::split(const std::string& frame,
+                                  const std::function<void(smrf::ByteVector&&)>& onMessage)
+{
+    const auto* data = reinterpret_cast<const std::uint8_t*>(frame.data());
+    std::size_t offset = 0;
+    while (offset < frame.size()) {
+        if (frame.size() - offset < SIZE_PREFIX_LENGTH) {
+            return false;
+        }
+        const std::size_t size = (static_cast<std::size_t>(data[offset]) << 24) |
+                                 (static_cast<std::size_t>(data[offset + 1]) << 16) |
+                                 (static_cast<std::size_t>(data[offset + 2]) << 8) |
+                                 static_cast<std::size_t>(data[offset + 3]);
+        offset += SIZE_PREFIX_LENGTH;
+        if (frame.size() - offset < size) {
+            return false;
+        }
+        onMessage(smrf::ByteVector(data + offset, data + offset + size));
+        offset += size;
+    }
+    return true;
+}
+
+} // namespace joynr
@@ -0,0 +1,62 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef WEBSOCKETMESSAGEBATCH_H
+#define WEBSOCKETMESSAGEBATCH_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include <smrf/ByteArrayView.h>
+#include <smrf/ByteVector.h>
+
+namespace joynr
+{
+
+/**
+ * @brief Framing which packs several SMRF messages into a single WebSocket frame.
+ *
+ * It is only used on connections which negotiated the WebSocket subprotocol SUBPROTOCOL().
+ * On such connections every binary frame in both directions is a batch, i.e. a sequence of
+ * messages each preceded by its size as 32 bit unsigned integer in network byte order.
+ */
+class WebSocketMessageBatch
+{
+public:
+    static const std::string& SUBPROTOCOL();
+
+    /**
+     * @brief Appends the message including its size prefix to the frame
+     */
+    static void append(std::string& frame, const smrf::ByteArrayView& message);
+
+    /**
+     * @brief Calls onMessage for every message contained in the frame
+     * @return false if the frame is malformed; messages preceding the malformed part
+     * have already been passed to onMessage
+     */
+    static bool split(const std::string& frame,
+                      const std::function<void(smrf::ByteVector&&)>& onMessage);
+
+    static constexpr std::size_t SIZE_PREFIX_LENGTH = 4;
+};
+
+} // namespace joynr
+
+#endif // WEBSOCKETMESSAGEBATCH_H
@@ -22,6 +22,8 @@
 
 #include "joynr/IWebSocketSendInterface.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Metrics.h"
+#include "joynr/TrackingInfo.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/serializer/Serializer.h"
 
@@ -37,6 +39,9 @@ void WebSocketMessagingStub::transmit(
         std::shared_ptr<ImmutableMessage> message,
         const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure)
 {
+    static const std::shared_ptr<metrics::Histogram> sendLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("transport.websocket.send.latencyUs");
+    metrics::ScopedLatencyRecorder sendLatencyRecorder(*sendLatencyHistogram);
 
     if (!_webSocket->isInitialized()) {
         JOYNR_LOG_WARN(logger(),
@@ -48,7 +53,7 @@ void WebSocketMessagingStub::transmit(
     }
 
     if (logger().getLogLevel() == LogLevel::Debug) {
-        JOYNR_LOG_DEBUG(logger(), ">>> OUTGOING >>> {}", message->getTrackingInfo());
+        JOYNR_LOG_DEBUG(logger(), ">>> OUTGOING >>> {}", TrackingInfo(*message));
     } else {
         JOYNR_LOG_TRACE(logger(), ">>> OUTGOING >>> {}", message->toLogMessage());
     }
@@ -40,6 +40,7 @@
 #include "joynr/system/RoutingTypes/WebSocketProtocol.h"
 
 #include "IWebSocketPpClient.h"
+#include "WebSocketMessageBatch.h"
 #include "WebSocketPpReceiver.h"
 #include "WebSocketPpSender.h"
 
@@ -64,6 +65,8 @@ public:
               _performingInitialConnect(true),
               _address(),
               _reconnectSleepTimeMs(wsSettings.getReconnectSleepTimeMs()),
+              _isMessageBatchingEnabled(wsSettings.isMessageBatchingEnabled()),
+              _isBatchingNegotiated(false),
               _sender(nullptr),
               _receiver(),
               _isShuttingDown(false),
@@ -94,10 +97,14 @@ public:
                 std::bind(&WebSocketPpClient::onConnectionFailed, this, std::placeholders::_1));
         _endpoint.set_close_handler(
                 std::bind(&WebSocketPpClient::onConnectionClosed, this, std::placeholders::_1));
-        _endpoint.set_message_handler(std::bind(&WebSocketPpReceiver<Client>::onMessageReceived,
-                                                &_receiver,
-                                                std::placeholders::_1,
-                                                std::placeholders::_2));
+        _endpoint.set_message_handler(
+                [this](ConnectionHandle hdl, typename Client::message_ptr message) {
+                    if (_isBatchingNegotiated) {
+                        _receiver.onBatchedMessageReceived(std::move(hdl), std::move(message));
+                    } else {
+                        _receiver.onMessageReceived(std::move(hdl), std::move(message));
+                    }
+                });
 
         _sender = std::make_shared<WebSocketPpSender<Client>>(_endpoint);
     }
@@ -243,6 +250,15 @@ private:
             return;
         }
 
+        if (_isMessageBatchingEnabled) {
+            connectionPtr->add_subprotocol(WebSocketMessageBatch::SUBPROTOCOL(), websocketError);
+            if (websocketError) {
+                JOYNR_LOG_WARN(logger(),
+                               "could not request message batching - error: {}",
+                               websocketError.message());
+            }
+        }
+
         _state = State::Connecting;
         _sender->resetConnectionHandle();
         _endpoint.connect(connectionPtr);
@@ -279,9 +295,17 @@ private:
     void onConnectionOpened(ConnectionHandle hdl)
     {
         _connection = hdl;
+        ConnectionPtr connectionPtr = _endpoint.get_con_from_hdl(hdl);
+        // older cluster controllers do not select the subprotocol and keep
+        // receiving one message per frame
+        _isBatchingNegotiated =
+                connectionPtr->get_subprotocol() == WebSocketMessageBatch::SUBPROTOCOL();
+        _sender->setBatchingEnabled(_isBatchingNegotiated);
         _sender->setConnectionHandle(_connection);
         _state = State::Connected;
-        JOYNR_LOG_INFO(logger(), "connection established");
+        JOYNR_LOG_INFO(logger(),
+                       "connection established, message batching {}",
+                       _isBatchingNegotiated ? "enabled" : "disabled");
 
         if (_performingInitialConnect) {
             if (_onConnectionOpenedCallback) {
@@ -340,6 +364,8 @@ private:
     // store address for reconnect
     system::RoutingTypes::WebSocketAddress _address;
     std::chrono::milliseconds _reconnectSleepTimeMs;
+    const bool _isMessageBatchingEnabled;
+    std::atomic<bool> _isBatchingNegotiated;
 
     std::function<void()> _onConnectionOpenedCallback;
     std::function<void()> _onConnectionClosedCallback;
@@ -27,6 +27,7 @@
 
 #include "joynr/IKeychain.h"
 #include "joynr/Logger.h"
+#include "joynr/TlsSessionCache.h"
 #include "joynr/WebSocketSettings.h"
 
 namespace joynr
@@ -34,7 +35,8 @@ namespace joynr
 WebSocketPpClientTLS::WebSocketPpClientTLS(const WebSocketSettings& wsSettings,
                                            boost::asio::io_service& ioService,
                                            std::shared_ptr<joynr::IKeychain> keyChain)
-        : WebSocketPpClient<websocketpp::config::asio_tls_client>(wsSettings, ioService)
+        : WebSocketPpClient<websocketpp::config::asio_tls_client>(wsSettings, ioService),
+          _tlsSessionCache(std::make_shared<TlsSessionCache>("transport.websocket.tls"))
 {
     _endpoint.set_tls_init_handler(
             [this, keyChain](ConnectionHandle hdl) -> std::shared_ptr<SSLContext> {
@@ -84,6 +86,10 @@ std::shared_ptr<WebSocketPpClientTLS::SSLContext> WebSocketPpClientTLS::createSS
             return preverified;
         };
         sslContext->set_verify_callback(std::move(clientCertCheck));
+
+        // a rotated keychain invalidates the cached session
+        _tlsSessionCache->attachTo(sslContext->native_handle(),
+                                   certificatePem + certificateAuthorityCertificatePem);
     } catch (boost::system::system_error& e) {
         JOYNR_LOG_FATAL(logger(), "Failed to initialize TLS session {}", e.what());
         return nullptr;
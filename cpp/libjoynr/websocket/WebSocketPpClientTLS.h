@@ -21,11 +21,14 @@
 
 #include "WebSocketPpClient.h"
 
+#include <memory>
+
 #include "joynr/BoostIoserviceForwardDecl.h"
 
 namespace joynr
 {
 class IKeychain;
+class TlsSessionCache;
 class WebSocketSettings;
 
 class WebSocketPpClientTLS : public WebSocketPpClient<websocketpp::config::asio_tls_client>
@@ -39,6 +42,9 @@ public:
 
 private:
     std::shared_ptr<SSLContext> createSSLContext(std::shared_ptr<IKeychain> keyChain);
+
+    // shared by the contexts of all connections so that reconnects resume the last session
+    std::shared_ptr<TlsSessionCache> _tlsSessionCache;
 };
 
 } // namespace joynr
@@ -27,6 +27,8 @@
 
 #include "joynr/Logger.h"
 
+#include "WebSocketMessageBatch.h"
+
 namespace joynr
 {
 
@@ -69,6 +71,32 @@ public:
         }
     }
 
+    /**
+     * @brief Handles frames of connections which negotiated WebSocketMessageBatch::SUBPROTOCOL()
+     */
+    void onBatchedMessageReceived(ConnectionHandle hdl, MessagePtr message)
+    {
+        using websocketpp::frame::opcode::value;
+        const value mode = message->get_opcode();
+        if (mode != value::binary) {
+            JOYNR_LOG_ERROR(
+                    logger(), "received unsupported message type {}, dropping message", mode);
+            return;
+        }
+        JOYNR_LOG_TRACE(
+                logger(), "incoming binary batch of size {}", message->get_payload().size());
+        if (!onMessageReceivedCallback) {
+            return;
+        }
+        const bool isValidBatch = WebSocketMessageBatch::split(
+                message->get_payload(), [this, &hdl](smrf::ByteVector&& rawMessage) {
+                    onMessageReceivedCallback(ConnectionHandle(hdl), std::move(rawMessage));
+                });
+        if (!isValidBatch) {
+            JOYNR_LOG_ERROR(logger(), "received malformed message batch, dropping remainder");
+        }
+    }
+
 private:
     std::function<void(ConnectionHandle&&, smrf::ByteVector&&)> onMessageReceivedCallback;
 
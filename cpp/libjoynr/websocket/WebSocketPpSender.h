@@ -19,7 +19,13 @@
 #ifndef WEBSOCKETPPSENDER_H
 #define WEBSOCKETPPSENDER_H
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <smrf/ByteVector.h>
 #include <websocketpp/error.hpp>
@@ -27,38 +33,67 @@
 #include "joynr/IWebSocketSendInterface.h"
 #include "joynr/Logger.h"
 
+#include "WebSocketMessageBatch.h"
+
 namespace joynr
 {
 
+/**
+ * @brief Sends messages via a websocketpp endpoint.
+ *
+ * If message batching has been negotiated for the connection, messages are not sent one per
+ * frame. As long as the previous frame has not been taken over by the socket yet (i.e. the
+ * buffered amount of the connection is not zero), messages are collected and sent together in
+ * the next frame (see WebSocketMessageBatch). An idle connection thus sends a single message
+ * immediately, while a busy connection sends fewer, larger frames. The collected messages are
+ * limited to _MAX_PENDING_FRAME_SIZE, further messages are rejected until the frame is sent.
+ */
 template <typename Endpoint>
-class WebSocketPpSender final : public IWebSocketSendInterface
+class WebSocketPpSender final : public IWebSocketSendInterface,
+                                public std::enable_shared_from_this<WebSocketPpSender<Endpoint>>
 {
 protected:
     using ConnectionHandle = websocketpp::connection_hdl;
 
 public:
-    WebSocketPpSender(Endpoint& endpoint) : _endpoint(endpoint), _connectionHandle()
+    using OnFailure = std::function<void(const exceptions::JoynrRuntimeException&)>;
+
+    WebSocketPpSender(Endpoint& endpoint)
+            : _endpoint(endpoint),
+              _connectionHandle(),
+              _isBatchingEnabled(false),
+              _batchMutex(),
+              _pendingFrame(),
+              _pendingOnFailure(),
+              _isFlushing(false),
+              _MAX_PENDING_FRAME_SIZE(1024 * 1024),
+              _FLUSH_RETRY_INTERVAL_MS(1)
     {
     }
 
     ~WebSocketPpSender() = default;
 
-    void send(
-            const smrf::ByteArrayView& msg,
-            const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure) override
+    void send(const smrf::ByteArrayView& msg, const OnFailure& onFailure) override
     {
         JOYNR_LOG_TRACE(logger(), "outgoing binary message of size {}", msg.size());
-        websocketpp::lib::error_code websocketError;
-        _endpoint.send(_connectionHandle,
-                       msg.data(),
-                       msg.size(),
-                       websocketpp::frame::opcode::binary,
-                       websocketError);
-        if (websocketError) {
-            onFailure(exceptions::JoynrDelayMessageException(
-                    "Error sending binary message via WebSocketPpSender: " +
-                    websocketError.message()));
+        if (!_isBatchingEnabled) {
+            websocketpp::lib::error_code websocketError;
+            sendFrame(msg.data(), msg.size(), websocketError);
+            if (websocketError) {
+                onFailure(createSendException(websocketError));
+            }
+            return;
         }
+        sendBatched(msg, onFailure);
+    }
+
+    /**
+     * @brief Enables or disables packing multiple messages into a single frame.
+     * Must only be enabled if the peer negotiated WebSocketMessageBatch::SUBPROTOCOL()
+     */
+    void setBatchingEnabled(bool enabled)
+    {
+        _isBatchingEnabled = enabled;
     }
 
     /**
@@ -100,8 +135,122 @@ public:
     }
 
 private:
+    void sendBatched(const smrf::ByteArrayView& msg, const OnFailure& onFailure)
+    {
+        std::unique_lock<std::mutex> lock(_batchMutex);
+        if (!_pendingFrame.empty() &&
+            _pendingFrame.size() + msg.size() > _MAX_PENDING_FRAME_SIZE) {
+            lock.unlock();
+            onFailure(exceptions::JoynrDelayMessageException(
+                    "Error sending binary message via WebSocketPpSender: send queue is full"));
+            return;
+        }
+        WebSocketMessageBatch::append(_pendingFrame, msg);
+        _pendingOnFailure.push_back(onFailure);
+        if (_isFlushing) {
+            // the thread currently sending or the flush timer picks up the message
+            return;
+        }
+        _isFlushing = true;
+        flushPendingFrames(lock);
+    }
+
+    /**
+     * Sends the pending messages unless the previous frame is still buffered by the connection.
+     * In that case the messages are held back and the flush is retried by a timer of the
+     * connection. Must be called with _isFlushing set, resets it once nothing is pending.
+     */
+    void flushPendingFrames(std::unique_lock<std::mutex>& lock)
+    {
+        while (!_pendingFrame.empty()) {
+            lock.unlock();
+            if (getBufferedAmount() > 0 && scheduleFlush()) {
+                // keeps _isFlushing, the timer continues
+                return;
+            }
+            lock.lock();
+
+            std::string frame;
+            frame.swap(_pendingFrame);
+            std::vector<OnFailure> onFailureCallbacks;
+            onFailureCallbacks.swap(_pendingOnFailure);
+            lock.unlock();
+
+            JOYNR_LOG_TRACE(logger(),
+                            "outgoing batch of {} messages, size {}",
+                            onFailureCallbacks.size(),
+                            frame.size());
+            websocketpp::lib::error_code websocketError;
+            sendFrame(frame.data(), frame.size(), websocketError);
+            if (websocketError) {
+                const auto exception = createSendException(websocketError);
+                for (const auto& callback : onFailureCallbacks) {
+                    callback(exception);
+                }
+            }
+
+            lock.lock();
+        }
+        _isFlushing = false;
+    }
+
+    std::size_t getBufferedAmount() const
+    {
+        websocketpp::lib::error_code websocketError;
+        typename Endpoint::connection_ptr connection =
+                _endpoint.get_con_from_hdl(_connectionHandle, websocketError);
+        if (websocketError || !connection) {
+            return 0;
+        }
+        return connection->get_buffered_amount();
+    }
+
+    bool scheduleFlush()
+    {
+        websocketpp::lib::error_code websocketError;
+        typename Endpoint::connection_ptr connection =
+                _endpoint.get_con_from_hdl(_connectionHandle, websocketError);
+        if (websocketError || !connection) {
+            return false;
+        }
+        std::weak_ptr<WebSocketPpSender> thisWeakPtr = this->shared_from_this();
+        // the handler is also called if the timer is cancelled by closing the connection, the
+        // pending messages are failed by the send attempt then
+        connection->set_timer(
+                _FLUSH_RETRY_INTERVAL_MS, [thisWeakPtr](const websocketpp::lib::error_code&) {
+                    if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                        std::unique_lock<std::mutex> lock(thisSharedPtr->_batchMutex);
+                        thisSharedPtr->flushPendingFrames(lock);
+                    }
+                });
+        return true;
+    }
+
+    void sendFrame(const void* data, std::size_t size, websocketpp::lib::error_code& websocketError)
+    {
+        _endpoint.send(_connectionHandle,
+                       data,
+                       size,
+                       websocketpp::frame::opcode::binary,
+                       websocketError);
+    }
+
+    static exceptions::JoynrDelayMessageException createSendException(
+            const websocketpp::lib::error_code& websocketError)
+    {
+        return exceptions::JoynrDelayMessageException(
+                "Error sending binary message via WebSocketPpSender: " + websocketError.message());
+    }
+
     Endpoint& _endpoint;
     ConnectionHandle _connectionHandle;
+    std::atomic<bool> _isBatchingEnabled;
+    std::mutex _batchMutex;
+    std::string _pendingFrame;
+    std::vector<OnFailure> _pendingOnFailure;
+    bool _isFlushing;
+    const std::size_t _MAX_PENDING_FRAME_SIZE;
+    const long _FLUSH_RETRY_INTERVAL_MS;
     ADD_LOGGER(WebSocketPpSender)
 };
 
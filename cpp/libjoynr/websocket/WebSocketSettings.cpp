@@ -39,6 +39,7 @@ void WebSocketSettings::checkSettings()
 {
     assert(_settings.contains(SETTING_CC_MESSAGING_URL()));
     assert(_settings.contains(SETTING_RECONNECT_SLEEP_TIME_MS()));
+    assert(_settings.contains(SETTING_ENABLE_MESSAGE_BATCHING()));
 }
 
 const std::string& WebSocketSettings::SETTING_CC_MESSAGING_URL()
@@ -71,6 +72,12 @@ const std::string& WebSocketSettings::SETTING_PRIVATE_KEY_PEM_FILENAME()
     return value;
 }
 
+const std::string& WebSocketSettings::SETTING_ENABLE_MESSAGE_BATCHING()
+{
+    static const std::string value("websocket/enable-message-batching");
+    return value;
+}
+
 const std::string& WebSocketSettings::DEFAULT_WEBSOCKET_SETTINGS_FILENAME()
 {
     static const std::string value("default-websocket.settings");
@@ -120,6 +127,16 @@ void WebSocketSettings::setReconnectSleepTimeMs(
             WebSocketSettings::SETTING_RECONNECT_SLEEP_TIME_MS(), reconnectSleepTimeMs.count());
 }
 
+bool WebSocketSettings::isMessageBatchingEnabled() const
+{
+    return _settings.get<bool>(WebSocketSettings::SETTING_ENABLE_MESSAGE_BATCHING());
+}
+
+void WebSocketSettings::setMessageBatchingEnabled(bool enabled)
+{
+    _settings.set(WebSocketSettings::SETTING_ENABLE_MESSAGE_BATCHING(), enabled);
+}
+
 void WebSocketSettings::setCertificateAuthorityPemFilename(const std::string& filename)
 {
     _settings.set(WebSocketSettings::SETTING_CERTIFICATE_AUTHORITY_PEM_FILENAME(), filename);
@@ -163,6 +180,11 @@ void WebSocketSettings::printSettings() const
                    SETTING_CC_MESSAGING_URL(),
                    _settings.get<std::string>(SETTING_CC_MESSAGING_URL()));
 
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_ENABLE_MESSAGE_BATCHING(),
+                   _settings.get<std::string>(SETTING_ENABLE_MESSAGE_BATCHING()));
+
     JOYNR_LOG_INFO(logger(),
                    "SETTING: {} = {}",
                    SETTING_CERTIFICATE_AUTHORITY_PEM_FILENAME(),
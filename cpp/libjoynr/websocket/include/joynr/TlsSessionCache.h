@@ -0,0 +1,97 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef TLSSESSIONCACHE_H
+#define TLSSESSIONCACHE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/Logger.h"
+#include "joynr/Metrics.h"
+#include "joynr/PrivateCopyAssign.h"
+
+struct ssl_st;
+struct ssl_ctx_st;
+struct ssl_session_st;
+
+namespace joynr
+{
+
+/**
+ * @brief Client side TLS session cache of a single connection.
+ *
+ * Keeps the session (session ID or session ticket) of the last successful handshake and offers
+ * it to the server on the next handshake, so that reconnects can use an abbreviated handshake
+ * instead of a full one. Additionally, the duration of every handshake is recorded in
+ * "<metricsPrefix>.handshake.latencyUs" and counted in "<metricsPrefix>.handshake.full" or
+ * "<metricsPrefix>.handshake.resumed".
+ */
+class JOYNR_EXPORT TlsSessionCache : public std::enable_shared_from_this<TlsSessionCache>
+{
+public:
+    explicit TlsSessionCache(const std::string& metricsPrefix);
+    ~TlsSessionCache();
+
+    /**
+     * @brief Installs the session and info callbacks on the given client context.
+     * The context keeps a reference to this cache until it is freed.
+     * @param context the client context
+     * @param credentials the certificates used by the context, e.g. in PEM format. A cached
+     * session is dropped if it was established with other credentials, so that rotated
+     * certificates are presented and verified by a full handshake.
+     * @note Must be called after constructor is called
+     * since it requires shared_ptr to own object
+     */
+    void attachTo(ssl_ctx_st* context, const std::string& credentials = std::string());
+
+    bool hasSession() const;
+
+    /**
+     * @brief Forgets the cached session, the next handshake will be a full one
+     */
+    void clear();
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(TlsSessionCache);
+    ADD_LOGGER(TlsSessionCache)
+
+    static int getExDataIndex();
+    static std::shared_ptr<TlsSessionCache> fromSsl(const ssl_st* ssl);
+    static int onNewSession(ssl_st* ssl, ssl_session_st* session);
+    static void onInfo(const ssl_st* ssl, int where, int ret);
+
+    void storeSession(ssl_session_st* session);
+    void onHandshakeStart(ssl_st* ssl);
+    void onHandshakeDone(const ssl_st* ssl);
+
+    mutable std::mutex _mutex;
+    ssl_session_st* _session;
+    std::string _credentialsFingerprint;
+    bool _isHandshakeInProgress;
+    metrics::Clock::time_point _handshakeStart;
+    std::shared_ptr<metrics::Histogram> _handshakeLatency;
+    std::shared_ptr<metrics::Counter> _fullHandshakes;
+    std::shared_ptr<metrics::Counter> _resumedHandshakes;
+};
+
+} // namespace joynr
+
+#endif // TLSSESSIONCACHE_H
@@ -45,6 +45,7 @@ public:
     static const std::string& SETTING_CERTIFICATE_AUTHORITY_PEM_FILENAME();
     static const std::string& SETTING_CERTIFICATE_PEM_FILENAME();
     static const std::string& SETTING_PRIVATE_KEY_PEM_FILENAME();
+    static const std::string& SETTING_ENABLE_MESSAGE_BATCHING();
 
     static const std::string& DEFAULT_WEBSOCKET_SETTINGS_FILENAME();
 
@@ -61,6 +62,13 @@ public:
     std::chrono::milliseconds getReconnectSleepTimeMs() const;
     void setReconnectSleepTimeMs(const std::chrono::milliseconds reconnectSleepTimeMs);
 
+    /**
+     * @brief Whether several messages may be packed into a single WebSocket frame.
+     * Batching is only used on connections where both peers support it.
+     */
+    bool isMessageBatchingEnabled() const;
+    void setMessageBatchingEnabled(bool enabled);
+
     /*************************************************************************************
      * The certificate / key properties are only used internally and may be removed later
      *************************************************************************************/
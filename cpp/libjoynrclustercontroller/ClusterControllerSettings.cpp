@@ -81,6 +81,22 @@ void ClusterControllerSettings::checkSettings()
                 DEFAULT_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT_BYTES());
     }
 
+    if (!_settings.contains(SETTING_MESSAGE_QUEUE_SPILL_DIRECTORY())) {
+        setMessageQueueSpillDirectory(DEFAULT_MESSAGE_QUEUE_SPILL_DIRECTORY());
+    }
+
+    if (!_settings.contains(SETTING_MESSAGE_QUEUE_SPILL_LIMIT_BYTES())) {
+        setMessageQueueSpillLimitBytes(DEFAULT_MESSAGE_QUEUE_SPILL_LIMIT_BYTES());
+    }
+
+    if (!_settings.contains(SETTING_STARTUP_MAX_PARALLELISM())) {
+        setStartupMaxParallelism(DEFAULT_STARTUP_MAX_PARALLELISM());
+    }
+
+    if (!_settings.contains(SETTING_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES())) {
+        setGlobalLookupCacheMaxEntries(DEFAULT_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES());
+    }
+
     if (!_settings.contains(SETTING_MQTT_MULTICAST_TOPIC_PREFIX())) {
         setMqttMulticastTopicPrefix(DEFAULT_MQTT_MULTICAST_TOPIC_PREFIX());
     }
@@ -391,6 +407,27 @@ std::uint64_t ClusterControllerSettings::DEFAULT_TRANSPORT_NOT_AVAILABLE_QUEUE_L
     return 0;
 }
 
+const std::string& ClusterControllerSettings::DEFAULT_MESSAGE_QUEUE_SPILL_DIRECTORY()
+{
+    static const std::string value("");
+    return value;
+}
+
+std::uint64_t ClusterControllerSettings::DEFAULT_MESSAGE_QUEUE_SPILL_LIMIT_BYTES()
+{
+    return 0;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_STARTUP_MAX_PARALLELISM()
+{
+    return 4;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES()
+{
+    return 1000;
+}
+
 const std::string& ClusterControllerSettings::DEFAULT_MQTT_MULTICAST_TOPIC_PREFIX()
 {
     static const std::string value("");
@@ -666,6 +703,30 @@ const std::string& ClusterControllerSettings::SETTING_TRANSPORT_NOT_AVAILABLE_QU
     return value;
 }
 
+const std::string& ClusterControllerSettings::SETTING_MESSAGE_QUEUE_SPILL_DIRECTORY()
+{
+    static const std::string value("cluster-controller/message-queue-spill-directory");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_MESSAGE_QUEUE_SPILL_LIMIT_BYTES()
+{
+    static const std::string value("cluster-controller/message-queue-spill-limit-bytes");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_STARTUP_MAX_PARALLELISM()
+{
+    static const std::string value("cluster-controller/startup-max-parallelism");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES()
+{
+    static const std::string value("cluster-controller/global-lookup-cache-max-entries");
+    return value;
+}
+
 const std::string& ClusterControllerSettings::
         SETTING_LOCAL_DOMAIN_ACCESS_STORE_PERSISTENCE_FILENAME()
 {
@@ -748,6 +809,46 @@ void ClusterControllerSettings::setTransportNotAvailableQueueLimitBytes(std::uin
     _settings.set(SETTING_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT_BYTES(), limitBytes);
 }
 
+std::string ClusterControllerSettings::getMessageQueueSpillDirectory() const
+{
+    return _settings.get<std::string>(SETTING_MESSAGE_QUEUE_SPILL_DIRECTORY());
+}
+
+void ClusterControllerSettings::setMessageQueueSpillDirectory(const std::string& directory)
+{
+    _settings.set(SETTING_MESSAGE_QUEUE_SPILL_DIRECTORY(), directory);
+}
+
+std::uint64_t ClusterControllerSettings::getMessageQueueSpillLimitBytes() const
+{
+    return _settings.get<std::uint64_t>(SETTING_MESSAGE_QUEUE_SPILL_LIMIT_BYTES());
+}
+
+void ClusterControllerSettings::setMessageQueueSpillLimitBytes(std::uint64_t limitBytes)
+{
+    _settings.set(SETTING_MESSAGE_QUEUE_SPILL_LIMIT_BYTES(), limitBytes);
+}
+
+std::uint32_t ClusterControllerSettings::getStartupMaxParallelism() const
+{
+    return _settings.get<std::uint32_t>(SETTING_STARTUP_MAX_PARALLELISM());
+}
+
+void ClusterControllerSettings::setStartupMaxParallelism(std::uint32_t maxParallelism)
+{
+    _settings.set(SETTING_STARTUP_MAX_PARALLELISM(), maxParallelism);
+}
+
+std::uint32_t ClusterControllerSettings::getGlobalLookupCacheMaxEntries() const
+{
+    return _settings.get<std::uint32_t>(SETTING_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES());
+}
+
+void ClusterControllerSettings::setGlobalLookupCacheMaxEntries(std::uint32_t maxEntries)
+{
+    _settings.set(SETTING_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES(), maxEntries);
+}
+
 void ClusterControllerSettings::setAclEntriesDirectory(const std::string& directoryPath)
 {
     _settings.set(SETTING_ACL_ENTRIES_DIRECTORY(), directoryPath);
@@ -848,6 +949,22 @@ void ClusterControllerSettings::printSettings() const
                    "SETTING: {} = {}",
                    SETTING_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT_BYTES(),
                    getTransportNotAvailableQueueLimitBytes());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MESSAGE_QUEUE_SPILL_DIRECTORY(),
+                   getMessageQueueSpillDirectory());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MESSAGE_QUEUE_SPILL_LIMIT_BYTES(),
+                   getMessageQueueSpillLimitBytes());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_STARTUP_MAX_PARALLELISM(),
+                   getStartupMaxParallelism());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES(),
+                   getGlobalLookupCacheMaxEntries());
 
     JOYNR_LOG_INFO(
             logger(), "SETTING: {} = {}", SETTING_MQTT_CLIENT_ID_PREFIX(), getMqttClientIdPrefix());
@@ -23,7 +23,9 @@
 
 #include <atomic>
 #include <boost/algorithm/string/join.hpp>
+#include <map>
 #include <mutex>
+#include <set>
 
 #include "GlobalCapabilitiesDirectoryClient.h"
 
@@ -32,6 +34,7 @@
 #include "joynr/Message.h"
 #include "joynr/Semaphore.h"
 #include "joynr/TimePoint.h"
+#include "joynr/exceptions/MethodInvocationException.h"
 #include "joynr/infrastructure/GlobalCapabilitiesDirectoryProxy.h"
 #include "joynr/types/GlobalDiscoveryEntry.h"
 
@@ -46,7 +49,8 @@ GlobalCapabilitiesDirectoryClient::GlobalCapabilitiesDirectoryClient(
           _touchTtl(static_cast<std::uint64_t>(
                   clusterControllerSettings.getCapabilitiesFreshnessUpdateIntervalMs().count())),
           _removeStaleTtl(60000),
-          _sequentialTasks(std::move(taskSequencer))
+          _sequentialTasks(std::move(taskSequencer)),
+          _gcdSupportsMultipleRequests(std::make_shared<std::atomic<bool>>(true))
 {
 }
 
@@ -59,6 +63,41 @@ void GlobalCapabilitiesDirectoryClient::shutdown()
 {
     // Assure that all captures to class members are released.
     _sequentialTasks->cancel();
+    std::lock_guard<std::mutex> lock(_openBatchMutex);
+    _openAddBatch.reset();
+    _openRemoveBatch.reset();
+}
+
+void GlobalCapabilitiesDirectoryClient::addSequentialTask(
+        const TaskSequencer<void>::TaskWithExpiryDate& task)
+{
+    std::lock_guard<std::mutex> lock(_openBatchMutex);
+    // operations enqueued after this task must not overtake it by joining an earlier batch
+    _openAddBatch.reset();
+    _openRemoveBatch.reset();
+    _sequentialTasks->add(task);
+}
+
+void GlobalCapabilitiesDirectoryClient::addToBatch(AddBatchOperation::Item&& item)
+{
+    std::lock_guard<std::mutex> lock(_openBatchMutex);
+    if (_openAddBatch && _openAddBatch->tryAppend(std::move(item))) {
+        return;
+    }
+    auto addBatchOperation = std::make_shared<AddBatchOperation>(
+            _capabilitiesProxy, _messagingQos, _gcdSupportsMultipleRequests);
+    addBatchOperation->tryAppend(std::move(item));
+
+    TaskSequencer<void>::TaskWithExpiryDate addBatchTask;
+    addBatchTask._expiryDate = TimePoint::max();
+    addBatchTask._timeout = []() {};
+    addBatchTask._task = [addBatchOperation]() {
+        addBatchOperation->execute();
+        return addBatchOperation;
+    };
+    _openRemoveBatch.reset();
+    _openAddBatch = addBatchOperation;
+    _sequentialTasks->add(addBatchTask);
 }
 
 void GlobalCapabilitiesDirectoryClient::add(
@@ -69,6 +108,24 @@ void GlobalCapabilitiesDirectoryClient::add(
         std::function<void(const joynr::types::DiscoveryError::Enum& errorEnum)> onError,
         std::function<void(const exceptions::JoynrRuntimeException& error)> onRuntimeError)
 {
+    if (!awaitGlobalRegistration) {
+        // no individual deadline: can be merged with other adds for the same GBIDs
+        JOYNR_LOG_DEBUG(logger(),
+                        "Global provider registration scheduled: participantId {}, domain {}, "
+                        "interface {}, {}, awaitGlobalRegistration {}",
+                        entry.getParticipantId(),
+                        entry.getDomain(),
+                        entry.getInterfaceName(),
+                        entry.getProviderVersion().toString(),
+                        awaitGlobalRegistration);
+        addToBatch(AddBatchOperation::Item{entry,
+                                           gbids,
+                                           std::move(onSuccess),
+                                           std::move(onError),
+                                           std::move(onRuntimeError)});
+        return;
+    }
+
     MessagingQos addMessagingQos = _messagingQos;
     addMessagingQos.putCustomMessageHeader(Message::CUSTOM_HEADER_GBID_KEY(), gbids[0]);
     using std::move;
@@ -109,7 +166,7 @@ void GlobalCapabilitiesDirectoryClient::add(
                     entry.getInterfaceName(),
                     entry.getProviderVersion().toString(),
                     awaitGlobalRegistration);
-    _sequentialTasks->add(addTask);
+    addSequentialTask(addTask);
 }
 
 void GlobalCapabilitiesDirectoryClient::reAdd(
@@ -147,8 +204,7 @@ void GlobalCapabilitiesDirectoryClient::reAdd(
 
         for (const auto& discoveryEntry : discoveryEntries) {
             const std::string participantId = discoveryEntry.getParticipantId();
-            std::unique_lock<std::recursive_mutex> cacheLock(
-                    localCapabilitiesDirectoryStore->getCacheLock());
+            ReentrantReadLocker cacheLock(localCapabilitiesDirectoryStore->getCacheLock());
             std::vector<std::string> gbids =
                     localCapabilitiesDirectoryStore->getGbidsForParticipantId(
                             participantId, cacheLock);
@@ -200,7 +256,7 @@ void GlobalCapabilitiesDirectoryClient::reAdd(
     };
 
     JOYNR_LOG_DEBUG(logger(), "Re-Add scheduled.");
-    _sequentialTasks->add(reAddTask);
+    addSequentialTask(reAddTask);
 }
 
 void GlobalCapabilitiesDirectoryClient::remove(
@@ -210,24 +266,30 @@ void GlobalCapabilitiesDirectoryClient::remove(
         std::function<void(const joynr::types::DiscoveryError::Enum& errorEnum)> onError,
         std::function<void(const exceptions::JoynrRuntimeException& error)> onRuntimeError)
 {
-    MessagingQos removeMessagingQos = _messagingQos;
-    auto retryRemoveOperation =
-            std::make_shared<RetryRemoveOperation>(_capabilitiesProxy,
-                                                   participantId,
-                                                   localCapabilitiesDirectoryStore,
-                                                   std::move(onSuccess),
-                                                   std::move(onError),
-                                                   std::move(onRuntimeError),
-                                                   std::move(removeMessagingQos));
+    RemoveBatchOperation::Item item{participantId,
+                                    localCapabilitiesDirectoryStore,
+                                    std::move(onSuccess),
+                                    std::move(onError),
+                                    std::move(onRuntimeError)};
+    JOYNR_LOG_DEBUG(logger(), "Global remove scheduled, participantId {}", participantId);
+
+    std::lock_guard<std::mutex> lock(_openBatchMutex);
+    if (_openRemoveBatch && _openRemoveBatch->tryAppend(std::move(item))) {
+        return;
+    }
+    auto removeBatchOperation = std::make_shared<RemoveBatchOperation>(
+            _capabilitiesProxy, _messagingQos, _gcdSupportsMultipleRequests);
+    removeBatchOperation->tryAppend(std::move(item));
+
     TaskSequencer<void>::TaskWithExpiryDate removeTask;
     removeTask._expiryDate = TimePoint::max();
     removeTask._timeout = []() {};
-    removeTask._task = [retryRemoveOperation]() {
-        retryRemoveOperation->execute();
-        return retryRemoveOperation;
+    removeTask._task = [removeBatchOperation]() {
+        removeBatchOperation->execute();
+        return removeBatchOperation;
     };
-
-    JOYNR_LOG_DEBUG(logger(), "Global remove scheduled, participantId {}", participantId);
+    _openAddBatch.reset();
+    _openRemoveBatch = removeBatchOperation;
     _sequentialTasks->add(removeTask);
 }
 
@@ -299,6 +361,7 @@ void GlobalCapabilitiesDirectoryClient::setProxy(
         std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> capabilitiesProxy)
 {
     this->_capabilitiesProxy = std::move(capabilitiesProxy);
+    *_gcdSupportsMultipleRequests = true;
 }
 
 void GlobalCapabilitiesDirectoryClient::removeStale(
@@ -318,116 +381,233 @@ void GlobalCapabilitiesDirectoryClient::removeStale(
                                          removeStaleMessagingQos);
 }
 
-GlobalCapabilitiesDirectoryClient::RetryRemoveOperation::RetryRemoveOperation(
+GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::RemoveBatchOperation(
         const std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>& capabilitiesProxy,
-        const std::string& participantId,
-        std::shared_ptr<LocalCapabilitiesDirectoryStore> localCapabilitiesDirectoryStore,
-        std::function<void()>&& onSuccessFunc,
-        std::function<void(const types::DiscoveryError::Enum&)>&& onApplicationErrorFunc,
-        std::function<void(const exceptions::JoynrRuntimeException&)>&& onRuntimeErrorFunc,
-        MessagingQos qos)
+        MessagingQos qos,
+        std::shared_ptr<std::atomic<bool>> gcdSupportsMultipleRequests)
         : Future<void>(),
           _capabilitiesProxy{capabilitiesProxy},
-          _participantId{participantId},
-          _localCapabilitiesDirectoryStore{localCapabilitiesDirectoryStore},
-          _onSuccess{onSuccessFunc},
-          _onApplicationError{onApplicationErrorFunc},
-          _onRuntimeError{onRuntimeErrorFunc},
-          _qos{qos}
+          _qos{qos},
+          _gcdSupportsMultipleRequests{std::move(gcdSupportsMultipleRequests)},
+          _itemsMutex(),
+          _items(),
+          _isStarted{false},
+          _pendingRequests{0}
 {
 }
 
-void GlobalCapabilitiesDirectoryClient::RetryRemoveOperation::execute()
+bool GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::tryAppend(Item&& item)
 {
-    if (StatusCodeEnum::IN_PROGRESS == getStatus()) {
+    std::lock_guard<std::mutex> lock(_itemsMutex);
+    if (_isStarted) {
+        return false;
+    }
+    _items.push_back(std::move(item));
+    return true;
+}
+
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::execute()
+{
+    Items items;
+    {
+        std::lock_guard<std::mutex> lock(_itemsMutex);
+        _isStarted = true;
+        items.swap(_items);
+    }
+    // the operation must not complete before all requests have been sent
+    _pendingRequests = 1;
+    resolveGbidsAndSend(items);
+    onRequestFinished();
+}
+
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::resolveGbidsAndSend(
+        const Items& items)
+{
+    std::map<std::vector<std::string>, std::shared_ptr<Items>> itemsPerGbids;
+    for (const auto& item : items) {
         std::shared_ptr<LocalCapabilitiesDirectoryStore> localCapabilitiesDirectoryStore =
-                _localCapabilitiesDirectoryStore.lock();
-        if (localCapabilitiesDirectoryStore) {
-            std::unique_lock<std::recursive_mutex> cacheLock(
-                    localCapabilitiesDirectoryStore->getCacheLock());
-            auto foundGbids = localCapabilitiesDirectoryStore->getGbidsForParticipantId(
-                    _participantId, cacheLock);
-            cacheLock.unlock();
-            if (!foundGbids.empty()) {
-                _qos.putCustomMessageHeader(Message::CUSTOM_HEADER_GBID_KEY(), foundGbids[0]);
-                std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>
-                        capabilitiesProxy = _capabilitiesProxy.lock();
-                if (capabilitiesProxy) {
-                    using std::placeholders::_1;
-                    JOYNR_LOG_INFO(logger(),
-                                   "Removing globally registered participantId {} for GBIDs {}",
-                                   _participantId,
-                                   boost::algorithm::join(foundGbids, ","));
-                    capabilitiesProxy->removeAsync(
-                            _participantId,
-                            foundGbids,
-                            std::bind(&RetryRemoveOperation::forwardSuccess, shared_from_this()),
-                            std::bind(&RetryRemoveOperation::forwardApplicationError,
-                                      shared_from_this(),
-                                      _1),
-                            std::bind(&RetryRemoveOperation::retryOrForwardRuntimeError,
-                                      shared_from_this(),
-                                      _1),
-                            _qos);
-                } else {
-                    const exceptions::JoynrRuntimeException proxyNotAvailable(
-                            "Remove operation retry aborted since proxy not available.");
-                    if (_onRuntimeError) {
-                        _onRuntimeError(proxyNotAvailable);
-                    }
-                    onError(std::make_shared<exceptions::JoynrRuntimeException>(proxyNotAvailable));
-                }
-            } else {
-                std::string errorMessage = "Global remove failed because participantId to GBIDs "
-                                           "mapping is missing for participantId " +
-                                           _participantId;
-                JOYNR_LOG_WARN(logger(), errorMessage);
-                exceptions::ProviderRuntimeException exception(errorMessage);
-                onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
-            }
+                item._localCapabilitiesDirectoryStore.lock();
+        if (!localCapabilitiesDirectoryStore) {
+            JOYNR_LOG_WARN(logger(),
+                           "Global remove failed of entry with participantId {} since "
+                           "localCapabilitiesDirectoryStore is not available.",
+                           item._participantId);
+            continue;
+        }
+        ReentrantReadLocker cacheLock(localCapabilitiesDirectoryStore->getCacheLock());
+        auto foundGbids = localCapabilitiesDirectoryStore->getGbidsForParticipantId(
+                item._participantId, cacheLock);
+        cacheLock.unlock();
+        if (foundGbids.empty()) {
+            JOYNR_LOG_WARN(logger(),
+                           "Global remove failed because participantId to GBIDs mapping is "
+                           "missing for participantId {}",
+                           item._participantId);
         } else {
-            std::string errorMessage = "Global remove failed of entry with participantId {} since "
-                                       "localCapabilitiesDirectoryStore is not available.  " +
-                                       _participantId;
-            JOYNR_LOG_WARN(logger(), errorMessage);
-            exceptions::ProviderRuntimeException exception(errorMessage);
-            onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+            auto& gbidsItems = itemsPerGbids[foundGbids];
+            if (!gbidsItems) {
+                gbidsItems = std::make_shared<Items>();
+            }
+            gbidsItems->push_back(item);
         }
-    } else {
-        if (_onRuntimeError) {
-            _onRuntimeError(exceptions::JoynrRuntimeException("Remove operation retry canceled."));
+    }
+    for (auto& gbidsItems : itemsPerGbids) {
+        send(std::move(gbidsItems.second), gbidsItems.first);
+    }
+}
+
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::send(
+        std::shared_ptr<Items> items,
+        const std::vector<std::string>& gbids)
+{
+    if (StatusCodeEnum::IN_PROGRESS != getStatus()) {
+        forwardRuntimeError(
+                *items, exceptions::JoynrRuntimeException("Remove operation retry canceled."));
+        return;
+    }
+    std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> capabilitiesProxy =
+            _capabilitiesProxy.lock();
+    if (!capabilitiesProxy) {
+        forwardRuntimeError(*items,
+                            exceptions::JoynrRuntimeException(
+                                    "Remove operation retry aborted since proxy not available."));
+        return;
+    }
+
+    if (items->size() > 1 && !*_gcdSupportsMultipleRequests) {
+        for (const auto& item : *items) {
+            send(std::make_shared<Items>(1, item), gbids);
         }
+        return;
+    }
+
+    MessagingQos qos = _qos;
+    qos.putCustomMessageHeader(Message::CUSTOM_HEADER_GBID_KEY(), gbids[0]);
+    _pendingRequests++;
+    auto thisSharedPtr = shared_from_this();
+    auto onApplicationError = [thisSharedPtr, items](const types::DiscoveryError::Enum& e) {
+        thisSharedPtr->forwardApplicationError(*items, e);
+        thisSharedPtr->onRequestFinished();
+    };
+    auto onRuntimeError = [thisSharedPtr, items](const exceptions::JoynrRuntimeException& e) {
+        thisSharedPtr->retryOrFallback(items, e);
+    };
+
+    if (items->size() == 1) {
+        JOYNR_LOG_INFO(logger(),
+                       "Removing globally registered participantId {} for GBIDs {}",
+                       items->front()._participantId,
+                       boost::algorithm::join(gbids, ","));
+        capabilitiesProxy->removeAsync(
+                items->front()._participantId,
+                gbids,
+                [thisSharedPtr, items, gbids]() {
+                    thisSharedPtr->forwardResult(items, gbids, {});
+                },
+                std::move(onApplicationError),
+                std::move(onRuntimeError),
+                qos);
+        return;
     }
+
+    std::vector<std::string> participantIds;
+    participantIds.reserve(items->size());
+    for (const auto& item : *items) {
+        participantIds.push_back(item._participantId);
+    }
+    JOYNR_LOG_INFO(logger(),
+                   "Removing {} globally registered participantIds for GBIDs {}: {}",
+                   participantIds.size(),
+                   boost::algorithm::join(gbids, ","),
+                   boost::algorithm::join(participantIds, ","));
+    capabilitiesProxy->removeMultipleAsync(
+            participantIds,
+            gbids,
+            [thisSharedPtr, items, gbids](const std::vector<std::string>& failedParticipantIds) {
+                thisSharedPtr->forwardResult(items, gbids, failedParticipantIds);
+            },
+            std::move(onApplicationError),
+            std::move(onRuntimeError),
+            qos);
 }
 
-void GlobalCapabilitiesDirectoryClient::RetryRemoveOperation::forwardSuccess()
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::forwardResult(
+        std::shared_ptr<Items> items,
+        const std::vector<std::string>& gbids,
+        const std::vector<std::string>& failedParticipantIds)
 {
-    if (_onSuccess) {
-        _onSuccess();
+    const std::set<std::string> failed(failedParticipantIds.cbegin(), failedParticipantIds.cend());
+    for (const auto& item : *items) {
+        if (failed.count(item._participantId) != 0) {
+            // removeMultiple only reports that the remove failed: the single remove provides
+            // the same error as if the entry had not been batched
+            JOYNR_LOG_WARN(logger(),
+                           "Removing participantId {} in a batch failed, removing it individually",
+                           item._participantId);
+            send(std::make_shared<Items>(1, item), gbids);
+        } else if (item._onSuccess) {
+            item._onSuccess();
+        }
     }
-    onSuccess();
+    onRequestFinished();
 }
 
-void GlobalCapabilitiesDirectoryClient::RetryRemoveOperation::forwardApplicationError(
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::forwardApplicationError(
+        const Items& items,
         const types::DiscoveryError::Enum& e)
 {
-    if (_onApplicationError) {
-        _onApplicationError(e);
+    for (const auto& item : items) {
+        if (item._onApplicationError) {
+            item._onApplicationError(e);
+        }
     }
-    onError(std::make_shared<exceptions::JoynrRuntimeException>(
-            "Stop remove operation due to ApplicationException."));
 }
 
-void GlobalCapabilitiesDirectoryClient::RetryRemoveOperation::retryOrForwardRuntimeError(
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::forwardRuntimeError(
+        const Items& items,
+        const exceptions::JoynrRuntimeException& e)
+{
+    for (const auto& item : items) {
+        if (item._onRuntimeError) {
+            item._onRuntimeError(e);
+        }
+    }
+}
+
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::retryOrFallback(
+        std::shared_ptr<Items> items,
         const exceptions::JoynrRuntimeException& e)
 {
     if (typeid(exceptions::JoynrTimeOutException) == typeid(e)) {
-        execute();
-    } else {
-        if (_onRuntimeError) {
-            _onRuntimeError(e);
+        resolveGbidsAndSend(*items);
+    } else if (items->size() > 1) {
+        // GCDs without removeMultiple reply with a MethodInvocationException
+        if (e.getTypeName() != exceptions::MethodInvocationException::TYPE_NAME()) {
+            JOYNR_LOG_WARN(logger(),
+                           "Removing {} participantIds failed with exception: {} ({}), removing "
+                           "them individually",
+                           items->size(),
+                           e.getMessage(),
+                           e.getTypeName());
+        } else if (_gcdSupportsMultipleRequests->exchange(false)) {
+            JOYNR_LOG_INFO(logger(),
+                           "GlobalCapabilitiesDirectory does not support addMultiple and "
+                           "removeMultiple, falling back to single add and remove requests: {}",
+                           e.getMessage());
         }
-        onError(std::make_shared<exceptions::JoynrRuntimeException>(e));
+        for (const auto& item : *items) {
+            resolveGbidsAndSend(Items(1, item));
+        }
+    } else {
+        forwardRuntimeError(*items, e);
+    }
+    onRequestFinished();
+}
+
+void GlobalCapabilitiesDirectoryClient::RemoveBatchOperation::onRequestFinished()
+{
+    if (_pendingRequests.fetch_sub(1) == 1 && StatusCodeEnum::IN_PROGRESS == getStatus()) {
+        onSuccess();
     }
 }
 
@@ -547,4 +727,208 @@ void GlobalCapabilitiesDirectoryClient::AddOperation::retryOrForwardRuntimeError
     }
 }
 
+GlobalCapabilitiesDirectoryClient::AddBatchOperation::AddBatchOperation(
+        const std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>& capabilitiesProxy,
+        MessagingQos qos,
+        std::shared_ptr<std::atomic<bool>> gcdSupportsMultipleRequests)
+        : Future<void>(),
+          _capabilitiesProxy{capabilitiesProxy},
+          _qos{qos},
+          _gcdSupportsMultipleRequests{std::move(gcdSupportsMultipleRequests)},
+          _itemsMutex(),
+          _items(),
+          _isStarted{false},
+          _pendingRequests{0}
+{
+}
+
+bool GlobalCapabilitiesDirectoryClient::AddBatchOperation::tryAppend(Item&& item)
+{
+    std::lock_guard<std::mutex> lock(_itemsMutex);
+    if (_isStarted) {
+        return false;
+    }
+    _items.push_back(std::move(item));
+    return true;
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatchOperation::execute()
+{
+    std::map<std::vector<std::string>, std::shared_ptr<Items>> itemsPerGbids;
+    {
+        std::lock_guard<std::mutex> lock(_itemsMutex);
+        _isStarted = true;
+        for (auto& item : _items) {
+            auto& gbidsItems = itemsPerGbids[item._gbids];
+            if (!gbidsItems) {
+                gbidsItems = std::make_shared<Items>();
+            }
+            gbidsItems->push_back(std::move(item));
+        }
+        _items.clear();
+    }
+    // the operation must not complete before all requests have been sent
+    _pendingRequests = 1;
+    for (auto& gbidsItems : itemsPerGbids) {
+        send(std::move(gbidsItems.second));
+    }
+    onRequestFinished();
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatchOperation::send(std::shared_ptr<Items> items)
+{
+    if (StatusCodeEnum::IN_PROGRESS != getStatus()) {
+        forwardRuntimeError(*items,
+                            exceptions::JoynrRuntimeException("Add operation retry canceled."));
+        return;
+    }
+    std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> capabilitiesProxy =
+            _capabilitiesProxy.lock();
+    if (!capabilitiesProxy) {
+        forwardRuntimeError(*items,
+                            exceptions::JoynrRuntimeException(
+                                    "Add operation retry aborted since proxy not available."));
+        return;
+    }
+
+    if (items->size() > 1 && !*_gcdSupportsMultipleRequests) {
+        for (const auto& item : *items) {
+            send(std::make_shared<Items>(1, item));
+        }
+        return;
+    }
+
+    const std::vector<std::string>& gbids = items->front()._gbids;
+    MessagingQos qos = _qos;
+    qos.putCustomMessageHeader(Message::CUSTOM_HEADER_GBID_KEY(), gbids[0]);
+    _pendingRequests++;
+    auto thisSharedPtr = shared_from_this();
+    auto onApplicationError = [thisSharedPtr, items](const types::DiscoveryError::Enum& e) {
+        thisSharedPtr->forwardApplicationError(*items, e);
+        thisSharedPtr->onRequestFinished();
+    };
+    auto onRuntimeError = [thisSharedPtr, items](const exceptions::JoynrRuntimeException& e) {
+        thisSharedPtr->retryOrFallback(items, e);
+    };
+
+    if (items->size() == 1) {
+        const types::GlobalDiscoveryEntry& entry = items->front()._globalDiscoveryEntry;
+        JOYNR_LOG_DEBUG(logger(),
+                        "Global provider registration started: participantId {}, domain {}, "
+                        "interface {}, {}, awaitGlobalRegistration false",
+                        entry.getParticipantId(),
+                        entry.getDomain(),
+                        entry.getInterfaceName(),
+                        entry.getProviderVersion().toString());
+        capabilitiesProxy->addAsync(
+                entry,
+                gbids,
+                [thisSharedPtr, items]() { thisSharedPtr->forwardResult(items, {}); },
+                std::move(onApplicationError),
+                std::move(onRuntimeError),
+                qos);
+        return;
+    }
+
+    std::vector<types::GlobalDiscoveryEntry> entries;
+    entries.reserve(items->size());
+    for (const auto& item : *items) {
+        entries.push_back(item._globalDiscoveryEntry);
+    }
+    JOYNR_LOG_DEBUG(logger(),
+                    "Global provider registration started for {} participantIds in GBIDs {}",
+                    entries.size(),
+                    boost::algorithm::join(gbids, ","));
+    capabilitiesProxy->addMultipleAsync(
+            entries,
+            gbids,
+            [thisSharedPtr, items](const std::vector<std::string>& failedParticipantIds) {
+                thisSharedPtr->forwardResult(items, failedParticipantIds);
+            },
+            std::move(onApplicationError),
+            std::move(onRuntimeError),
+            qos);
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatchOperation::forwardResult(
+        std::shared_ptr<Items> items,
+        const std::vector<std::string>& failedParticipantIds)
+{
+    const std::set<std::string> failed(failedParticipantIds.cbegin(), failedParticipantIds.cend());
+    for (const auto& item : *items) {
+        const std::string& participantId = item._globalDiscoveryEntry.getParticipantId();
+        if (failed.count(participantId) != 0) {
+            // addMultiple only reports that the registration failed: the single add provides
+            // the same error as if the entry had not been batched
+            JOYNR_LOG_WARN(logger(),
+                           "Global registration of participantId {} in a batch failed, "
+                           "registering it individually",
+                           participantId);
+            send(std::make_shared<Items>(1, item));
+        } else if (item._onSuccess) {
+            item._onSuccess();
+        }
+    }
+    onRequestFinished();
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatchOperation::forwardApplicationError(
+        const Items& items,
+        const types::DiscoveryError::Enum& e)
+{
+    for (const auto& item : items) {
+        if (item._onApplicationError) {
+            item._onApplicationError(e);
+        }
+    }
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatchOperation::forwardRuntimeError(
+        const Items& items,
+        const exceptions::JoynrRuntimeException& e)
+{
+    for (const auto& item : items) {
+        if (item._onRuntimeError) {
+            item._onRuntimeError(e);
+        }
+    }
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatchOperation::retryOrFallback(
+        std::shared_ptr<Items> items,
+        const exceptions::JoynrRuntimeException& e)
+{
+    if (typeid(exceptions::JoynrTimeOutException) == typeid(e)) {
+        send(std::move(items));
+    } else if (items->size() > 1) {
+        // GCDs without addMultiple reply with a MethodInvocationException
+        if (e.getTypeName() != exceptions::MethodInvocationException::TYPE_NAME()) {
+            JOYNR_LOG_WARN(logger(),
+                           "Global registration of {} participantIds failed with exception: {} "
+                           "({}), registering them individually",
+                           items->size(),
+                           e.getMessage(),
+                           e.getTypeName());
+        } else if (_gcdSupportsMultipleRequests->exchange(false)) {
+            JOYNR_LOG_INFO(logger(),
+                           "GlobalCapabilitiesDirectory does not support addMultiple and "
+                           "removeMultiple, falling back to single add and remove requests: {}",
+                           e.getMessage());
+        }
+        for (const auto& item : *items) {
+            send(std::make_shared<Items>(1, item));
+        }
+    } else {
+        forwardRuntimeError(*items, e);
+    }
+    onRequestFinished();
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatchOperation::onRequestFinished()
+{
+    if (_pendingRequests.fetch_sub(1) == 1 && StatusCodeEnum::IN_PROGRESS == getStatus()) {
+        onSuccess();
+    }
+}
+
 } // namespace joynr
@@ -19,6 +19,7 @@
 #ifndef GLOBALCAPABILITIESDIRECTORYCLIENT_H
 #define GLOBALCAPABILITIESDIRECTORYCLIENT_H
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -145,34 +146,104 @@ public:
                const std::string& localAddress) override;
 
 private:
-    class RetryRemoveOperation : public Future<void>,
+    /*
+       Removes all participantIds which were enqueued while the previous task of the sequencer
+       was running. The participantIds are grouped by the GBIDs they are registered for and each
+       group is removed with one call of the GCD's removeMultiple. ParticipantIds which the GCD
+       reports as failed are removed again individually to get the error of the single remove.
+     */
+    class RemoveBatchOperation : public Future<void>,
                                  public std::enable_shared_from_this<
-                                         GlobalCapabilitiesDirectoryClient::RetryRemoveOperation>
+                                         GlobalCapabilitiesDirectoryClient::RemoveBatchOperation>
     {
     public:
-        RetryRemoveOperation(
+        struct Item {
+            std::string _participantId;
+            std::weak_ptr<LocalCapabilitiesDirectoryStore> _localCapabilitiesDirectoryStore;
+            std::function<void()> _onSuccess;
+            std::function<void(const types::DiscoveryError::Enum&)> _onApplicationError;
+            std::function<void(const exceptions::JoynrRuntimeException&)> _onRuntimeError;
+        };
+
+        RemoveBatchOperation(
                 const std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>&
                         capabilitiesProxy,
-                const std::string& participantId,
-                std::shared_ptr<LocalCapabilitiesDirectoryStore> localCapabilitiesDirectoryStore,
-                std::function<void()>&& onSuccessFunc,
-                std::function<void(const types::DiscoveryError::Enum&)>&& onApplicationErrorFunc,
-                std::function<void(const exceptions::JoynrRuntimeException&)>&& onRuntimeErrorFunc,
-                MessagingQos qos);
-        ~RetryRemoveOperation() override = default;
+                MessagingQos qos,
+                std::shared_ptr<std::atomic<bool>> gcdSupportsMultipleRequests);
+        ~RemoveBatchOperation() override = default;
+
+        /* @return false if the operation has already been started and cannot take more items */
+        bool tryAppend(Item&& item);
         void execute();
 
     private:
-        void forwardSuccess();
-        void forwardApplicationError(const types::DiscoveryError::Enum& e);
-        void retryOrForwardRuntimeError(const exceptions::JoynrRuntimeException& e);
+        using Items = std::vector<Item>;
+        void resolveGbidsAndSend(const Items& items);
+        void send(std::shared_ptr<Items> items, const std::vector<std::string>& gbids);
+        void forwardResult(std::shared_ptr<Items> items,
+                           const std::vector<std::string>& gbids,
+                           const std::vector<std::string>& failedParticipantIds);
+        void forwardApplicationError(const Items& items, const types::DiscoveryError::Enum& e);
+        void forwardRuntimeError(const Items& items, const exceptions::JoynrRuntimeException& e);
+        void retryOrFallback(std::shared_ptr<Items> items,
+                             const exceptions::JoynrRuntimeException& e);
+        void onRequestFinished();
+        std::weak_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> _capabilitiesProxy;
+        MessagingQos _qos;
+        std::shared_ptr<std::atomic<bool>> _gcdSupportsMultipleRequests;
+        std::mutex _itemsMutex;
+        Items _items;
+        bool _isStarted;
+        std::atomic_size_t _pendingRequests;
+    };
+
+    /*
+       Adds all entries which were enqueued while the previous task of the sequencer was
+       running and which are registered without awaitGlobalRegistration. The entries are grouped
+       by their GBIDs and each group is sent with one call of the GCD's addMultiple. Entries which
+       the GCD reports as failed are added again individually to get the error of the single add.
+     */
+    class AddBatchOperation : public Future<void>,
+                              public std::enable_shared_from_this<
+                                      GlobalCapabilitiesDirectoryClient::AddBatchOperation>
+    {
+    public:
+        struct Item {
+            types::GlobalDiscoveryEntry _globalDiscoveryEntry;
+            std::vector<std::string> _gbids;
+            std::function<void()> _onSuccess;
+            std::function<void(const types::DiscoveryError::Enum&)> _onApplicationError;
+            std::function<void(const exceptions::JoynrRuntimeException&)> _onRuntimeError;
+        };
+
+        AddBatchOperation(
+                const std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>&
+                        capabilitiesProxy,
+                MessagingQos qos,
+                std::shared_ptr<std::atomic<bool>> gcdSupportsMultipleRequests);
+        ~AddBatchOperation() override = default;
+
+        /* @return false if the operation has already been started and cannot take more items */
+        bool tryAppend(Item&& item);
+        void execute();
+
+    private:
+        using Items = std::vector<Item>;
+        void send(std::shared_ptr<Items> items);
+        void forwardResult(std::shared_ptr<Items> items,
+                           const std::vector<std::string>& failedParticipantIds);
+        void forwardApplicationError(const Items& items, const types::DiscoveryError::Enum& e);
+        void forwardRuntimeError(const Items& items, const exceptions::JoynrRuntimeException& e);
+        void retryOrFallback(std::shared_ptr<Items> items,
+                             const exceptions::JoynrRuntimeException& e);
+        void onRequestFinished();
         std::weak_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> _capabilitiesProxy;
-        std::string _participantId;
-        std::weak_ptr<LocalCapabilitiesDirectoryStore> _localCapabilitiesDirectoryStore;
-        std::function<void()> _onSuccess;
-        std::function<void(const types::DiscoveryError::Enum&)> _onApplicationError;
-        std::function<void(const exceptions::JoynrRuntimeException&)> _onRuntimeError;
         MessagingQos _qos;
+        std::shared_ptr<std::atomic<bool>> _gcdSupportsMultipleRequests;
+        std::mutex _itemsMutex;
+        Items _items;
+        bool _isStarted;
+        std::atomic_size_t _pendingRequests;
     };
 
     class AddOperation
@@ -210,11 +281,20 @@ private:
     };
 
     DISALLOW_COPY_AND_ASSIGN(GlobalCapabilitiesDirectoryClient);
+    void addSequentialTask(const TaskSequencer<void>::TaskWithExpiryDate& task);
+    void addToBatch(AddBatchOperation::Item&& item);
+
     std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> _capabilitiesProxy;
     MessagingQos _messagingQos;
     const std::uint64_t _touchTtl;
     const std::uint64_t _removeStaleTtl;
     std::unique_ptr<TaskSequencer<void>> _sequentialTasks;
+    // cleared when the GCD rejects addMultiple or removeMultiple as unknown methods
+    std::shared_ptr<std::atomic<bool>> _gcdSupportsMultipleRequests;
+    // batches which are the last task in _sequentialTasks and have not been started yet
+    std::mutex _openBatchMutex;
+    std::shared_ptr<AddBatchOperation> _openAddBatch;
+    std::shared_ptr<RemoveBatchOperation> _openRemoveBatch;
     ADD_LOGGER(GlobalCapabilitiesDirectoryClient)
 };
 
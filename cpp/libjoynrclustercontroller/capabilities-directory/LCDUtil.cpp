@@ -58,10 +58,11 @@ ValidateGBIDsEnum::Enum LCDUtil::validateGbids(std::vector<std::string> gbids,
 }
 
 std::vector<types::DiscoveryEntry> LCDUtil::filterDiscoveryEntriesByGbids(
-        const std::unique_lock<std::recursive_mutex>& cacheLock,
+        const ReentrantReadLocker& cacheLock,
         const std::vector<types::DiscoveryEntry>& entries,
         const std::unordered_set<std::string>& gbids,
-        std::unordered_map<std::string, std::vector<std::string>> globalParticipantIdsToGbidsMap)
+        const std::unordered_map<std::string, std::vector<std::string>>&
+                globalParticipantIdsToGbidsMap)
 {
     assert(cacheLock.owns_lock());
     std::vector<types::DiscoveryEntry> result;
@@ -152,10 +153,11 @@ std::string LCDUtil::joinToString(const std::vector<types::DiscoveryEntry>& disc
 }
 
 bool LCDUtil::isEntryForGbid(
-        const std::unique_lock<std::recursive_mutex>& cacheLock,
+        const ReentrantReadLocker& cacheLock,
         const types::DiscoveryEntry& entry,
-        const std::unordered_set<std::string> gbids,
-        std::unordered_map<std::string, std::vector<std::string>> globalParticipantIdsToGbidsMap)
+        const std::unordered_set<std::string>& gbids,
+        const std::unordered_map<std::string, std::vector<std::string>>&
+                globalParticipantIdsToGbidsMap)
 {
     assert(cacheLock.owns_lock());
     std::ignore = cacheLock;
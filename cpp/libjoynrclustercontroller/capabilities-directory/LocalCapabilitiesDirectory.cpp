@@ -159,8 +159,7 @@ void LocalCapabilitiesDirectory::sendAndRescheduleFreshnessUpdate(
                     .count();
     const std::int64_t newExpiryDateMs = newLastSeenDateMs + _defaultExpiryIntervalMs;
     {
-        std::unique_lock<std::recursive_mutex> expiryDateUpdateLock(
-                _localCapabilitiesDirectoryStore->getCacheLock());
+        ReentrantWriteLocker expiryDateUpdateLock(_localCapabilitiesDirectoryStore->getCacheLock());
         participantIds =
                 _localCapabilitiesDirectoryStore
                         ->getLocallyRegisteredCapabilities(expiryDateUpdateLock)
@@ -185,8 +184,7 @@ void LocalCapabilitiesDirectory::sendAndRescheduleFreshnessUpdate(
     }
 
     for (const std::string& participantIdToTouch : participantIds) {
-        std::unique_lock<std::recursive_mutex> cacheLock(
-                _localCapabilitiesDirectoryStore->getCacheLock());
+        ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore->getCacheLock());
         std::vector<std::string> gbids = _localCapabilitiesDirectoryStore->getGbidsForParticipantId(
                 participantIdToTouch, cacheLock);
         cacheLock.unlock();
@@ -316,8 +314,7 @@ void LocalCapabilitiesDirectory::addInternal(
     discoveryEntry.setLastSeenDateMs(TimePoint::now().toMilliseconds());
 
     if (!isGloballyVisible || !awaitGlobalRegistration) {
-        std::lock_guard<std::recursive_mutex> lock1(
-                _localCapabilitiesDirectoryStore->getCacheLock());
+        ReentrantWriteLocker lock1(_localCapabilitiesDirectoryStore->getCacheLock());
         if (isGloballyVisible) {
             _localCapabilitiesDirectoryStore->insertInGlobalLookupCache(discoveryEntry, gbids);
         }
@@ -393,7 +390,7 @@ void LocalCapabilitiesDirectory::addInternal(
                                                   gbids,
                                                   onSuccess]() {
             if (auto thisSharedPtr = thisWeakPtr.lock()) {
-                std::lock_guard<std::recursive_mutex> cacheInsertionLock(
+                ReentrantWriteLocker cacheInsertionLock(
                         thisSharedPtr->_localCapabilitiesDirectoryStore->getCacheLock());
                 if (awaitGlobalRegistration) {
                     thisSharedPtr->_localCapabilitiesDirectoryStore->insertInGlobalLookupCache(
@@ -453,7 +450,7 @@ void LocalCapabilitiesDirectory::triggerGlobalProviderReregistration(
     std::ignore = onError;
 
     {
-        std::unique_lock<std::recursive_mutex> providerReregistrationLock(
+        ReentrantWriteLocker providerReregistrationLock(
                 _localCapabilitiesDirectoryStore->getCacheLock());
         JOYNR_LOG_DEBUG(logger(), "triggerGlobalProviderReregistration");
         std::vector<types::DiscoveryEntry> entries;
@@ -619,7 +616,7 @@ void LocalCapabilitiesDirectory::lookup(const std::string& participantId,
                 if (replaceGdeGbid) {
                     LCDUtil::replaceGbidWithEmptyString(result);
                 }
-                std::lock_guard<std::recursive_mutex> cacheLock(
+                ReentrantWriteLocker cacheLock(
                         thisSharedPtr->_localCapabilitiesDirectoryStore->getCacheLock());
                 thisSharedPtr->capabilitiesReceived(
                         result,
@@ -675,7 +672,7 @@ void LocalCapabilitiesDirectory::lookup(const std::vector<std::string>& domains,
                           replaceGdeGbid = LCDUtil::containsOnlyEmptyString(gbids)](
                                  std::vector<joynr::types::GlobalDiscoveryEntry> result) {
             if (auto thisSharedPtr = thisWeakPtr.lock()) {
-                std::lock_guard<std::recursive_mutex> cacheLock(
+                ReentrantWriteLocker cacheLock(
                         thisSharedPtr->_localCapabilitiesDirectoryStore->getCacheLock());
                 std::lock_guard<std::mutex> lock(thisSharedPtr->_pendingLookupsLock);
                 if (!(thisSharedPtr->_lcdPendingLookupsHandler.isCallbackCalled(
@@ -1124,8 +1121,7 @@ void LocalCapabilitiesDirectory::remove(
 {
     std::ignore = onError;
     {
-        std::unique_lock<std::recursive_mutex> removeLock(
-                _localCapabilitiesDirectoryStore->getCacheLock());
+        ReentrantWriteLocker removeLock(_localCapabilitiesDirectoryStore->getCacheLock());
 
         boost::optional<types::DiscoveryEntry> optionalEntry =
                 _localCapabilitiesDirectoryStore->getLocallyRegisteredCapabilities(removeLock)
@@ -1150,8 +1146,7 @@ void LocalCapabilitiesDirectory::remove(
                                           lCDStoreWeakPtr = joynr::util::as_weak_ptr(
                                                   _localCapabilitiesDirectoryStore)]() {
                 if (auto lCDStoreSharedPtr = lCDStoreWeakPtr.lock()) {
-                    std::unique_lock<std::recursive_mutex> cacheLock(
-                            lCDStoreSharedPtr->getCacheLock());
+                    ReentrantWriteLocker cacheLock(lCDStoreSharedPtr->getCacheLock());
                     const std::string gbidString = boost::algorithm::join(
                             lCDStoreSharedPtr->getGbidsForParticipantId(participantId, cacheLock),
                             ", ");
@@ -1183,8 +1178,7 @@ void LocalCapabilitiesDirectory::remove(
                 case DiscoveryError::Enum::NO_ENTRY_FOR_PARTICIPANT:
                 case DiscoveryError::Enum::NO_ENTRY_FOR_SELECTED_BACKENDS:
                     if (auto lCDStoreSharedPtr = lCDStoreWeakPtr.lock()) {
-                        std::unique_lock<std::recursive_mutex> cacheLock(
-                                lCDStoreSharedPtr->getCacheLock());
+                        ReentrantWriteLocker cacheLock(lCDStoreSharedPtr->getCacheLock());
                         const std::string gbidString =
                                 boost::algorithm::join(lCDStoreSharedPtr->getGbidsForParticipantId(
                                                                participantId, cacheLock),
@@ -1218,8 +1212,7 @@ void LocalCapabilitiesDirectory::remove(
                 case DiscoveryError::Enum::INTERNAL_ERROR:
                 default:
                     if (auto lCDStoreSharedPtr = lCDStoreWeakPtr.lock()) {
-                        std::unique_lock<std::recursive_mutex> cacheLock(
-                                lCDStoreSharedPtr->getCacheLock());
+                        ReentrantWriteLocker cacheLock(lCDStoreSharedPtr->getCacheLock());
                         const std::string gbidString =
                                 boost::algorithm::join(lCDStoreSharedPtr->getGbidsForParticipantId(
                                                                participantId, cacheLock),
@@ -1239,8 +1232,7 @@ void LocalCapabilitiesDirectory::remove(
                                            _localCapabilitiesDirectoryStore)](
                                           const exceptions::JoynrRuntimeException& exception) {
                 if (auto lCDStoreSharedPtr = lCDStoreWeakPtr.lock()) {
-                    std::unique_lock<std::recursive_mutex> cacheLock(
-                            lCDStoreSharedPtr->getCacheLock());
+                    ReentrantWriteLocker cacheLock(lCDStoreSharedPtr->getCacheLock());
                     const std::string gbidString = boost::algorithm::join(
                             lCDStoreSharedPtr->getGbidsForParticipantId(participantId, cacheLock),
                             ", ");
@@ -1283,7 +1275,7 @@ void LocalCapabilitiesDirectory::saveLocalCapabilitiesToFile(const std::string&
     }
 
     try {
-        std::unique_lock<std::recursive_mutex> filePersistencyStorageLock(
+        ReentrantWriteLocker filePersistencyStorageLock(
                 _localCapabilitiesDirectoryStore->getCacheLock());
         joynr::util::saveStringToFile(
                 fileName,
@@ -1319,7 +1311,7 @@ void LocalCapabilitiesDirectory::loadPersistedFile()
         return;
     }
 
-    std::unique_lock<std::recursive_mutex> filePersistencyRetrievalLock(
+    ReentrantWriteLocker filePersistencyRetrievalLock(
             _localCapabilitiesDirectoryStore->getCacheLock());
 
     try {
@@ -1422,48 +1414,66 @@ void LocalCapabilitiesDirectory::checkExpiredDiscoveryEntries(
                         errorCode.message());
     }
 
+    // expired entries are purged in bounded batches, earliest expiry first, and the cache lock is
+    // released between the batches so that lookups are not stalled by a large sweep
     bool fileUpdateRequired = false;
-    {
-        std::unique_lock<std::recursive_mutex> discoveryEntryExpiryCheckLock(
-                _localCapabilitiesDirectoryStore->getCacheLock());
+    auto messageRouterSharedPtr = _messageRouter.lock();
+    bool moreEntriesExpired = true;
+    while (moreEntriesExpired) {
+        std::vector<types::DiscoveryEntry> removedLocalCapabilities;
+        std::vector<types::DiscoveryEntry> removedGlobalCapabilities;
+        {
+            ReentrantWriteLocker discoveryEntryExpiryCheckLock(
+                    _localCapabilitiesDirectoryStore->getCacheLock());
 
-        auto removedLocalCapabilities =
-                _localCapabilitiesDirectoryStore
-                        ->getLocallyRegisteredCapabilities(discoveryEntryExpiryCheckLock)
-                        ->removeExpired();
-        auto removedGlobalCapabilities =
-                _localCapabilitiesDirectoryStore
-                        ->getGlobalLookupCache(discoveryEntryExpiryCheckLock)
-                        ->removeExpired();
-
-        if (!removedLocalCapabilities.empty() || !removedGlobalCapabilities.empty()) {
-            fileUpdateRequired = true;
-            if (auto messageRouterSharedPtr = _messageRouter.lock()) {
-                JOYNR_LOG_INFO(
-                        logger(),
-                        "Following discovery entries expired: local: {}, "
-                        "#localCapabilities: {}, global: {}, #globalLookupCache: {}",
-                        LCDUtil::joinToString(removedLocalCapabilities),
-                        _localCapabilitiesDirectoryStore
-                                ->getLocallyRegisteredCapabilities(discoveryEntryExpiryCheckLock)
-                                ->size(),
-                        LCDUtil::joinToString(removedGlobalCapabilities),
-                        _localCapabilitiesDirectoryStore
-                                ->getGlobalLookupCache(discoveryEntryExpiryCheckLock)
-                                ->size());
+            removedLocalCapabilities =
+                    _localCapabilitiesDirectoryStore
+                            ->getLocallyRegisteredCapabilities(discoveryEntryExpiryCheckLock)
+                            ->removeExpired(EXPIRED_DISCOVERY_ENTRIES_BATCH_SIZE);
+            removedGlobalCapabilities =
+                    _localCapabilitiesDirectoryStore
+                            ->getGlobalLookupCache(discoveryEntryExpiryCheckLock)
+                            ->removeExpired(EXPIRED_DISCOVERY_ENTRIES_BATCH_SIZE);
 
+            if (removedLocalCapabilities.empty() && removedGlobalCapabilities.empty()) {
+                break;
+            }
+            JOYNR_LOG_INFO(logger(),
+                           "Following discovery entries expired: local: {}, "
+                           "#localCapabilities: {}, global: {}, #globalLookupCache: {}",
+                           LCDUtil::joinToString(removedLocalCapabilities),
+                           _localCapabilitiesDirectoryStore
+                                   ->getLocallyRegisteredCapabilities(discoveryEntryExpiryCheckLock)
+                                   ->size(),
+                           LCDUtil::joinToString(removedGlobalCapabilities),
+                           _localCapabilitiesDirectoryStore
+                                   ->getGlobalLookupCache(discoveryEntryExpiryCheckLock)
+                                   ->size());
+
+            if (messageRouterSharedPtr) {
                 for (const auto& capability :
                      boost::join(removedLocalCapabilities, removedGlobalCapabilities)) {
-                    messageRouterSharedPtr->removeNextHop(capability.getParticipantId());
                     _localCapabilitiesDirectoryStore->eraseParticipantIdToGbidMapping(
                             capability.getParticipantId(), discoveryEntryExpiryCheckLock);
                 }
-            } else {
-                JOYNR_LOG_FATAL(logger(),
-                                "could not call removeNextHop because messageRouter is "
-                                "not available");
             }
         }
+        fileUpdateRequired = true;
+        moreEntriesExpired =
+                removedLocalCapabilities.size() == EXPIRED_DISCOVERY_ENTRIES_BATCH_SIZE ||
+                removedGlobalCapabilities.size() == EXPIRED_DISCOVERY_ENTRIES_BATCH_SIZE;
+
+        // the routing table has its own lock, no need to block the caches meanwhile
+        if (messageRouterSharedPtr) {
+            for (const auto& capability :
+                 boost::join(removedLocalCapabilities, removedGlobalCapabilities)) {
+                messageRouterSharedPtr->removeNextHop(capability.getParticipantId());
+            }
+        } else {
+            JOYNR_LOG_FATAL(logger(),
+                            "could not call removeNextHop because messageRouter is "
+                            "not available");
+        }
     }
 
     if (fileUpdateRequired) {
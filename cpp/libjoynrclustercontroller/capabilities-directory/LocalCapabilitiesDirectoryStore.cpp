@@ -20,7 +20,6 @@
 #include <boost/algorithm/string/join.hpp>
 #include <boost/optional.hpp>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <vector>
 
@@ -29,6 +28,8 @@
 #include "joynr/ILocalCapabilitiesCallback.h"
 #include "joynr/LCDUtil.h"
 #include "joynr/LocalCapabilitiesDirectoryStore.h"
+#include "joynr/Metrics.h"
+#include "joynr/ReentrantReadWriteLock.h"
 #include "joynr/Util.h"
 #include "joynr/types/DiscoveryQos.h"
 
@@ -36,9 +37,25 @@ namespace joynr
 {
 
 LocalCapabilitiesDirectoryStore::LocalCapabilitiesDirectoryStore()
+        : LocalCapabilitiesDirectoryStore(capabilities::CachingStorage::DEFAULT_MAX_ELEMENT_COUNT)
+{
+}
+
+LocalCapabilitiesDirectoryStore::LocalCapabilitiesDirectoryStore(
+        std::size_t globalLookupCacheMaxEntries)
         : _locallyRegisteredCapabilities(std::make_shared<capabilities::Storage>()),
-          _globalLookupCache(std::make_shared<capabilities::CachingStorage>()),
-          _cacheLock()
+          _globalLookupCache(std::make_shared<capabilities::CachingStorage>(
+                  globalLookupCacheMaxEntries,
+                  metrics::MetricsRegistry::instance().getCounter(
+                          "capabilities.globalLookupCache.evictions"),
+                  [this](const std::string& participantId) {
+                      onGlobalLookupCacheEviction(participantId);
+                  })),
+          _cacheLock(),
+          _globalLookupCacheHits(metrics::MetricsRegistry::instance().getCounter(
+                  "capabilities.globalLookupCache.hits")),
+          _globalLookupCacheMisses(metrics::MetricsRegistry::instance().getCounter(
+                  "capabilities.globalLookupCache.misses"))
 {
 }
 
@@ -50,7 +67,7 @@ LocalCapabilitiesDirectoryStore::~LocalCapabilitiesDirectoryStore()
 std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::
         getCachedGlobalDiscoveryEntries() const
 {
-    std::lock_guard<std::recursive_mutex> globalCachedRetrievalLock(_cacheLock);
+    ReentrantReadLocker globalCachedRetrievalLock(_cacheLock);
 
     return std::vector<types::DiscoveryEntry>(
             _globalLookupCache->cbegin(), _globalLookupCache->cend());
@@ -59,7 +76,7 @@ std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::
 std::size_t LocalCapabilitiesDirectoryStore::countGlobalCapabilities() const
 {
     std::size_t counter = 0;
-    std::lock_guard<std::recursive_mutex> lock4(_cacheLock);
+    ReentrantReadLocker lock4(_cacheLock);
     for (const auto& capability : *_locallyRegisteredCapabilities) {
         if (capability.getQos().getScope() == types::ProviderScope::GLOBAL) {
             counter++;
@@ -71,7 +88,7 @@ std::size_t LocalCapabilitiesDirectoryStore::countGlobalCapabilities() const
 std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::getAllGlobalCapabilities() const
 {
     std::vector<types::DiscoveryEntry> allGlobalEntries;
-    std::lock_guard<std::recursive_mutex> storeLock(_cacheLock);
+    ReentrantReadLocker storeLock(_cacheLock);
     for (const auto& capability : *_locallyRegisteredCapabilities) {
         if (LCDUtil::isGlobal(capability)) {
             allGlobalEntries.push_back(capability);
@@ -190,7 +207,7 @@ bool LocalCapabilitiesDirectoryStore::callReceiverIfPossible(
 std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::getLocalCapabilities(
         const std::string& participantId)
 {
-    std::lock_guard<std::recursive_mutex> localCachedRetrievalLock(_cacheLock);
+    ReentrantReadLocker localCachedRetrievalLock(_cacheLock);
     return LCDUtil::optionalToVector(
             _locallyRegisteredCapabilities->lookupByParticipantId(participantId));
 }
@@ -203,7 +220,7 @@ std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::getLocalCapa
 
 void LocalCapabilitiesDirectoryStore::clear()
 {
-    std::lock_guard<std::recursive_mutex> clearingLock(_cacheLock);
+    ReentrantWriteLocker clearingLock(_cacheLock);
     _locallyRegisteredCapabilities->clear();
     _globalLookupCache->clear();
     _globalParticipantIdsToGbidsMap.clear();
@@ -212,7 +229,7 @@ void LocalCapabilitiesDirectoryStore::clear()
 void LocalCapabilitiesDirectoryStore::insertInLocalCapabilitiesStorage(
         const types::DiscoveryEntry& entry)
 {
-    std::lock_guard<std::recursive_mutex> localInsertionLock(_cacheLock);
+    ReentrantWriteLocker localInsertionLock(_cacheLock);
 
     auto found = _globalParticipantIdsToGbidsMap.find(entry.getParticipantId());
     _locallyRegisteredCapabilities->insert(entry,
@@ -229,9 +246,7 @@ void LocalCapabilitiesDirectoryStore::insertInGlobalLookupCache(
         const types::DiscoveryEntry& entry,
         const std::vector<std::string>& gbids)
 {
-    std::lock_guard<std::recursive_mutex> globalInsertionLock(_cacheLock);
-
-    _globalLookupCache->insert(entry);
+    ReentrantWriteLocker globalInsertionLock(_cacheLock);
 
     const std::string& participantId = entry.getParticipantId();
     std::vector<std::string> allGbids(gbids);
@@ -246,6 +261,8 @@ void LocalCapabilitiesDirectoryStore::insertInGlobalLookupCache(
         }
     }
     _globalParticipantIdsToGbidsMap[participantId] = allGbids;
+    // inserting may evict entries including their GBID mapping, hence it comes last
+    _globalLookupCache->insert(entry);
 
     JOYNR_LOG_INFO(
             logger(),
@@ -260,7 +277,7 @@ std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::searchGlobal
         const std::vector<std::string>& gbids,
         std::chrono::milliseconds maxCacheAge)
 {
-    std::unique_lock<std::recursive_mutex> globalSearchLock(_cacheLock);
+    ReentrantReadLocker globalSearchLock(_cacheLock);
 
     const std::unordered_set<std::string> gbidsSet(gbids.cbegin(), gbids.cend());
     std::vector<types::DiscoveryEntry> result;
@@ -270,6 +287,7 @@ std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::searchGlobal
 
         const auto entries =
                 _globalLookupCache->lookupCacheByDomainAndInterface(domain, interface, maxCacheAge);
+        (entries.empty() ? _globalLookupCacheMisses : _globalLookupCacheHits)->increment();
         const auto filteredEntries = LCDUtil::filterDiscoveryEntriesByGbids(
                 globalSearchLock, entries, gbidsSet, _globalParticipantIdsToGbidsMap);
         result.insert(result.end(),
@@ -282,7 +300,7 @@ std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::searchGlobal
 std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::searchLocalCache(
         const std::vector<InterfaceAddress>& interfaceAddresses)
 {
-    std::lock_guard<std::recursive_mutex> localSearchLock(_cacheLock);
+    ReentrantReadLocker localSearchLock(_cacheLock);
 
     std::vector<types::DiscoveryEntry> result;
     for (const auto& interfaceAddress : interfaceAddresses) {
@@ -304,7 +322,7 @@ boost::optional<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::searchCa
         const std::vector<std::string>& gbids,
         std::chrono::milliseconds maxCacheAge)
 {
-    std::unique_lock<std::recursive_mutex> lock(_cacheLock);
+    ReentrantReadLocker lock(_cacheLock);
 
     // first search locally
     auto entry = _locallyRegisteredCapabilities->lookupByParticipantId(participantId);
@@ -318,6 +336,7 @@ boost::optional<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::searchCa
     } else {
         entry = _globalLookupCache->lookupCacheByParticipantId(participantId, maxCacheAge);
     }
+    (entry ? _globalLookupCacheHits : _globalLookupCacheMisses)->increment();
     if (entry) {
         const std::unordered_set<std::string> gbidsSet(gbids.cbegin(), gbids.cend());
         if (!LCDUtil::isEntryForGbid(lock, *entry, gbidsSet, _globalParticipantIdsToGbidsMap)) {
@@ -327,14 +346,24 @@ boost::optional<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::searchCa
     return entry;
 }
 
-std::recursive_mutex& LocalCapabilitiesDirectoryStore::getCacheLock()
+void LocalCapabilitiesDirectoryStore::onGlobalLookupCacheEviction(const std::string& participantId)
+{
+    // the cache is only modified while holding the write lock, so this does not block
+    ReentrantWriteLocker evictionLock(_cacheLock);
+    // the GBIDs of globally registered local providers are still needed to re-register them
+    if (!_locallyRegisteredCapabilities->lookupByParticipantId(participantId)) {
+        eraseParticipantIdToGbidMapping(participantId, evictionLock);
+    }
+}
+
+ReentrantReadWriteLock& LocalCapabilitiesDirectoryStore::getCacheLock()
 {
     return _cacheLock;
 }
 
 void LocalCapabilitiesDirectoryStore::eraseParticipantIdToGbidMapping(
         const std::string& participantId,
-        const std::unique_lock<std::recursive_mutex>& cacheLock)
+        const ReentrantWriteLocker& cacheLock)
 {
     assert(cacheLock.owns_lock());
     std::ignore = cacheLock;
@@ -343,7 +372,20 @@ void LocalCapabilitiesDirectoryStore::eraseParticipantIdToGbidMapping(
 
 std::vector<std::string> LocalCapabilitiesDirectoryStore::getGbidsForParticipantId(
         const std::string& participantId,
-        const std::unique_lock<std::recursive_mutex>& cacheLock)
+        const ReentrantWriteLocker& cacheLock)
+{
+    assert(cacheLock.owns_lock());
+    std::ignore = cacheLock;
+    auto foundGbids = _globalParticipantIdsToGbidsMap.find(participantId);
+    if (foundGbids == _globalParticipantIdsToGbidsMap.cend()) {
+        return {};
+    }
+    return foundGbids->second;
+}
+
+std::vector<std::string> LocalCapabilitiesDirectoryStore::getGbidsForParticipantId(
+        const std::string& participantId,
+        const ReentrantReadLocker& cacheLock)
 {
     assert(cacheLock.owns_lock());
     std::ignore = cacheLock;
@@ -355,7 +397,7 @@ std::vector<std::string> LocalCapabilitiesDirectoryStore::getGbidsForParticipant
 }
 
 std::shared_ptr<capabilities::CachingStorage> LocalCapabilitiesDirectoryStore::getGlobalLookupCache(
-        const std::unique_lock<std::recursive_mutex>& cacheLock)
+        const ReentrantWriteLocker& cacheLock)
 {
     assert(cacheLock.owns_lock());
     std::ignore = cacheLock;
@@ -363,7 +405,7 @@ std::shared_ptr<capabilities::CachingStorage> LocalCapabilitiesDirectoryStore::g
 }
 
 std::shared_ptr<capabilities::Storage> LocalCapabilitiesDirectoryStore::
-        getLocallyRegisteredCapabilities(const std::unique_lock<std::recursive_mutex>& cacheLock)
+        getLocallyRegisteredCapabilities(const ReentrantWriteLocker& cacheLock)
 {
     assert(cacheLock.owns_lock());
     std::ignore = cacheLock;
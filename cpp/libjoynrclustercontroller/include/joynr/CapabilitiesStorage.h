@@ -19,6 +19,12 @@
 #ifndef CAPABILITIESSTORAGE_H
 #define CAPABILITIESSTORAGE_H
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -34,6 +40,7 @@
 
 #include <muesli/Traits.h>
 
+#include "joynr/Metrics.h"
 #include "joynr/serializer/Serializer.h"
 #include "joynr/types/DiscoveryEntry.h"
 
@@ -98,10 +105,30 @@ using Timestamp = std::chrono::time_point<std::chrono::system_clock>;
 
 struct CachedDiscoveryEntry : public DiscoveryEntry {
     CachedDiscoveryEntry(const DiscoveryEntry& entry, Timestamp timestamp)
-            : DiscoveryEntry(entry), _timestamp(timestamp)
+            : DiscoveryEntry(entry), _timestamp(timestamp), _referenced(false)
     {
     }
+    CachedDiscoveryEntry(const CachedDiscoveryEntry& other)
+            : DiscoveryEntry(other),
+              _timestamp(other._timestamp),
+              _referenced(other._referenced.load(std::memory_order_relaxed))
+    {
+    }
+    CachedDiscoveryEntry& operator=(const CachedDiscoveryEntry& other)
+    {
+        DiscoveryEntry::operator=(other);
+        _timestamp = other._timestamp;
+        _referenced.store(other._referenced.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+        return *this;
+    }
+    void markReferenced() const
+    {
+        _referenced.store(true, std::memory_order_relaxed);
+    }
     Timestamp _timestamp;
+    // set by lookups which only hold the cache lock shared, hence atomic
+    mutable std::atomic<bool> _referenced;
 };
 
 using ContainerIndices = Container::index_specifier_type_list;
@@ -187,16 +214,23 @@ public:
     }
 
     /**
-     * @brief removes expired entries based on expiryDate
+     * @brief removes expired entries based on expiryDate, earliest expiry first
+     * @param maxEntries maximum number of entries to remove in this call
      * @return expired/removed entries
      */
-    virtual std::vector<DiscoveryEntry> removeExpired()
+    virtual std::vector<DiscoveryEntry> removeExpired(
+            std::size_t maxEntries = std::numeric_limits<std::size_t>::max())
     {
         auto& index = _container.template get<tags::ExpiryDate>();
         auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
                            std::chrono::system_clock::now().time_since_epoch())
                            .count();
-        auto last = index.lower_bound(now);
+        auto last = index.begin();
+        std::size_t count = 0;
+        while (last != index.end() && last->getExpiryDateMs() < now && count < maxEntries) {
+            ++last;
+            ++count;
+        }
         std::vector<DiscoveryEntry> removedEntries(index.begin(), last);
         index.erase(index.begin(), last);
         return removedEntries;
@@ -314,6 +348,14 @@ public:
     }
 };
 
+/**
+ * @brief Bounded cache of discovery entries looked up from the global capabilities directory.
+ *
+ * When the cache is full, the least recently used entry is evicted. Recency is approximated
+ * with the second chance (clock) algorithm: lookups only mark hit entries as referenced, which
+ * is safe while holding the cache lock shared, and eviction moves referenced entries back to
+ * the front instead of evicting them. Newly inserted and refreshed entries start at the front.
+ */
 class CachingStorage : public BaseStorage<CachingContainer>
 {
 private:
@@ -323,12 +365,34 @@ private:
         return [maxAge, now](const CachedDiscoveryEntry& cachedEntry) {
             auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                     now - cachedEntry._timestamp);
-            return elapsed <= maxAge;
+            if (elapsed > maxAge) {
+                return false;
+            }
+            cachedEntry.markReferenced();
+            return true;
         };
     }
 
+    struct MarkReferenced {
+        bool operator()(const CachedDiscoveryEntry& cachedEntry) const
+        {
+            cachedEntry.markReferenced();
+            return true;
+        }
+    };
+
 public:
-    CachingStorage(std::size_t maxElementCount = 1000) : _maxElementCount(maxElementCount)
+    static constexpr std::size_t DEFAULT_MAX_ELEMENT_COUNT = 1000;
+
+    // called with the participantId of every entry evicted because the cache is full
+    using EvictionCallback = std::function<void(const std::string& participantId)>;
+
+    CachingStorage(std::size_t maxElementCount = DEFAULT_MAX_ELEMENT_COUNT,
+                   std::shared_ptr<metrics::Counter> evictionCounter = nullptr,
+                   EvictionCallback onEvicted = nullptr)
+            : _maxElementCount(maxElementCount),
+              _evictionCounter(std::move(evictionCounter)),
+              _onEvicted(std::move(onEvicted))
     {
     }
 
@@ -343,22 +407,34 @@ public:
 
         // entry already existed
         if (!insertResult.second) {
-
-            auto existingIt = insertResult.first;
-
             // replace
-            bool replaceResult = index.replace(existingIt, cachedEntry);
+            bool replaceResult = index.replace(insertResult.first, cachedEntry);
             assert(replaceResult);
             std::ignore = replaceResult;
+        }
+
+        // rank to top; entries inserted via another index are appended at the end
+        auto sequencedIt = _container.project<0>(insertResult.first);
+        _container.relocate(_container.begin(), sequencedIt);
 
-            // rank to top
-            auto sequencedIt = _container.project<0>(existingIt);
-            _container.relocate(_container.begin(), sequencedIt);
-        } else if (_container.size() > _maxElementCount) {
-            _container.pop_back();
+        if (insertResult.second) {
+            evictLeastRecentlyUsed();
         }
     }
 
+    boost::optional<DiscoveryEntry> lookupByParticipantId(
+            const std::string& participantId) const override
+    {
+        return lookupByParticipantIdFiltered(participantId, MarkReferenced());
+    }
+
+    std::vector<DiscoveryEntry> lookupByDomainAndInterface(
+            const std::string& domain,
+            const std::string& interface) const override
+    {
+        return lookupByDomainAndInterfaceFiltered(domain, interface, MarkReferenced());
+    }
+
     virtual boost::optional<DiscoveryEntry> lookupCacheByParticipantId(
             const std::string& participantId,
             std::chrono::milliseconds maxAge) const
@@ -374,8 +450,36 @@ public:
         return lookupByDomainAndInterfaceFiltered(domain, interface, filterByAge(maxAge));
     }
 
+    std::size_t getMaxElementCount() const
+    {
+        return _maxElementCount;
+    }
+
 private:
+    void evictLeastRecentlyUsed()
+    {
+        // every entry gets at most one second chance, hence this terminates after
+        // at most two passes over the container
+        while (_container.size() > _maxElementCount) {
+            auto last = std::prev(_container.end());
+            if (last->_referenced.exchange(false, std::memory_order_relaxed)) {
+                _container.relocate(_container.begin(), last);
+                continue;
+            }
+            const std::string participantId = last->getParticipantId();
+            _container.erase(last);
+            if (_evictionCounter) {
+                _evictionCounter->increment();
+            }
+            if (_onEvicted) {
+                _onEvicted(participantId);
+            }
+        }
+    }
+
     std::size_t _maxElementCount;
+    std::shared_ptr<metrics::Counter> _evictionCounter;
+    EvictionCallback _onEvicted;
 };
 
 } // namespace capabilities
@@ -116,6 +116,12 @@ public:
                     std::function<void(const joynr::exceptions::ProviderRuntimeException&)>
                             onError = nullptr) final;
 
+    /*
+     * Direct in-process dispatch bypasses the access control check in route(), hence it is
+     * only allowed while no access controller is set.
+     */
+    bool canDispatchInProcess(const std::string& participantId) final;
+
     /*
      * Implement methods from RoutingAbstractProvider
      */
@@ -175,6 +181,20 @@ public:
             std::function<void()> onSuccess,
             std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError) final;
 
+    void addNextHops(
+            const std::vector<std::string>& participantIds,
+            const joynr::system::RoutingTypes::WebSocketClientAddress& webSocketClientAddress,
+            const bool& isGloballyVisible,
+            std::function<void()> onSuccess,
+            std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError) final;
+
+    void addNextHops(
+            const std::vector<std::string>& participantIds,
+            const joynr::system::RoutingTypes::UdsClientAddress& udsClientAddress,
+            const bool& isGloballyVisible,
+            std::function<void()> onSuccess,
+            std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError) final;
+
     void removeNextHop(const std::string& participantId,
                        std::function<void()> onSuccess = nullptr,
                        std::function<void(const joynr::exceptions::ProviderRuntimeException&)>
@@ -185,6 +205,11 @@ public:
             std::function<void(const bool& resolved)> onSuccess,
             std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError) final;
 
+    void resolveNextHops(
+            const std::vector<std::string>& participantIds,
+            std::function<void(const std::vector<bool>& resolved)> onSuccess,
+            std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError) final;
+
     void getGlobalAddress(
             std::function<void(const std::string&)> onSuccess,
             std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError) final;
@@ -236,6 +261,13 @@ private:
     bool allowRoutingEntryUpdate(const routingtable::RoutingEntry& oldEntry,
                                  const system::RoutingTypes::Address& newAddress) final;
 
+    void addNextHops(
+            const std::vector<std::string>& participantIds,
+            const std::shared_ptr<const joynr::system::RoutingTypes::Address>& address,
+            bool isGloballyVisible,
+            std::function<void()> onSuccess,
+            std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError);
+
     void reestablishMulticastSubscriptions();
     void registerMulticastInSkeleton(
             const std::string& multicastId,
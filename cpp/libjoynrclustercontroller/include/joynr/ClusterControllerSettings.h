@@ -43,6 +43,10 @@ public:
     static const std::string& SETTING_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT();
     static const std::string& SETTING_MESSAGE_QUEUE_LIMIT_BYTES();
     static const std::string& SETTING_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT_BYTES();
+    static const std::string& SETTING_MESSAGE_QUEUE_SPILL_DIRECTORY();
+    static const std::string& SETTING_MESSAGE_QUEUE_SPILL_LIMIT_BYTES();
+    static const std::string& SETTING_STARTUP_MAX_PARALLELISM();
+    static const std::string& SETTING_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES();
     static const std::string& SETTING_MQTT_CLIENT_ID_PREFIX();
     static const std::string& SETTING_MQTT_TLS_ENABLED();
     static const std::string& SETTING_MQTT_TLS_VERSION();
@@ -86,6 +90,10 @@ public:
     static std::uint64_t DEFAULT_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT();
     static std::uint64_t DEFAULT_MESSAGE_QUEUE_LIMIT_BYTES();
     static std::uint64_t DEFAULT_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT_BYTES();
+    static const std::string& DEFAULT_MESSAGE_QUEUE_SPILL_DIRECTORY();
+    static std::uint64_t DEFAULT_MESSAGE_QUEUE_SPILL_LIMIT_BYTES();
+    static std::uint32_t DEFAULT_STARTUP_MAX_PARALLELISM();
+    static std::uint32_t DEFAULT_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES();
     static bool DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_COMPRESSED_MESSAGES_ENABLED();
     static int DEFAULT_ROUTED_MESSAGE_PRINT_INTERVAL_S();
     static bool DEFAULT_WEBSOCKET_ENABLED();
@@ -160,6 +168,29 @@ public:
     std::uint64_t getTransportNotAvailableQueueLimitBytes() const;
     void setTransportNotAvailableQueueLimitBytes(std::uint64_t limitBytes);
 
+    /**
+     * @brief Directory of the files to which queued messages are spilled once the
+     * queue limits are reached. Spilling is disabled if the directory is empty.
+     */
+    std::string getMessageQueueSpillDirectory() const;
+    void setMessageQueueSpillDirectory(const std::string& directory);
+
+    /**
+     * @brief Maximum size of each spill file, 0 means unlimited
+     */
+    std::uint64_t getMessageQueueSpillLimitBytes() const;
+    void setMessageQueueSpillLimitBytes(std::uint64_t limitBytes);
+
+    /**
+     * @brief Maximum number of independent startup steps which are run concurrently,
+     * 1 initializes the cluster controller sequentially
+     */
+    std::uint32_t getStartupMaxParallelism() const;
+    void setStartupMaxParallelism(std::uint32_t maxParallelism);
+
+    std::uint32_t getGlobalLookupCacheMaxEntries() const;
+    void setGlobalLookupCacheMaxEntries(std::uint32_t maxEntries);
+
     bool enableAccessController() const;
     void setEnableAccessController(bool enable);
 
@@ -19,7 +19,6 @@
 #ifndef LCDUTIL_H
 #define LCDUTIL_H
 
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -30,6 +29,7 @@
 
 #include "joynr/InterfaceAddress.h"
 #include "joynr/Logger.h"
+#include "joynr/ReentrantReadWriteLock.h"
 #include "joynr/types/DiscoveryEntry.h"
 
 namespace joynr
@@ -70,10 +70,10 @@ public:
                                                  std::unordered_set<std::string> validGbids);
 
     static std::vector<types::DiscoveryEntry> filterDiscoveryEntriesByGbids(
-            const std::unique_lock<std::recursive_mutex>& cacheLock,
+            const ReentrantReadLocker& cacheLock,
             const std::vector<types::DiscoveryEntry>& entries,
             const std::unordered_set<std::string>& gbids,
-            std::unordered_map<std::string, std::vector<std::string>>
+            const std::unordered_map<std::string, std::vector<std::string>>&
                     globalParticipantIdsToGbidsMap);
 
     static std::vector<types::DiscoveryEntryWithMetaInfo> filterDuplicates(
@@ -91,10 +91,10 @@ public:
 
     static std::string joinToString(const std::vector<types::DiscoveryEntry>& discoveryEntries);
 
-    static bool isEntryForGbid(const std::unique_lock<std::recursive_mutex>& cacheLock,
+    static bool isEntryForGbid(const ReentrantReadLocker& cacheLock,
                                const types::DiscoveryEntry& entry,
-                               const std::unordered_set<std::string> gbids,
-                               std::unordered_map<std::string, std::vector<std::string>>
+                               const std::unordered_set<std::string>& gbids,
+                               const std::unordered_map<std::string, std::vector<std::string>>&
                                        globalParticipantIdsToGbidsMap);
     static types::GlobalDiscoveryEntry toGlobalDiscoveryEntry(
             const types::DiscoveryEntry& discoveryEntry,
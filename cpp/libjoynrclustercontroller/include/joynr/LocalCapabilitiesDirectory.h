@@ -268,6 +268,8 @@ private:
 
     boost::asio::steady_timer _checkExpiredDiscoveryEntriesTimer;
     const bool _isLocalCapabilitiesDirectoryPersistencyEnabled;
+    // maximum number of expired entries per cache removed while holding the cache lock
+    static constexpr std::size_t EXPIRED_DISCOVERY_ENTRIES_BATCH_SIZE = 64;
 
     void scheduleCleanupTimer();
     void checkExpiredDiscoveryEntries(const boost::system::error_code& errorCode);
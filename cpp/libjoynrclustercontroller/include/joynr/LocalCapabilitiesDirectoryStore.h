@@ -21,13 +21,13 @@
 
 #include <boost/optional.hpp>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "joynr/InterfaceAddress.h"
 #include "joynr/Logger.h"
+#include "joynr/ReentrantReadWriteLock.h"
 #include "joynr/types/DiscoveryScope.h"
 
 namespace joynr
@@ -41,6 +41,11 @@ class Storage;
 class CachingStorage;
 } // namespace capabilities
 
+namespace metrics
+{
+class Counter;
+} // namespace metrics
+
 namespace types
 {
 class DiscoveryEntry;
@@ -52,6 +57,11 @@ class LocalCapabilitiesDirectoryStore
 
 public:
     LocalCapabilitiesDirectoryStore();
+    /*
+     * @param globalLookupCacheMaxEntries maximum number of entries in the global lookup cache,
+     * the least recently used entries are evicted when it is full
+     */
+    explicit LocalCapabilitiesDirectoryStore(std::size_t globalLookupCacheMaxEntries);
     virtual ~LocalCapabilitiesDirectoryStore();
 
     /*
@@ -92,18 +102,25 @@ public:
 
     virtual std::vector<std::string> getGbidsForParticipantId(
             const std::string& participantId,
-            const std::unique_lock<std::recursive_mutex>& cacheLock);
+            const ReentrantWriteLocker& cacheLock);
+    virtual std::vector<std::string> getGbidsForParticipantId(
+            const std::string& participantId,
+            const ReentrantReadLocker& cacheLock);
     std::vector<types::DiscoveryEntry> searchLocalCache(
             const std::vector<InterfaceAddress>& interfaceAddress);
 
-    std::recursive_mutex& getCacheLock();
+    /*
+     * Lookups take the cache lock shared so that they do not block each other.
+     * Callers modifying the caches must hold it exclusively (ReentrantWriteLocker).
+     */
+    ReentrantReadWriteLock& getCacheLock();
     virtual void eraseParticipantIdToGbidMapping(
             const std::string& participantId,
-            const std::unique_lock<std::recursive_mutex>& cacheLock);
+            const ReentrantWriteLocker& cacheLock);
     virtual std::shared_ptr<capabilities::CachingStorage> getGlobalLookupCache(
-            const std::unique_lock<std::recursive_mutex>& cacheLock);
+            const ReentrantWriteLocker& cacheLock);
     virtual std::shared_ptr<capabilities::Storage> getLocallyRegisteredCapabilities(
-            const std::unique_lock<std::recursive_mutex>& cacheLock);
+            const ReentrantWriteLocker& cacheLock);
 
 private:
     boost::optional<types::DiscoveryEntry> searchCaches(const std::string& participantId,
@@ -118,11 +135,14 @@ private:
                                 std::vector<types::DiscoveryEntry>&& localCapabilities,
                                 std::vector<types::DiscoveryEntry>&& globalCapabilities,
                                 std::shared_ptr<ILocalCapabilitiesCallback> callback);
+    void onGlobalLookupCacheEviction(const std::string& participantId);
 
     std::shared_ptr<capabilities::Storage> _locallyRegisteredCapabilities;
     std::shared_ptr<capabilities::CachingStorage> _globalLookupCache;
     std::unordered_map<std::string, std::vector<std::string>> _globalParticipantIdsToGbidsMap;
-    mutable std::recursive_mutex _cacheLock;
+    mutable ReentrantReadWriteLock _cacheLock;
+    std::shared_ptr<metrics::Counter> _globalLookupCacheHits;
+    std::shared_ptr<metrics::Counter> _globalLookupCacheMisses;
     ADD_LOGGER(LocalCapabilitiesDirectoryStore)
 };
 } // namespace joynr
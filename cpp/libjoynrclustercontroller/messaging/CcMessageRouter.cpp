@@ -29,15 +29,19 @@
 #include <unordered_set>
 #include <utility>
 
+#include <boost/algorithm/string/join.hpp>
+
 #include "joynr/ClusterControllerSettings.h"
 #include "joynr/IMulticastAddressCalculator.h"
 #include "joynr/IPlatformSecurityManager.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/InProcessMessagingAddress.h"
 #include "joynr/Message.h"
+#include "joynr/MessageTracer.h"
 #include "joynr/MessageQueue.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingSettings.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastMessagingSkeletonDirectory.h"
 #include "joynr/MulticastReceiverDirectory.h"
 #include "joynr/RoutingTable.h"
@@ -84,6 +88,7 @@ public:
 private:
     const bool _aclAudit;
     std::uint32_t _tryCount;
+    const metrics::Clock::time_point _creationTime;
     ADD_LOGGER(ConsumerPermissionCallback)
 };
 
@@ -175,6 +180,14 @@ void CcMessageRouter::setAccessController(std::weak_ptr<IAccessController> acces
     this->_accessController = std::move(accessController);
 }
 
+bool CcMessageRouter::canDispatchInProcess(const std::string& participantId)
+{
+    if (_accessController.lock()) {
+        return false;
+    }
+    return AbstractMessageRouter::canDispatchInProcess(participantId);
+}
+
 std::shared_ptr<system::MessageNotificationProvider> CcMessageRouter::
         getMessageNotificationProvider() const
 {
@@ -638,6 +651,79 @@ void CcMessageRouter::addNextHop(
                std::move(onSuccess));
 }
 
+// inherited from joynr::system::RoutingProvider
+void CcMessageRouter::addNextHops(
+        const std::vector<std::string>& participantIds,
+        const system::RoutingTypes::WebSocketClientAddress& webSocketClientAddress,
+        const bool& isGloballyVisible,
+        std::function<void()> onSuccess,
+        std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
+{
+    auto address = std::make_shared<const joynr::system::RoutingTypes::WebSocketClientAddress>(
+            webSocketClientAddress);
+    addNextHops(participantIds,
+                address,
+                isGloballyVisible,
+                std::move(onSuccess),
+                std::move(onError));
+}
+
+// inherited from joynr::system::RoutingProvider
+void CcMessageRouter::addNextHops(
+        const std::vector<std::string>& participantIds,
+        const system::RoutingTypes::UdsClientAddress& udsClientAddress,
+        const bool& isGloballyVisible,
+        std::function<void()> onSuccess,
+        std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
+{
+    auto address =
+            std::make_shared<const joynr::system::RoutingTypes::UdsClientAddress>(udsClientAddress);
+    addNextHops(participantIds,
+                address,
+                isGloballyVisible,
+                std::move(onSuccess),
+                std::move(onError));
+}
+
+void CcMessageRouter::addNextHops(
+        const std::vector<std::string>& participantIds,
+        const std::shared_ptr<const joynr::system::RoutingTypes::Address>& address,
+        bool isGloballyVisible,
+        std::function<void()> onSuccess,
+        std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
+{
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const bool isSticky = false;
+    // all entries share the same address instance
+    std::vector<std::string> failedParticipantIds;
+    for (const auto& participantId : participantIds) {
+        addNextHop(participantId,
+                   address,
+                   isGloballyVisible,
+                   expiryDateMs,
+                   isSticky,
+                   nullptr,
+                   [&failedParticipantIds, &participantId](
+                           const exceptions::ProviderRuntimeException&) {
+                       failedParticipantIds.push_back(participantId);
+                   });
+    }
+
+    if (failedParticipantIds.empty()) {
+        if (onSuccess) {
+            onSuccess();
+        }
+        return;
+    }
+    const std::string errorMessage =
+            "unable to addNextHops, as addToRoutingTable failed for participantIds: " +
+            boost::algorithm::join(failedParticipantIds, ", ");
+    JOYNR_LOG_ERROR(logger(), errorMessage);
+    if (onError) {
+        onError(exceptions::ProviderRuntimeException(errorMessage));
+    }
+}
+
 void CcMessageRouter::resolveNextHop(
         const std::string& participantId,
         std::function<void(const bool& resolved)> onSuccess,
@@ -653,6 +739,24 @@ void CcMessageRouter::resolveNextHop(
     onSuccess(resolved);
 }
 
+void CcMessageRouter::resolveNextHops(
+        const std::vector<std::string>& participantIds,
+        std::function<void(const std::vector<bool>& resolved)> onSuccess,
+        std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
+{
+    std::ignore = onError;
+
+    std::vector<bool> resolved;
+    resolved.reserve(participantIds.size());
+    {
+        ReadLocker lock(_routingTableLock);
+        for (const auto& participantId : participantIds) {
+            resolved.push_back(_routingTable.containsParticipantId(participantId));
+        }
+    }
+    onSuccess(resolved);
+}
+
 void CcMessageRouter::registerMulticastInSkeleton(
         const std::string& multicastId,
         const std::string& providerParticipantId,
@@ -917,12 +1021,18 @@ ConsumerPermissionCallback::ConsumerPermissionCallback(
           _message(message),
           _destination(destination),
           _aclAudit(aclAudit),
-          _tryCount(tryCount)
+          _tryCount(tryCount),
+          _creationTime(metrics::Clock::now())
 {
 }
 
 void ConsumerPermissionCallback::hasConsumerPermission(IAccessController::Enum hasPermission)
 {
+    static const std::shared_ptr<metrics::Histogram> aclCheckLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("acl.check.latencyUs");
+    aclCheckLatencyHistogram->recordElapsedSince(_creationTime);
+    JOYNR_TRACE_MESSAGE(ACL_DONE, _message->getId());
+
     if (_aclAudit) {
         if (hasPermission == IAccessController::Enum::NO) {
             JOYNR_LOG_ERROR(logger(),
@@ -20,6 +20,8 @@
 
 #include "joynr/ITransportMessageSender.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Metrics.h"
+#include "joynr/TrackingInfo.h"
 
 namespace joynr
 {
@@ -34,11 +36,14 @@ void MqttMessagingStub::transmit(
         std::shared_ptr<ImmutableMessage> message,
         const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure)
 {
+    static const std::shared_ptr<metrics::Histogram> sendLatencyHistogram =
+            metrics::MetricsRegistry::instance().getHistogram("transport.mqtt.send.latencyUs");
+    metrics::ScopedLatencyRecorder sendLatencyRecorder(*sendLatencyHistogram);
     if (logger().getLogLevel() == LogLevel::Debug) {
         JOYNR_LOG_DEBUG(logger(),
                         ">>> OUTGOING TO >{}< >>> {}",
                         _destinationAddress.getBrokerUri(),
-                        message->getTrackingInfo());
+                        TrackingInfo(*message));
     } else {
         JOYNR_LOG_TRACE(logger(),
                         ">>> OUTGOING TO >{}< >>> {}",
@@ -19,8 +19,12 @@
 
 #include "MosquittoConnection.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <sstream>
 #include <thread>
 #include <tuple>
@@ -30,6 +34,7 @@
 #include <openssl/ssl.h>
 
 #include "joynr/ClusterControllerSettings.h"
+#include "joynr/TlsSessionCache.h"
 #include "joynr/Url.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
@@ -59,6 +64,8 @@ MosquittoConnection::MosquittoConnection(const ClusterControllerSettings& ccSett
           _subscribeChannelMid(),
           _topic(),
           _additionalTopics(),
+          _pendingTopics(),
+          _isSubscribingToPendingTopics(false),
           _additionalTopicsMutex(),
           _isConnected(false),
           _isRunning(false),
@@ -209,8 +216,10 @@ MosquittoConnection::MosquittoConnection(const ClusterControllerSettings& ccSett
             JOYNR_LOG_FATAL(logger(), message);
             throw joynr::exceptions::JoynrRuntimeException(message);
         }
+        // A resumed handshake carries no stapled OCSP response, hence TLS sessions are not
+        // resumed and every connection revalidates the broker certificate.
         JOYNR_LOG_DEBUG(logger(),
-                        "[{}] Connection to {} :MQTT OCSP is enabled",
+                        "[{}] Connection to {} :MQTT OCSP is enabled, TLS sessions are not resumed",
                         _gbid,
                         brokerUrl.toString());
 #else
@@ -218,6 +227,30 @@ MosquittoConnection::MosquittoConnection(const ClusterControllerSettings& ccSett
                         "[{}] Connection to {} :MQTT OCSP is disabled",
                         _gbid,
                         brokerUrl.toString());
+
+        // mosquitto never offers a previous TLS session to the broker, hence every reconnect
+        // would do a full handshake. Provide an own context which resumes the last session,
+        // mosquitto still applies the TLS settings from above to it.
+#if (OPENSSL_VERSION_NUMBER >= 0x10100000L)
+        SSL_CTX* sslContext = SSL_CTX_new(TLS_client_method());
+#else
+        SSL_CTX* sslContext = SSL_CTX_new(SSLv23_client_method());
+#endif
+        rc = sslContext ? mosquitto_int_option(_mosq, MOSQ_OPT_SSL_CTX_WITH_DEFAULTS, true)
+                        : MOSQ_ERR_NOMEM;
+        if (rc == MOSQ_ERR_SUCCESS) {
+            std::make_shared<TlsSessionCache>("transport.mqtt.tls")->attachTo(sslContext);
+            rc = mosquitto_void_option(_mosq, MOSQ_OPT_SSL_CTX, sslContext);
+        }
+        // mosquitto keeps its own reference to the context
+        SSL_CTX_free(sslContext);
+        if (rc != MOSQ_ERR_SUCCESS) {
+            JOYNR_LOG_WARN(logger(),
+                           "[{}] Connection to {} : TLS session resumption not available: {}",
+                           _gbid,
+                           brokerUrl.toString(),
+                           getErrorString(rc));
+        }
 #endif /* MQTT_OCSP_ENABLED */
     } else {
         JOYNR_LOG_DEBUG(logger(),
@@ -751,9 +784,11 @@ void MosquittoConnection::createSubscriptions()
     try {
         subscribeToTopicInternal(_topic, true);
         std::lock_guard<std::recursive_mutex> lock(_additionalTopicsMutex);
-        for (const std::string& additionalTopic : _additionalTopics) {
-            subscribeToTopicInternal(additionalTopic);
-        }
+        // pending topics are contained in _additionalTopics, no need to send them twice
+        _pendingTopics.clear();
+        subscribeToTopicsInternal(
+                std::vector<std::string>(_additionalTopics.cbegin(), _additionalTopics.cend()),
+                true);
     } catch (const exceptions::JoynrRuntimeException& error) {
         JOYNR_LOG_ERROR(logger(),
                         "[{}] Connection to {}: Error subscribing to Mqtt topic, error: ",
@@ -806,25 +841,157 @@ void MosquittoConnection::subscribeToTopicInternal(const std::string& topic,
     }
 }
 
+void MosquittoConnection::subscribeToTopicsInternal(const std::vector<std::string>& topics,
+                                                    const bool isRestoringSubscriptions)
+{
+    // fixed header, packet identifier and properties of a SUBSCRIBE packet
+    constexpr std::size_t subscribePacketOverhead = 16;
+    const std::size_t maximumPacketSize = getMqttMaximumPacketSize() > 0
+                                                  ? getMqttMaximumPacketSize()
+                                                  : std::numeric_limits<std::size_t>::max();
+
+    auto batchBegin = topics.cbegin();
+    while (batchBegin != topics.cend()) {
+        std::vector<char*> batch;
+        std::size_t packetSize = subscribePacketOverhead;
+        auto batchEnd = batchBegin;
+        while (batchEnd != topics.cend() && batch.size() < maxTopicsPerSubscribe) {
+            // length prefix, topic filter and subscription options
+            const std::size_t topicSize = 2 + batchEnd->size() + 1;
+            if (!batch.empty() && packetSize + topicSize > maximumPacketSize) {
+                break;
+            }
+            packetSize += topicSize;
+            batch.push_back(const_cast<char*>(batchEnd->c_str()));
+            ++batchEnd;
+        }
+
+        int rc = subscribeMultiple(batch);
+        switch (rc) {
+        case (MOSQ_ERR_SUCCESS):
+            JOYNR_LOG_INFO(logger(),
+                           "[{}] Connection to {}: Subscribed to {} topics",
+                           _gbid,
+                           _brokerUrl.toString(),
+                           batch.size());
+            break;
+        case (MOSQ_ERR_NO_CONN): {
+            const std::string errorString(getErrorString(rc));
+            JOYNR_LOG_DEBUG(logger(),
+                            "[{}] Connection to {}: Subscription to {} topics failed: error: {} "
+                            "({}). Subscriptions will be restored on connect.",
+                            _gbid,
+                            _brokerUrl.toString(),
+                            batch.size(),
+                            std::to_string(rc),
+                            errorString);
+            break;
+        }
+        default: {
+            // MOSQ_ERR_NOMEM, MOSQ_ERR_OVERSIZE_PACKET; the topics have been validated before
+            const std::string errorString(getErrorString(rc));
+            std::string errorMsg =
+                    fmt::format("[{}] Subscription to {} topics failed: error: {} ({})",
+                                _gbid,
+                                std::distance(batchBegin, topics.cend()),
+                                std::to_string(rc),
+                                errorString);
+            if (!isRestoringSubscriptions) {
+                // this and the following batches are not subscribed, forget their topics so
+                // that the caller can subscribe to them again
+                for (auto topic = batchBegin; topic != topics.cend(); ++topic) {
+                    _additionalTopics.erase(*topic);
+                }
+            }
+            throw exceptions::JoynrRuntimeException(errorMsg);
+        }
+        }
+        batchBegin = batchEnd;
+    }
+}
+
+int MosquittoConnection::subscribeMultiple(std::vector<char*>& topics)
+{
+    const int options = 0;
+    const mosquitto_property* props = nullptr;
+    return mosquitto_subscribe_multiple(_mosq,
+                                        nullptr,
+                                        static_cast<int>(topics.size()),
+                                        topics.data(),
+                                        getMqttQos(),
+                                        options,
+                                        props);
+}
+
+void MosquittoConnection::subscribeToPendingTopics()
+{
+    // topics added by other threads while this thread is sending a batch are sent with the
+    // next batch, so a burst of subscribeToTopic calls results in few SUBSCRIBE packets
+    while (true) {
+        std::lock_guard<std::recursive_mutex> lock(_additionalTopicsMutex);
+        if (_pendingTopics.empty()) {
+            _isSubscribingToPendingTopics = false;
+            return;
+        }
+        std::vector<std::string> topics;
+        topics.swap(_pendingTopics);
+        try {
+            subscribeToTopicsInternal(topics, false);
+        } catch (const exceptions::JoynrRuntimeException&) {
+            // topics queued meanwhile are sent by the next caller or on the next connect
+            _isSubscribingToPendingTopics = false;
+            throw;
+        }
+    }
+}
+
 void MosquittoConnection::subscribeToTopic(const std::string& topic)
+{
+    subscribeToTopics({topic});
+}
+
+void MosquittoConnection::subscribeToTopics(const std::vector<std::string>& topics)
 {
     if (!_isChannelIdRegistered) {
-        std::string errorMsg = fmt::format(
-                "[{}] No channelId registered, cannot subscribe to topic {}", _gbid, topic);
+        std::string errorMsg =
+                fmt::format("[{}] No channelId registered, cannot subscribe to {} topics",
+                            _gbid,
+                            topics.size());
         throw exceptions::JoynrRuntimeException(errorMsg);
     }
 
     {
         std::lock_guard<std::recursive_mutex> lock(_additionalTopicsMutex);
-        if (_additionalTopics.find(topic) != _additionalTopics.end()) {
-            JOYNR_LOG_DEBUG(logger(), "[{}] Already subscribed to topic {}", _gbid, topic);
-            return;
+        // validate all topics before registering any of them, an invalid topic must neither
+        // fail a whole batch nor leave the other topics registered
+        for (const std::string& topic : topics) {
+            int rc = mosquitto_sub_topic_check(topic.c_str());
+            if (rc != MOSQ_ERR_SUCCESS) {
+                const std::string errorString(getErrorString(rc));
+                std::string errorMsg =
+                        fmt::format("[{}] Subscription to {} failed: error: {} ({})",
+                                    _gbid,
+                                    topic,
+                                    std::to_string(rc),
+                                    errorString);
+                throw exceptions::JoynrRuntimeException(errorMsg);
+            }
         }
 
-        subscribeToTopicInternal(topic);
-
-        _additionalTopics.insert(topic);
+        for (const std::string& topic : topics) {
+            if (!_additionalTopics.insert(topic).second) {
+                JOYNR_LOG_DEBUG(logger(), "[{}] Already subscribed to topic {}", _gbid, topic);
+                continue;
+            }
+            _pendingTopics.push_back(topic);
+        }
+        if (_pendingTopics.empty() || _isSubscribingToPendingTopics) {
+            // the subscribing thread picks up the topics with its next batch
+            return;
+        }
+        _isSubscribingToPendingTopics = true;
     }
+    subscribeToPendingTopics();
 }
 
 void MosquittoConnection::unsubscribeFromTopic(const std::string& topic)
@@ -837,6 +1004,12 @@ void MosquittoConnection::unsubscribeFromTopic(const std::string& topic)
             return;
         }
         _additionalTopics.erase(topic);
+        auto pendingTopic = std::find(_pendingTopics.begin(), _pendingTopics.end(), topic);
+        if (pendingTopic != _pendingTopics.end()) {
+            // not sent to the broker yet
+            _pendingTopics.erase(pendingTopic);
+            return;
+        }
         if (_isConnected && _isRunning) {
             const mosquitto_property* props = nullptr;
             int rc = mosquitto_unsubscribe_v5(_mosq, nullptr, topic.c_str(), props);
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wredundant-decls"
@@ -95,6 +96,13 @@ public:
             const uint32_t payloadlen,
             const void* payload);
     virtual void subscribeToTopic(const std::string& topic);
+    /**
+     * Subscribes to all given topics with as few SUBSCRIBE packets as possible. Throws
+     * JoynrRuntimeException if a topic is invalid, then none of the topics is subscribed, or if
+     * a SUBSCRIBE packet cannot be sent, then the topics which were not sent can be subscribed
+     * again. Topics queued concurrently by other threads may be sent with these topics.
+     */
+    virtual void subscribeToTopics(const std::vector<std::string>& topics);
     virtual void unsubscribeFromTopic(const std::string& topic);
     virtual void registerChannelId(const std::string& channelId);
     virtual void registerReceiveCallback(std::function<void(smrf::ByteVector&&)> onMessageReceived);
@@ -150,6 +158,19 @@ private:
 
     void createSubscriptions();
     void subscribeToTopicInternal(const std::string& _topic, const bool isChannelTopic = false);
+    /**
+     * Subscribes to the given topics with as few SUBSCRIBE packets as the broker's maximum
+     * packet size allows. Must be called with _additionalTopicsMutex held. Throws
+     * JoynrRuntimeException if a packet cannot be sent; unless subscriptions are restored after
+     * a connect, the topics which were not sent are removed from _additionalTopics.
+     */
+    void subscribeToTopicsInternal(const std::vector<std::string>& topics,
+                                   const bool isRestoringSubscriptions);
+    /**
+     * Sends a single SUBSCRIBE packet for all given topics, wraps mosquitto_subscribe_multiple
+     */
+    virtual int subscribeMultiple(std::vector<char*>& topics);
+    void subscribeToPendingTopics();
     void setReadyToSend(bool readyToSend);
     static std::string getErrorString(int rc);
 
@@ -168,6 +189,9 @@ private:
     int _subscribeChannelMid;
     std::string _topic;
     std::unordered_set<std::string> _additionalTopics;
+    // topics added by subscribeToTopic which have not been sent to the broker yet
+    std::vector<std::string> _pendingTopics;
+    bool _isSubscribingToPendingTopics;
     std::recursive_mutex _additionalTopicsMutex;
 
     std::atomic<bool> _isConnected;
@@ -195,6 +219,7 @@ private:
     std::string _gbid;
 
     static constexpr std::int32_t sessionExpiryInterval = std::numeric_limits<std::int32_t>::max();
+    static constexpr std::size_t maxTopicsPerSubscribe = 256;
 
     ADD_LOGGER(MosquittoConnection)
 };
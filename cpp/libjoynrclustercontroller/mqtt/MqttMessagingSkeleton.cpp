@@ -26,6 +26,8 @@
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/MqttReceiver.h"
+#include "joynr/PoolAllocator.h"
+#include "joynr/TrackingInfo.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
 
@@ -108,7 +110,7 @@ void MqttMessagingSkeleton::onMessageReceived(smrf::ByteVector&& rawMessage)
 {
     std::shared_ptr<ImmutableMessage> immutableMessage;
     try {
-        immutableMessage = std::make_shared<ImmutableMessage>(std::move(rawMessage));
+        immutableMessage = util::makePooledShared<ImmutableMessage>(std::move(rawMessage));
     } catch (const smrf::EncodingException& e) {
         JOYNR_LOG_ERROR(logger(), "Unable to deserialize message - error: {}", e.what());
         return;
@@ -121,7 +123,7 @@ void MqttMessagingSkeleton::onMessageReceived(smrf::ByteVector&& rawMessage)
         JOYNR_LOG_DEBUG(logger(),
                         "<<< INCOMING FROM >{}< <<< {}",
                         _ownGbid,
-                        immutableMessage->getTrackingInfo());
+                        TrackingInfo(*immutableMessage));
     } else {
         JOYNR_LOG_TRACE(logger(),
                         "<<< INCOMING FROM >{}< <<< {}",
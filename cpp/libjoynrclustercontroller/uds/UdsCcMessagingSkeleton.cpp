@@ -29,6 +29,8 @@
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Logger.h"
+#include "joynr/PoolAllocator.h"
+#include "joynr/TrackingInfo.h"
 #include "joynr/exceptions/JoynrException.h"
 
 namespace joynr
@@ -56,7 +58,7 @@ void UdsCcMessagingSkeleton::onMessageReceived(smrf::ByteVector&& message,
     // deserialize message and transmit
     std::shared_ptr<ImmutableMessage> immutableMessage;
     try {
-        immutableMessage = std::make_shared<ImmutableMessage>(std::move(message));
+        immutableMessage = util::makePooledShared<ImmutableMessage>(std::move(message));
         immutableMessage->setCreator(creator);
     } catch (const smrf::EncodingException& e) {
         JOYNR_LOG_ERROR(logger(), "Unable to deserialize message - error: {}", e.what());
@@ -67,7 +69,7 @@ void UdsCcMessagingSkeleton::onMessageReceived(smrf::ByteVector&& message,
     }
 
     if (logger().getLogLevel() == LogLevel::Debug) {
-        JOYNR_LOG_DEBUG(logger(), "<<< INCOMING <<< {}", immutableMessage->getTrackingInfo());
+        JOYNR_LOG_DEBUG(logger(), "<<< INCOMING <<< {}", TrackingInfo(*immutableMessage));
     } else {
         JOYNR_LOG_TRACE(logger(), "<<< INCOMING <<< {}", immutableMessage->toLogMessage());
     }
@@ -75,7 +77,7 @@ void UdsCcMessagingSkeleton::onMessageReceived(smrf::ByteVector&& message,
     auto onFailure = [immutableMessage](const exceptions::JoynrRuntimeException& e) {
         JOYNR_LOG_ERROR(logger(),
                         "Incoming Message {} could not be sent! reason: {}",
-                        immutableMessage->getTrackingInfo(),
+                        TrackingInfo(*immutableMessage),
                         e.getMessage());
     };
     transmit(std::move(immutableMessage), std::move(onFailure));
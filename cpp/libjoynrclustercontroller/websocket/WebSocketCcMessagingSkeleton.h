@@ -19,10 +19,12 @@
 #ifndef WEBSOCKETCCMESSAGINGSKELETON_H
 #define WEBSOCKETCCMESSAGINGSKELETON_H
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -34,14 +36,17 @@
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Logger.h"
+#include "joynr/PoolAllocator.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/Semaphore.h"
 #include "joynr/SingleThreadedIOService.h"
+#include "joynr/TrackingInfo.h"
 #include "joynr/Util.h"
 #include "joynr/serializer/Serializer.h"
 #include "joynr/system/RoutingTypes/WebSocketClientAddress.h"
 
 // This is not good... Coming from "../../libjoynr/websocket
+#include "WebSocketMessageBatch.h"
 #include "WebSocketMessagingStubFactory.h"
 #include "WebSocketPpReceiver.h"
 #include "WebSocketPpSender.h"
@@ -77,12 +82,16 @@ public:
      * @brief Constructor
      * @param messageRouter Router
      * @param messagingStubFactory Factory
+     * @param port Port to listen on
+     * @param enableMessageBatching Whether clients requesting
+     * WebSocketMessageBatch::SUBPROTOCOL() may send and receive batched frames
      */
     WebSocketCcMessagingSkeleton(
             boost::asio::io_service& ioService,
             std::shared_ptr<IMessageRouter> messageRouter,
             std::shared_ptr<WebSocketMessagingStubFactory> messagingStubFactory,
-            std::uint16_t port)
+            std::uint16_t port,
+            bool enableMessageBatching)
             : IWebsocketCcMessagingSkeleton(),
               std::enable_shared_from_this<WebSocketCcMessagingSkeleton<Config>>(),
               _ioService(ioService),
@@ -94,6 +103,7 @@ public:
               _messageRouter(std::move(messageRouter)),
               _messagingStubFactory(std::move(messagingStubFactory)),
               _port(port),
+              _isMessageBatchingEnabled(enableMessageBatching),
               _shuttingDown(false)
     {
     }
@@ -123,6 +133,15 @@ public:
             }
         });
 
+        _endpoint.set_validate_handler([thisWeakPtr = joynr::util::as_weak_ptr(
+                                                this->shared_from_this())](ConnectionHandle hdl) {
+            if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                thisSharedPtr->onValidateConnection(hdl);
+                return true;
+            }
+            return false;
+        });
+
         // new connections are handled in onInitMessageReceived; if initialization was successful,
         // any further messages for this connection are handled in onMessageReceived
         _endpoint.set_message_handler(
@@ -247,6 +266,32 @@ protected:
     std::map<ConnectionHandle, CertEntry, std::owner_less<ConnectionHandle>> _clients;
 
 private:
+    void onValidateConnection(ConnectionHandle hdl)
+    {
+        if (!_isMessageBatchingEnabled) {
+            return;
+        }
+        typename Server::connection_ptr connection = _endpoint.get_con_from_hdl(hdl);
+        const std::vector<std::string>& subprotocols = connection->get_requested_subprotocols();
+        if (std::find(subprotocols.cbegin(),
+                      subprotocols.cend(),
+                      WebSocketMessageBatch::SUBPROTOCOL()) == subprotocols.cend()) {
+            return;
+        }
+        websocketpp::lib::error_code websocketError;
+        connection->select_subprotocol(WebSocketMessageBatch::SUBPROTOCOL(), websocketError);
+        if (websocketError) {
+            JOYNR_LOG_WARN(logger(),
+                           "could not enable message batching - error: {}",
+                           websocketError.message());
+        }
+    }
+
+    bool isBatchingNegotiated(typename Server::connection_ptr connection) const
+    {
+        return connection->get_subprotocol() == WebSocketMessageBatch::SUBPROTOCOL();
+    }
+
     void onConnectionClosed(ConnectionHandle hdl)
     {
         std::lock_guard<std::mutex> lock2(_clientsMutex);
@@ -274,7 +319,34 @@ private:
                     mode);
             return;
         }
-        const std::string& initMessage = message->get_payload();
+        typename Server::connection_ptr connection = _endpoint.get_con_from_hdl(hdl);
+        const bool batchingNegotiated = isBatchingNegotiated(connection);
+
+        // on batched connections, the frame carrying the initialization message may
+        // already contain further messages which must be routed after registration
+        std::string initMessage;
+        std::vector<smrf::ByteVector> followingMessages;
+        if (batchingNegotiated) {
+            bool isFirstMessage = true;
+            const bool isValidBatch = WebSocketMessageBatch::split(
+                    message->get_payload(),
+                    [&isFirstMessage, &initMessage, &followingMessages](
+                            smrf::ByteVector&& rawMessage) {
+                        if (isFirstMessage) {
+                            initMessage.assign(rawMessage.cbegin(), rawMessage.cend());
+                            isFirstMessage = false;
+                        } else {
+                            followingMessages.push_back(std::move(rawMessage));
+                        }
+                    });
+            if (!isValidBatch) {
+                JOYNR_LOG_ERROR(logger(), "received malformed initial message batch");
+                return;
+            }
+        } else {
+            initMessage = message->get_payload();
+        }
+
         if (isInitializationMessage(initMessage)) {
             JOYNR_LOG_DEBUG(logger(),
                             "received initialization message from websocket client: {}",
@@ -294,20 +366,29 @@ private:
             }
 
             JOYNR_LOG_INFO(logger(),
-                           "Init connection for websocket client id: {}",
-                           clientAddress->getId());
+                           "Init connection for websocket client id: {}, message batching {}",
+                           clientAddress->getId(),
+                           batchingNegotiated ? "enabled" : "disabled");
 
             auto sender = std::make_shared<WebSocketPpSender<Server>>(_endpoint);
+            sender->setBatchingEnabled(batchingNegotiated);
             sender->setConnectionHandle(hdl);
 
             _messagingStubFactory->addClient(*clientAddress, std::move(sender));
 
-            typename Server::connection_ptr connection = _endpoint.get_con_from_hdl(hdl);
-            connection->set_message_handler(
-                    std::bind(&WebSocketPpReceiver<Server>::onMessageReceived,
-                              &_receiver,
-                              std::placeholders::_1,
-                              std::placeholders::_2));
+            if (batchingNegotiated) {
+                connection->set_message_handler(
+                        std::bind(&WebSocketPpReceiver<Server>::onBatchedMessageReceived,
+                                  &_receiver,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2));
+            } else {
+                connection->set_message_handler(
+                        std::bind(&WebSocketPpReceiver<Server>::onMessageReceived,
+                                  &_receiver,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2));
+            }
             {
                 std::lock_guard<std::mutex> lock3(_clientsMutex);
                 // search whether this connection handler has been mapped to a cert. (secure
@@ -325,6 +406,10 @@ private:
             }
 
             _messageRouter->sendQueuedMessages(std::move(clientAddress));
+
+            for (auto& followingMessage : followingMessages) {
+                onMessageReceived(ConnectionHandle(hdl), std::move(followingMessage));
+            }
         } else {
             JOYNR_LOG_ERROR(
                     logger(), "received an initial message with wrong format: \"{}\"", initMessage);
@@ -336,7 +421,7 @@ private:
         // deserialize message and transmit
         std::shared_ptr<ImmutableMessage> immutableMessage;
         try {
-            immutableMessage = std::make_shared<ImmutableMessage>(std::move(message));
+            immutableMessage = util::makePooledShared<ImmutableMessage>(std::move(message));
         } catch (const smrf::EncodingException& e) {
             JOYNR_LOG_ERROR(logger(), "Unable to deserialize message - error: {}", e.what());
             return;
@@ -346,26 +431,25 @@ private:
         }
 
         if (logger().getLogLevel() == LogLevel::Debug) {
-            JOYNR_LOG_DEBUG(logger(), "<<< INCOMING <<< {}", immutableMessage->getTrackingInfo());
+            JOYNR_LOG_DEBUG(logger(), "<<< INCOMING <<< {}", TrackingInfo(*immutableMessage));
         } else {
             JOYNR_LOG_TRACE(logger(), "<<< INCOMING <<< {}", immutableMessage->toLogMessage());
         }
 
         if (!preprocessIncomingMessage(immutableMessage)) {
-            JOYNR_LOG_ERROR(logger(), "Dropping message {}", immutableMessage->getTrackingInfo());
+            JOYNR_LOG_ERROR(logger(), "Dropping message {}", TrackingInfo(*immutableMessage));
             return;
         }
 
         if (!validateIncomingMessage(hdl, immutableMessage)) {
-            JOYNR_LOG_ERROR(logger(), "Dropping message {}", immutableMessage->getTrackingInfo());
+            JOYNR_LOG_ERROR(logger(), "Dropping message {}", TrackingInfo(*immutableMessage));
             return;
         }
 
-        auto onFailure = [trackingInfo = immutableMessage->getTrackingInfo()](
-                                 const exceptions::JoynrRuntimeException& e) {
+        auto onFailure = [immutableMessage](const exceptions::JoynrRuntimeException& e) {
             JOYNR_LOG_ERROR(logger(),
                             "Incoming Message {} could not be sent! reason: {}",
-                            trackingInfo,
+                            TrackingInfo(*immutableMessage),
                             e.getMessage());
         };
         transmit(std::move(immutableMessage), std::move(onFailure));
@@ -385,6 +469,7 @@ private:
     /*! Factory to build outgoing messaging stubs */
     std::shared_ptr<WebSocketMessagingStubFactory> _messagingStubFactory;
     std::uint16_t _port;
+    const bool _isMessageBatchingEnabled;
     std::atomic<bool> _shuttingDown;
 
     DISALLOW_COPY_AND_ASSIGN(WebSocketCcMessagingSkeleton);
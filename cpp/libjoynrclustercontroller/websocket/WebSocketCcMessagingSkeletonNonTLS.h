@@ -34,11 +34,13 @@ public:
             boost::asio::io_service& ioService,
             std::shared_ptr<IMessageRouter> messageRouter,
             std::shared_ptr<WebSocketMessagingStubFactory> messagingStubFactory,
-            const system::RoutingTypes::WebSocketAddress& serverAddress)
+            const system::RoutingTypes::WebSocketAddress& serverAddress,
+            bool enableMessageBatching)
             : WebSocketCcMessagingSkeleton<websocketpp::config::asio>(ioService,
                                                                       messageRouter,
                                                                       messagingStubFactory,
-                                                                      serverAddress.getPort())
+                                                                      serverAddress.getPort(),
+                                                                      enableMessageBatching)
     {
     }
 
@@ -40,12 +40,14 @@ WebSocketCcMessagingSkeletonTLS::WebSocketCcMessagingSkeletonTLS(
         const system::RoutingTypes::WebSocketAddress& serverAddress,
         const std::string& caPemFile,
         const std::string& certPemFile,
-        const std::string& privateKeyPemFile)
+        const std::string& privateKeyPemFile,
+        bool enableMessageBatching)
         : WebSocketCcMessagingSkeleton<websocketpp::config::asio_tls>(
                   ioService,
                   std::move(messageRouter),
                   std::move(messagingStubFactory),
-                  serverAddress.getPort()),
+                  serverAddress.getPort(),
+                  enableMessageBatching),
           _caPemFile(caPemFile),
           _certPemFile(certPemFile),
           _privateKeyPemFile(privateKeyPemFile)
@@ -42,7 +42,8 @@ public:
             const system::RoutingTypes::WebSocketAddress& serverAddress,
             const std::string& caPemFile,
             const std::string& certPemFile,
-            const std::string& privateKeyPemFile);
+            const std::string& privateKeyPemFile,
+            bool enableMessageBatching);
 
     virtual void init() override;
 
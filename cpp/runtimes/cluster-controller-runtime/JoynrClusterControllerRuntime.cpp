@@ -18,6 +18,9 @@
  */
 #include "joynr/JoynrClusterControllerRuntime.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -52,10 +55,12 @@
 #include "joynr/LocalCapabilitiesDirectoryStore.h"
 #include "joynr/LocalDiscoveryAggregator.h"
 #include "joynr/MessageQueue.h"
+#include "joynr/MessageQueueSpillFile.h"
 #include "joynr/MessageSender.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingSettings.h"
 #include "joynr/MessagingStubFactory.h"
+#include "joynr/Metrics.h"
 #include "joynr/MqttMessagingSkeleton.h"
 #include "joynr/MqttMulticastAddressCalculator.h"
 #include "joynr/MqttReceiver.h"
@@ -66,6 +71,7 @@
 #include "joynr/PublicationManager.h"
 #include "joynr/Settings.h"
 #include "joynr/SingleThreadedIOService.h"
+#include "joynr/StartupGraph.h"
 #include "joynr/SubscriptionManager.h"
 #include "joynr/SystemServicesSettings.h"
 #include "joynr/TaskSequencer.h"
@@ -92,6 +98,7 @@
 #include "libjoynr/in-process/InProcessMessagingStubFactory.h"
 #include "libjoynr/joynr-messaging/DummyPlatformSecurityManager.h"
 #include "libjoynr/uds/UdsMessagingStubFactory.h"
+#include "libjoynr/uds/UdsTransportStatus.h"
 #include "libjoynr/websocket/WebSocketMessagingStubFactory.h"
 
 #include "libjoynrclustercontroller/ClusterControllerCallContext.h"
@@ -119,6 +126,22 @@ namespace joynr
 class IKeychain;
 class ITransportStatus;
 
+namespace
+{
+
+void exportStartupTimings(const StartupGraph& startupGraph, const std::string& metricsPrefix)
+{
+    auto& metricsRegistry = metrics::MetricsRegistry::instance();
+    for (const auto& timing : startupGraph.getTimings()) {
+        metricsRegistry.getGauge(metricsPrefix + timing.name + ".durationUs")
+                ->set(timing.duration.count());
+    }
+    metricsRegistry.getGauge(metricsPrefix + "totalUs")
+            ->set(startupGraph.getTotalDuration().count());
+}
+
+} // namespace
+
 JoynrClusterControllerRuntime::JoynrClusterControllerRuntime(
         std::unique_ptr<Settings> settings,
         std::function<void(const exceptions::JoynrRuntimeException&)>&& onFatalRuntimeError,
@@ -150,7 +173,8 @@ JoynrClusterControllerRuntime::JoynrClusterControllerRuntime(
           _aclEditor(nullptr),
           _lifetimeSemaphore(0),
           _accessController(nullptr),
-          _localCapabilitiesDirectoryStore(std::make_shared<LocalCapabilitiesDirectoryStore>()),
+          _localCapabilitiesDirectoryStore(std::make_shared<LocalCapabilitiesDirectoryStore>(
+                  _clusterControllerSettings.getGlobalLookupCacheMaxEntries())),
           _routingProviderParticipantId(),
           _discoveryProviderParticipantId(),
           _providerReregistrationControllerParticipantId(
@@ -276,21 +300,34 @@ void JoynrClusterControllerRuntime::init()
     auto messagingStubFactory = std::make_shared<MessagingStubFactory>();
     messagingStubFactory->registerStubFactory(std::make_shared<InProcessMessagingStubFactory>());
 
-    MessagingPropertiesPersistence persist(
-            _messagingSettings.getMessagingPropertiesPersistenceFilename());
-    const std::string clusterControllerId = persist.getChannelId();
-
-    std::vector<std::shared_ptr<ITransportStatus>> transportStatuses;
-
     _clusterControllerSettings.printSettings();
     _libjoynrSettings.printSettings();
     _wsSettings.printSettings();
     _udsSettings.printSettings();
 
-    if (_doMqttMessaging) {
-        const std::string ccMqttClientIdPrefix = _clusterControllerSettings.getMqttClientIdPrefix();
-        const std::string mqttClientId = ccMqttClientIdPrefix + clusterControllerId;
+    /*
+     * The initialization is split into steps of a dependency graph. Steps which only load
+     * persisted state or set up one of the MQTT connections do not depend on each other and
+     * run concurrently; the messaging infrastructure is wired up as soon as its inputs are
+     * available.
+     */
+    StartupGraph startupGraph("JoynrClusterControllerRuntime::init");
+
+    std::string clusterControllerId;
+    startupGraph.addStep("messagingPropertiesPersistence", {}, [this, &clusterControllerId]() {
+        MessagingPropertiesPersistence persist(
+                _messagingSettings.getMessagingPropertiesPersistenceFilename());
+        clusterControllerId = persist.getChannelId();
+    });
+
+    // one slot per broker keeps the order of the transport statuses independent of the order
+    // in which the connections are set up
+    std::vector<std::shared_ptr<ITransportStatus>> transportStatuses(
+            _mqttConnectionDataVector.size());
+    std::atomic<bool> mqttConnectionFailed(false);
+    std::vector<std::string> mqttConnectionSteps;
 
+    if (_doMqttMessaging) {
         const std::chrono::seconds mqttReconnectDelayTimeSeconds =
                 _messagingSettings.getMqttReconnectDelayTimeSeconds();
 
@@ -298,16 +335,15 @@ void JoynrClusterControllerRuntime::init()
                 _messagingSettings.getMqttReconnectMaxDelayTimeSeconds();
         const bool isMqttExponentialBackoffEnabled =
                 _messagingSettings.getMqttExponentialBackoffEnabled();
-        std::chrono::seconds mqttKeepAliveTimeSeconds(0);
-        BrokerUrl brokerUrl = defaultBrokerUrl;
 
         // default brokerIndex = 0
         for (std::uint8_t brokerIndex = 0; brokerIndex < _mqttConnectionDataVector.size();
              brokerIndex++) {
+            std::chrono::seconds mqttKeepAliveTimeSeconds(0);
+            BrokerUrl brokerUrl = defaultBrokerUrl;
             if (brokerIndex == 0) {
                 // default broker settings
                 mqttKeepAliveTimeSeconds = _messagingSettings.getMqttKeepAliveTimeSeconds();
-                brokerUrl = defaultBrokerUrl;
             } else {
                 mqttKeepAliveTimeSeconds =
                         _messagingSettings.getAdditionalBackendMqttKeepAliveTimeSeconds(
@@ -315,109 +351,373 @@ void JoynrClusterControllerRuntime::init()
                 brokerUrl = _messagingSettings.getAdditionalBackendBrokerUrl(brokerIndex - 1);
             }
 
-            try {
-                const auto& mosquittoConnection =
-                        std::make_shared<MosquittoConnection>(_clusterControllerSettings,
-                                                              brokerUrl,
-                                                              mqttKeepAliveTimeSeconds,
-                                                              mqttReconnectDelayTimeSeconds,
-                                                              mqttReconnectMaxDelayTimeSeconds,
-                                                              isMqttExponentialBackoffEnabled,
-                                                              mqttClientId,
-                                                              _availableGbids[brokerIndex]);
-
-                const auto& connectionData = _mqttConnectionDataVector[brokerIndex];
-
-                const auto& mqttMessageReceiver = connectionData->getMqttMessageReceiver();
-
-                if (!mqttMessageReceiver || !connectionData->getMqttMessageSender()) {
-                    JOYNR_LOG_TRACE(logger(),
-                                    "{}: The mqtt message receiver supplied is NULL, creating "
-                                    "MosquittoConnection ",
-                                    brokerIndex);
-                    connectionData->setMosquittoConnection(mosquittoConnection);
-
-                    auto mqttTransportStatus = std::make_shared<MqttTransportStatus>(
-                            mosquittoConnection, _availableGbids[brokerIndex]);
-                    transportStatuses.emplace_back(std::move(mqttTransportStatus));
+            const std::string stepName = "mqttConnection" + std::to_string(brokerIndex);
+            mqttConnectionSteps.push_back(stepName);
+            startupGraph.addStep(
+                    stepName,
+                    {"messagingPropertiesPersistence"},
+                    [this,
+                     brokerIndex,
+                     brokerUrl,
+                     mqttKeepAliveTimeSeconds,
+                     mqttReconnectDelayTimeSeconds,
+                     mqttReconnectMaxDelayTimeSeconds,
+                     isMqttExponentialBackoffEnabled,
+                     &clusterControllerId,
+                     &transportStatuses,
+                     &mqttConnectionFailed]() {
+                        const std::string mqttClientId =
+                                _clusterControllerSettings.getMqttClientIdPrefix() +
+                                clusterControllerId;
+                        try {
+                            const auto& mosquittoConnection =
+                                    std::make_shared<MosquittoConnection>(
+                                            _clusterControllerSettings,
+                                            brokerUrl,
+                                            mqttKeepAliveTimeSeconds,
+                                            mqttReconnectDelayTimeSeconds,
+                                            mqttReconnectMaxDelayTimeSeconds,
+                                            isMqttExponentialBackoffEnabled,
+                                            mqttClientId,
+                                            _availableGbids[brokerIndex]);
+
+                            const auto& connectionData = _mqttConnectionDataVector[brokerIndex];
+
+                            const auto& mqttMessageReceiver =
+                                    connectionData->getMqttMessageReceiver();
+
+                            if (!mqttMessageReceiver || !connectionData->getMqttMessageSender()) {
+                                JOYNR_LOG_TRACE(logger(),
+                                                "{}: The mqtt message receiver supplied is NULL, "
+                                                "creating MosquittoConnection ",
+                                                brokerIndex);
+                                connectionData->setMosquittoConnection(mosquittoConnection);
+
+                                transportStatuses[brokerIndex] =
+                                        std::make_shared<MqttTransportStatus>(
+                                                mosquittoConnection, _availableGbids[brokerIndex]);
+                            }
+                            if (!mqttMessageReceiver) {
+                                JOYNR_LOG_TRACE(logger(),
+                                                "{}: The mqtt message receiver supplied is NULL, "
+                                                "creating the default mqtt MessageReceiver",
+                                                brokerIndex);
+
+                                connectionData->setMqttMessageReceiver(
+                                        std::make_shared<MqttReceiver>(
+                                                mosquittoConnection,
+                                                _messagingSettings,
+                                                clusterControllerId,
+                                                _availableGbids[brokerIndex],
+                                                _clusterControllerSettings
+                                                        .getMqttUnicastTopicPrefix()));
+                            }
+                        } catch (const exceptions::JoynrRuntimeException& e) {
+                            JOYNR_LOG_ERROR(logger(),
+                                            "{}: Creating mosquittoConnection failed. Error: {}",
+                                            brokerIndex,
+                                            e.getMessage());
+                            mqttConnectionFailed = true;
+                        }
+                    });
+        }
+    }
+
+    startupGraph.addStep("participantIdStorage", {}, [this]() {
+        // Set up the persistence file for storing provider participant ids
+        std::string persistenceFilename = _libjoynrSettings.getParticipantIdsPersistenceFilename();
+        _participantIdStorage = std::make_shared<ParticipantIdStorage>(persistenceFilename);
+    });
+
+    std::shared_ptr<LocalDomainAccessStore> localDomainAccessStore;
+    startupGraph.addStep("localDomainAccessStore", {}, [this, &localDomainAccessStore]() {
+        localDomainAccessStore = loadLocalDomainAccessStore();
+    });
+
+    std::vector<std::string> messageRouterDependencies = mqttConnectionSteps;
+    messageRouterDependencies.push_back("messagingPropertiesPersistence");
+    std::string globalClusterControllerAddress;
+    startupGraph.addStep(
+            "messageRouter",
+            messageRouterDependencies,
+            [&]() {
+                if (mqttConnectionFailed) {
+                    _doMqttMessaging = false;
                 }
-                if (!mqttMessageReceiver) {
-                    JOYNR_LOG_TRACE(
-                            logger(),
-                            "{}: The mqtt message receiver supplied is NULL, creating the default "
-                            "mqtt MessageReceiver",
-                            brokerIndex);
-
-                    connectionData->setMqttMessageReceiver(std::make_shared<MqttReceiver>(
-                            mosquittoConnection,
-                            _messagingSettings,
-                            clusterControllerId,
-                            _availableGbids[brokerIndex],
-                            _clusterControllerSettings.getMqttUnicastTopicPrefix()));
+                transportStatuses.erase(
+                        std::remove(transportStatuses.begin(), transportStatuses.end(), nullptr),
+                        transportStatuses.end());
+                if (_clusterControllerSettings.isUdsEnabled()) {
+                    _udsTransportStatus = std::make_shared<UdsTransportStatus>();
+                    transportStatuses.push_back(_udsTransportStatus);
                 }
-            } catch (const exceptions::JoynrRuntimeException& e) {
-                JOYNR_LOG_ERROR(logger(),
-                                "{}: Creating mosquittoConnection failed. Error: {}",
-                                brokerIndex,
-                                e.getMessage());
 
-                _doMqttMessaging = false;
-                break;
-            }
-        }
-    }
+                globalClusterControllerAddress = getSerializedGlobalClusterControllerAddress();
+
+                std::unique_ptr<MessageQueue<std::string>> messageQueue =
+                        std::make_unique<MessageQueue<std::string>>(
+                                _clusterControllerSettings.getMessageQueueLimit(),
+                                _clusterControllerSettings.getPerParticipantIdMessageQueueLimit(),
+                                _clusterControllerSettings.getMessageQueueLimitBytes());
+                std::unique_ptr<MessageQueue<std::shared_ptr<ITransportStatus>>>
+                        transportStatusQueue =
+                                std::make_unique<MessageQueue<std::shared_ptr<ITransportStatus>>>(
+                                        _clusterControllerSettings
+                                                .getTransportNotAvailableQueueLimit(),
+                                        0,
+                                        _clusterControllerSettings
+                                                .getTransportNotAvailableQueueLimitBytes());
+                setupMessageQueueSpillFiles(
+                        clusterControllerId, *messageQueue, *transportStatusQueue);
+                // init message router
+                _ccMessageRouter = std::make_shared<CcMessageRouter>(
+                        _messagingSettings,
+                        _clusterControllerSettings,
+                        messagingStubFactory,
+                        _multicastMessagingSkeletonDirectory,
+                        std::move(securityManager),
+                        _singleThreadedIOService->getIOService(),
+                        std::move(addressCalculator),
+                        globalClusterControllerAddress,
+                        _systemServicesSettings.getCcMessageNotificationProviderParticipantId(),
+                        std::move(transportStatuses),
+                        std::move(messageQueue),
+                        std::move(transportStatusQueue),
+                        getGlobalClusterControllerAddress(),
+                        _availableGbids);
+
+                _ccMessageRouter->init();
+
+                // provision global capabilities directory
+                bool isGloballyVisible = true;
+                if (boost::starts_with(capabilitiesDirectoryChannelId, "{")) {
+                    try {
+                        using system::RoutingTypes::MqttAddress;
+                        auto globalCapabilitiesDirectoryAddress = std::make_shared<MqttAddress>();
+                        joynr::serializer::deserializeFromJson(
+                                *globalCapabilitiesDirectoryAddress,
+                                capabilitiesDirectoryChannelId);
+                        _ccMessageRouter->addProvisionedNextHop(
+                                capabilitiesDirectoryParticipantId,
+                                std::move(globalCapabilitiesDirectoryAddress),
+                                isGloballyVisible);
+                    } catch (const std::invalid_argument& e) {
+                        JOYNR_LOG_FATAL(logger(),
+                                        "could not deserialize MqttAddress from {} - error: {}",
+                                        capabilitiesDirectoryChannelId,
+                                        e.what());
+                    }
+                }
 
-    const std::string globalClusterControllerAddress =
-            getSerializedGlobalClusterControllerAddress();
-
-    std::unique_ptr<MessageQueue<std::string>> messageQueue =
-            std::make_unique<MessageQueue<std::string>>(
-                    _clusterControllerSettings.getMessageQueueLimit(),
-                    _clusterControllerSettings.getPerParticipantIdMessageQueueLimit(),
-                    _clusterControllerSettings.getMessageQueueLimitBytes());
-    std::unique_ptr<MessageQueue<std::shared_ptr<ITransportStatus>>> transportStatusQueue =
-            std::make_unique<MessageQueue<std::shared_ptr<ITransportStatus>>>(
-                    _clusterControllerSettings.getTransportNotAvailableQueueLimit(),
-                    0,
-                    _clusterControllerSettings.getTransportNotAvailableQueueLimitBytes());
-    // init message router
-    _ccMessageRouter = std::make_shared<CcMessageRouter>(
-            _messagingSettings,
-            _clusterControllerSettings,
-            messagingStubFactory,
-            _multicastMessagingSkeletonDirectory,
-            std::move(securityManager),
-            _singleThreadedIOService->getIOService(),
-            std::move(addressCalculator),
-            globalClusterControllerAddress,
-            _systemServicesSettings.getCcMessageNotificationProviderParticipantId(),
-            std::move(transportStatuses),
-            std::move(messageQueue),
-            std::move(transportStatusQueue),
-            getGlobalClusterControllerAddress(),
-            _availableGbids);
-
-    _ccMessageRouter->init();
-
-    // provision global capabilities directory
-    bool isGloballyVisible = true;
-    if (boost::starts_with(capabilitiesDirectoryChannelId, "{")) {
-        try {
-            using system::RoutingTypes::MqttAddress;
-            auto globalCapabilitiesDirectoryAddress = std::make_shared<MqttAddress>();
-            joynr::serializer::deserializeFromJson(
-                    *globalCapabilitiesDirectoryAddress, capabilitiesDirectoryChannelId);
-            _ccMessageRouter->addProvisionedNextHop(capabilitiesDirectoryParticipantId,
-                                                    std::move(globalCapabilitiesDirectoryAddress),
-                                                    isGloballyVisible);
-        } catch (const std::invalid_argument& e) {
-            JOYNR_LOG_FATAL(logger(),
-                            "could not deserialize MqttAddress from {} - error: {}",
-                            capabilitiesDirectoryChannelId,
-                            e.what());
-        }
+                setupLocalMessagingStubFactories(messagingStubFactory);
+
+                /* LibJoynr */
+                _messageSender = std::make_shared<MessageSender>(
+                        _ccMessageRouter, _keyChain, _messagingSettings.getTtlUpliftMs());
+                _joynrDispatcher = std::make_shared<Dispatcher>(
+                        _messageSender, _singleThreadedIOService->getIOService());
+                _messageSender->registerDispatcher(_joynrDispatcher);
+                _messageSender->setReplyToAddress(globalClusterControllerAddress);
+                _ccMessageRouter->setMessageSender(_messageSender);
+
+                /* CC */
+                _libJoynrMessagingSkeleton =
+                        std::make_shared<InProcessMessagingSkeleton>(_joynrDispatcher);
+
+                setupMqttMessagingSkeletons(messagingStubFactory);
+
+                /**
+                 * libJoynr side
+                 *
+                 */
+                _publicationManager = std::make_shared<PublicationManager>(
+                        _singleThreadedIOService->getIOService(),
+                        _messageSender,
+                        _messagingSettings.getTtlUpliftMs());
+                _subscriptionManager = std::make_shared<SubscriptionManager>(
+                        _singleThreadedIOService->getIOService(), _ccMessageRouter);
+
+                _dispatcherAddress =
+                        std::make_shared<InProcessMessagingAddress>(_libJoynrMessagingSkeleton);
+
+                auto joynrMessagingConnectorFactory =
+                        std::make_unique<JoynrMessagingConnectorFactory>(
+                                _messageSender, _subscriptionManager);
+
+                _proxyFactory =
+                        std::make_unique<ProxyFactory>(std::move(joynrMessagingConnectorFactory));
+            });
+
+    auto provisionedDiscoveryEntries = getProvisionedEntries();
+    startupGraph.addStep(
+            "localCapabilitiesDirectory",
+            {"messageRouter"},
+            [this,
+             &provisionedDiscoveryEntries,
+             &globalClusterControllerAddress,
+             &clusterControllerId]() {
+                _discoveryProxy =
+                        std::make_shared<LocalDiscoveryAggregator>(provisionedDiscoveryEntries);
+
+                std::unique_ptr<TaskSequencer<void>> taskSequencer =
+                        std::make_unique<TaskSequencer<void>>(
+                                std::chrono::milliseconds(MessagingQos().getTtl()));
+                _globalCapabilitiesDirectoryClient =
+                        std::make_shared<GlobalCapabilitiesDirectoryClient>(
+                                _clusterControllerSettings, std::move(taskSequencer));
+                _localCapabilitiesDirectory = std::make_shared<LocalCapabilitiesDirectory>(
+                        _clusterControllerSettings,
+                        _globalCapabilitiesDirectoryClient,
+                        _localCapabilitiesDirectoryStore,
+                        globalClusterControllerAddress,
+                        _ccMessageRouter,
+                        _singleThreadedIOService->getIOService(),
+                        clusterControllerId,
+                        _availableGbids,
+                        _messagingSettings.getDiscoveryEntryExpiryIntervalMs());
+                _localCapabilitiesDirectory->init();
+            });
+
+    startupGraph.addStep("localCapabilitiesDirectoryPersistence",
+                         {"localCapabilitiesDirectory"},
+                         [this]() {
+                             _localCapabilitiesDirectory->loadPersistedFile();
+                             // importPersistedLocalCapabilitiesDirectory();
+                         });
+
+    startupGraph.addStep(
+            "capabilitiesRegistrar",
+            {"localCapabilitiesDirectory", "participantIdStorage"},
+            [this, &provisionedDiscoveryEntries, &globalClusterControllerAddress]() {
+                std::string discoveryProviderParticipantId(
+                        _systemServicesSettings.getCcDiscoveryProviderParticipantId());
+
+                MessagingQos messagingQos;
+                messagingQos.setCompress(
+                        _clusterControllerSettings
+                                .isGlobalCapabilitiesDirectoryCompressedMessagesEnabled());
+
+                {
+                    auto provisionedProviderDiscoveryEntry =
+                            provisionedDiscoveryEntries
+                                    .find(_systemServicesSettings
+                                                  .getCcDiscoveryProviderParticipantId())
+                                    ->second;
+                    using joynr::system::DiscoveryJoynrMessagingConnector;
+                    auto discoveryJoynrMessagingConnector =
+                            std::make_unique<DiscoveryJoynrMessagingConnector>(
+                                    _messageSender,
+                                    _subscriptionManager,
+                                    std::string(),
+                                    discoveryProviderParticipantId,
+                                    messagingQos,
+                                    provisionedProviderDiscoveryEntry);
+                    _discoveryProxy->setDiscoveryProxy(std::move(discoveryJoynrMessagingConnector));
+                }
+                _capabilitiesRegistrar = std::make_unique<CapabilitiesRegistrar>(
+                        _joynrDispatcher,
+                        _discoveryProxy,
+                        _participantIdStorage,
+                        _dispatcherAddress,
+                        _ccMessageRouter,
+                        _messagingSettings.getDiscoveryEntryExpiryIntervalMs(),
+                        _publicationManager,
+                        globalClusterControllerAddress);
+
+                _joynrDispatcher->registerPublicationManager(_publicationManager);
+                _joynrDispatcher->registerSubscriptionManager(_subscriptionManager);
+
+                // ******************************************************************************
+                // WARNING: Latent dependency in place!
+                //
+                // ProxyBuilder performs a discovery this is why discoveryProxy->setDiscoveryProxy
+                // must be called before any createProxyBuilder().
+                //
+                // ******************************************************************************
+                DiscoveryQos discoveryQos(10000);
+                discoveryQos.setArbitrationStrategy(
+                        DiscoveryQos::ArbitrationStrategy::FIXED_PARTICIPANT);
+                discoveryQos.addCustomParameter(
+                        "fixedParticipantId",
+                        _messagingSettings.getCapabilitiesDirectoryParticipantId());
+
+                auto capabilitiesProxyBuilder =
+                        createProxyBuilder<infrastructure::GlobalCapabilitiesDirectoryProxy>(
+                                _messagingSettings.getDiscoveryDirectoriesDomain());
+                capabilitiesProxyBuilder->setDiscoveryQos(discoveryQos);
+
+                capabilitiesProxyBuilder->setMessagingQos(messagingQos);
+
+                _globalCapabilitiesDirectoryClient->setProxy(capabilitiesProxyBuilder->build());
+            });
+
+    // Do this after local capabilities directory and message router have been initialized.
+    startupGraph.addStep(
+            "accessController",
+            {"localDomainAccessStore",
+             "localCapabilitiesDirectoryPersistence",
+             "capabilitiesRegistrar"},
+            [this, &provisionedDiscoveryEntries, &localDomainAccessStore]() {
+                enableAccessController(provisionedDiscoveryEntries, localDomainAccessStore);
+            });
+
+    startupGraph.addStep("internalSystemServiceProviders", {"accessController"}, [this]() {
+        registerInternalSystemServiceProviders();
+    });
+
+    startupGraph.run(_clusterControllerSettings.getStartupMaxParallelism());
+    JOYNR_LOG_INFO(logger(), "{}", startupGraph.getTimingReport());
+    exportStartupTimings(startupGraph, "startup.init.");
+}
+
+void JoynrClusterControllerRuntime::setupMessageQueueSpillFiles(
+        const std::string& clusterControllerId,
+        MessageQueue<std::string>& messageQueue,
+        MessageQueue<std::shared_ptr<ITransportStatus>>& transportStatusQueue) const
+{
+    const std::string messageQueueSpillDirectory =
+            _clusterControllerSettings.getMessageQueueSpillDirectory();
+    if (messageQueueSpillDirectory.empty()) {
+        return;
+    }
+    const std::uint64_t spillLimitBytes =
+            _clusterControllerSettings.getMessageQueueSpillLimitBytes();
+    const boost::filesystem::path spillDirectory(messageQueueSpillDirectory);
+    // several cluster controllers may share the directory, each one uses its own files
+    std::string fileNamePrefix = clusterControllerId;
+    std::replace_if(fileNamePrefix.begin(),
+                    fileNamePrefix.end(),
+                    [](char c) {
+                        return !std::isalnum(static_cast<unsigned char>(c)) && c != '-' &&
+                               c != '_' && c != '.';
+                    },
+                    '_');
+    try {
+        boost::filesystem::create_directories(spillDirectory);
+        // both queues spill or none: the spill file of the message queue is deleted again if
+        // the one of the transport status queue cannot be created
+        auto messageQueueSpillFile = std::make_shared<MessageQueueSpillFile>(
+                (spillDirectory / (fileNamePrefix + "-message-queue.spill")).string(),
+                spillLimitBytes);
+        auto transportStatusQueueSpillFile = std::make_shared<MessageQueueSpillFile>(
+                (spillDirectory / (fileNamePrefix + "-transport-not-available-queue.spill"))
+                        .string(),
+                spillLimitBytes);
+        messageQueue.setSpillFile(std::move(messageQueueSpillFile));
+        transportStatusQueue.setSpillFile(std::move(transportStatusQueueSpillFile));
+    } catch (const boost::filesystem::filesystem_error& e) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Message queue spilling disabled, cannot create {}: {}",
+                        messageQueueSpillDirectory,
+                        e.what());
+    } catch (const exceptions::JoynrRuntimeException& e) {
+        JOYNR_LOG_ERROR(logger(), "Message queue spilling disabled: {}", e.getMessage());
     }
+}
 
+void JoynrClusterControllerRuntime::setupLocalMessagingStubFactories(
+        std::shared_ptr<MessagingStubFactory> messagingStubFactory)
+{
     if (_clusterControllerSettings.isWebSocketEnabled()) {
         // setup CC WebSocket interface
         _wsMessagingStubFactory = std::make_shared<WebSocketMessagingStubFactory>();
@@ -451,23 +751,11 @@ void JoynrClusterControllerRuntime::init()
 
         messagingStubFactory->registerStubFactory(_udsMessagingStubFactory);
     }
+}
 
-    /* LibJoynr */
-    _messageSender = std::make_shared<MessageSender>(
-            _ccMessageRouter, _keyChain, _messagingSettings.getTtlUpliftMs());
-    _joynrDispatcher =
-            std::make_shared<Dispatcher>(_messageSender, _singleThreadedIOService->getIOService());
-    _messageSender->registerDispatcher(_joynrDispatcher);
-    _messageSender->setReplyToAddress(globalClusterControllerAddress);
-    _ccMessageRouter->setMessageSender(_messageSender);
-
-    /* CC */
-    _libJoynrMessagingSkeleton = std::make_shared<InProcessMessagingSkeleton>(_joynrDispatcher);
-
-    /**
-     * ClusterController side MQTT
-     *
-     */
+void JoynrClusterControllerRuntime::setupMqttMessagingSkeletons(
+        std::shared_ptr<MessagingStubFactory> messagingStubFactory)
+{
     if (_doMqttMessaging) {
         // create MqttMessagingSkeletonFactory only once and use it to create multiple skeletons
         if (!_mqttMessagingSkeletonFactory) {
@@ -521,110 +809,6 @@ void JoynrClusterControllerRuntime::init()
                     connectionData->getMqttMessageSender(), _availableGbids[brokerIndex]));
         }
     }
-
-    /**
-     * libJoynr side
-     *
-     */
-    _publicationManager =
-            std::make_shared<PublicationManager>(_singleThreadedIOService->getIOService(),
-                                                 _messageSender,
-                                                 _messagingSettings.getTtlUpliftMs());
-    _subscriptionManager = std::make_shared<SubscriptionManager>(
-            _singleThreadedIOService->getIOService(), _ccMessageRouter);
-
-    _dispatcherAddress = std::make_shared<InProcessMessagingAddress>(_libJoynrMessagingSkeleton);
-
-    auto joynrMessagingConnectorFactory =
-            std::make_unique<JoynrMessagingConnectorFactory>(_messageSender, _subscriptionManager);
-
-    _proxyFactory = std::make_unique<ProxyFactory>(std::move(joynrMessagingConnectorFactory));
-
-    // Set up the persistence file for storing provider participant ids
-    std::string persistenceFilename = _libjoynrSettings.getParticipantIdsPersistenceFilename();
-    _participantIdStorage = std::make_shared<ParticipantIdStorage>(persistenceFilename);
-
-    auto provisionedDiscoveryEntries = getProvisionedEntries();
-    _discoveryProxy = std::make_shared<LocalDiscoveryAggregator>(provisionedDiscoveryEntries);
-
-    std::unique_ptr<TaskSequencer<void>> taskSequencer = std::make_unique<TaskSequencer<void>>(
-            std::chrono::milliseconds(MessagingQos().getTtl()));
-    _globalCapabilitiesDirectoryClient = std::make_shared<GlobalCapabilitiesDirectoryClient>(
-            _clusterControllerSettings, std::move(taskSequencer));
-    _localCapabilitiesDirectory = std::make_shared<LocalCapabilitiesDirectory>(
-            _clusterControllerSettings,
-            _globalCapabilitiesDirectoryClient,
-            _localCapabilitiesDirectoryStore,
-            globalClusterControllerAddress,
-            _ccMessageRouter,
-            _singleThreadedIOService->getIOService(),
-            clusterControllerId,
-            _availableGbids,
-            _messagingSettings.getDiscoveryEntryExpiryIntervalMs());
-    _localCapabilitiesDirectory->init();
-    _localCapabilitiesDirectory->loadPersistedFile();
-    // importPersistedLocalCapabilitiesDirectory();
-
-    std::string discoveryProviderParticipantId(
-            _systemServicesSettings.getCcDiscoveryProviderParticipantId());
-
-    MessagingQos messagingQos;
-    messagingQos.setCompress(
-            _clusterControllerSettings.isGlobalCapabilitiesDirectoryCompressedMessagesEnabled());
-
-    {
-        auto provisionedProviderDiscoveryEntry =
-                provisionedDiscoveryEntries
-                        .find(_systemServicesSettings.getCcDiscoveryProviderParticipantId())
-                        ->second;
-        using joynr::system::DiscoveryJoynrMessagingConnector;
-        auto discoveryJoynrMessagingConnector = std::make_unique<DiscoveryJoynrMessagingConnector>(
-                _messageSender,
-                _subscriptionManager,
-                std::string(),
-                discoveryProviderParticipantId,
-                messagingQos,
-                provisionedProviderDiscoveryEntry);
-        _discoveryProxy->setDiscoveryProxy(std::move(discoveryJoynrMessagingConnector));
-    }
-    _capabilitiesRegistrar = std::make_unique<CapabilitiesRegistrar>(
-            _joynrDispatcher,
-            _discoveryProxy,
-            _participantIdStorage,
-            _dispatcherAddress,
-            _ccMessageRouter,
-            _messagingSettings.getDiscoveryEntryExpiryIntervalMs(),
-            _publicationManager,
-            globalClusterControllerAddress);
-
-    _joynrDispatcher->registerPublicationManager(_publicationManager);
-    _joynrDispatcher->registerSubscriptionManager(_subscriptionManager);
-
-    // ******************************************************************************************
-    // WARNING: Latent dependency in place!
-    //
-    // ProxyBuilder performs a discovery this is why discoveryProxy->setDiscoveryProxy must be
-    // called before any createProxyBuilder().
-    //
-    // ******************************************************************************************
-    DiscoveryQos discoveryQos(10000);
-    discoveryQos.setArbitrationStrategy(DiscoveryQos::ArbitrationStrategy::FIXED_PARTICIPANT);
-    discoveryQos.addCustomParameter(
-            "fixedParticipantId", _messagingSettings.getCapabilitiesDirectoryParticipantId());
-
-    auto capabilitiesProxyBuilder =
-            createProxyBuilder<infrastructure::GlobalCapabilitiesDirectoryProxy>(
-                    _messagingSettings.getDiscoveryDirectoriesDomain());
-    capabilitiesProxyBuilder->setDiscoveryQos(discoveryQos);
-
-    capabilitiesProxyBuilder->setMessagingQos(messagingQos);
-
-    _globalCapabilitiesDirectoryClient->setProxy(capabilitiesProxyBuilder->build());
-
-    // Do this after local capabilities directory and message router have been initialized.
-    enableAccessController(provisionedDiscoveryEntries);
-
-    registerInternalSystemServiceProviders();
 }
 
 std::shared_ptr<IMessageRouter> JoynrClusterControllerRuntime::getMessageRouter()
@@ -662,11 +846,11 @@ std::map<std::string, joynr::types::DiscoveryEntryWithMetaInfo> JoynrClusterCont
     return provisionedDiscoveryEntries;
 }
 
-void JoynrClusterControllerRuntime::enableAccessController(
-        const std::map<std::string, joynr::types::DiscoveryEntryWithMetaInfo>& provisionedEntries)
+std::shared_ptr<LocalDomainAccessStore> JoynrClusterControllerRuntime::loadLocalDomainAccessStore()
+        const
 {
     if (!_clusterControllerSettings.enableAccessController()) {
-        return;
+        return nullptr;
     }
 
     JOYNR_LOG_INFO(logger(),
@@ -691,6 +875,16 @@ void JoynrClusterControllerRuntime::enableAccessController(
         JOYNR_LOG_ERROR(
                 logger(), "Access control directory: {} does not exist.", aclEntriesPath.string());
     }
+    return localDomainAccessStore;
+}
+
+void JoynrClusterControllerRuntime::enableAccessController(
+        const std::map<std::string, joynr::types::DiscoveryEntryWithMetaInfo>& provisionedEntries,
+        std::shared_ptr<LocalDomainAccessStore> localDomainAccessStore)
+{
+    if (!localDomainAccessStore) {
+        return;
+    }
 
     _localDomainAccessController =
             std::make_shared<joynr::LocalDomainAccessController>(localDomainAccessStore);
@@ -774,6 +968,12 @@ void JoynrClusterControllerRuntime::unregisterInternalSystemServiceProviders()
 }
 
 void JoynrClusterControllerRuntime::startLocalCommunication()
+{
+    startWebSocketCommunication();
+    startUdsCommunication();
+}
+
+void JoynrClusterControllerRuntime::startWebSocketCommunication()
 {
     if (_clusterControllerSettings.isWebSocketEnabled()) {
         if (_clusterControllerSettings.isWsTLSPortSet()) {
@@ -801,7 +1001,8 @@ void JoynrClusterControllerRuntime::startLocalCommunication()
                         wsAddress,
                         certificateAuthorityPemFilename,
                         certificatePemFilename,
-                        privateKeyPemFilename);
+                        privateKeyPemFilename,
+                        _wsSettings.isMessageBatchingEnabled());
                 _wsTLSCcMessagingSkeleton->init();
             }
         }
@@ -817,10 +1018,15 @@ void JoynrClusterControllerRuntime::startLocalCommunication()
                     _singleThreadedIOService->getIOService(),
                     _ccMessageRouter,
                     _wsMessagingStubFactory,
-                    wsAddress);
+                    wsAddress,
+                    _wsSettings.isMessageBatchingEnabled());
             _wsCcMessagingSkeleton->init();
         }
     }
+}
+
+void JoynrClusterControllerRuntime::startUdsCommunication()
+{
     if (_udsMessagingStubFactory) {
         //_udsMessagingStubFactory only created if UDS is enabled
         _udsCcMessagingSkeleton = std::make_unique<UdsCcMessagingSkeleton>(_ccMessageRouter);
@@ -840,6 +1046,10 @@ void JoynrClusterControllerRuntime::startLocalCommunication()
                                               const std::string& creator) {
             _udsCcMessagingSkeleton->onMessageReceived(std::move(newMessage), creator);
         });
+        _udsServer->setBackpressureCallback(
+                [this](const system::RoutingTypes::UdsClientAddress& address, bool isPaused) {
+                    _udsTransportStatus->onBackpressureChanged(address, isPaused);
+                });
         _udsServer->start();
     }
 }
@@ -925,6 +1135,8 @@ void JoynrClusterControllerRuntime::shutdown()
     }
 
     _removeStaleTimer.cancel();
+
+    stopDiagnostics();
 }
 
 void JoynrClusterControllerRuntime::shutdownClusterController()
@@ -972,9 +1184,22 @@ std::shared_ptr<JoynrClusterControllerRuntime> JoynrClusterControllerRuntime::cr
 void JoynrClusterControllerRuntime::start()
 {
     _singleThreadedIOService->start();
-    startExternalCommunication();
-    startLocalCommunication();
+
+    // the transports do not depend on each other
+    StartupGraph startupGraph("JoynrClusterControllerRuntime::start");
+    startupGraph.addStep("externalCommunication", {}, [this]() { startExternalCommunication(); });
+    startupGraph.addStep("webSocketCommunication", {}, [this]() { startWebSocketCommunication(); });
+    startupGraph.addStep("udsCommunication", {}, [this]() { startUdsCommunication(); });
+    startupGraph.run(_clusterControllerSettings.getStartupMaxParallelism());
+    JOYNR_LOG_INFO(logger(), "{}", startupGraph.getTimingReport());
+    exportStartupTimings(startupGraph, "startup.start.");
+
     scheduleRemoveStaleTimer();
+
+    const std::int64_t timeToReadyMs =
+            TimePoint::now().toMilliseconds() - _clusterControllerStartDateMs;
+    metrics::MetricsRegistry::instance().getGauge("startup.timeToReadyMs")->set(timeToReadyMs);
+    JOYNR_LOG_INFO(logger(), "Cluster controller ready {}ms after creation", timeToReadyMs);
 }
 
 void JoynrClusterControllerRuntime::scheduleRemoveStaleTimer()
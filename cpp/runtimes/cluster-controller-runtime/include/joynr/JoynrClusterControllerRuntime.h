@@ -65,6 +65,7 @@ class IMessageRouter;
 class IMessageSender;
 class ITransportMessageReceiver;
 class ITransportMessageSender;
+class ITransportStatus;
 class IWebsocketCcMessagingSkeleton;
 class InProcessMessagingSkeleton;
 class JoynrClusterControllerMqttConnectionData;
@@ -72,14 +73,20 @@ class GlobalCapabilitiesDirectoryClient;
 class LocalCapabilitiesDirectory;
 class LocalCapabilitiesDirectoryStore;
 class LocalDomainAccessController;
+class LocalDomainAccessStore;
+class MessagingStubFactory;
 class MqttReceiver;
 class MulticastMessagingSkeletonDirectory;
 class Settings;
 class SubscriptionManager;
 class UdsCcMessagingSkeleton;
 class UdsMessagingStubFactory;
+class UdsTransportStatus;
 class WebSocketMessagingStubFactory;
 
+template <typename T>
+class MessageQueue;
+
 namespace capabilities
 {
 class CachingStorage;
@@ -174,9 +181,10 @@ protected:
     std::shared_ptr<LocalDomainAccessController> _localDomainAccessController;
     ClusterControllerSettings _clusterControllerSettings;
 
-    // skeleton and stub-factory register methods to the server, hence the server must be removed
-    // first
+    // skeleton, stub-factory and transport status register methods to the server, hence the
+    // server must be removed first
     UdsSettings _udsSettings;
+    std::shared_ptr<UdsTransportStatus> _udsTransportStatus;
     std::shared_ptr<UdsMessagingStubFactory> _udsMessagingStubFactory;
     std::unique_ptr<UdsCcMessagingSkeleton> _udsCcMessagingSkeleton;
     std::unique_ptr<UdsServer> _udsServer;
@@ -218,6 +226,15 @@ private:
     void unregisterInternalSystemServiceProviders();
     void unregisterInternalSystemServiceProvider(const std::string& participantId);
     void startLocalCommunication();
+    void startWebSocketCommunication();
+    void startUdsCommunication();
+    void setupMessageQueueSpillFiles(
+            const std::string& clusterControllerId,
+            MessageQueue<std::string>& messageQueue,
+            MessageQueue<std::shared_ptr<ITransportStatus>>& transportStatusQueue) const;
+    void setupLocalMessagingStubFactories(
+            std::shared_ptr<MessagingStubFactory> messagingStubFactory);
+    void setupMqttMessagingSkeletons(std::shared_ptr<MessagingStubFactory> messagingStubFactory);
     std::string getSerializedGlobalClusterControllerAddress() const;
     const system::RoutingTypes::Address& getGlobalClusterControllerAddress() const;
     void scheduleRemoveStaleTimer();
@@ -228,8 +245,10 @@ private:
     std::shared_ptr<CcMessageRouter> _ccMessageRouter;
     std::shared_ptr<AccessControlListEditor> _aclEditor;
 
+    std::shared_ptr<LocalDomainAccessStore> loadLocalDomainAccessStore() const;
     void enableAccessController(
-            const std::map<std::string, types::DiscoveryEntryWithMetaInfo>& provisionedEntries);
+            const std::map<std::string, types::DiscoveryEntryWithMetaInfo>& provisionedEntries,
+            std::shared_ptr<LocalDomainAccessStore> localDomainAccessStore);
 
     Semaphore _lifetimeSemaphore;
 
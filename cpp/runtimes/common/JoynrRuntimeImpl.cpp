@@ -18,10 +18,14 @@
  */
 #include "joynr/JoynrRuntimeImpl.h"
 
+#include <chrono>
 #include <cstdint>
 #include <limits>
+#include <stdexcept>
 
 #include "joynr/Logger.h"
+#include "joynr/MessageTracer.h"
+#include "joynr/MetricsDumper.h"
 #include "joynr/ProxyFactory.h"
 #include "joynr/SingleThreadedIOService.h"
 #include "joynr/Util.h"
@@ -48,20 +52,66 @@ JoynrRuntimeImpl::JoynrRuntimeImpl(
           _dispatcherAddress(nullptr),
           _discoveryProxy(nullptr),
           _publicationManager(nullptr),
-          _keyChain(std::move(keyChain))
+          _keyChain(std::move(keyChain)),
+          _proxyBuilders(),
+          _proxyBuildersMutex(),
+          _metricsDumper(nullptr)
 {
     _messagingSettings.printSettings();
     _systemServicesSettings.printSettings();
+
+    const std::string metricsDumpFilename = _messagingSettings.getMetricsDumpFilename();
+    if (!metricsDumpFilename.empty()) {
+        _metricsDumper = std::make_shared<MetricsDumper>(
+                _singleThreadedIOService->getIOService(),
+                metricsDumpFilename,
+                std::chrono::milliseconds(_messagingSettings.getMetricsDumpIntervalMs()));
+        _metricsDumper->start();
+    }
+
+    if (!_messagingSettings.getMessageTraceFilename().empty()) {
+        tracing::MessageTracer::instance().enable(
+                static_cast<std::size_t>(_messagingSettings.getMessageTraceBufferSize()));
+    }
 }
 
 JoynrRuntimeImpl::~JoynrRuntimeImpl()
 {
 }
 
+boost::asio::io_service& JoynrRuntimeImpl::getIOService()
+{
+    return _singleThreadedIOService->getIOService();
+}
+
 void JoynrRuntimeImpl::shutdown()
 {
 }
 
+void JoynrRuntimeImpl::stopDiagnostics()
+{
+    if (_metricsDumper) {
+        _metricsDumper->stop();
+    }
+
+    const std::string messageTraceFilename = _messagingSettings.getMessageTraceFilename();
+    if (!messageTraceFilename.empty()) {
+        tracing::MessageTracer& messageTracer = tracing::MessageTracer::instance();
+        messageTracer.disable();
+        const auto format = (_messagingSettings.getMessageTraceFormat() == "binary")
+                                    ? tracing::MessageTracer::Format::BINARY
+                                    : tracing::MessageTracer::Format::CHROME_TRACE;
+        try {
+            messageTracer.flushToFile(messageTraceFilename, format);
+        } catch (const std::runtime_error& e) {
+            JOYNR_LOG_ERROR(logger(),
+                            "Failed to write message trace to {}: {}",
+                            messageTraceFilename,
+                            e.what());
+        }
+    }
+}
+
 bool JoynrRuntimeImpl::checkAndLogCryptoFileExistence(const std::string& caPemFile,
                                                       const std::string& certPemFile,
                                                       const std::string& privateKeyPemFile,
@@ -28,11 +28,13 @@
 #include <utility>
 #include <vector>
 
+#include "joynr/BoostIoserviceForwardDecl.h"
 #include "joynr/CapabilitiesRegistrar.h"
 #include "joynr/Future.h"
 #include "joynr/GuidedProxyBuilder.h"
 #include "joynr/JoynrClusterControllerRuntimeExport.h"
 #include "joynr/LocalDiscoveryAggregator.h"
+#include "joynr/Logger.h"
 #include "joynr/MessagingSettings.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/ProxyBuilder.h"
@@ -45,6 +47,7 @@ namespace joynr
 class IKeychain;
 class IMessageRouter;
 class IRequestCallerDirectory;
+class MetricsDumper;
 class ParticipantIdStorage;
 class ProxyFactory;
 class PublicationManager;
@@ -483,6 +486,7 @@ public:
         }
 
         auto proxyBuilder = std::make_shared<ProxyBuilder<TIntfProxy>>(shared_from_this(),
+                                                                       getIOService(),
                                                                        *_proxyFactory,
                                                                        _discoveryProxy,
                                                                        domain,
@@ -505,6 +509,7 @@ public:
 
         std::string interfaceName = TIntfProxy::INTERFACE_NAME();
         auto guidedProxyBuilder = std::make_shared<GuidedProxyBuilder>(shared_from_this(),
+                                                                       getIOService(),
                                                                        *_proxyFactory,
                                                                        _discoveryProxy,
                                                                        domain,
@@ -539,6 +544,9 @@ protected:
     /** @brief Return an IMessageRouter instance */
     virtual std::shared_ptr<IMessageRouter> getMessageRouter() = 0;
 
+    /** @brief Return the io_service of the runtime, e.g. for scheduling arbitration retries */
+    boost::asio::io_service& getIOService();
+
     bool checkAndLogCryptoFileExistence(const std::string& caPemFile,
                                         const std::string& certPemFile,
                                         const std::string& privateKeyPemFile,
@@ -550,6 +558,12 @@ protected:
     virtual std::map<std::string, joynr::types::DiscoveryEntryWithMetaInfo> getProvisionedEntries()
             const;
 
+    /**
+     * @brief Stops the periodic metrics dump and writes the metrics a last time.
+     * Writes the message trace file. Both only if enabled.
+     */
+    void stopDiagnostics();
+
     std::shared_ptr<SingleThreadedIOService> _singleThreadedIOService;
 
     /** @brief Factory for creating proxy instances */
@@ -578,9 +592,12 @@ protected:
     std::shared_ptr<IKeychain> _keyChain;
     std::vector<std::shared_ptr<IProxyBuilderBase>> _proxyBuilders;
     std::mutex _proxyBuildersMutex;
+    /** @brief Periodically writes the runtime metrics to a file, nullptr if disabled */
+    std::shared_ptr<MetricsDumper> _metricsDumper;
 
 private:
     DISALLOW_COPY_AND_ASSIGN(JoynrRuntimeImpl);
+    ADD_LOGGER(JoynrRuntimeImpl)
 };
 
 } // namespace joynr
@@ -113,6 +113,8 @@ void LibJoynrRuntime::shutdown()
     assert(_singleThreadedIOService);
     _singleThreadedIOService->stop();
 
+    stopDiagnostics();
+
     std::lock_guard<std::mutex> lock(_proxyBuildersMutex);
     for (auto proxyBuilder : _proxyBuilders) {
         proxyBuilder->stop();
@@ -144,6 +146,7 @@ void LibJoynrRuntime::init(
         std::shared_ptr<const joynr::system::RoutingTypes::Address> libjoynrMessagingAddress,
         std::shared_ptr<const joynr::system::RoutingTypes::Address> ccMessagingAddress,
         std::unique_ptr<IMulticastAddressCalculator> addressCalculator,
+        std::vector<std::shared_ptr<ITransportStatus>> transportStatuses,
         std::function<void()> onSuccess,
         std::function<void(const joynr::exceptions::JoynrRuntimeException&)> onError)
 {
@@ -166,7 +169,7 @@ void LibJoynrRuntime::init(
             std::move(messagingStubFactory),
             _singleThreadedIOService->getIOService(),
             std::move(addressCalculator),
-            std::vector<std::shared_ptr<ITransportStatus>>{},
+            std::move(transportStatuses),
             std::make_unique<MessageQueue<std::string>>(),
             std::make_unique<MessageQueue<std::shared_ptr<ITransportStatus>>>());
     _libJoynrMessageRouter->init();
@@ -23,6 +23,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "joynr/JoynrRuntimeImpl.h"
 #include "joynr/Logger.h"
@@ -36,6 +37,7 @@ class IMessageRouter;
 class IMessageSender;
 class IMiddlewareMessagingStubFactory;
 class IMulticastAddressCalculator;
+class ITransportStatus;
 class InProcessMessagingSkeleton;
 class JoynrMessagingConnectorFactory;
 class LibJoynrMessageRouter;
@@ -86,6 +88,7 @@ protected:
               std::shared_ptr<const joynr::system::RoutingTypes::Address> libjoynrMessagingAddress,
               std::shared_ptr<const joynr::system::RoutingTypes::Address> ccMessagingAddress,
               std::unique_ptr<IMulticastAddressCalculator> addressCalculator,
+              std::vector<std::shared_ptr<ITransportStatus>> transportStatuses,
               std::function<void()> onSuccess,
               std::function<void(const joynr::exceptions::JoynrRuntimeException&)> onError);
 
@@ -32,6 +32,7 @@
 
 #include "libjoynr/uds/UdsLibJoynrMessagingSkeleton.h"
 #include "libjoynr/uds/UdsMessagingStubFactory.h"
+#include "libjoynr/uds/UdsTransportStatus.h"
 
 namespace joynr
 {
@@ -41,6 +42,7 @@ LibJoynrUdsRuntime::LibJoynrUdsRuntime(
         std::function<void(const exceptions::JoynrRuntimeException&)>&& onFatalRuntimeError)
         : LibJoynrRuntime(std::move(settings), std::move(onFatalRuntimeError), nullptr),
           _stubFactory(std::make_shared<UdsMessagingStubFactory>()),
+          _transportStatus(std::make_shared<UdsTransportStatus>()),
           _isShuttingDown(false)
 {
     UdsSettings udsSettings(*_settings);
@@ -48,6 +50,9 @@ LibJoynrUdsRuntime::LibJoynrUdsRuntime(
     _serverAddress =
             std::make_shared<system::RoutingTypes::UdsAddress>(udsSettings.getSocketPath());
     _client = std::make_shared<UdsClient>(udsSettings, _onFatalRuntimeError);
+    _client->setBackpressureCallback([this](bool isPaused) {
+        _transportStatus->onBackpressureChanged(*_serverAddress, isPaused);
+    });
 }
 
 LibJoynrUdsRuntime::~LibJoynrUdsRuntime()
@@ -86,6 +91,7 @@ void LibJoynrUdsRuntime::connect(
                            std::move(ownAddress),
                            _serverAddress,
                            std::move(addressCalculator),
+                           {_transportStatus},
                            std::move(onSuccess),
                            std::move(onError));
             });
@@ -35,6 +35,7 @@ class IMessageRouter;
 class UdsMessagingStubFactory;
 class UdsLibJoynrMessagingSkeleton;
 class UdsClient;
+class UdsTransportStatus;
 class Settings;
 
 namespace exceptions
@@ -74,6 +75,8 @@ private:
     std::shared_ptr<UdsMessagingStubFactory> _stubFactory;
     std::unique_ptr<UdsLibJoynrMessagingSkeleton> _skeleton;
     std::shared_ptr<UdsClient> _client;
+    // Pauses the message router while the sending queue of the client is congested
+    std::shared_ptr<UdsTransportStatus> _transportStatus;
 
     std::atomic<bool> _isShuttingDown;
     ADD_LOGGER(LibJoynrUdsRuntime)
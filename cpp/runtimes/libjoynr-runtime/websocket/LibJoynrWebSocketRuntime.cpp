@@ -131,6 +131,7 @@ void LibJoynrWebSocketRuntime::connect(
                                         libjoynrMessagingAddress,
                                         ccMessagingAddress,
                                         std::move(addressCalculator),
+                                        std::vector<std::shared_ptr<ITransportStatus>>{},
                                         std::move(onSuccess),
                                         std::move(onError));
                 }
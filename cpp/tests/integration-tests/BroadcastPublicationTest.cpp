@@ -239,3 +239,49 @@ TEST_F(BroadcastPublicationTest, sendPublication_FilterChainFail)
 
     _provider->fireLocationUpdateSelective(_gpsLocation1);
 }
+
+/**
+ * Trigger:    A broadcast occurs. Two subscriptions have equal filter parameters.
+ * Expected:   The filter chain is executed only once, both subscriptions get a publication
+ */
+TEST_F(BroadcastPublicationTest, filterChainIsEvaluatedOnceForEqualFilterParameters)
+{
+    const std::string secondSubscriptionId("secondSubscriptionId");
+    BroadcastSubscriptionRequest secondRequest;
+    secondRequest.setSubscribeToName("locationUpdateSelective");
+    secondRequest.setSubscriptionId(secondSubscriptionId);
+    secondRequest.setQos(std::make_shared<OnChangeSubscriptionQos>(1000, // publication ttl
+                                                                   80,   // validity_ms
+                                                                   100   // minInterval_ms
+                                                                   ));
+    secondRequest.setFilterParameters(_filterParameters);
+    _publicationManager->add(_proxyParticipantId,
+                             _providerParticipantId,
+                             _requestCaller,
+                             secondRequest,
+                             _publicationSender);
+
+    EXPECT_CALL(*_filter1, filter(Eq(_gpsLocation1), Eq(_filterParameters)))
+            .WillOnce(Return(true));
+    EXPECT_CALL(*_filter2, filter(Eq(_gpsLocation1), Eq(_filterParameters)))
+            .WillOnce(Return(true));
+
+    EXPECT_CALL(*_publicationSender,
+                sendSubscriptionPublicationMock(
+                        Eq(_providerParticipantId),
+                        Eq(_proxyParticipantId),
+                        _,
+                        AllOf(A<const SubscriptionPublication&>(),
+                              Property(&SubscriptionPublication::getSubscriptionId,
+                                       Eq(_subscriptionId)))));
+    EXPECT_CALL(*_publicationSender,
+                sendSubscriptionPublicationMock(
+                        Eq(_providerParticipantId),
+                        Eq(_proxyParticipantId),
+                        _,
+                        AllOf(A<const SubscriptionPublication&>(),
+                              Property(&SubscriptionPublication::getSubscriptionId,
+                                       Eq(secondSubscriptionId)))));
+
+    _provider->fireLocationUpdateSelective(_gpsLocation1);
+}
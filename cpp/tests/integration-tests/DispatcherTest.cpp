@@ -403,6 +403,38 @@ TEST_F(DispatcherTest, receive_interpreteReplyAndCallReplyCaller)
     EXPECT_TRUE(semaphore->waitFor(std::chrono::milliseconds(5000)));
 }
 
+TEST_F(DispatcherTest, dispatchInProcessRequest_callsOperationAndReplyCallerWithoutRouting)
+{
+    auto semaphore = std::make_shared<Semaphore>(0);
+
+    EXPECT_CALL(*mockRequestCaller,
+                getLocationMock(
+                        A<std::function<void(const joynr::types::Localisation::GpsLocation&)>>(),
+                        A<std::function<void(const std::shared_ptr<
+                                             joynr::exceptions::ProviderRuntimeException>&)>>()))
+            .WillOnce(Invoke(this, &DispatcherTest::invokeLocationAndSaveCallContext));
+    EXPECT_CALL(*mockCallback, onSuccess(Eq(types::Localisation::GpsLocation())))
+            .WillOnce(ReleaseSemaphore(semaphore));
+    // neither the request nor the reply are serialized and routed
+    EXPECT_CALL(*mockMessageRouter, route(_, _)).Times(0);
+
+    Request request;
+    request.setRequestReplyId(requestReplyId);
+    request.setMethodName("getLocation");
+    request.setParams();
+    request.setParamDatatypes(std::vector<std::string>());
+
+    dispatcher->addRequestCaller(providerParticipantId, mockRequestCaller);
+    dispatcher->addReplyCaller(requestReplyId, mockReplyCaller, qos);
+    dispatcher->dispatchInProcessRequest(
+            proxyParticipantId, providerParticipantId, qos, std::move(request));
+
+    EXPECT_TRUE(getLocationCalledSemaphore->waitFor(std::chrono::milliseconds(5000)));
+    EXPECT_TRUE(semaphore->waitFor(std::chrono::milliseconds(5000)));
+    // requests from the same runtime do not carry a principal
+    EXPECT_EQ("", callContext.getPrincipal());
+}
+
 TEST_F(DispatcherTest, receive_interpreteSubscriptionReplyAndCallSubscriptionCallback)
 {
     auto semaphore = std::make_shared<Semaphore>(0);
@@ -0,0 +1,58 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef TESTS_MICROBENCHMARKS_BENCHMARKUTILS_H
+#define TESTS_MICROBENCHMARKS_BENCHMARKUTILS_H
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
+#include "joynr/MutableMessage.h"
+#include "joynr/TimePoint.h"
+
+namespace joynr
+{
+namespace benchmarks
+{
+
+inline MutableMessage createMutableMessage(const std::string& recipient, std::size_t payloadSize)
+{
+    MutableMessage mutableMessage;
+    mutableMessage.setType(Message::VALUE_MESSAGE_TYPE_REQUEST());
+    mutableMessage.setSender("benchmark-sender-participant-id");
+    mutableMessage.setRecipient(recipient);
+    mutableMessage.setExpiryDate(TimePoint::fromRelativeMs(60 * 60 * 1000));
+    mutableMessage.setReplyTo("benchmark-reply-to-address");
+    mutableMessage.setPayload(std::string(payloadSize, 'x'));
+    return mutableMessage;
+}
+
+inline std::shared_ptr<ImmutableMessage> createImmutableMessage(const std::string& recipient,
+                                                                std::size_t payloadSize = 256)
+{
+    return createMutableMessage(recipient, payloadSize).getImmutableMessage();
+}
+
+} // namespace benchmarks
+} // namespace joynr
+
+#endif // TESTS_MICROBENCHMARKS_BENCHMARKUTILS_H
@@ -0,0 +1,63 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <memory>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "joynr/Directory.h"
+
+using namespace joynr;
+
+static void BM_Directory_addAndTake(benchmark::State& state)
+{
+    Directory<std::string, std::string> directory;
+    std::vector<std::string> keys;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        keys.push_back("benchmark-request-reply-id-" + std::to_string(i));
+    }
+    auto value = std::make_shared<std::string>("benchmark-value");
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            directory.add(key, value);
+        }
+        for (const auto& key : keys) {
+            benchmark::DoNotOptimize(directory.take(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Directory_addAndTake)->Range(1, 1 << 10);
+
+static void BM_Directory_addAndTake_multiThreaded(benchmark::State& state)
+{
+    static Directory<std::string, std::string> directory;
+    const std::size_t threadIdHash = std::hash<std::thread::id>()(std::this_thread::get_id());
+    const std::string key = "benchmark-request-reply-id-" + std::to_string(threadIdHash);
+    auto value = std::make_shared<std::string>("benchmark-value");
+    for (auto _ : state) {
+        directory.add(key, value);
+        benchmark::DoNotOptimize(directory.take(key));
+    }
+}
+BENCHMARK(BM_Directory_addAndTake_multiThreaded)->ThreadRange(1, 8);
@@ -0,0 +1,85 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "joynr/infrastructure/DacTypes/MasterAccessControlEntry.h"
+#include "joynr/infrastructure/DacTypes/Permission.h"
+#include "joynr/infrastructure/DacTypes/TrustLevel.h"
+
+#include "libjoynrclustercontroller/access-control/LocalDomainAccessStore.h"
+
+using namespace joynr;
+using namespace joynr::infrastructure::DacTypes;
+
+namespace
+{
+
+void fillLocalDomainAccessStore(LocalDomainAccessStore& localDomainAccessStore,
+                                std::int64_t numberOfEntries)
+{
+    const std::vector<TrustLevel::Enum> trustLevels{TrustLevel::LOW, TrustLevel::HIGH};
+    const std::vector<Permission::Enum> permissions{Permission::NO, Permission::YES};
+    for (std::int64_t i = 0; i < numberOfEntries; ++i) {
+        MasterAccessControlEntry masterAce("benchmark-user-" + std::to_string(i % 16),
+                                           "benchmark.domain." + std::to_string(i),
+                                           "benchmark/interface",
+                                           TrustLevel::LOW,
+                                           trustLevels,
+                                           TrustLevel::LOW,
+                                           trustLevels,
+                                           "*",
+                                           Permission::YES,
+                                           permissions);
+        localDomainAccessStore.updateMasterAccessControlEntry(masterAce);
+    }
+}
+
+} // namespace
+
+static void BM_LocalDomainAccessStore_getMasterAccessControlEntry(benchmark::State& state)
+{
+    LocalDomainAccessStore localDomainAccessStore;
+    fillLocalDomainAccessStore(localDomainAccessStore, state.range(0));
+    const std::int64_t index = state.range(0) / 2;
+    const std::string uid = "benchmark-user-" + std::to_string(index % 16);
+    const std::string domain = "benchmark.domain." + std::to_string(index);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(localDomainAccessStore.getMasterAccessControlEntry(
+                uid, domain, "benchmark/interface", "*"));
+    }
+}
+BENCHMARK(BM_LocalDomainAccessStore_getMasterAccessControlEntry)->Range(8, 8 << 10);
+
+static void BM_LocalDomainAccessStore_getMasterAccessControlEntriesByDomainAndInterface(
+        benchmark::State& state)
+{
+    LocalDomainAccessStore localDomainAccessStore;
+    fillLocalDomainAccessStore(localDomainAccessStore, state.range(0));
+    const std::string domain = "benchmark.domain." + std::to_string(state.range(0) / 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(localDomainAccessStore.getMasterAccessControlEntries(
+                domain, "benchmark/interface"));
+    }
+}
+BENCHMARK(BM_LocalDomainAccessStore_getMasterAccessControlEntriesByDomainAndInterface)
+        ->Range(8, 8 << 10);
@@ -0,0 +1,58 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include <smrf/ByteVector.h>
+
+#include "joynr/ImmutableMessage.h"
+#include "joynr/MutableMessage.h"
+
+#include "tests/microbenchmarks/BenchmarkUtils.h"
+
+using namespace joynr;
+
+static void BM_MutableMessage_getImmutableMessage(benchmark::State& state)
+{
+    const MutableMessage mutableMessage = benchmarks::createMutableMessage(
+            "benchmark-recipient", static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mutableMessage.getImmutableMessage());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_MutableMessage_getImmutableMessage)->Arg(64)->Arg(1024)->Arg(64 * 1024);
+
+static void BM_ImmutableMessage_construct(benchmark::State& state)
+{
+    const smrf::ByteVector serializedMessage =
+            benchmarks::createImmutableMessage(
+                    "benchmark-recipient", static_cast<std::size_t>(state.range(0)))
+                    ->getSerializedMessage();
+    for (auto _ : state) {
+        smrf::ByteVector messageBytes(serializedMessage);
+        ImmutableMessage immutableMessage(std::move(messageBytes));
+        benchmark::DoNotOptimize(immutableMessage.getRecipient());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(serializedMessage.size()));
+}
+BENCHMARK(BM_ImmutableMessage_construct)->Arg(64)->Arg(1024)->Arg(64 * 1024);
@@ -0,0 +1,96 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "joynr/ImmutableMessage.h"
+#include "joynr/MessageQueue.h"
+
+#include "tests/microbenchmarks/BenchmarkUtils.h"
+
+using namespace joynr;
+
+static void BM_MessageQueue_queueAndDrain(benchmark::State& state)
+{
+    const std::int64_t numberOfKeys = state.range(0);
+    const std::int64_t messagesPerKey = state.range(1);
+    std::vector<std::string> keys;
+    std::vector<std::shared_ptr<ImmutableMessage>> messages;
+    for (std::int64_t i = 0; i < numberOfKeys; ++i) {
+        keys.push_back("benchmark-recipient-" + std::to_string(i));
+        for (std::int64_t j = 0; j < messagesPerKey; ++j) {
+            messages.push_back(benchmarks::createImmutableMessage(keys.back()));
+        }
+    }
+
+    MessageQueue<std::string> messageQueue;
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            messageQueue.queueMessage(message->getRecipient(), message);
+        }
+        for (const auto& key : keys) {
+            while (auto message = messageQueue.getNextMessageFor(key)) {
+                benchmark::DoNotOptimize(message);
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(messages.size()));
+}
+BENCHMARK(BM_MessageQueue_queueAndDrain)->Args({1, 1000})->Args({100, 10})->Args({1000, 1});
+
+static void BM_MessageQueue_queueWithLimit(benchmark::State& state)
+{
+    const std::uint64_t messageQueueLimit = static_cast<std::uint64_t>(state.range(0));
+    const std::uint64_t perKeyMessageQueueLimit = messageQueueLimit / 10;
+    std::vector<std::shared_ptr<ImmutableMessage>> messages;
+    for (std::uint64_t i = 0; i < 2 * messageQueueLimit; ++i) {
+        const std::string recipient = "benchmark-recipient-" + std::to_string(i % 20);
+        messages.push_back(benchmarks::createImmutableMessage(recipient));
+    }
+
+    for (auto _ : state) {
+        MessageQueue<std::string> messageQueue(messageQueueLimit, perKeyMessageQueueLimit);
+        for (const auto& message : messages) {
+            benchmark::DoNotOptimize(messageQueue.queueMessage(message->getRecipient(), message));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(messages.size()));
+}
+BENCHMARK(BM_MessageQueue_queueWithLimit)->Arg(100)->Arg(1000);
+
+static void BM_MessageQueue_removeOutdatedMessages(benchmark::State& state)
+{
+    MessageQueue<std::string> messageQueue;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        const std::string recipient = "benchmark-recipient-" + std::to_string(i);
+        auto message = benchmarks::createImmutableMessage(recipient);
+        messageQueue.queueMessage(message->getRecipient(), std::move(message));
+    }
+    for (auto _ : state) {
+        // no message is expired, hence this measures the cost of the expiry scan only
+        messageQueue.removeOutdatedMessages();
+    }
+}
+BENCHMARK(BM_MessageQueue_removeOutdatedMessages)->Range(8, 8 << 10);
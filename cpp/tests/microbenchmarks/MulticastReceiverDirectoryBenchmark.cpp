@@ -0,0 +1,45 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "joynr/MulticastReceiverDirectory.h"
+
+using namespace joynr;
+
+static void BM_MulticastReceiverDirectory_getReceivers(benchmark::State& state)
+{
+    MulticastReceiverDirectory multicastReceiverDirectory;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        const std::string providerParticipantId = "benchmark-provider-" + std::to_string(i);
+        multicastReceiverDirectory.registerMulticastReceiver(
+                providerParticipantId + "/broadcast/partition0",
+                "benchmark-receiver-" + std::to_string(i));
+        multicastReceiverDirectory.registerMulticastReceiver(
+                providerParticipantId + "/broadcast/+", "benchmark-wildcard-receiver");
+    }
+    const std::string multicastId =
+            "benchmark-provider-" + std::to_string(state.range(0) / 2) + "/broadcast/partition0";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(multicastReceiverDirectory.getReceivers(multicastId));
+    }
+}
+BENCHMARK(BM_MulticastReceiverDirectory_getReceivers)->Range(8, 8 << 10);
@@ -0,0 +1,87 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "joynr/RoutingTable.h"
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+
+using namespace joynr;
+
+namespace
+{
+
+const std::string gcdParticipantId("benchmark-gcd-participant-id");
+const std::vector<std::string> knownGbids{"gbid1", "gbid2"};
+
+std::string createParticipantId(std::int64_t index)
+{
+    return "benchmark-participant-" + std::to_string(index);
+}
+
+void fillRoutingTable(RoutingTable& routingTable, std::int64_t numberOfEntries)
+{
+    auto address = std::make_shared<const system::RoutingTypes::MqttAddress>(
+            "gbid1", "benchmark/topic");
+    for (std::int64_t i = 0; i < numberOfEntries; ++i) {
+        routingTable.add(createParticipantId(i),
+                         false,
+                         address,
+                         std::numeric_limits<std::int64_t>::max(),
+                         false);
+    }
+}
+
+} // namespace
+
+static void BM_RoutingTable_lookupRoutingEntryByParticipantId(benchmark::State& state)
+{
+    RoutingTable routingTable(gcdParticipantId, knownGbids);
+    fillRoutingTable(routingTable, state.range(0));
+    const std::string participantId = createParticipantId(state.range(0) / 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(routingTable.lookupRoutingEntryByParticipantId(participantId));
+    }
+}
+BENCHMARK(BM_RoutingTable_lookupRoutingEntryByParticipantId)->Range(8, 8 << 10);
+
+static void BM_RoutingTable_add(benchmark::State& state)
+{
+    auto address = std::make_shared<const system::RoutingTypes::MqttAddress>(
+            "gbid1", "benchmark/topic");
+    std::vector<std::string> participantIds;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        participantIds.push_back(createParticipantId(i));
+    }
+    for (auto _ : state) {
+        RoutingTable routingTable(gcdParticipantId, knownGbids);
+        for (const auto& participantId : participantIds) {
+            routingTable.add(
+                    participantId, false, address, std::numeric_limits<std::int64_t>::max(), false);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_RoutingTable_add)->Range(8, 8 << 10);
@@ -0,0 +1,116 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "joynr/serializer/Serializer.h"
+#include "joynr/types/GlobalDiscoveryEntry.h"
+#include "joynr/types/Localisation/GpsFixEnum.h"
+#include "joynr/types/Localisation/GpsLocation.h"
+#include "joynr/types/Localisation/Trip.h"
+#include "joynr/types/ProviderQos.h"
+#include "joynr/types/Version.h"
+
+using namespace joynr;
+
+namespace
+{
+
+using GpsFixEnum = types::Localisation::GpsFixEnum;
+
+types::Localisation::Trip createTrip(std::int64_t numberOfLocations)
+{
+    std::vector<types::Localisation::GpsLocation> locations;
+    for (std::int64_t i = 0; i < numberOfLocations; ++i) {
+        locations.push_back(types::Localisation::GpsLocation(1.1,
+                                                             2.2,
+                                                             3.3,
+                                                             GpsFixEnum::MODE3D,
+                                                             0.0,
+                                                             0.0,
+                                                             0.0,
+                                                             0.0,
+                                                             0,
+                                                             0,
+                                                             i));
+    }
+    return types::Localisation::Trip(locations, "benchmark-trip");
+}
+
+types::GlobalDiscoveryEntry createGlobalDiscoveryEntry()
+{
+    return types::GlobalDiscoveryEntry(types::Version(47, 11),
+                                       "benchmark.domain",
+                                       "benchmark/interface",
+                                       "benchmark-participant-id",
+                                       types::ProviderQos(),
+                                       1000,
+                                       2000,
+                                       "benchmark-public-key-id",
+                                       R"({"_typeName":"joynr.system.RoutingTypes.MqttAddress",)"
+                                       R"("brokerUri":"tcp://localhost:1883",)"
+                                       R"("topic":"benchmark/topic"})");
+}
+
+} // namespace
+
+static void BM_Json_serialize_Trip(benchmark::State& state)
+{
+    const types::Localisation::Trip trip = createTrip(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serializer::serializeToJson(trip));
+    }
+}
+BENCHMARK(BM_Json_serialize_Trip)->Range(1, 1 << 10);
+
+static void BM_Json_deserialize_Trip(benchmark::State& state)
+{
+    const std::string serializedTrip = serializer::serializeToJson(createTrip(state.range(0)));
+    for (auto _ : state) {
+        types::Localisation::Trip trip;
+        serializer::deserializeFromJson(trip, serializedTrip);
+        benchmark::DoNotOptimize(trip);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(serializedTrip.size()));
+}
+BENCHMARK(BM_Json_deserialize_Trip)->Range(1, 1 << 10);
+
+static void BM_Json_serialize_GlobalDiscoveryEntry(benchmark::State& state)
+{
+    const types::GlobalDiscoveryEntry globalDiscoveryEntry = createGlobalDiscoveryEntry();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serializer::serializeToJson(globalDiscoveryEntry));
+    }
+}
+BENCHMARK(BM_Json_serialize_GlobalDiscoveryEntry);
+
+static void BM_Json_deserialize_GlobalDiscoveryEntry(benchmark::State& state)
+{
+    const std::string serializedEntry = serializer::serializeToJson(createGlobalDiscoveryEntry());
+    for (auto _ : state) {
+        types::GlobalDiscoveryEntry globalDiscoveryEntry;
+        serializer::deserializeFromJson(globalDiscoveryEntry, serializedEntry);
+        benchmark::DoNotOptimize(globalDiscoveryEntry);
+    }
+}
+BENCHMARK(BM_Json_deserialize_GlobalDiscoveryEntry);
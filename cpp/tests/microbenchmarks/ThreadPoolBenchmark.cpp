@@ -0,0 +1,79 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "joynr/Runnable.h"
+#include "joynr/Semaphore.h"
+#include "joynr/ThreadPool.h"
+
+using namespace joynr;
+
+namespace
+{
+
+class CountDownRunnable : public Runnable
+{
+public:
+    CountDownRunnable(std::atomic<std::int64_t>& pendingRunnables, Semaphore& finished)
+            : Runnable(), _pendingRunnables(pendingRunnables), _finished(finished)
+    {
+    }
+
+    void shutdown() override
+    {
+    }
+
+    void run() override
+    {
+        if (_pendingRunnables.fetch_sub(1) == 1) {
+            _finished.notify();
+        }
+    }
+
+private:
+    std::atomic<std::int64_t>& _pendingRunnables;
+    Semaphore& _finished;
+};
+
+} // namespace
+
+static void BM_ThreadPool_execute(benchmark::State& state)
+{
+    const auto numberOfThreads = static_cast<std::uint8_t>(state.range(0));
+    const std::int64_t runnablesPerIteration = 1000;
+    auto threadPool = std::make_shared<ThreadPool>("Benchmark", numberOfThreads);
+    threadPool->init();
+
+    std::atomic<std::int64_t> pendingRunnables(0);
+    Semaphore finished(0);
+    for (auto _ : state) {
+        pendingRunnables = runnablesPerIteration;
+        for (std::int64_t i = 0; i < runnablesPerIteration; ++i) {
+            threadPool->execute(std::make_shared<CountDownRunnable>(pendingRunnables, finished));
+        }
+        finished.wait();
+    }
+    threadPool->shutdown();
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * runnablesPerIteration);
+}
+BENCHMARK(BM_ThreadPool_execute)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
@@ -60,7 +60,7 @@ public:
     MOCK_METHOD1(removeByParticipantId, void(const std::string& participantId));
     MOCK_METHOD0(clear, void());
     MOCK_CONST_METHOD0(size, std::size_t());
-    MOCK_METHOD0(removeExpired, std::vector<DiscoveryEntry>());
+    MOCK_METHOD1(removeExpired, std::vector<DiscoveryEntry>(std::size_t maxEntries));
 
     void insert(const DiscoveryEntry& entry, const std::vector<std::string>& gbids = {}) override
     {
@@ -109,7 +109,7 @@ public:
     MOCK_METHOD1(removeByParticipantId, void(const std::string& participantId));
     MOCK_METHOD0(clear, void());
     MOCK_CONST_METHOD0(size, std::size_t());
-    MOCK_METHOD0(removeExpired, std::vector<DiscoveryEntry>());
+    MOCK_METHOD1(removeExpired, std::vector<DiscoveryEntry>(std::size_t maxEntries));
 
     MOCK_METHOD1(insert, void(const DiscoveryEntry& entry));
     MOCK_CONST_METHOD2(lookupCacheByParticipantIdMock,
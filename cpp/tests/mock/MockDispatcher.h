@@ -26,6 +26,8 @@
 
 #include "joynr/IDispatcher.h"
 #include "joynr/MessagingQos.h"
+#include "joynr/OneWayRequest.h"
+#include "joynr/Request.h"
 
 class MockDispatcher : public joynr::IDispatcher
 {
@@ -39,6 +41,30 @@ public:
                       std::shared_ptr<joynr::RequestCaller> requestCaller));
     MOCK_METHOD1(removeRequestCaller, void(const std::string& participantId));
     MOCK_METHOD1(receive, void(std::shared_ptr<joynr::ImmutableMessage> message));
+
+    void dispatchInProcessRequest(const std::string& senderParticipantId,
+                                  const std::string& receiverParticipantId,
+                                  const joynr::MessagingQos& qos,
+                                  joynr::Request&& request) override
+    {
+        dispatchInProcessRequestMock(senderParticipantId, receiverParticipantId, qos, request);
+    }
+    MOCK_METHOD4(dispatchInProcessRequestMock,
+                 void(const std::string& senderParticipantId,
+                      const std::string& receiverParticipantId,
+                      const joynr::MessagingQos& qos,
+                      const joynr::Request& request));
+
+    void dispatchInProcessOneWayRequest(const std::string& receiverParticipantId,
+                                        const joynr::MessagingQos& qos,
+                                        joynr::OneWayRequest&& request) override
+    {
+        dispatchInProcessOneWayRequestMock(receiverParticipantId, qos, request);
+    }
+    MOCK_METHOD3(dispatchInProcessOneWayRequestMock,
+                 void(const std::string& receiverParticipantId,
+                      const joynr::MessagingQos& qos,
+                      const joynr::OneWayRequest& request));
     MOCK_METHOD1(registerSubscriptionManager,
                  void(std::shared_ptr<joynr::ISubscriptionManager> subscriptionManager));
     MOCK_METHOD1(registerPublicationManager,
@@ -83,6 +83,28 @@ public:
                     std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
                     std::shared_ptr<MessagingQos> qos));
 
+    std::shared_ptr<Future<std::vector<std::string>>> addMultipleAsync(
+            const std::vector<GlobalDiscoveryEntry>& globalDiscoveryEntries,
+            const std::vector<std::string>& gbids,
+            std::function<void(const std::vector<std::string>& failedParticipantIds)> onSuccess,
+            std::function<void(const DiscoveryError::Enum& errorEnum)> onApplicationError,
+            std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
+            boost::optional<MessagingQos> qos) noexcept override
+    {
+        return addMultipleAsyncMock(globalDiscoveryEntries, gbids, onSuccess, onApplicationError,
+                                    onRuntimeError, std::make_shared<MessagingQos>(qos.get()));
+    }
+    MOCK_METHOD6(
+            addMultipleAsyncMock,
+            std::shared_ptr<Future<std::vector<std::string>>>(
+                    const std::vector<GlobalDiscoveryEntry>& globalDiscoveryEntries,
+                    const std::vector<std::string>& gbids,
+                    std::function<void(const std::vector<std::string>& failedParticipantIds)>
+                            onSuccess,
+                    std::function<void(const DiscoveryError::Enum& errorEnum)> onApplicationError,
+                    std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
+                    std::shared_ptr<MessagingQos> qos));
+
     std::shared_ptr<Future<std::vector<GlobalDiscoveryEntry>>> lookupAsync(
             const std::vector<std::string>& domains,
             const std::string& interfaceName,
@@ -148,6 +170,28 @@ public:
                     std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
                     std::shared_ptr<MessagingQos> qos));
 
+    std::shared_ptr<Future<std::vector<std::string>>> removeMultipleAsync(
+            const std::vector<std::string>& participantIds,
+            const std::vector<std::string>& gbids,
+            std::function<void(const std::vector<std::string>& failedParticipantIds)> onSuccess,
+            std::function<void(const DiscoveryError::Enum& errorEnum)> onApplicationError,
+            std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
+            boost::optional<MessagingQos> qos) noexcept override
+    {
+        return removeMultipleAsyncMock(participantIds, gbids, onSuccess, onApplicationError,
+                                       onRuntimeError, std::make_shared<MessagingQos>(qos.get()));
+    }
+    MOCK_METHOD6(
+            removeMultipleAsyncMock,
+            std::shared_ptr<Future<std::vector<std::string>>>(
+                    const std::vector<std::string>& participantIds,
+                    const std::vector<std::string>& gbids,
+                    std::function<void(const std::vector<std::string>& failedParticipantIds)>
+                            onSuccess,
+                    std::function<void(const DiscoveryError::Enum& errorEnum)> onApplicationError,
+                    std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
+                    std::shared_ptr<MessagingQos> qos));
+
     std::shared_ptr<Future<void>> touchAsync(
             const std::string& clusterControllerId,
             std::function<void()> onSuccess,
@@ -32,7 +32,10 @@ public:
         dtorCalled();
     }
 
-    MOCK_METHOD2(send, void(const smrf::ByteArrayView& message, const SendFailed& onFailure));
+    MOCK_METHOD3(send,
+                 void(const smrf::ByteArrayView& message,
+                      const SendFailed& onFailure,
+                      Priority priority));
 };
 
 #endif // TESTS_MOCKIUDSSENDER_H
@@ -56,13 +56,15 @@ public:
                       std::shared_ptr<ILocalCapabilitiesCallback> callback));
     MOCK_METHOD2(getGbidsForParticipantId,
                  std::vector<std::string>(const std::string& participantId,
-                                          const std::unique_lock<std::recursive_mutex>& cacheLock));
+                                          const ReentrantWriteLocker& cacheLock));
+    MOCK_METHOD2(getGbidsForParticipantId,
+                 std::vector<std::string>(const std::string& participantId,
+                                          const ReentrantReadLocker& cacheLock));
     MOCK_CONST_METHOD0(getAllGlobalCapabilities, std::vector<types::DiscoveryEntry>());
     MOCK_METHOD2(eraseParticipantIdToGbidMapping,
-                 void(const std::string& participantId,
-                      const std::unique_lock<std::recursive_mutex>& cacheLock));
+                 void(const std::string& participantId, const ReentrantWriteLocker& cacheLock));
     std::shared_ptr<capabilities::CachingStorage> getGlobalLookupCache(
-            const std::unique_lock<std::recursive_mutex>& cacheLock) override
+            const ReentrantWriteLocker& cacheLock) override
     {
         if (_globalLookupCache) {
             return _globalLookupCache;
@@ -70,7 +72,7 @@ public:
         return joynr::LocalCapabilitiesDirectoryStore::getGlobalLookupCache(cacheLock);
     }
     std::shared_ptr<capabilities::Storage> getLocallyRegisteredCapabilities(
-            const std::unique_lock<std::recursive_mutex>& cacheLock) override
+            const ReentrantWriteLocker& cacheLock) override
     {
         if (_locallyRegisteredCapabilities) {
             return _locallyRegisteredCapabilities;
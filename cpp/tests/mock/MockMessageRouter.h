@@ -68,6 +68,8 @@ public:
     MOCK_METHOD2(route,
                  void(std::shared_ptr<joynr::ImmutableMessage> message, std::uint32_t tryCount));
 
+    MOCK_METHOD1(canDispatchInProcess, bool(const std::string& participantId));
+
     MOCK_METHOD1(publishToGlobal, bool(const joynr::ImmutableMessage& message));
 
     MOCK_METHOD6(
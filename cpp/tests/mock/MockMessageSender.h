@@ -54,6 +54,19 @@ public:
                       std::shared_ptr<joynr::IReplyCaller> callback,
                       bool isLocalMessage));
 
+    MOCK_METHOD5(sendInProcessRequest,
+                 bool(const std::string& senderParticipantId,
+                      const std::string& receiverParticipantId,
+                      const joynr::MessagingQos& qos,
+                      joynr::Request& request,
+                      std::shared_ptr<joynr::IReplyCaller> callback));
+
+    MOCK_METHOD4(sendInProcessOneWayRequest,
+                 bool(const std::string& senderParticipantId,
+                      const std::string& receiverParticipantId,
+                      const joynr::MessagingQos& qos,
+                      joynr::OneWayRequest& request));
+
     MOCK_METHOD5(sendOneWayRequest,
                  void(const std::string& senderParticipantId,
                       const std::string& receiverParticipantId,
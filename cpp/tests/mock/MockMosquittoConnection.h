@@ -70,6 +70,7 @@ public:
     MOCK_METHOD0(start, void());
     MOCK_METHOD0(stop, void());
     MOCK_METHOD1(subscribeToTopic, void(const std::string& _topic));
+    MOCK_METHOD1(subscribeToTopics, void(const std::vector<std::string>& _topics));
     MOCK_METHOD1(unsubscribeFromTopic, void(const std::string& _topic));
 };
 
@@ -19,6 +19,9 @@
 #ifndef TESTS_MOCK_MOCKROUTINGPROXY_H
 #define TESTS_MOCK_MOCKROUTINGPROXY_H
 
+#include <string>
+#include <vector>
+
 #include "tests/utils/Gmock.h"
 
 #include "joynr/MessagingQos.h"
@@ -94,6 +97,59 @@ public:
                                  onRuntimeError,
                          boost::optional<joynr::MessagingQos> qos));
 
+    std::shared_ptr<joynr::Future<void>> addNextHopsAsync(
+            const std::vector<std::string>& participantIds,
+            const joynr::system::RoutingTypes::WebSocketClientAddress& webSocketClientAddress,
+            const bool& isGloballyVisible,
+            std::function<void()> onSuccess,
+            std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                    onRuntimeError,
+            boost::optional<joynr::MessagingQos> qos) noexcept override
+    {
+        return addNextHopsAsyncMockWs(participantIds,
+                                      webSocketClientAddress,
+                                      isGloballyVisible,
+                                      std::move(onSuccess),
+                                      std::move(onRuntimeError),
+                                      std::move(qos));
+    }
+    MOCK_METHOD6(addNextHopsAsyncMockWs,
+                 std::shared_ptr<joynr::Future<void>>(
+                         const std::vector<std::string>& participantIds,
+                         const joynr::system::RoutingTypes::WebSocketClientAddress&
+                                 webSocketClientAddress,
+                         const bool& isGloballyVisible,
+                         std::function<void()> onSuccess,
+                         std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                                 onRuntimeError,
+                         boost::optional<joynr::MessagingQos> qos));
+
+    std::shared_ptr<joynr::Future<void>> addNextHopsAsync(
+            const std::vector<std::string>& participantIds,
+            const joynr::system::RoutingTypes::UdsClientAddress& udsClientAddress,
+            const bool& isGloballyVisible,
+            std::function<void()> onSuccess,
+            std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                    onRuntimeError,
+            boost::optional<joynr::MessagingQos> qos) noexcept override
+    {
+        return addNextHopsAsyncMockUds(participantIds,
+                                       udsClientAddress,
+                                       isGloballyVisible,
+                                       std::move(onSuccess),
+                                       std::move(onRuntimeError),
+                                       std::move(qos));
+    }
+    MOCK_METHOD6(addNextHopsAsyncMockUds,
+                 std::shared_ptr<joynr::Future<void>>(
+                         const std::vector<std::string>& participantIds,
+                         const joynr::system::RoutingTypes::UdsClientAddress& udsClientAddress,
+                         const bool& isGloballyVisible,
+                         std::function<void()> onSuccess,
+                         std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                                 onRuntimeError,
+                         boost::optional<joynr::MessagingQos> qos));
+
     std::shared_ptr<joynr::Future<bool>> resolveNextHopAsync(
             const std::string& participantId,
             std::function<void(const bool& resolved)> onSuccess,
@@ -112,6 +168,24 @@ public:
                                  onRuntimeError,
                          boost::optional<joynr::MessagingQos> qos));
 
+    std::shared_ptr<joynr::Future<std::vector<bool>>> resolveNextHopsAsync(
+            const std::vector<std::string>& participantIds,
+            std::function<void(const std::vector<bool>& resolved)> onSuccess,
+            std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                    onRuntimeError,
+            boost::optional<joynr::MessagingQos> qos) noexcept override
+    {
+        return resolveNextHopsAsyncMock(
+                participantIds, std::move(onSuccess), std::move(onRuntimeError), std::move(qos));
+    }
+    MOCK_METHOD4(resolveNextHopsAsyncMock,
+                 std::shared_ptr<joynr::Future<std::vector<bool>>>(
+                         const std::vector<std::string>& participantIds,
+                         std::function<void(const std::vector<bool>& resolved)> onSuccess,
+                         std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                                 onRuntimeError,
+                         boost::optional<joynr::MessagingQos> qos));
+
     std::shared_ptr<joynr::Future<void>> addMulticastReceiverAsync(
             const std::string& multicastId,
             const std::string& subscriberParticipantId,
@@ -26,12 +26,17 @@
 class MockTransportStatus : public joynr::ITransportStatus
 {
 public:
+    using DestinationAvailableCallback =
+            std::function<void(std::shared_ptr<const joynr::system::RoutingTypes::Address>)>;
+
     MOCK_METHOD1(isReponsibleFor,
                  bool(std::shared_ptr<const joynr::system::RoutingTypes::Address>));
     MOCK_METHOD0(isAvailable, bool());
 
     MOCK_METHOD1(setAvailabilityChangedCallback,
                  void(std::function<void(bool)> availabilityChangedCallback));
+    MOCK_METHOD1(setDestinationAvailableCallback,
+                 void(DestinationAvailableCallback destinationAvailableCallback));
 };
 
 #endif // TESTS_MOCK_MOCKTRANSPORTSTATUS_H
@@ -37,6 +37,7 @@
 #include "joynr/LastSeenArbitrationStrategyFunction.h"
 #include "joynr/QosArbitrationStrategyFunction.h"
 #include "joynr/Semaphore.h"
+#include "joynr/SingleThreadedIOService.h"
 #include "joynr/exceptions/NoCompatibleProviderFoundException.h"
 #include "joynr/types/DiscoveryEntryWithMetaInfo.h"
 #include "joynr/types/DiscoveryError.h"
@@ -96,14 +97,16 @@ static std::string getErrorMsgUnableToLookup(const types::DiscoveryError::Enum&
 class MockArbitrator : public Arbitrator
 {
 public:
-    MockArbitrator(const std::string& domain,
+    MockArbitrator(boost::asio::io_service& ioService,
+                   const std::string& domain,
                    const std::string& interfaceName,
                    const joynr::types::Version& interfaceVersion,
                    std::weak_ptr<joynr::system::IDiscoveryAsync> discoveryProxy,
                    const DiscoveryQos& discoveryQos,
                    const std::vector<std::string>& gbids,
                    std::unique_ptr<const ArbitrationStrategyFunction> arbitrationStrategyFunction)
-            : Arbitrator(domain,
+            : Arbitrator(ioService,
+                         domain,
                          interfaceName,
                          interfaceVersion,
                          discoveryProxy,
@@ -132,8 +135,15 @@ public:
               _defaultRetryIntervalMs(1000),
               _publicKeyId("publicKeyId"),
               _mockDiscovery(std::make_shared<MockDiscovery>()),
-              _semaphore(std::make_shared<Semaphore>())
+              _semaphore(std::make_shared<Semaphore>()),
+              _singleThreadedIOService(std::make_shared<SingleThreadedIOService>())
     {
+        _singleThreadedIOService->start();
+    }
+
+    ~ArbitratorTest() override
+    {
+        _singleThreadedIOService->stop();
     }
 
     void testExceptionEmptyResult(std::shared_ptr<Arbitrator> arbitrator,
@@ -155,6 +165,7 @@ protected:
     const std::shared_ptr<MockDiscovery> _mockDiscovery;
     const std::vector<std::string> _emptyGbidsVector;
     std::shared_ptr<Semaphore> _semaphore;
+    std::shared_ptr<SingleThreadedIOService> _singleThreadedIOService;
 };
 
 TEST_F(ArbitratorTest, arbitrationTimeout_callsOnErrorIfNoRetryIsPossible)
@@ -166,7 +177,8 @@ TEST_F(ArbitratorTest, arbitrationTimeout_callsOnErrorIfNoRetryIsPossible)
     discoveryQos.setDiscoveryTimeoutMs(discoveryTimeoutMs);
     discoveryQos.setRetryIntervalMs(retryIntervalMs);
     auto mockArbitrator =
-            std::make_shared<MockArbitrator>("domain",
+            std::make_shared<MockArbitrator>(_singleThreadedIOService->getIOService(),
+                                             "domain",
                                              "interfaceName",
                                              providerVersion,
                                              _mockDiscovery,
@@ -251,12 +263,14 @@ TEST_F(ArbitratorTest, arbitrationStrategy_lastSeen_selectsCorrectProvider)
                                 _,  // onRuntimeError
                                 _)) // qos
             .WillOnce(DoAll(::testing::SaveArg<2>(&capturedDiscoveryQos), Return(mockFuture)));
-    auto lastSeenArbitrator = ArbitratorFactory::createArbitrator(_domain,
-                                                                  _interfaceName,
-                                                                  providerVersion,
-                                                                  _mockDiscovery,
-                                                                  discoveryQos,
-                                                                  _emptyGbidsVector);
+    auto lastSeenArbitrator =
+            ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                _domain,
+                                                _interfaceName,
+                                                providerVersion,
+                                                _mockDiscovery,
+                                                discoveryQos,
+                                                _emptyGbidsVector);
     // Check that the correct participant was selected
     auto onSuccess = [this, &lastSeenParticipantId](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo discoveryEntry =
@@ -331,7 +345,8 @@ TEST_F(ArbitratorTest, arbitrationStrategy_highestPriority_selectsCorrectProvide
     ON_CALL(*_mockDiscovery,
             lookupAsyncMock(Matcher<const std::vector<std::string>&>(_), _, _, _, _, _, _, _))
             .WillByDefault(Return(mockFuture));
-    auto qosArbitrator = std::make_shared<Arbitrator>(_domain,
+    auto qosArbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                      _domain,
                                                       _interfaceName,
                                                       providerVersion,
                                                       _mockDiscovery,
@@ -405,7 +420,8 @@ TEST_F(ArbitratorTest, arbitrationStrategy_highestPriority_checksVersion)
     ON_CALL(*_mockDiscovery,
             lookupAsyncMock(Matcher<const std::vector<std::string>&>(_), _, _, _, _, _, _, _))
             .WillByDefault(Return(mockFuture));
-    auto qosArbitrator = std::make_shared<Arbitrator>(_domain,
+    auto qosArbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                      _domain,
                                                       _interfaceName,
                                                       expectedVersion,
                                                       _mockDiscovery,
@@ -482,7 +498,8 @@ TEST_F(ArbitratorTest, arbitrationStrategy_highestPriority_checksOnChange)
     ON_CALL(*_mockDiscovery,
             lookupAsyncMock(Matcher<const std::vector<std::string>&>(_), _, _, _, _, _, _, _))
             .WillByDefault(Return(mockFuture));
-    auto qosArbitrator = std::make_shared<Arbitrator>(_domain,
+    auto qosArbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                      _domain,
                                                       _interfaceName,
                                                       providerVersion,
                                                       _mockDiscovery,
@@ -571,7 +588,8 @@ TEST_F(ArbitratorTest, arbitrationStrategy_keyword_selectsCorrectProvider)
     ON_CALL(*_mockDiscovery,
             lookupAsyncMock(Matcher<const std::vector<std::string>&>(_), _, _, _, _, _, _, _))
             .WillByDefault(Return(mockFuture));
-    auto qosArbitrator = std::make_shared<Arbitrator>(_domain,
+    auto qosArbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                      _domain,
                                                       _interfaceName,
                                                       providerVersion,
                                                       _mockDiscovery,
@@ -650,7 +668,8 @@ TEST_F(ArbitratorTest, arbitrationStrategy_keyword_checksVersion)
     ON_CALL(*_mockDiscovery,
             lookupAsyncMock(Matcher<const std::vector<std::string>&>(_), _, _, _, _, _, _, _))
             .WillByDefault(Return(mockFuture));
-    auto qosArbitrator = std::make_shared<Arbitrator>(_domain,
+    auto qosArbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                      _domain,
                                                       _interfaceName,
                                                       expectedVersion,
                                                       _mockDiscovery,
@@ -702,7 +721,8 @@ TEST_F(ArbitratorTest, allowFourRetries_expectFiveDiscoveryAttempts)
     discoveryQos.setDiscoveryTimeoutMs(990);
     joynr::types::Version providerVersion(47, 11);
     auto lastSeenArbitrator =
-            std::make_shared<Arbitrator>(_domain,
+            std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                         _domain,
                                          _interfaceName,
                                          providerVersion,
                                          _mockDiscovery,
@@ -722,6 +742,61 @@ TEST_F(ArbitratorTest, allowFourRetries_expectFiveDiscoveryAttempts)
     lastSeenArbitrator->stopArbitration();
 }
 
+TEST_F(ArbitratorTest, pendingLookupTimesOut_callsOnErrorWithoutBlockingCaller)
+{
+    // the future is never completed and the callbacks are never invoked
+    auto pendingFuture = std::make_shared<
+            joynr::Future<std::vector<joynr::types::DiscoveryEntryWithMetaInfo>>>();
+
+    EXPECT_CALL(*_mockDiscovery,
+                lookupAsyncMock(A<const std::vector<std::string>&>(),
+                                A<const std::string&>(),
+                                A<const joynr::types::DiscoveryQos&>(),
+                                _,
+                                _,
+                                _,
+                                _,
+                                _))
+            .WillOnce(Return(pendingFuture));
+
+    constexpr std::int64_t discoveryTimeoutMs = 300;
+    DiscoveryQos discoveryQos;
+    discoveryQos.setRetryIntervalMs(1000);
+    discoveryQos.setDiscoveryTimeoutMs(discoveryTimeoutMs);
+    joynr::types::Version providerVersion(47, 11);
+    auto lastSeenArbitrator =
+            std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                         _domain,
+                                         _interfaceName,
+                                         providerVersion,
+                                         _mockDiscovery,
+                                         discoveryQos,
+                                         _emptyGbidsVector,
+                                         move(_lastSeenArbitrationStrategyFunction));
+
+    const std::string expectedErrorMessage = getExceptionMsgUnableToLookup(
+            exceptions::JoynrTimeOutException("Request did not finish in time"),
+            _emptyGbidsVector);
+    auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
+        types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
+        FAIL() << "Got result: " << result.toString();
+    };
+    auto onError = [this, &expectedErrorMessage](
+                           const exceptions::DiscoveryException& discoveryException) {
+        EXPECT_EQ(expectedErrorMessage, discoveryException.getMessage());
+        _semaphore->notify();
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    lastSeenArbitrator->startArbitration(onSuccess, onError);
+    const auto startArbitrationDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start);
+    EXPECT_LT(startArbitrationDurationMs.count(), discoveryTimeoutMs);
+
+    EXPECT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(discoveryTimeoutMs * 10)));
+    lastSeenArbitrator->stopArbitration();
+}
+
 /*
  * Tests that the arbitrators report a NoCompatibleProviderFoundException if only providers
  * with incompatible versions were found
@@ -821,7 +896,8 @@ TEST_F(ArbitratorTest, getHighestPriorityReturnsNoCompatibleProviderFoundExcepti
                 lookupAsyncMock(Matcher<const std::vector<std::string>&>(_), _, _, _, _, _, _, _))
             .WillOnce(Return(mockFuture1))
             .WillRepeatedly(Return(mockFuture2));
-    auto qosArbitrator = std::make_shared<Arbitrator>(_domain,
+    auto qosArbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                      _domain,
                                                       _interfaceName,
                                                       expectedVersion,
                                                       _mockDiscovery,
@@ -920,7 +996,8 @@ TEST_F(ArbitratorTest, getKeywordProviderReturnsNoCompatibleProviderFoundExcepti
             .WillOnce(Return(mockFuture1))
             .WillRepeatedly(Return(mockFuture2));
     auto keywordArbitrator =
-            std::make_shared<Arbitrator>(_domain,
+            std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                         _domain,
                                          _interfaceName,
                                          expectedVersion,
                                          _mockDiscovery,
@@ -1001,7 +1078,8 @@ TEST_F(ArbitratorTest, getFixedParticipantProviderReturnsNoCompatibleProviderFou
             .WillOnce(Return(mockFuture1))
             .WillRepeatedly(Return(mockFuture2));
     auto fixedParticipantArbitrator =
-            std::make_shared<Arbitrator>(_domain,
+            std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                         _domain,
                                          _interfaceName,
                                          expectedVersion,
                                          _mockDiscovery,
@@ -1096,7 +1174,8 @@ TEST_F(ArbitratorTest, getDefaultReturnsNoCompatibleProviderFoundException)
             .WillOnce(Return(mockFuture1))
             .WillRepeatedly(Return(mockFuture2));
     auto lastSeenArbitrator =
-            std::make_shared<Arbitrator>(_domain,
+            std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                         _domain,
                                          _interfaceName,
                                          expectedVersion,
                                          _mockDiscovery,
@@ -1159,8 +1238,13 @@ TEST_F(ArbitratorTest,
             .WillRepeatedly(Return(mockFutureFixedPartId));
 
     joynr::types::Version version;
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _gbids);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                          _domain,
+                                                          _interfaceName,
+                                                          version,
+                                                          _mockDiscovery,
+                                                          discoveryQos,
+                                                          _gbids);
 
     auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
@@ -1223,8 +1307,13 @@ TEST_F(ArbitratorTest,
             .WillRepeatedly(Return(mockFuture));
 
     joynr::types::Version version;
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _gbids);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                          _domain,
+                                                          _interfaceName,
+                                                          version,
+                                                          _mockDiscovery,
+                                                          discoveryQos,
+                                                          _gbids);
 
     auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
@@ -1305,7 +1394,8 @@ TEST_F(ArbitratorTest, filterByVersionAndArbitrationStrategy_disabled_versionAnd
     ON_CALL(*_mockDiscovery,
             lookupAsyncMock(Matcher<const std::vector<std::string>&>(_), _, _, _, _, _, _, _))
             .WillByDefault(Return(mockFuture));
-    auto arbitrator = std::make_shared<Arbitrator>(_domain,
+    auto arbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                   _domain,
                                                    _interfaceName,
                                                    providerVersion,
                                                    _mockDiscovery,
@@ -1381,8 +1471,13 @@ TEST_F(ArbitratorTest,
                             Return(mockFutureFixedPartId)));
 
     joynr::types::Version version;
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _gbids);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                          _domain,
+                                                          _interfaceName,
+                                                          version,
+                                                          _mockDiscovery,
+                                                          discoveryQos,
+                                                          _gbids);
 
     auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
@@ -1450,8 +1545,13 @@ TEST_F(ArbitratorTest,
                             Return(mockFutureFixedPartId)));
 
     joynr::types::Version version;
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _gbids);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                          _domain,
+                                                          _interfaceName,
+                                                          version,
+                                                          _mockDiscovery,
+                                                          discoveryQos,
+                                                          _gbids);
 
     auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
@@ -1519,8 +1619,13 @@ TEST_F(ArbitratorTest,
                     DoAll(::testing::SaveArg<2>(&capturedDiscoveryQosRetried), Return(mockFuture)));
 
     joynr::types::Version version;
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _gbids);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                          _domain,
+                                                          _interfaceName,
+                                                          version,
+                                                          _mockDiscovery,
+                                                          discoveryQos,
+                                                          _gbids);
 
     auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
@@ -1585,8 +1690,13 @@ TEST_F(ArbitratorTest,
                     DoAll(::testing::SaveArg<7>(&capturedMessagingQosRetried), Return(mockFuture)));
 
     joynr::types::Version version;
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _gbids);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                          _domain,
+                                                          _interfaceName,
+                                                          version,
+                                                          _mockDiscovery,
+                                                          discoveryQos,
+                                                          _gbids);
 
     auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
@@ -1685,8 +1795,14 @@ protected:
         }
 
         joynr::types::Version version;
-        auto arbitrator = ArbitratorFactory::createArbitrator(
-                _domain, _interfaceName, version, _mockDiscovery, discoveryQos, gbids);
+        auto arbitrator =
+                ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                    _domain,
+                                                    _interfaceName,
+                                                    version,
+                                                    _mockDiscovery,
+                                                    discoveryQos,
+                                                    gbids);
 
         auto onSuccess = [this](const ArbitrationResult&) { _semaphore->notify(); };
         auto onError = [this](const exceptions::DiscoveryException&) { _semaphore->notify(); };
@@ -1762,8 +1878,14 @@ protected:
         }
 
         joynr::types::Version version;
-        auto arbitrator = ArbitratorFactory::createArbitrator(
-                _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _gbids);
+        auto arbitrator =
+                ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                    _domain,
+                                                    _interfaceName,
+                                                    version,
+                                                    _mockDiscovery,
+                                                    discoveryQos,
+                                                    _gbids);
 
         auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
             types::DiscoveryEntryWithMetaInfo result =
@@ -1880,8 +2002,13 @@ TEST_P(ArbitratorTestWithParams, discoveryException_exceptionFromDiscoveryProxy)
                 .WillRepeatedly(Return(mockFuture2));
     }
 
-    auto arbitrator = ArbitratorFactory::createArbitrator(
-            _domain, _interfaceName, version, _mockDiscovery, discoveryQos, _emptyGbidsVector);
+    auto arbitrator = ArbitratorFactory::createArbitrator(_singleThreadedIOService->getIOService(),
+                                                          _domain,
+                                                          _interfaceName,
+                                                          version,
+                                                          _mockDiscovery,
+                                                          discoveryQos,
+                                                          _emptyGbidsVector);
 
     auto onSuccess = [](const ArbitrationResult& arbitrationResult) {
         types::DiscoveryEntryWithMetaInfo result = arbitrationResult.getDiscoveryEntries().front();
@@ -2002,7 +2129,8 @@ TEST_P(ArbitratorTestWithParams, discoveryException_emptyResult)
         FAIL() << "Got result: " << result.toString();
     };
 
-    auto arbitrator = std::make_shared<Arbitrator>(_domain,
+    auto arbitrator = std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                   _domain,
                                                    _interfaceName,
                                                    expectedVersion,
                                                    _mockDiscovery,
@@ -2058,7 +2186,8 @@ void ArbitratorTest::testArbitrationStopsOnShutdown(bool testRetry)
     }
 
     auto arbitrator =
-            std::make_shared<joynr::Arbitrator>("domain",
+            std::make_shared<joynr::Arbitrator>(_singleThreadedIOService->getIOService(),
+                                                "domain",
                                                 interfaceName,
                                                 providerVersion,
                                                 _mockDiscovery,
@@ -2141,7 +2270,8 @@ TEST_F(ArbitratorTest, discoveryExceptionOnIncompatibleInterface)
     EXPECT_CALL(*_mockDiscovery, lookupAsyncMock(Matcher<const std::string&>(_), _, _, _, _, _, _))
             .WillOnce(Return(mockFuture));
     auto fixedParticipantArbitrator =
-            std::make_shared<Arbitrator>(_domain,
+            std::make_shared<Arbitrator>(_singleThreadedIOService->getIOService(),
+                                         _domain,
                                          _interfaceName,
                                          expectedVersion,
                                          _mockDiscovery,
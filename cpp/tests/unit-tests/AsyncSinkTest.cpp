@@ -0,0 +1,213 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/sink.h>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/AsyncSink.h"
+
+using namespace joynr;
+
+namespace
+{
+
+class CapturingSink : public spdlog::sinks::sink
+{
+public:
+    CapturingSink() : _mutex(), _isBlocked(false), _condition(), _payloads(), _numberOfFlushes(0)
+    {
+    }
+
+    void log(const spdlog::details::log_msg& msg) override
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return !_isBlocked; });
+        _payloads.emplace_back(msg.payload.data(), msg.payload.size());
+    }
+
+    void flush() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_numberOfFlushes;
+    }
+
+    void set_pattern(const std::string&) override
+    {
+    }
+
+    void set_formatter(std::unique_ptr<spdlog::formatter>) override
+    {
+    }
+
+    void setBlocked(bool isBlocked)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isBlocked = isBlocked;
+        }
+        _condition.notify_all();
+    }
+
+    std::vector<std::string> getPayloads()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _payloads;
+    }
+
+    std::size_t getNumberOfFlushes()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _numberOfFlushes;
+    }
+
+private:
+    std::mutex _mutex;
+    bool _isBlocked;
+    std::condition_variable _condition;
+    std::vector<std::string> _payloads;
+    std::size_t _numberOfFlushes;
+};
+
+} // namespace
+
+class AsyncSinkTest : public ::testing::Test
+{
+public:
+    AsyncSinkTest() : _capturingSink(std::make_shared<CapturingSink>())
+    {
+    }
+
+protected:
+    std::unique_ptr<AsyncSink> createAsyncSink(std::size_t queueSize,
+                                               AsyncSink::OverflowPolicy overflowPolicy)
+    {
+        return std::make_unique<AsyncSink>(
+                std::vector<spdlog::sink_ptr>{_capturingSink}, queueSize, overflowPolicy);
+    }
+
+    static void log(AsyncSink& asyncSink,
+                    spdlog::level::level_enum level,
+                    const std::string& payload)
+    {
+        asyncSink.log(spdlog::details::log_msg(
+                spdlog::source_loc{}, "AsyncSinkTest", level, spdlog::string_view_t(payload)));
+    }
+
+    std::shared_ptr<CapturingSink> _capturingSink;
+};
+
+TEST_F(AsyncSinkTest, capacityIsRoundedUpToPowerOfTwo)
+{
+    EXPECT_EQ(8u, createAsyncSink(5, AsyncSink::OverflowPolicy::Drop)->getCapacity());
+    EXPECT_EQ(16u, createAsyncSink(16, AsyncSink::OverflowPolicy::Drop)->getCapacity());
+}
+
+TEST_F(AsyncSinkTest, messagesAreWrittenInOrderOnFlush)
+{
+    auto asyncSink = createAsyncSink(64, AsyncSink::OverflowPolicy::Drop);
+    for (int i = 0; i < 10; ++i) {
+        log(*asyncSink, spdlog::level::info, std::to_string(i));
+    }
+    asyncSink->flush();
+
+    const std::vector<std::string> payloads = _capturingSink->getPayloads();
+    ASSERT_EQ(10u, payloads.size());
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(std::to_string(i), payloads[i]);
+    }
+    EXPECT_LE(1u, _capturingSink->getNumberOfFlushes());
+}
+
+TEST_F(AsyncSinkTest, dropPolicyDropsMessagesIfQueueIsFull)
+{
+    auto asyncSink = createAsyncSink(4, AsyncSink::OverflowPolicy::Drop);
+    _capturingSink->setBlocked(true);
+    for (int i = 0; i < 100; ++i) {
+        log(*asyncSink, spdlog::level::debug, std::to_string(i));
+    }
+    EXPECT_LE(100u - 2 * asyncSink->getCapacity(), asyncSink->getNumberOfDroppedMessages());
+    _capturingSink->setBlocked(false);
+    asyncSink->flush();
+
+    const std::vector<std::string> payloads = _capturingSink->getPayloads();
+    ASSERT_FALSE(payloads.empty());
+    EXPECT_NE(std::string::npos, payloads.back().find("log messages dropped"));
+}
+
+TEST_F(AsyncSinkTest, errorMessagesAreNeverDropped)
+{
+    auto asyncSink = createAsyncSink(4, AsyncSink::OverflowPolicy::Drop);
+    for (int i = 0; i < 1000; ++i) {
+        log(*asyncSink, spdlog::level::err, std::to_string(i));
+    }
+    asyncSink->flush();
+
+    EXPECT_EQ(0u, asyncSink->getNumberOfDroppedMessages());
+    EXPECT_EQ(1000u, _capturingSink->getPayloads().size());
+}
+
+TEST_F(AsyncSinkTest, blockPolicyDoesNotDropMessages)
+{
+    auto asyncSink = createAsyncSink(4, AsyncSink::OverflowPolicy::Block);
+    for (int i = 0; i < 1000; ++i) {
+        log(*asyncSink, spdlog::level::debug, std::to_string(i));
+    }
+    asyncSink->flush();
+
+    EXPECT_EQ(0u, asyncSink->getNumberOfDroppedMessages());
+    const std::vector<std::string> payloads = _capturingSink->getPayloads();
+    ASSERT_EQ(1000u, payloads.size());
+    EXPECT_EQ("999", payloads.back());
+}
+
+TEST_F(AsyncSinkTest, samplePolicyKeepsEveryNthMessageIfQueueIsFilling)
+{
+    auto asyncSink = createAsyncSink(1024, AsyncSink::OverflowPolicy::Sample);
+    _capturingSink->setBlocked(true);
+    const std::size_t numberOfMessages = 512 + 16 * AsyncSink::SAMPLE_RATE;
+    for (std::size_t i = 0; i < numberOfMessages; ++i) {
+        log(*asyncSink, spdlog::level::debug, std::to_string(i));
+    }
+    _capturingSink->setBlocked(false);
+    asyncSink->flush();
+
+    // the consumer may already have taken the first message before being blocked
+    const std::uint64_t numberOfDroppedMessages = asyncSink->getNumberOfDroppedMessages();
+    EXPECT_GE(16 * (AsyncSink::SAMPLE_RATE - 1), numberOfDroppedMessages);
+    EXPECT_LE(15 * (AsyncSink::SAMPLE_RATE - 1), numberOfDroppedMessages);
+}
+
+TEST_F(AsyncSinkTest, pendingMessagesAreWrittenOnDestruction)
+{
+    {
+        auto asyncSink = createAsyncSink(1024, AsyncSink::OverflowPolicy::Drop);
+        for (int i = 0; i < 100; ++i) {
+            log(*asyncSink, spdlog::level::info, std::to_string(i));
+        }
+    }
+    EXPECT_EQ(100u, _capturingSink->getPayloads().size());
+}
@@ -19,13 +19,16 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "tests/utils/Gtest.h"
 #include <gmock/gmock-matchers.h>
 
 #include "joynr/CapabilitiesStorage.h"
+#include "joynr/Metrics.h"
 #include "joynr/types/DiscoveryEntry.h"
 #include "joynr/types/DiscoveryQos.h"
 #include "joynr/types/Version.h"
@@ -82,6 +85,81 @@ TEST_F(LocalCapabilitiesStorageTest, insertWithGbids)
     EXPECT_TRUE(++it == storage.cend());
 }
 
+class CachingStorageTest : public CapabilitiesStorageTestBase
+{
+protected:
+    joynr::types::DiscoveryEntry createEntry(const std::string& participantIdParam) const
+    {
+        return joynr::types::DiscoveryEntry(version,
+                                            domain,
+                                            interface,
+                                            participantIdParam,
+                                            types::ProviderQos(),
+                                            1000,
+                                            10000,
+                                            "publicKeyId");
+    }
+};
+
+TEST_F(CachingStorageTest, newlyInsertedEntryIsNotEvicted)
+{
+    auto evictionCounter = std::make_shared<metrics::Counter>();
+    capabilities::CachingStorage storage(1, evictionCounter);
+    storage.insert(createEntry("participantId1"));
+    storage.insert(createEntry("participantId2"));
+
+    ASSERT_EQ(1, storage.size());
+    EXPECT_FALSE(storage.lookupByParticipantId("participantId1").is_initialized());
+    EXPECT_TRUE(storage.lookupByParticipantId("participantId2").is_initialized());
+    EXPECT_EQ(1, evictionCounter->getValue());
+}
+
+TEST_F(CachingStorageTest, evictsLeastRecentlyUsedEntryWhenFull)
+{
+    auto evictionCounter = std::make_shared<metrics::Counter>();
+    capabilities::CachingStorage storage(2, evictionCounter);
+    storage.insert(createEntry("participantId1"));
+    storage.insert(createEntry("participantId2"));
+
+    // participantId1 is older but was used recently
+    EXPECT_TRUE(storage.lookupCacheByParticipantId("participantId1", std::chrono::hours(1))
+                        .is_initialized());
+    storage.insert(createEntry("participantId3"));
+
+    ASSERT_EQ(2, storage.size());
+    EXPECT_TRUE(storage.lookupByParticipantId("participantId1").is_initialized());
+    EXPECT_FALSE(storage.lookupByParticipantId("participantId2").is_initialized());
+    EXPECT_TRUE(storage.lookupByParticipantId("participantId3").is_initialized());
+    EXPECT_EQ(1, evictionCounter->getValue());
+}
+
+TEST_F(CachingStorageTest, evictionCallbackReceivesParticipantIdOfEvictedEntry)
+{
+    std::vector<std::string> evictedParticipantIds;
+    capabilities::CachingStorage storage(
+            1, nullptr, [&evictedParticipantIds](const std::string& evictedParticipantId) {
+                evictedParticipantIds.push_back(evictedParticipantId);
+            });
+    storage.insert(createEntry("participantId1"));
+    storage.insert(createEntry("participantId1"));
+    EXPECT_TRUE(evictedParticipantIds.empty());
+
+    storage.insert(createEntry("participantId2"));
+    EXPECT_EQ(std::vector<std::string>{"participantId1"}, evictedParticipantIds);
+}
+
+TEST_F(CachingStorageTest, replacingAnEntryDoesNotEvict)
+{
+    auto evictionCounter = std::make_shared<metrics::Counter>();
+    capabilities::CachingStorage storage(2, evictionCounter);
+    storage.insert(createEntry("participantId1"));
+    storage.insert(createEntry("participantId2"));
+    storage.insert(createEntry("participantId1"));
+
+    EXPECT_EQ(2, storage.size());
+    EXPECT_EQ(0, evictionCounter->getValue());
+}
+
 template <typename Storage>
 class CapabilitiesStorageTest : public CapabilitiesStorageTestBase
 {
@@ -180,3 +258,52 @@ TYPED_TEST(CapabilitiesStorageTest, removeExpiredEntries)
     EXPECT_THAT(removedEntries, Contains(entry1));
     EXPECT_THAT(removedEntries, Not(Contains(entry2)));
 }
+
+TYPED_TEST(CapabilitiesStorageTest, removeExpiredEntriesInBatchesEarliestFirst)
+{
+    TypeParam storage;
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::system_clock::now().time_since_epoch())
+                       .count();
+
+    joynr::types::DiscoveryEntry entry1(this->version,
+                                        this->domain,
+                                        "interface1",
+                                        "participantId1",
+                                        types::ProviderQos(),
+                                        0,
+                                        now - 300,
+                                        "publicKeyId");
+    joynr::types::DiscoveryEntry entry2(this->version,
+                                        this->domain,
+                                        "interface2",
+                                        "participantId2",
+                                        types::ProviderQos(),
+                                        0,
+                                        now - 200,
+                                        "publicKeyId");
+    joynr::types::DiscoveryEntry entry3(this->version,
+                                        this->domain,
+                                        "interface3",
+                                        "participantId3",
+                                        types::ProviderQos(),
+                                        0,
+                                        now + 10000,
+                                        "publicKeyId");
+
+    storage.insert(entry3);
+    storage.insert(entry2);
+    storage.insert(entry1);
+
+    auto removedEntries = storage.removeExpired(1);
+    ASSERT_EQ(1, removedEntries.size());
+    EXPECT_EQ(entry1, removedEntries[0]);
+
+    removedEntries = storage.removeExpired(1);
+    ASSERT_EQ(1, removedEntries.size());
+    EXPECT_EQ(entry2, removedEntries[0]);
+
+    removedEntries = storage.removeExpired(1);
+    EXPECT_TRUE(removedEntries.empty());
+    EXPECT_EQ(1, storage.size());
+}
@@ -1054,6 +1054,37 @@ TEST_F(CcMessageRouterTest, routingTableGetsCleaned)
     EXPECT_TRUE(successCallbackCalled.waitFor(std::chrono::milliseconds(3000)));
 }
 
+TEST_F(CcMessageRouterTest, addNextHops_addsAllParticipantsWhichAreResolvedByResolveNextHops)
+{
+    const std::vector<std::string> participantIds{"participantId1", "participantId2"};
+    const std::string unknownParticipantId("unknownParticipantId");
+    const system::RoutingTypes::WebSocketClientAddress webSocketClientAddress("testClientId");
+    const bool isGloballyVisible = false;
+
+    Semaphore addNextHopsDone(0);
+    _messageRouter->addNextHops(
+            participantIds,
+            webSocketClientAddress,
+            isGloballyVisible,
+            [&addNextHopsDone]() { addNextHopsDone.notify(); },
+            [](const joynr::exceptions::ProviderRuntimeException& exception) {
+                FAIL() << "addNextHops did not succeed: " << exception.getMessage();
+            });
+    EXPECT_TRUE(addNextHopsDone.waitFor(std::chrono::milliseconds(1000)));
+
+    Semaphore resolveNextHopsDone(0);
+    _messageRouter->resolveNextHops(
+            {participantIds[0], unknownParticipantId, participantIds[1]},
+            [&resolveNextHopsDone](const std::vector<bool>& resolved) {
+                EXPECT_EQ(std::vector<bool>({true, false, true}), resolved);
+                resolveNextHopsDone.notify();
+            },
+            [](const joynr::exceptions::ProviderRuntimeException& exception) {
+                FAIL() << "resolveNextHops did not succeed: " << exception.getMessage();
+            });
+    EXPECT_TRUE(resolveNextHopsDone.waitFor(std::chrono::milliseconds(1000)));
+}
+
 void CcMessageRouterTest::routeMessageAndCheckQueue(const std::string& msgType,
                                                     bool msgShouldBeQueued)
 {
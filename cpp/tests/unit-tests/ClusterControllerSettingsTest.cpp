@@ -123,6 +123,18 @@ TEST(ClusterControllerSettingsTest, transportNotAvailableQueueLimitBytesIsSet)
               std::uint64_t(52428800));
 }
 
+TEST(ClusterControllerSettingsTest, messageQueueSpillSettingsAreSet)
+{
+    Settings testSettings("test-resources/CCSettingsWithMessageQueueLimit.settings");
+    ASSERT_TRUE(testSettings.isLoaded());
+
+    ClusterControllerSettings clusterControllerSettings(testSettings);
+
+    EXPECT_EQ(clusterControllerSettings.getMessageQueueSpillDirectory(), "/tmp/joynr-spill");
+    EXPECT_EQ(clusterControllerSettings.getMessageQueueSpillLimitBytes(),
+              std::uint64_t(1073741824));
+}
+
 TEST(ClusterControllerSettingsTest, globalCapabilitiesDirectoryCompressedMessagesEnabledIsSet)
 {
     Settings testSettings("test-resources/CCSettingsWithGlobalDiscovery.settings");
@@ -207,6 +219,35 @@ TEST(ClusterControllerSettingsTest, defaultTransportNotAvailableQueueLimitBytesI
               ClusterControllerSettings::DEFAULT_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT_BYTES());
 }
 
+TEST(ClusterControllerSettingsTest, defaultMessageQueueSpillSettingsAreSet)
+{
+    Settings settings;
+    ClusterControllerSettings clusterControllerSettings(settings);
+
+    EXPECT_EQ(clusterControllerSettings.getMessageQueueSpillDirectory(),
+              ClusterControllerSettings::DEFAULT_MESSAGE_QUEUE_SPILL_DIRECTORY());
+    EXPECT_EQ(clusterControllerSettings.getMessageQueueSpillLimitBytes(),
+              ClusterControllerSettings::DEFAULT_MESSAGE_QUEUE_SPILL_LIMIT_BYTES());
+}
+
+TEST(ClusterControllerSettingsTest, defaultStartupMaxParallelismIsSet)
+{
+    Settings settings;
+    ClusterControllerSettings clusterControllerSettings(settings);
+
+    EXPECT_EQ(clusterControllerSettings.getStartupMaxParallelism(),
+              ClusterControllerSettings::DEFAULT_STARTUP_MAX_PARALLELISM());
+}
+
+TEST(ClusterControllerSettingsTest, defaultGlobalLookupCacheMaxEntriesIsSet)
+{
+    Settings settings;
+    ClusterControllerSettings clusterControllerSettings(settings);
+
+    EXPECT_EQ(clusterControllerSettings.getGlobalLookupCacheMaxEntries(),
+              ClusterControllerSettings::DEFAULT_GLOBAL_LOOKUP_CACHE_MAX_ENTRIES());
+}
+
 TEST(ClusterControllerSettingsTest,
      defaultGlobalCapabilitiesDirectoryCompressedMessagesEnabledIsSet)
 {
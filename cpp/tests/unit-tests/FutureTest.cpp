@@ -16,7 +16,11 @@
  * limitations under the License.
  * #L%
  */
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "tests/utils/Gmock.h"
 #include "tests/utils/Gtest.h"
@@ -177,3 +181,112 @@ TEST_F(FutureTest, waitForFinishWithTimerForVoid)
         EXPECT_EQ(StatusCodeEnum::WAIT_TIMED_OUT, voidFuture.getStatus());
     }
 }
+
+TEST_F(FutureTest, thenContinuationIsInvokedWhenResultIsReceived)
+{
+    int continuationValue = 0;
+    std::size_t errorCount = 0;
+    intFuture.then([&continuationValue](const int& value) { continuationValue = value; })
+            ->catchError([&errorCount](const exceptions::JoynrException&) { errorCount++; });
+    EXPECT_EQ(0, continuationValue);
+
+    intFuture.onSuccess(10);
+    EXPECT_EQ(10, continuationValue);
+    EXPECT_EQ(0, errorCount);
+}
+
+TEST_F(FutureTest, thenContinuationIsInvokedImmediatelyIfResultIsAlreadyAvailable)
+{
+    intFuture.onSuccess(10);
+
+    int continuationValue = 0;
+    intFuture.then([&continuationValue](const int& value) { continuationValue = value; });
+    EXPECT_EQ(10, continuationValue);
+}
+
+TEST_F(FutureTest, catchErrorContinuationIsInvokedWhenFailureIsReceived)
+{
+    std::size_t successCount = 0;
+    std::string errorMessage;
+    voidFuture.catchError([&errorMessage](const exceptions::JoynrException& error) {
+        errorMessage = error.getMessage();
+    });
+    voidFuture.then([&successCount]() { successCount++; });
+
+    voidFuture.onError(
+            std::make_shared<exceptions::ProviderRuntimeException>("exceptionMessageVoidFuture"));
+    EXPECT_EQ("exceptionMessageVoidFuture", errorMessage);
+    EXPECT_EQ(0, successCount);
+
+    // continuations registered after completion are invoked immediately
+    errorMessage.clear();
+    voidFuture.catchError([&errorMessage](const exceptions::JoynrException& error) {
+        errorMessage = error.getMessage();
+    });
+    EXPECT_EQ("exceptionMessageVoidFuture", errorMessage);
+}
+
+TEST_F(FutureTest, thenReturnsFutureForResultOfContinuation)
+{
+    std::shared_ptr<Future<std::string>> stringFuture =
+            intFuture.then([](const int& value) { return std::to_string(value * 2); });
+    std::shared_ptr<Future<void>> chainedFuture =
+            stringFuture->then([](const std::string& value) { EXPECT_EQ("20", value); });
+    EXPECT_EQ(StatusCodeEnum::IN_PROGRESS, stringFuture->getStatus());
+
+    intFuture.onSuccess(10);
+    std::string result;
+    stringFuture->get(result);
+    EXPECT_EQ("20", result);
+    EXPECT_TRUE(chainedFuture->isOk());
+}
+
+TEST_F(FutureTest, futureReturnedByThenFailsWithErrorOfPreviousFuture)
+{
+    std::size_t successCount = 0;
+    std::string errorMessage;
+    auto chainedFuture = voidFuture.then([&successCount]() {
+        successCount++;
+        return 1;
+    });
+    chainedFuture->catchError([&errorMessage](const exceptions::JoynrException& error) {
+        errorMessage = error.getMessage();
+    });
+
+    voidFuture.onError(
+            std::make_shared<exceptions::ProviderRuntimeException>("exceptionMessageVoidFuture"));
+    EXPECT_EQ(0, successCount);
+    EXPECT_EQ("exceptionMessageVoidFuture", errorMessage);
+    EXPECT_EQ(StatusCodeEnum::ERROR, chainedFuture->getStatus());
+    int result;
+    EXPECT_THROW(chainedFuture->get(result), exceptions::ProviderRuntimeException);
+}
+
+TEST_F(FutureTest, futureReturnedByThenFailsWithExceptionOfContinuation)
+{
+    auto chainedFuture = intFuture.then([](const int&) -> int {
+        throw exceptions::JoynrRuntimeException("exceptionMessageContinuation");
+    });
+
+    intFuture.onSuccess(10);
+    EXPECT_EQ(StatusCodeEnum::ERROR, chainedFuture->getStatus());
+    int result;
+    EXPECT_THROW(chainedFuture->get(result), exceptions::JoynrRuntimeException);
+}
+
+TEST_F(FutureTest, continuationIsRunByGivenExecutor)
+{
+    std::vector<std::function<void()>> queuedTasks;
+    auto executor = [&queuedTasks](std::function<void()> task) {
+        queuedTasks.push_back(std::move(task));
+    };
+    std::size_t successCount = 0;
+    voidFuture.then([&successCount]() { successCount++; }, executor);
+
+    voidFuture.onSuccess();
+    ASSERT_EQ(1, queuedTasks.size());
+    EXPECT_EQ(0, successCount);
+
+    queuedTasks.front()();
+    EXPECT_EQ(1, successCount);
+}
@@ -16,6 +16,7 @@
  * limitations under the License.
  * #L%
  */
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -29,6 +30,7 @@
 #include "joynr/MessagingSettings.h"
 #include "joynr/Settings.h"
 #include "joynr/StatusCode.h"
+#include "joynr/exceptions/MethodInvocationException.h"
 #include "libjoynrclustercontroller/capabilities-directory/GlobalCapabilitiesDirectoryClient.h"
 #include "tests/JoynrTest.h"
 #include "tests/mock/MockGlobalCapabilitiesDirectoryProxy.h"
@@ -86,6 +88,7 @@ public:
                                    capPublicKeyId,
                                    capSerializedMqttAddress),
               mockFuture(std::make_shared<joynr::Future<void>>()),
+              mockMultipleFuture(std::make_shared<joynr::Future<std::vector<std::string>>>()),
               onSuccess([]() {}),
               onError([](const types::DiscoveryError::Enum& /*error*/) {}),
               onRuntimeError([](const exceptions::JoynrRuntimeException& /*error*/) {})
@@ -139,6 +142,7 @@ protected:
     joynr::types::Version providerVersion;
     types::GlobalDiscoveryEntry globalDiscoveryEntry;
     std::shared_ptr<joynr::Future<void>> mockFuture;
+    std::shared_ptr<joynr::Future<std::vector<std::string>>> mockMultipleFuture;
     std::function<void()> onSuccess;
     std::function<void(const types::DiscoveryError::Enum& error)> onError;
     std::function<void(const exceptions::JoynrRuntimeException& error)> onRuntimeError;
@@ -277,12 +281,14 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
     EXPECT_CALL(*mockLCDStore, getAllGlobalCapabilities()).WillOnce(Return(allGlobalEntries));
 
     EXPECT_CALL(*mockLCDStore,
-                getGbidsForParticipantId(Eq(globalDiscoveryEntry1.getParticipantId()), _))
+                getGbidsForParticipantId(Eq(globalDiscoveryEntry1.getParticipantId()),
+                                         A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(Return(gbids));
 
     EXPECT_CALL(*mockLCDStore,
-                getGbidsForParticipantId(Eq(globalDiscoveryEntry2.getParticipantId()), _))
+                getGbidsForParticipantId(Eq(globalDiscoveryEntry2.getParticipantId()),
+                                         A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(Return(gbids));
 
@@ -371,17 +377,20 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
     EXPECT_CALL(*mockLCDStore, getAllGlobalCapabilities()).WillOnce(Return(allGlobalEntries));
 
     EXPECT_CALL(*mockLCDStore,
-                getGbidsForParticipantId(Eq(globalDiscoveryEntry1.getParticipantId()), _))
+                getGbidsForParticipantId(Eq(globalDiscoveryEntry1.getParticipantId()),
+                                         A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(Return(gbids));
 
     EXPECT_CALL(*mockLCDStore,
-                getGbidsForParticipantId(Eq(globalDiscoveryEntry2.getParticipantId()), _))
+                getGbidsForParticipantId(Eq(globalDiscoveryEntry2.getParticipantId()),
+                                         A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(Return(gbids));
 
     EXPECT_CALL(*mockLCDStore,
-                getGbidsForParticipantId(Eq(globalDiscoveryEntry3.getParticipantId()), _))
+                getGbidsForParticipantId(Eq(globalDiscoveryEntry3.getParticipantId()),
+                                         A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(Return(gbids));
 
@@ -476,7 +485,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
 
     EXPECT_CALL(*mockLCDStore, getAllGlobalCapabilities()).WillOnce(Return(allGlobalEntries));
 
-    EXPECT_CALL(*mockLCDStore, getGbidsForParticipantId(_, _)).Times(0);
+    EXPECT_CALL(*mockLCDStore, getGbidsForParticipantId(_, A<const ReentrantReadLocker&>()))
+            .Times(0);
 
     EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy, addAsyncMock(_, _, _, _, _, _)).Times(0);
 
@@ -522,12 +532,14 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testReAddTask_entryWithoutGbids_re
 
     std::vector<std::string> emptyGbids{};
     EXPECT_CALL(*mockLCDStore,
-                getGbidsForParticipantId(Eq(globalDiscoveryEntry1.getParticipantId()), _))
+                getGbidsForParticipantId(Eq(globalDiscoveryEntry1.getParticipantId()),
+                                         A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(Return(emptyGbids));
 
     EXPECT_CALL(*mockLCDStore,
-                getGbidsForParticipantId(Eq(globalDiscoveryEntry2.getParticipantId()), _))
+                getGbidsForParticipantId(Eq(globalDiscoveryEntry2.getParticipantId()),
+                                         A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(Return(gbids));
 
@@ -792,8 +804,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemove)
     std::shared_ptr<joynr::MessagingQos> messagingQosCapture;
     auto semaphore = std::make_shared<Semaphore>();
 
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(gbids)));
 
@@ -844,8 +856,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveUsesCorrectTtl)
     std::shared_ptr<joynr::MessagingQos> messagingQosCapture;
     auto semaphore = std::make_shared<Semaphore>();
 
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(gbids)));
 
@@ -869,8 +881,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveNoRetryAfterSuccess)
     std::function<void()> onSuccessCallback;
     auto semaphore = std::make_shared<Semaphore>();
 
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(gbids)));
     EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
@@ -894,8 +906,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveRetryAfterTimeout)
     auto semaphore = std::make_shared<Semaphore>();
     constexpr unsigned int numberOfTimeouts = 10;
 
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(numberOfTimeouts + 1)
             .WillRepeatedly(DoAll(ReleaseSemaphore(semaphore), Return(gbids)));
     EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
@@ -925,8 +937,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveNoRetryAfterRuntimeExcep
     std::function<void(const exceptions::JoynrRuntimeException&)> onRuntimeErrorCallback;
     auto semaphore = std::make_shared<Semaphore>();
 
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(gbids)));
 
@@ -950,8 +962,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveNoRetryAfterApplicationE
     std::function<void(const types::DiscoveryError::Enum&)> onApplicationErrorCallback;
     auto semaphore = std::make_shared<Semaphore>();
 
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(gbids)));
 
@@ -974,8 +986,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveDeletionWhileRetry)
 {
     std::function<void(const exceptions::JoynrRuntimeException&)> onRuntimeErrorCallback;
     auto semaphore = std::make_shared<Semaphore>();
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(2)
             .WillRepeatedly(DoAll(ReleaseSemaphore(semaphore), Return(gbids)));
     EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
@@ -1000,8 +1012,8 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveParticipantNotRegistered
     std::vector<std::string> expectedGbids;
     auto lcdStoreSemaphore = std::make_shared<Semaphore>();
 
-    EXPECT_CALL(
-            *mockLocalCapabilitiesDirectoryStore, getGbidsForParticipantId(Eq(capParticipantId), _))
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(Eq(capParticipantId), A<const ReentrantReadLocker&>()))
             .Times(1)
             .WillOnce(DoAll(ReleaseSemaphore(lcdStoreSemaphore), Return(expectedGbids)));
 
@@ -1017,6 +1029,367 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveParticipantNotRegistered
     ASSERT_TRUE(lcdStoreSemaphore->waitFor(std::chrono::seconds(10)));
 }
 
+TEST_F(GlobalCapabilitiesDirectoryClientTest, testPendingAddsForSameGbidsAreSentInOneRequest)
+{
+    std::function<void()> firstOnSuccessCallback;
+    std::function<void(const std::vector<std::string>&)> batchOnSuccessCallback;
+    std::shared_ptr<joynr::MessagingQos> messagingQosCapture;
+    auto semaphore = std::make_shared<Semaphore>();
+    std::atomic_size_t onSuccessCalls(0);
+    auto countingOnSuccess = [&onSuccessCalls]() { onSuccessCalls++; };
+
+    std::vector<types::GlobalDiscoveryEntry> pendingEntries;
+    for (int i = 1; i <= 3; i++) {
+        types::GlobalDiscoveryEntry pendingEntry(globalDiscoveryEntry);
+        pendingEntry.setParticipantId("participantId" + std::to_string(i));
+        pendingEntries.push_back(pendingEntry);
+    }
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&firstOnSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addMultipleAsyncMock(Eq(pendingEntries), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&batchOnSuccessCallback),
+                            SaveArg<5>(&messagingQosCapture),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockMultipleFuture)));
+
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, false, gbids, countingOnSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    // the first request is still running, the following adds have to be merged
+    for (const auto& pendingEntry : pendingEntries) {
+        globalCapabilitiesDirectoryClient->add(
+                pendingEntry, false, gbids, countingOnSuccess, onError, onRuntimeError);
+    }
+    firstOnSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    testMessagingQosForCustomHeaderGbidKey(gbids[0], messagingQosCapture);
+
+    batchOnSuccessCallback({});
+    EXPECT_EQ(4u, onSuccessCalls.load());
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest, testFailedEntriesOfBatchAddAreAddedIndividually)
+{
+    std::function<void()> firstOnSuccessCallback;
+    std::function<void(const std::vector<std::string>&)> batchOnSuccessCallback;
+    std::function<void(const types::DiscoveryError::Enum&)> singleOnErrorCallback;
+    auto semaphore = std::make_shared<Semaphore>();
+    std::atomic_size_t onSuccessCalls(0);
+    auto countingOnSuccess = [&onSuccessCalls]() { onSuccessCalls++; };
+    std::atomic_size_t onErrorCalls(0);
+    auto countingOnError = [&onErrorCalls](const types::DiscoveryError::Enum& error) {
+        EXPECT_EQ(types::DiscoveryError::INTERNAL_ERROR, error);
+        onErrorCalls++;
+    };
+
+    types::GlobalDiscoveryEntry globalDiscoveryEntry2(globalDiscoveryEntry);
+    globalDiscoveryEntry2.setParticipantId("participantId2");
+    types::GlobalDiscoveryEntry globalDiscoveryEntry3(globalDiscoveryEntry);
+    globalDiscoveryEntry3.setParticipantId("participantId3");
+    const std::vector<types::GlobalDiscoveryEntry> pendingEntries{
+            globalDiscoveryEntry2, globalDiscoveryEntry3};
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&firstOnSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addMultipleAsyncMock(Eq(pendingEntries), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&batchOnSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockMultipleFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry2), _, _, _, _, _))
+            .Times(0);
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry3), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<3>(&singleOnErrorCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, false, gbids, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    for (const auto& pendingEntry : pendingEntries) {
+        globalCapabilitiesDirectoryClient->add(
+                pendingEntry, false, gbids, countingOnSuccess, countingOnError, onRuntimeError);
+    }
+    firstOnSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    // the failed entry is sent again with the single add to report its DiscoveryError
+    batchOnSuccessCallback({globalDiscoveryEntry3.getParticipantId()});
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    EXPECT_EQ(1u, onSuccessCalls.load());
+    EXPECT_EQ(0u, onErrorCalls.load());
+
+    singleOnErrorCallback(types::DiscoveryError::INTERNAL_ERROR);
+    EXPECT_EQ(1u, onSuccessCalls.load());
+    EXPECT_EQ(1u, onErrorCalls.load());
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest, testBatchAddApplicationErrorIsForwardedToAllEntries)
+{
+    std::function<void()> firstOnSuccessCallback;
+    std::function<void(const types::DiscoveryError::Enum&)> batchOnErrorCallback;
+    auto semaphore = std::make_shared<Semaphore>();
+    std::atomic_size_t onErrorCalls(0);
+    auto countingOnError = [&onErrorCalls](const types::DiscoveryError::Enum& error) {
+        EXPECT_EQ(types::DiscoveryError::UNKNOWN_GBID, error);
+        onErrorCalls++;
+    };
+
+    types::GlobalDiscoveryEntry globalDiscoveryEntry2(globalDiscoveryEntry);
+    globalDiscoveryEntry2.setParticipantId("participantId2");
+    types::GlobalDiscoveryEntry globalDiscoveryEntry3(globalDiscoveryEntry);
+    globalDiscoveryEntry3.setParticipantId("participantId3");
+    const std::vector<types::GlobalDiscoveryEntry> pendingEntries{
+            globalDiscoveryEntry2, globalDiscoveryEntry3};
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&firstOnSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addMultipleAsyncMock(Eq(pendingEntries), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<3>(&batchOnErrorCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockMultipleFuture)));
+
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, false, gbids, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    for (const auto& pendingEntry : pendingEntries) {
+        globalCapabilitiesDirectoryClient->add(
+                pendingEntry, false, gbids, onSuccess, countingOnError, onRuntimeError);
+    }
+    firstOnSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    batchOnErrorCallback(types::DiscoveryError::UNKNOWN_GBID);
+    EXPECT_EQ(2u, onErrorCalls.load());
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest, testFailedBatchAddIsRetriedWithIndividualRequests)
+{
+    std::function<void()> firstOnSuccessCallback;
+    std::function<void(const exceptions::JoynrRuntimeException&)> batchOnRuntimeErrorCallback;
+    auto semaphore = std::make_shared<Semaphore>();
+
+    types::GlobalDiscoveryEntry globalDiscoveryEntry2(globalDiscoveryEntry);
+    globalDiscoveryEntry2.setParticipantId("participantId2");
+    types::GlobalDiscoveryEntry globalDiscoveryEntry3(globalDiscoveryEntry);
+    globalDiscoveryEntry3.setParticipantId("participantId3");
+    const std::vector<types::GlobalDiscoveryEntry> pendingEntries{
+            globalDiscoveryEntry2, globalDiscoveryEntry3};
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&firstOnSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addMultipleAsyncMock(Eq(pendingEntries), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<4>(&batchOnRuntimeErrorCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockMultipleFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry2), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry3), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(mockFuture)));
+
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, false, gbids, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    for (const auto& pendingEntry : pendingEntries) {
+        globalCapabilitiesDirectoryClient->add(
+                pendingEntry, false, gbids, onSuccess, onError, onRuntimeError);
+    }
+    firstOnSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    batchOnRuntimeErrorCallback(exceptions::JoynrRuntimeException("Test exception"));
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest, testBatchAddFallsBackToSingleAddsForOldGcd)
+{
+    std::function<void()> firstOnSuccessCallback;
+    std::function<void(const exceptions::JoynrRuntimeException&)> batchOnRuntimeErrorCallback;
+    std::vector<std::function<void()>> singleOnSuccessCallbacks;
+    singleOnSuccessCallbacks.reserve(4);
+    auto semaphore = std::make_shared<Semaphore>();
+
+    std::vector<types::GlobalDiscoveryEntry> pendingEntries;
+    for (int i = 1; i <= 4; i++) {
+        types::GlobalDiscoveryEntry pendingEntry(globalDiscoveryEntry);
+        pendingEntry.setParticipantId("participantId" + std::to_string(i));
+        pendingEntries.push_back(pendingEntry);
+    }
+    const std::vector<types::GlobalDiscoveryEntry> firstBatch{
+            pendingEntries[0], pendingEntries[1]};
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&firstOnSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    // only the first batch is sent with addMultiple
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addMultipleAsyncMock(Eq(firstBatch), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<4>(&batchOnRuntimeErrorCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockMultipleFuture)));
+    for (const auto& pendingEntry : pendingEntries) {
+        EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                    addAsyncMock(Eq(pendingEntry), Eq(gbids), _, _, _, _))
+                .WillOnce(DoAll(Invoke([&singleOnSuccessCallbacks](
+                                               const types::GlobalDiscoveryEntry&,
+                                               const std::vector<std::string>&,
+                                               std::function<void()> onSuccessCallback,
+                                               std::function<void(
+                                                       const types::DiscoveryError::Enum&)>,
+                                               std::function<void(
+                                                       const exceptions::JoynrRuntimeException&)>,
+                                               std::shared_ptr<MessagingQos>) {
+                                    singleOnSuccessCallbacks.push_back(onSuccessCallback);
+                                }),
+                                ReleaseSemaphore(semaphore),
+                                Return(mockFuture)));
+    }
+
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, false, gbids, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    for (const auto& pendingEntry : firstBatch) {
+        globalCapabilitiesDirectoryClient->add(
+                pendingEntry, false, gbids, onSuccess, onError, onRuntimeError);
+    }
+    firstOnSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    batchOnRuntimeErrorCallback(exceptions::MethodInvocationException("unknown method"));
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    // the next batch is sent with single adds right away
+    globalCapabilitiesDirectoryClient->add(
+            pendingEntries[2], false, gbids, onSuccess, onError, onRuntimeError);
+    globalCapabilitiesDirectoryClient->add(
+            pendingEntries[3], false, gbids, onSuccess, onError, onRuntimeError);
+    ASSERT_EQ(2u, singleOnSuccessCallbacks.size());
+    auto firstSingleOnSuccessCallback = singleOnSuccessCallbacks[0];
+    auto secondSingleOnSuccessCallback = singleOnSuccessCallbacks[1];
+    firstSingleOnSuccessCallback();
+    secondSingleOnSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest, testPendingRemovesForSameGbidsAreSentInOneRequest)
+{
+    const std::vector<std::string> pendingParticipantIds{
+            "participantId1", "participantId2", "participantId3"};
+    std::function<void()> firstOnSuccessCallback;
+    std::function<void(const std::vector<std::string>&)> batchOnSuccessCallback;
+    std::function<void(const types::DiscoveryError::Enum&)> singleOnErrorCallback;
+    std::shared_ptr<joynr::MessagingQos> messagingQosCapture;
+    auto semaphore = std::make_shared<Semaphore>();
+    std::atomic_size_t onSuccessCalls(0);
+    auto countingOnSuccess = [&onSuccessCalls]() { onSuccessCalls++; };
+    std::atomic_size_t onErrorCalls(0);
+    auto countingOnError = [&onErrorCalls](const types::DiscoveryError::Enum& error) {
+        EXPECT_EQ(types::DiscoveryError::NO_ENTRY_FOR_SELECTED_BACKENDS, error);
+        onErrorCalls++;
+    };
+
+    EXPECT_CALL(*mockLocalCapabilitiesDirectoryStore,
+                getGbidsForParticipantId(_, A<const ReentrantReadLocker&>()))
+            .WillRepeatedly(Return(gbids));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                removeAsyncMock(Eq(capParticipantId), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&firstOnSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                removeMultipleAsyncMock(Eq(pendingParticipantIds), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&batchOnSuccessCallback),
+                            SaveArg<5>(&messagingQosCapture),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockMultipleFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                removeAsyncMock(Eq(pendingParticipantIds[1]), Eq(gbids), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<3>(&singleOnErrorCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+
+    globalCapabilitiesDirectoryClient->remove(capParticipantId,
+                                              mockLocalCapabilitiesDirectoryStore,
+                                              countingOnSuccess,
+                                              onError,
+                                              onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    for (const auto& participantId : pendingParticipantIds) {
+        globalCapabilitiesDirectoryClient->remove(participantId,
+                                                  mockLocalCapabilitiesDirectoryStore,
+                                                  countingOnSuccess,
+                                                  countingOnError,
+                                                  onRuntimeError);
+    }
+    firstOnSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    testMessagingQosForCustomHeaderGbidKey(gbids[0], messagingQosCapture);
+
+    // the failed participantId is removed again individually to report its DiscoveryError
+    batchOnSuccessCallback({pendingParticipantIds[1]});
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    EXPECT_EQ(3u, onSuccessCalls.load());
+
+    singleOnErrorCallback(types::DiscoveryError::NO_ENTRY_FOR_SELECTED_BACKENDS);
+    EXPECT_EQ(3u, onSuccessCalls.load());
+    EXPECT_EQ(1u, onErrorCalls.load());
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest, testOperationsAreOnlyMergedWithDirectPredecessor)
+{
+    std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
+            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+    auto mockTaskSequencerRef = mockTaskSequencer.get();
+    std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
+            std::make_shared<GlobalCapabilitiesDirectoryClient>(
+                    clusterControllerSettings, std::move(mockTaskSequencer));
+    const std::vector<std::string> singleGbid{gbids[0]};
+
+    // add, add with several GBIDs | remove, remove | add | add with awaitGlobalRegistration | add
+    EXPECT_CALL(*mockTaskSequencerRef, add(_)).Times(5);
+
+    gcdClient->add(globalDiscoveryEntry, false, singleGbid, onSuccess, onError, onRuntimeError);
+    gcdClient->add(globalDiscoveryEntry, false, gbids, onSuccess, onError, onRuntimeError);
+    gcdClient->remove(capParticipantId,
+                      mockLocalCapabilitiesDirectoryStore,
+                      onSuccess,
+                      onError,
+                      onRuntimeError);
+    gcdClient->remove(capParticipantId,
+                      mockLocalCapabilitiesDirectoryStore,
+                      onSuccess,
+                      onError,
+                      onRuntimeError);
+    gcdClient->add(globalDiscoveryEntry, false, singleGbid, onSuccess, onError, onRuntimeError);
+    gcdClient->add(globalDiscoveryEntry, true, gbids, onSuccess, onError, onRuntimeError);
+    gcdClient->add(globalDiscoveryEntry, false, singleGbid, onSuccess, onError, onRuntimeError);
+}
+
 TEST_F(GlobalCapabilitiesDirectoryClientTest, testTouch)
 {
     std::shared_ptr<joynr::MessagingQos> messagingQosCapture;
@@ -40,12 +40,15 @@ TEST(IUdsSenderTest, mockIUdsSenderAPIsCanBeCalled)
     EXPECT_CALL(
             *mockIUdsSender,
             send(A<const smrf::ByteArrayView&>(),
-                 A<const std::function<void(const joynr::exceptions::JoynrRuntimeException&)>&>()));
+                 A<const std::function<void(const joynr::exceptions::JoynrRuntimeException&)>&>(),
+                 A<IUdsSender::Priority>()));
     std::shared_ptr<IUdsSender> iUdsSender = mockIUdsSender;
 
     EXPECT_CALL(*mockIUdsSender, dtorCalled()).Times(1);
-    iUdsSender->send(byteArrayView, [](const exceptions::JoynrRuntimeException& error) {
-        std::ignore = error;
-        FAIL() << "onError callback invoked";
-    });
+    iUdsSender->send(byteArrayView,
+                     [](const exceptions::JoynrRuntimeException& error) {
+                         std::ignore = error;
+                         FAIL() << "onError callback invoked";
+                     },
+                     IUdsSender::Priority::NORMAL);
 }
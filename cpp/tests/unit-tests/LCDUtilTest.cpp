@@ -19,7 +19,6 @@
 #include "tests/utils/Gmock.h"
 #include "tests/utils/Gtest.h"
 
-#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -27,6 +26,7 @@
 #include <boost/optional.hpp>
 
 #include "joynr/LCDUtil.h"
+#include "joynr/ReentrantReadWriteLock.h"
 #include "joynr/serializer/Serializer.h"
 #include "joynr/system/RoutingTypes/MqttAddress.h"
 #include "joynr/types/DiscoveryEntry.h"
@@ -203,8 +203,8 @@ TEST(LCDUtilTest, test_isGlobal)
 
 TEST(LCDUtilTest, test_isEntryForGbid)
 {
-    std::recursive_mutex lock;
-    std::unique_lock<std::recursive_mutex> cacheLock(lock);
+    ReentrantReadWriteLock lock;
+    ReentrantReadLocker cacheLock(lock);
     types::Version providerVersion(42, 42);
     types::ProviderQos providerQos;
     std::string participantId = "participantId1";
@@ -234,8 +234,8 @@ TEST(LCDUtilTest, test_isEntryForGbid)
 
 TEST(LCDUtilTest, filterDiscoveryEntriesByGbids)
 {
-    std::recursive_mutex lock;
-    std::unique_lock<std::recursive_mutex> cacheLock(lock);
+    ReentrantReadWriteLock lock;
+    ReentrantReadLocker cacheLock(lock);
     types::Version providerVersion(42, 42);
     types::ProviderQos providerQos;
     std::string participantId = "participantId1";
@@ -23,6 +23,7 @@
 #include <memory>
 
 #include "joynr/InProcessMessagingAddress.h"
+#include "joynr/exceptions/MethodInvocationException.h"
 #include "joynr/system/RoutingTypes/Address.h"
 #include "joynr/system/RoutingTypes/BrowserAddress.h"
 #include "joynr/system/RoutingTypes/MqttAddress.h"
@@ -39,6 +40,7 @@
 
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::ElementsAre;
 using ::testing::Eq;
 using ::testing::HasSubstr;
 using ::testing::InSequence;
@@ -46,6 +48,7 @@ using ::testing::InvokeArgument;
 using ::testing::Mock;
 using ::testing::Pointee;
 using ::testing::Return;
+using ::testing::SaveArg;
 
 using namespace joynr;
 
@@ -438,6 +441,279 @@ TEST_F(LibJoynrMessageRouterTest, addNextHop_callsAddNextHopInRoutingProxy)
     testAddNextHopCallsRoutingProxyCorrectly(isGloballyVisible, providerAddress2);
 }
 
+TEST_F(LibJoynrMessageRouterTest, addNextHop_coalescesRegistrationsWhileParentRequestsAreRunning)
+{
+    auto mockRoutingProxy = std::make_unique<MockRoutingProxy>(_runtime);
+    MockRoutingProxy* mockRoutingProxyRef = mockRoutingProxy.get();
+    std::vector<std::function<void()>> runningRequestCallbacks;
+    ON_CALL(*mockRoutingProxy, addNextHopAsyncMockWs(_, _, _, _, _, _))
+            .WillByDefault(DoAll(Invoke([&runningRequestCallbacks](
+                                                const std::string&,
+                                                const system::RoutingTypes::WebSocketClientAddress&,
+                                                const bool&,
+                                                std::function<void()> onSuccess,
+                                                std::function<void(
+                                                        const exceptions::JoynrRuntimeException&)>,
+                                                boost::optional<MessagingQos>) {
+                                     runningRequestCallbacks.push_back(std::move(onSuccess));
+                                 }),
+                                 Return(nullptr)));
+    _messageRouter->setParentAddress(std::string("parentParticipantId"), _localTransport);
+    _messageRouter->setParentRouter(std::move(mockRoutingProxy));
+
+    auto dispatcher = std::make_shared<MockDispatcher>();
+    auto mockSkeleton = std::make_shared<MockInProcessMessagingSkeleton>(dispatcher);
+    const auto providerAddress =
+            std::make_shared<const joynr::InProcessMessagingAddress>(mockSkeleton);
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const bool isSticky = false;
+
+    // the parent router proxy's own registration occupies the first request slot
+    EXPECT_CALL(*mockRoutingProxyRef, addNextHopAsyncMockWs(_, _, _, _, _, _)).Times(3);
+    EXPECT_CALL(*mockRoutingProxyRef, addNextHopsAsyncMockWs(_, _, _, _, _, _)).Times(0);
+    for (const std::string participantId : {"participantId1", "participantId2", "participantId3"}) {
+        _messageRouter->addNextHop(
+                participantId, providerAddress, _isGloballyVisible, expiryDateMs, isSticky);
+    }
+    std::uint32_t pendingSuccessCallbacks = 0;
+    for (const std::string participantId : {"participantId4", "participantId5"}) {
+        _messageRouter->addNextHop(participantId,
+                                   providerAddress,
+                                   _isGloballyVisible,
+                                   expiryDateMs,
+                                   isSticky,
+                                   [&pendingSuccessCallbacks]() { pendingSuccessCallbacks++; });
+    }
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+    ASSERT_EQ(4, runningRequestCallbacks.size());
+
+    std::function<void()> batchOnSuccess;
+    EXPECT_CALL(*mockRoutingProxyRef,
+                addNextHopsAsyncMockWs(ElementsAre("participantId4", "participantId5"),
+                                       Eq(*_webSocketClientAddress),
+                                       Eq(_isGloballyVisible),
+                                       _,
+                                       _,
+                                       _))
+            .WillOnce(DoAll(SaveArg<3>(&batchOnSuccess), Return(nullptr)));
+    runningRequestCallbacks.front()();
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+
+    ASSERT_TRUE(batchOnSuccess);
+    EXPECT_EQ(0, pendingSuccessCallbacks);
+    batchOnSuccess();
+    EXPECT_EQ(2, pendingSuccessCallbacks);
+}
+
+TEST_F(LibJoynrMessageRouterTest, removeNextHop_dropsRegistrationWaitingForParentRequestSlot)
+{
+    auto mockRoutingProxy = std::make_unique<MockRoutingProxy>(_runtime);
+    MockRoutingProxy* mockRoutingProxyRef = mockRoutingProxy.get();
+    std::vector<std::function<void()>> runningRequestCallbacks;
+    ON_CALL(*mockRoutingProxy, addNextHopAsyncMockWs(_, _, _, _, _, _))
+            .WillByDefault(DoAll(Invoke([&runningRequestCallbacks](
+                                                const std::string&,
+                                                const system::RoutingTypes::WebSocketClientAddress&,
+                                                const bool&,
+                                                std::function<void()> onSuccess,
+                                                std::function<void(
+                                                        const exceptions::JoynrRuntimeException&)>,
+                                                boost::optional<MessagingQos>) {
+                                     runningRequestCallbacks.push_back(std::move(onSuccess));
+                                 }),
+                                 Return(nullptr)));
+    _messageRouter->setParentAddress(std::string("parentParticipantId"), _localTransport);
+    _messageRouter->setParentRouter(std::move(mockRoutingProxy));
+
+    auto dispatcher = std::make_shared<MockDispatcher>();
+    auto mockSkeleton = std::make_shared<MockInProcessMessagingSkeleton>(dispatcher);
+    const auto providerAddress =
+            std::make_shared<const joynr::InProcessMessagingAddress>(mockSkeleton);
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const bool isSticky = false;
+    for (const std::string participantId : {"participantId1", "participantId2", "participantId3"}) {
+        _messageRouter->addNextHop(
+                participantId, providerAddress, _isGloballyVisible, expiryDateMs, isSticky);
+    }
+    bool removedAddSucceeded = false;
+    bool removedAddFailed = false;
+    _messageRouter->addNextHop(
+            "removedParticipantId",
+            providerAddress,
+            _isGloballyVisible,
+            expiryDateMs,
+            isSticky,
+            [&removedAddSucceeded]() { removedAddSucceeded = true; },
+            [&removedAddFailed](const exceptions::ProviderRuntimeException&) {
+                removedAddFailed = true;
+            });
+    ASSERT_EQ(4, runningRequestCallbacks.size());
+
+    _messageRouter->removeNextHop("removedParticipantId", nullptr, nullptr);
+    // the registration never reached the parent, so it must not be reported as successful
+    EXPECT_FALSE(removedAddSucceeded);
+    EXPECT_TRUE(removedAddFailed);
+
+    // the slot of the finished request is released without sending the removed entry
+    EXPECT_CALL(*mockRoutingProxyRef, addNextHopAsyncMockWs(_, _, _, _, _, _)).Times(0);
+    EXPECT_CALL(*mockRoutingProxyRef, addNextHopsAsyncMockWs(_, _, _, _, _, _)).Times(0);
+    runningRequestCallbacks.front()();
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+}
+
+TEST_F(LibJoynrMessageRouterTest, routeInternal_coalescesResolvesWhileParentRequestsAreRunning)
+{
+    auto mockRoutingProxy = std::make_unique<MockRoutingProxy>(_runtime);
+    MockRoutingProxy* mockRoutingProxyRef = mockRoutingProxy.get();
+    std::vector<std::function<void(const bool&)>> runningRequestCallbacks;
+    ON_CALL(*mockRoutingProxy, resolveNextHopAsyncMock(_, _, _, _))
+            .WillByDefault(DoAll(
+                    Invoke([&runningRequestCallbacks](
+                                   const std::string&,
+                                   std::function<void(const bool&)> onSuccess,
+                                   std::function<void(const exceptions::JoynrRuntimeException&)>,
+                                   boost::optional<MessagingQos>) {
+                        runningRequestCallbacks.push_back(std::move(onSuccess));
+                    }),
+                    Return(nullptr)));
+    _messageRouter->setParentAddress(std::string("parentParticipantId"), _localTransport);
+    _messageRouter->setParentRouter(std::move(mockRoutingProxy));
+
+    _mutableMessage.setType(joynr::Message::VALUE_MESSAGE_TYPE_REQUEST());
+    _mutableMessage.setSender("sender");
+    _mutableMessage.setExpiryDate(TimePoint::now() + std::chrono::milliseconds(60000));
+
+    EXPECT_CALL(*mockRoutingProxyRef, resolveNextHopAsyncMock(_, _, _, _)).Times(4);
+    EXPECT_CALL(*mockRoutingProxyRef, resolveNextHopsAsyncMock(_, _, _, _)).Times(0);
+    for (const std::string recipient :
+         {"recipient1", "recipient2", "recipient3", "recipient4", "recipient5", "recipient6"}) {
+        _mutableMessage.setRecipient(recipient);
+        _messageRouter->route(_mutableMessage.getImmutableMessage());
+    }
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+    ASSERT_EQ(4, runningRequestCallbacks.size());
+
+    EXPECT_CALL(*mockRoutingProxyRef,
+                resolveNextHopsAsyncMock(ElementsAre("recipient5", "recipient6"), _, _, _));
+    runningRequestCallbacks.front()(false);
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+}
+
+TEST_F(LibJoynrMessageRouterTest, addNextHop_fallsBackToSingleRequestsIfParentLacksAddNextHops)
+{
+    auto mockRoutingProxy = std::make_unique<MockRoutingProxy>(_runtime);
+    MockRoutingProxy* mockRoutingProxyRef = mockRoutingProxy.get();
+    std::vector<std::string> registeredParticipantIds;
+    std::vector<std::function<void()>> runningRequestCallbacks;
+    ON_CALL(*mockRoutingProxy, addNextHopAsyncMockWs(_, _, _, _, _, _))
+            .WillByDefault(DoAll(Invoke([&registeredParticipantIds, &runningRequestCallbacks](
+                                                const std::string& participantId,
+                                                const system::RoutingTypes::WebSocketClientAddress&,
+                                                const bool&,
+                                                std::function<void()> onSuccess,
+                                                std::function<void(
+                                                        const exceptions::JoynrRuntimeException&)>,
+                                                boost::optional<MessagingQos>) {
+                                     registeredParticipantIds.push_back(participantId);
+                                     runningRequestCallbacks.push_back(std::move(onSuccess));
+                                 }),
+                                 Return(nullptr)));
+    _messageRouter->setParentAddress(std::string("parentParticipantId"), _localTransport);
+    _messageRouter->setParentRouter(std::move(mockRoutingProxy));
+
+    auto dispatcher = std::make_shared<MockDispatcher>();
+    auto mockSkeleton = std::make_shared<MockInProcessMessagingSkeleton>(dispatcher);
+    const auto providerAddress =
+            std::make_shared<const joynr::InProcessMessagingAddress>(mockSkeleton);
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const bool isSticky = false;
+    std::uint32_t successCallbacks = 0;
+    for (const std::string participantId : {"participantId1",
+                                            "participantId2",
+                                            "participantId3",
+                                            "participantId4",
+                                            "participantId5"}) {
+        _messageRouter->addNextHop(participantId,
+                                   providerAddress,
+                                   _isGloballyVisible,
+                                   expiryDateMs,
+                                   isSticky,
+                                   [&successCallbacks]() { successCallbacks++; });
+    }
+    ASSERT_EQ(4, runningRequestCallbacks.size());
+
+    // an older parent replies to the unknown method with a MethodInvocationException
+    EXPECT_CALL(*mockRoutingProxyRef, addNextHopsAsyncMockWs(_, _, _, _, _, _))
+            .WillOnce(DoAll(InvokeArgument<4>(exceptions::MethodInvocationException(
+                                    "unknown method name for interface Routing: addNextHops")),
+                            Return(nullptr)));
+    runningRequestCallbacks.front()();
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+    ASSERT_EQ(6, registeredParticipantIds.size());
+    EXPECT_EQ("participantId4", registeredParticipantIds[4]);
+    EXPECT_EQ("participantId5", registeredParticipantIds[5]);
+
+    runningRequestCallbacks[4]();
+    runningRequestCallbacks[5]();
+    EXPECT_EQ(2, successCallbacks);
+
+    // further registrations are sent one by one right away
+    EXPECT_CALL(*mockRoutingProxyRef, addNextHopsAsyncMockWs(_, _, _, _, _, _)).Times(0);
+    EXPECT_CALL(*mockRoutingProxyRef,
+                addNextHopAsyncMockWs(Eq("participantId6"), _, _, _, _, _))
+            .WillOnce(DoAll(InvokeArgument<3>(), Return(nullptr)));
+    _messageRouter->addNextHop("participantId6",
+                               providerAddress,
+                               _isGloballyVisible,
+                               expiryDateMs,
+                               isSticky,
+                               [&successCallbacks]() { successCallbacks++; });
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+    EXPECT_EQ(3, successCallbacks);
+}
+
+TEST_F(LibJoynrMessageRouterTest,
+       routeInternal_fallsBackToSingleResolvesIfParentLacksResolveNextHops)
+{
+    auto mockRoutingProxy = std::make_unique<MockRoutingProxy>(_runtime);
+    MockRoutingProxy* mockRoutingProxyRef = mockRoutingProxy.get();
+    std::vector<std::string> resolvedParticipantIds;
+    std::vector<std::function<void(const bool&)>> runningRequestCallbacks;
+    ON_CALL(*mockRoutingProxy, resolveNextHopAsyncMock(_, _, _, _))
+            .WillByDefault(DoAll(
+                    Invoke([&resolvedParticipantIds, &runningRequestCallbacks](
+                                   const std::string& participantId,
+                                   std::function<void(const bool&)> onSuccess,
+                                   std::function<void(const exceptions::JoynrRuntimeException&)>,
+                                   boost::optional<MessagingQos>) {
+                        resolvedParticipantIds.push_back(participantId);
+                        runningRequestCallbacks.push_back(std::move(onSuccess));
+                    }),
+                    Return(nullptr)));
+    _messageRouter->setParentAddress(std::string("parentParticipantId"), _localTransport);
+    _messageRouter->setParentRouter(std::move(mockRoutingProxy));
+
+    _mutableMessage.setType(joynr::Message::VALUE_MESSAGE_TYPE_REQUEST());
+    _mutableMessage.setSender("sender");
+    _mutableMessage.setExpiryDate(TimePoint::now() + std::chrono::milliseconds(60000));
+    for (const std::string recipient :
+         {"recipient1", "recipient2", "recipient3", "recipient4", "recipient5", "recipient6"}) {
+        _mutableMessage.setRecipient(recipient);
+        _messageRouter->route(_mutableMessage.getImmutableMessage());
+    }
+    ASSERT_EQ(4, runningRequestCallbacks.size());
+
+    EXPECT_CALL(*mockRoutingProxyRef, resolveNextHopsAsyncMock(_, _, _, _))
+            .WillOnce(DoAll(InvokeArgument<2>(exceptions::MethodInvocationException(
+                                    "unknown method name for interface Routing: resolveNextHops")),
+                            Return(nullptr)));
+    runningRequestCallbacks.front()(false);
+    Mock::VerifyAndClearExpectations(mockRoutingProxyRef);
+    ASSERT_EQ(6, resolvedParticipantIds.size());
+    EXPECT_EQ("recipient5", resolvedParticipantIds[4]);
+    EXPECT_EQ("recipient6", resolvedParticipantIds[5]);
+}
+
 TEST_F(LibJoynrMessageRouterTest, setToKnown_addsParentAddress)
 {
     auto mockRoutingProxy = std::make_unique<MockRoutingProxy>(_runtime);
@@ -1031,7 +1307,7 @@ TEST_F(LibJoynrMessageRouterTest, udsIncomingAddress)
     std::unique_ptr<IMulticastAddressCalculator> noMultiCast(nullptr);
     std::vector<std::shared_ptr<ITransportStatus>> transportStatuses;
 
-    LibJoynrMessageRouter messageRouter(
+    auto messageRouter = std::make_shared<LibJoynrMessageRouter>(
             messagingSettings,
             udsIncomingAddress,
             stubFactory,
@@ -1040,7 +1316,7 @@ TEST_F(LibJoynrMessageRouterTest, udsIncomingAddress)
             transportStatuses,
             std::make_unique<MessageQueue<std::string>>(),
             std::make_unique<MessageQueue<std::shared_ptr<ITransportStatus>>>());
-    messageRouter.setParentAddress("routing UUID", _localTransport);
+    messageRouter->setParentAddress("routing UUID", _localTransport);
 
     auto parentProxyMock = std::make_shared<MockRoutingProxy>(_runtime);
     const auto proxyUuid = parentProxyMock->getProxyParticipantId();
@@ -1052,7 +1328,7 @@ TEST_F(LibJoynrMessageRouterTest, udsIncomingAddress)
                                        _,
                                        _,
                                        _));
-    messageRouter.setParentRouter(parentProxyMock);
+    messageRouter->setParentRouter(parentProxyMock);
 
     const std::string serverConnectionId{"Provider UUID"};
     constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
@@ -1068,8 +1344,8 @@ TEST_F(LibJoynrMessageRouterTest, udsIncomingAddress)
                                        _,
                                        _,
                                        _));
-    messageRouter.addNextHop(
+    messageRouter->addNextHop(
             serverConnectionId, serverConnectionAddress, isGloballyVisible, expiryDateMs, isSticky);
 
-    messageRouter.shutdown();
+    messageRouter->shutdown();
 }
@@ -113,23 +113,20 @@ protected:
 
 TEST_F(LocalCapabilitiesDirectoryStoreTest, getGlobalLookupCache)
 {
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore.getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore.getCacheLock());
     ASSERT_NE(nullptr, _localCapabilitiesDirectoryStore.getGlobalLookupCache(cacheLock));
 }
 
 TEST_F(LocalCapabilitiesDirectoryStoreTest, getLocallyRegisteredCapabilities)
 {
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore.getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore.getCacheLock());
     ASSERT_NE(
             nullptr, _localCapabilitiesDirectoryStore.getLocallyRegisteredCapabilities(cacheLock));
 }
 
 TEST_F(LocalCapabilitiesDirectoryStoreTest, insertInLocalCapabilitiesStorage)
 {
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore.getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore.getCacheLock());
     ASSERT_EQ(0,
               _localCapabilitiesDirectoryStore.getLocallyRegisteredCapabilities(cacheLock)->size());
     _localCapabilitiesDirectoryStore.insertInLocalCapabilitiesStorage(_localEntry);
@@ -141,8 +138,7 @@ TEST_F(LocalCapabilitiesDirectoryStoreTest, insertInLocalCapabilitiesStorage)
 TEST_F(LocalCapabilitiesDirectoryStoreTest, insertInGlobalLookupCache)
 {
     std::vector<std::string> gbids = {"gbid1", "gbid2"};
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore.getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore.getCacheLock());
     ASSERT_EQ(0, _localCapabilitiesDirectoryStore.getGlobalLookupCache(cacheLock)->size());
     _localCapabilitiesDirectoryStore.insertInGlobalLookupCache(_localEntry, gbids);
     ASSERT_EQ(1, _localCapabilitiesDirectoryStore.getGlobalLookupCache(cacheLock)->size());
@@ -156,8 +152,7 @@ TEST_F(LocalCapabilitiesDirectoryStoreTest, updateEntryInGlobalLookupCacheIfItEx
     const std::vector<std::string> gbids1 = {"gbid1", "gbid2"};
     const std::vector<std::string> expectedGbids1 = {gbids1};
     const std::vector<types::DiscoveryEntry> expectedDiscoveryEntries1 = {_localEntry};
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore.getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore.getCacheLock());
     ASSERT_EQ(0, _localCapabilitiesDirectoryStore.getGlobalLookupCache(cacheLock)->size());
 
     _localCapabilitiesDirectoryStore.insertInGlobalLookupCache(_localEntry, gbids1);
@@ -228,8 +223,7 @@ TEST_F(LocalCapabilitiesDirectoryStoreTest, getAllGlobalCapabilities)
 
 TEST_F(LocalCapabilitiesDirectoryStoreTest, clear)
 {
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore.getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore.getCacheLock());
     ASSERT_EQ(0,
               _localCapabilitiesDirectoryStore.getLocallyRegisteredCapabilities(cacheLock)->size());
     _localCapabilitiesDirectoryStore.insertInLocalCapabilitiesStorage(_localEntry);
@@ -268,8 +262,7 @@ TEST_F(LocalCapabilitiesDirectoryStoreTest, handlingOfGbidMappings)
 {
     std::vector<std::string> gbids = {"gbid1", "gbid2"};
 
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore.getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore.getCacheLock());
     ASSERT_EQ(0,
               _localCapabilitiesDirectoryStore
                       .getGbidsForParticipantId(_participantIdGlobal, cacheLock)
@@ -292,6 +285,39 @@ TEST_F(LocalCapabilitiesDirectoryStoreTest, handlingOfGbidMappings)
                       .size());
 }
 
+TEST_F(LocalCapabilitiesDirectoryStoreTest, evictionFromGlobalLookupCacheErasesGbidMapping)
+{
+    const std::vector<std::string> gbids = {"gbid1", "gbid2"};
+    LocalCapabilitiesDirectoryStore store(1);
+
+    store.insertInGlobalLookupCache(_globalEntry, gbids);
+    types::DiscoveryEntry otherEntry(_globalEntry);
+    otherEntry.setParticipantId("otherParticipantId");
+    store.insertInGlobalLookupCache(otherEntry, gbids);
+
+    ReentrantWriteLocker cacheLock(store.getCacheLock());
+    ASSERT_EQ(1, store.getGlobalLookupCache(cacheLock)->size());
+    EXPECT_TRUE(store.getGbidsForParticipantId(_participantIdGlobal, cacheLock).empty());
+    EXPECT_EQ(gbids, store.getGbidsForParticipantId("otherParticipantId", cacheLock));
+}
+
+TEST_F(LocalCapabilitiesDirectoryStoreTest,
+       evictionFromGlobalLookupCacheKeepsGbidMappingOfLocalProvider)
+{
+    const std::vector<std::string> gbids = {"gbid1", "gbid2"};
+    LocalCapabilitiesDirectoryStore store(1);
+
+    store.insertInGlobalLookupCache(_globalEntry, gbids);
+    store.insertInLocalCapabilitiesStorage(_globalEntry);
+    types::DiscoveryEntry otherEntry(_globalEntry);
+    otherEntry.setParticipantId("otherParticipantId");
+    store.insertInGlobalLookupCache(otherEntry, gbids);
+
+    ReentrantWriteLocker cacheLock(store.getCacheLock());
+    ASSERT_EQ(1, store.getGlobalLookupCache(cacheLock)->size());
+    EXPECT_EQ(gbids, store.getGbidsForParticipantId(_participantIdGlobal, cacheLock));
+}
+
 TEST_F(LocalCapabilitiesDirectoryStoreTest,
        getLocalAndCachedCapabilities_interfaceAddresses_local_only)
 {
@@ -450,7 +450,7 @@ public:
                                             _defaultProviderRuntimeExceptionError);
         EXPECT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(_TIMEOUT)));
 
-        std::unique_lock<std::recursive_mutex> cacheLock(capturedLCDStore->getCacheLock());
+        ReentrantWriteLocker cacheLock(capturedLCDStore->getCacheLock());
         std::vector<std::string> capturedGbids = capturedLCDStore->getGbidsForParticipantId(
                 _dummyParticipantIdsVector[0], cacheLock);
         cacheLock.unlock();
@@ -5385,8 +5385,7 @@ TEST_F(LocalCapabilitiesDirectoryTest, touchRefreshesAllEntries_GcdTouchOnlyUses
     EXPECT_LT(minExpiryDateMs,
               _localCapabilitiesDirectoryStore->getLocalCapabilities(participantId1)[0]
                       .getExpiryDateMs());
-    std::unique_lock<std::recursive_mutex> cacheLock(
-            _localCapabilitiesDirectoryStore->getCacheLock());
+    ReentrantWriteLocker cacheLock(_localCapabilitiesDirectoryStore->getCacheLock());
     ASSERT_FALSE(_localCapabilitiesDirectoryStore->getGlobalLookupCache(cacheLock)
                          ->lookupByParticipantId(participantId1));
     cacheLock.unlock();
@@ -16,15 +16,20 @@
  * limitations under the License.
  * #L%
  */
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "tests/utils/Gmock.h"
 #include "tests/utils/Gtest.h"
 
 #include "joynr/ImmutableMessage.h"
 #include "joynr/MessageQueue.h"
+#include "joynr/MessageQueueSpillFile.h"
 #include "joynr/MutableMessage.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/Semaphore.h"
@@ -174,6 +179,81 @@ TEST_F(MessageQueueTest, dequeueInvalidParticipantId)
     EXPECT_EQ(_messageQueue.getNextMessageFor("TEST"), nullptr);
 }
 
+TEST_F(MessageQueueTest, messagesForOneKeyAreReturnedInFifoOrder)
+{
+    const std::string participantId("TEST");
+    const int messageCount = 10;
+    for (int i = 0; i < messageCount; i++) {
+        MutableMessage mutableMessage;
+        mutableMessage.setRecipient(participantId);
+        // later messages expire earlier to make sure the order does not depend on the TTL
+        mutableMessage.setExpiryDate(_expiryDate + (messageCount - i));
+        mutableMessage.setPayload(std::to_string(i));
+        _messageQueue.queueMessage(participantId, mutableMessage.getImmutableMessage());
+    }
+
+    for (int i = 0; i < messageCount; i++) {
+        auto message = _messageQueue.getNextMessageFor(participantId);
+        ASSERT_NE(nullptr, message);
+        const smrf::ByteArrayView body = message->getUnencryptedBody();
+        EXPECT_EQ(std::to_string(i), std::string(body.data(), body.data() + body.size()));
+    }
+    EXPECT_EQ(nullptr, _messageQueue.getNextMessageFor(participantId));
+}
+
+TEST_F(MessageQueueTest, removeExpiredMessages_ignoresAlreadyDequeuedMessages)
+{
+    const std::string participantId("TEST");
+    MutableMessage mutableMessage;
+    mutableMessage.setRecipient(participantId);
+    mutableMessage.setExpiryDate(TimePoint::now() - std::chrono::milliseconds(10));
+    _messageQueue.queueMessage(participantId, mutableMessage.getImmutableMessage());
+    createAndQueueMessage(TimePoint::now() - std::chrono::milliseconds(10));
+    EXPECT_EQ(2, _messageQueue.getQueueLength());
+
+    EXPECT_NE(nullptr, _messageQueue.getNextMessageFor(participantId));
+    _messageQueue.removeOutdatedMessages();
+    EXPECT_EQ(0, _messageQueue.getQueueLength());
+    EXPECT_EQ(0, _messageQueue.getQueueSizeBytes());
+}
+
+TEST_F(MessageQueueTest, concurrentQueueAndDequeue)
+{
+    constexpr int numberOfThreads = 4;
+    constexpr int messagesPerThread = 500;
+    constexpr int numberOfKeys = 20;
+    std::atomic<int> dequeuedMessages(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numberOfThreads; t++) {
+        threads.emplace_back([this, t, &dequeuedMessages]() {
+            for (int i = 0; i < messagesPerThread; i++) {
+                const std::string key = std::to_string(i % numberOfKeys);
+                MutableMessage mutableMessage;
+                mutableMessage.setRecipient(key);
+                mutableMessage.setExpiryDate(_expiryDate + 10000);
+                _messageQueue.queueMessage(key, mutableMessage.getImmutableMessage());
+                if (_messageQueue.getNextMessageFor(std::to_string((i + t) % numberOfKeys))) {
+                    dequeuedMessages++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    int remainingMessages = 0;
+    for (int key = 0; key < numberOfKeys; key++) {
+        while (_messageQueue.getNextMessageFor(std::to_string(key))) {
+            remainingMessages++;
+        }
+    }
+    EXPECT_EQ(numberOfThreads * messagesPerThread, dequeuedMessages + remainingMessages);
+    EXPECT_EQ(0, _messageQueue.getQueueLength());
+    EXPECT_EQ(0, _messageQueue.getQueueSizeBytes());
+}
+
 class MessageQueueWithLimitTest : public ::testing::Test
 {
 public:
@@ -211,6 +291,19 @@ protected:
                 reinterpret_cast<const char*>(byteArrayView.data()), byteArrayView.size());
     }
 
+    // compaction runs in the background
+    bool waitForSpillFileSize(const MessageQueueSpillFile& spillFile, std::uint64_t sizeBytes)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (spillFile.getSizeBytes() != sizeBytes) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
 private:
     DISALLOW_COPY_AND_ASSIGN(MessageQueueWithLimitTest);
 };
@@ -345,6 +438,59 @@ TEST_F(MessageQueueWithLimitTest, testPerKeyQueueLimit_lowestTtlRemoved)
     EXPECT_EQ(msgRecipient2Payload1, payloadAsString(recipient2Message));
 }
 
+TEST_F(MessageQueueWithLimitTest, testPerKeyQueueLimit_lowestTtlRemovedInsteadOfOldest)
+{
+    const std::string recipient("recipient");
+    constexpr std::uint64_t messageQueueLimit = 10;
+    constexpr std::uint64_t perKeyQueueLimit = 4;
+
+    const auto now = TimePoint::now();
+    MessageQueue<std::string> queue(messageQueueLimit, perKeyQueueLimit);
+    createAndQueueMessage(queue, now + 4000, recipient, "1");
+    createAndQueueMessage(queue, now + 1000, recipient, "2");
+    createAndQueueMessage(queue, now + 3000, recipient, "3");
+    createAndQueueMessage(queue, now + 2000, recipient, "4");
+
+    auto droppedMessages =
+            queue.queueMessage(recipient, createMessage(now + 5000, recipient, "5"));
+    ASSERT_EQ(1, droppedMessages.size());
+    EXPECT_EQ("2", payloadAsString(droppedMessages.front()));
+    droppedMessages = queue.queueMessage(recipient, createMessage(now + 5000, recipient, "6"));
+    ASSERT_EQ(1, droppedMessages.size());
+    EXPECT_EQ("4", payloadAsString(droppedMessages.front()));
+
+    // the remaining messages keep their FIFO order
+    for (const std::string payload : {"1", "3", "5", "6"}) {
+        auto message = queue.getNextMessageFor(recipient);
+        ASSERT_NE(nullptr, message);
+        EXPECT_EQ(payload, payloadAsString(message));
+    }
+    EXPECT_EQ(nullptr, queue.getNextMessageFor(recipient));
+}
+
+TEST_F(MessageQueueWithLimitTest, queueLimitExceeded_lowestTtlOfAllKeysRemoved)
+{
+    constexpr std::uint64_t messageQueueLimit = 64;
+    MessageQueue<std::string> queue(messageQueueLimit);
+
+    // the keys are distributed over all stripes of the queue
+    const auto now = TimePoint::now();
+    for (std::uint64_t i = 0; i < messageQueueLimit; i++) {
+        const std::int64_t ttl = i == 42 ? 1000 : 10000 + static_cast<std::int64_t>(i);
+        createAndQueueMessage(queue, now + ttl, "recipient" + std::to_string(i));
+    }
+
+    auto droppedMessages =
+            queue.queueMessage("newRecipient", createMessage(now + 20000, "newRecipient"));
+    ASSERT_EQ(1, droppedMessages.size());
+    EXPECT_EQ("recipient42", droppedMessages.front()->getRecipient());
+    droppedMessages =
+            queue.queueMessage("newRecipient", createMessage(now + 20000, "newRecipient"));
+    ASSERT_EQ(1, droppedMessages.size());
+    EXPECT_EQ("recipient0", droppedMessages.front()->getRecipient());
+    EXPECT_EQ(messageQueueLimit, queue.getQueueLength());
+}
+
 TEST_F(MessageQueueWithLimitTest, testPerKeyQueueLimit_overallQueueIsFull)
 {
     const std::string recipient1("recipient1");
@@ -375,8 +521,39 @@ TEST_F(MessageQueueWithLimitTest, testPerKeyQueueLimit_overallQueueIsFull)
     EXPECT_NE(nullptr, recipient1Message2);
     EXPECT_EQ(nullptr, recipient2Message1);
 
-    EXPECT_EQ(msgRecipient1Payload2, payloadAsString(recipient1Message1));
-    EXPECT_EQ(msgRecipient1Payload1, payloadAsString(recipient1Message2));
+    // messages of the same key are returned in FIFO order
+    EXPECT_EQ(msgRecipient1Payload1, payloadAsString(recipient1Message1));
+    EXPECT_EQ(msgRecipient1Payload2, payloadAsString(recipient1Message2));
+}
+
+TEST_F(MessageQueueWithLimitTest, testPerKeyQueueLimit_concurrentInsertsDoNotExceedLimit)
+{
+    const std::string recipient("recipient");
+    constexpr std::uint64_t messageQueueLimit = 1000;
+    constexpr std::uint64_t perKeyQueueLimit = 3;
+    constexpr int numberOfThreads = 8;
+    constexpr int messagesPerThread = 200;
+
+    const auto now = TimePoint::now();
+    MessageQueue<std::string> queue(messageQueueLimit, perKeyQueueLimit);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numberOfThreads; t++) {
+        threads.emplace_back([this, &queue, &recipient, now, t]() {
+            for (int i = 0; i < messagesPerThread; i++) {
+                createAndQueueMessage(queue, now + 10000 + t * messagesPerThread + i, recipient);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(perKeyQueueLimit, queue.getQueueLength());
+    std::uint64_t queuedForRecipient = 0;
+    while (queue.getNextMessageFor(recipient)) {
+        queuedForRecipient++;
+    }
+    EXPECT_EQ(perKeyQueueLimit, queuedForRecipient);
 }
 
 TEST_F(MessageQueueWithLimitTest, testMessageQueueLimitBytes)
@@ -444,3 +621,121 @@ TEST_F(MessageQueueWithLimitTest, testMessageQueueHandlesTooLargeMessage)
 
     EXPECT_EQ(0, queue.getQueueLength());
 }
+
+TEST_F(MessageQueueWithLimitTest, queueLimitExceeded_messagesSpilledAndReturnedInOrder)
+{
+    const std::string recipient("recipient");
+    constexpr std::uint64_t messageQueueLimit = 2;
+    MessageQueue<std::string> queue(messageQueueLimit);
+    auto spillFile = std::make_shared<MessageQueueSpillFile>("MessageQueueTest.spill", 0);
+    queue.setSpillFile(spillFile);
+
+    const auto now = TimePoint::now();
+    const int messageCount = 5;
+    for (int i = 0; i < messageCount; i++) {
+        auto message = createMessage(now + 10000, recipient, std::to_string(i));
+        message->setCreator("creator");
+        message->setReceivedFromGlobal(true);
+        EXPECT_TRUE(queue.queueMessage(recipient, std::move(message)).empty());
+    }
+    EXPECT_EQ(messageCount, queue.getQueueLength());
+    EXPECT_EQ(messageCount - messageQueueLimit, queue.getSpilledQueueLength());
+    EXPECT_EQ(messageCount - messageQueueLimit, spillFile->getNumberOfRecords());
+
+    for (int i = 0; i < messageCount; i++) {
+        auto message = queue.getNextMessageFor(recipient);
+        ASSERT_NE(nullptr, message);
+        EXPECT_EQ(std::to_string(i), payloadAsString(message));
+        EXPECT_EQ("creator", message->getCreator());
+        EXPECT_TRUE(message->isReceivedFromGlobal());
+    }
+    EXPECT_EQ(nullptr, queue.getNextMessageFor(recipient));
+    EXPECT_EQ(0, queue.getQueueLength());
+    EXPECT_EQ(0, spillFile->getSizeBytes());
+}
+
+TEST_F(MessageQueueWithLimitTest, spillFileFull_droppedMessagesReturned)
+{
+    const std::string recipient("recipient");
+    constexpr std::uint64_t messageQueueLimit = 1;
+    MessageQueue<std::string> queue(messageQueueLimit);
+    queue.setSpillFile(std::make_shared<MessageQueueSpillFile>("MessageQueueTest.spill", 1));
+
+    const auto now = TimePoint::now();
+    auto droppedMessages = queue.queueMessage(recipient, createMessage(now + 10000, recipient));
+    EXPECT_TRUE(droppedMessages.empty());
+    droppedMessages = queue.queueMessage(recipient, createMessage(now + 10000, recipient));
+    EXPECT_EQ(1, droppedMessages.size());
+    EXPECT_EQ(1, queue.getQueueLength());
+    EXPECT_EQ(0, queue.getSpilledQueueLength());
+}
+
+TEST_F(MessageQueueWithLimitTest, removeOutdatedMessages_removesSpilledMessages)
+{
+    const std::string recipient("recipient");
+    constexpr std::uint64_t messageQueueLimit = 1;
+    MessageQueue<std::string> queue(messageQueueLimit);
+    queue.setSpillFile(std::make_shared<MessageQueueSpillFile>("MessageQueueTest.spill", 0));
+
+    const auto now = TimePoint::now();
+    createAndQueueMessage(queue, TimePoint::fromAbsoluteMs(0), recipient, "expired");
+    createAndQueueMessage(queue, now + 10000, recipient, "valid");
+    EXPECT_EQ(1, queue.getSpilledQueueLength());
+
+    queue.removeOutdatedMessages();
+    EXPECT_EQ(0, queue.getSpilledQueueLength());
+    EXPECT_EQ(1, queue.getQueueLength());
+    EXPECT_EQ("valid", payloadAsString(queue.getNextMessageFor(recipient)));
+}
+
+TEST_F(MessageQueueWithLimitTest, spillFileFull_releasedSpaceReusedByCompaction)
+{
+    const std::string recipient("recipient");
+    const auto now = TimePoint::now();
+    MessageQueueSpillFile::Record record1, record2, record3;
+    std::uint64_t recordSize = 0;
+    {
+        MessageQueueSpillFile sizeProbe("MessageQueueTest.spill", 0);
+        ASSERT_TRUE(sizeProbe.append(*createMessage(now + 10000, recipient, "0"), record1));
+        recordSize = sizeProbe.getSizeBytes();
+    }
+    MessageQueueSpillFile spillFile("MessageQueueTest.spill", 2 * recordSize);
+
+    ASSERT_TRUE(spillFile.append(*createMessage(now + 10000, recipient, "1"), record1));
+    ASSERT_TRUE(spillFile.append(*createMessage(now + 10000, recipient, "2"), record2));
+    EXPECT_EQ("1", payloadAsString(spillFile.take(record1)));
+
+    // only fits once the space of the first record is reclaimed
+    ASSERT_TRUE(waitForSpillFileSize(spillFile, recordSize));
+    ASSERT_TRUE(spillFile.append(*createMessage(now + 10000, recipient, "3"), record3));
+    EXPECT_EQ(2 * recordSize, spillFile.getSizeBytes());
+    EXPECT_EQ("2", payloadAsString(spillFile.take(record2)));
+    EXPECT_EQ("3", payloadAsString(spillFile.take(record3)));
+    EXPECT_EQ(0, spillFile.getSizeBytes());
+}
+
+TEST_F(MessageQueueWithLimitTest, spillFileWithoutLimit_compactedOnceMostRecordsReleased)
+{
+    const std::string recipient("recipient");
+    const auto now = TimePoint::now();
+    MessageQueueSpillFile spillFile("MessageQueueTest.spill", 0);
+    const std::string payload(64 * 1024, 'x');
+    const int messageCount = 20;
+    std::vector<MessageQueueSpillFile::Record> records(messageCount);
+    for (int i = 0; i < messageCount; i++) {
+        auto message = createMessage(now + 10000, recipient, payload + std::to_string(10 + i));
+        ASSERT_TRUE(spillFile.append(*message, records[i]));
+    }
+    const std::uint64_t recordSize = spillFile.getSizeBytes() / messageCount;
+
+    // 16 released records exceed 1 MiB and the size of the 4 remaining ones
+    const int releasedCount = 16;
+    for (int i = 0; i < releasedCount; i++) {
+        spillFile.discard(records[i]);
+    }
+    EXPECT_TRUE(waitForSpillFileSize(spillFile, (messageCount - releasedCount) * recordSize));
+    for (int i = releasedCount; i < messageCount; i++) {
+        EXPECT_EQ(payload + std::to_string(10 + i), payloadAsString(spillFile.take(records[i])));
+    }
+    EXPECT_EQ(0, spillFile.getNumberOfRecords());
+}
@@ -519,6 +519,65 @@ TYPED_TEST(MessageRouterTest, routedMessageQueuedIfTransportIsNotAvailable)
     EXPECT_EQ(0, this->_transportNotAvailableQueueRef->getQueueLength());
 }
 
+TYPED_TEST(MessageRouterTest, onlyMessagesForAvailableDestinationAreRescheduled)
+{
+    auto mockTransportStatus = std::make_shared<MockTransportStatus>();
+
+    MockTransportStatus::DestinationAvailableCallback destinationAvailableCallback;
+    EXPECT_CALL(*mockTransportStatus, setDestinationAvailableCallback(_))
+            .WillOnce(SaveArg<0>(&destinationAvailableCallback));
+
+    this->_messageRouter->shutdown();
+    this->_messageRouter = this->createMessageRouter({mockTransportStatus});
+
+    const std::string resumedParticipantId = "resumed";
+    const std::string pausedParticipantId = "paused";
+    const bool isGloballyVisible = true;
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const bool isSticky = false;
+    auto dispatcher = std::make_shared<MockDispatcher>();
+    auto resumedSkeleton = std::make_shared<MockInProcessMessagingSkeleton>(dispatcher);
+    auto pausedSkeleton = std::make_shared<MockInProcessMessagingSkeleton>(dispatcher);
+    auto resumedAddress = std::make_shared<const InProcessMessagingAddress>(resumedSkeleton);
+    auto pausedAddress = std::make_shared<const InProcessMessagingAddress>(pausedSkeleton);
+
+    this->_messageRouter->addNextHop(
+            resumedParticipantId, resumedAddress, isGloballyVisible, expiryDateMs, isSticky);
+    this->_messageRouter->addNextHop(
+            pausedParticipantId, pausedAddress, isGloballyVisible, expiryDateMs, isSticky);
+
+    ON_CALL(*mockTransportStatus, isReponsibleFor(_)).WillByDefault(Return(true));
+    ON_CALL(*mockTransportStatus, isAvailable()).WillByDefault(Return(false));
+
+    // Both messages are queued as their destinations are not available
+    this->_mutableMessage.setRecipient(pausedParticipantId);
+    std::shared_ptr<ImmutableMessage> pausedMessage = this->_mutableMessage.getImmutableMessage();
+    this->_mutableMessage.setRecipient(resumedParticipantId);
+    std::shared_ptr<ImmutableMessage> resumedMessage =
+            this->_mutableMessage.getImmutableMessage();
+    this->_messageRouter->route(pausedMessage);
+    this->_messageRouter->route(resumedMessage);
+    EXPECT_EQ(2, this->_transportNotAvailableQueueRef->getQueueLength());
+
+    // Now pretend that one of the destinations became available
+    auto semaphore = std::make_shared<joynr::Semaphore>(0);
+    auto mockMessagingStub = std::make_shared<MockMessagingStub>();
+    ON_CALL(*mockMessagingStub, transmit(resumedMessage, _))
+            .WillByDefault(ReleaseSemaphore(semaphore));
+    EXPECT_CALL(*(this->_messagingStubFactory), create(addressWithSkeleton(resumedSkeleton)))
+            .Times(1)
+            .WillOnce(Return(mockMessagingStub));
+    EXPECT_CALL(*(this->_messagingStubFactory), create(addressWithSkeleton(pausedSkeleton)))
+            .Times(0);
+    ON_CALL(*mockTransportStatus, isAvailable()).WillByDefault(Return(true));
+
+    destinationAvailableCallback(resumedAddress);
+
+    EXPECT_TRUE(semaphore->waitFor(std::chrono::seconds(2)));
+    // the message for the other destination stays queued
+    EXPECT_EQ(1, this->_transportNotAvailableQueueRef->getQueueLength());
+}
+
 TYPED_TEST(MessageRouterTest,
            queuedMsgsAreQueuedInTransportNotAvailableQueueWhenTransportIsUnavailable)
 {
@@ -53,6 +53,7 @@ using ::testing::AllOf;
 using ::testing::Eq;
 using ::testing::NotNull;
 using ::testing::Property;
+using ::testing::Return;
 using namespace joynr;
 
 class MessageSenderTest : public ::testing::Test
@@ -154,6 +155,65 @@ TEST_F(MessageSenderTest, sendOneWayRequest_normal)
             senderID, receiverID, qosSettings, oneWayRequest, isLocalMessage);
 }
 
+TEST_F(MessageSenderTest, sendInProcessRequest_providerInSameRuntime_bypassesRouting)
+{
+    Request request;
+    request.setMethodName("methodName");
+    request.setRequestReplyId(requestID);
+    request.setParams(42, std::string("value"));
+
+    EXPECT_CALL(*mockMessageRouter, canDispatchInProcess(Eq(receiverID))).WillOnce(Return(true));
+    EXPECT_CALL(*mockMessageRouter, route(_, _)).Times(0);
+    EXPECT_CALL(*mockDispatcher, addReplyCaller(Eq(requestID), _, _));
+    EXPECT_CALL(*mockDispatcher,
+                dispatchInProcessRequestMock(Eq(senderID),
+                                             Eq(receiverID),
+                                             _,
+                                             Property(&Request::getRequestReplyId, Eq(requestID))));
+
+    MessageSender messageSender(mockMessageRouter, nullptr);
+    messageSender.registerDispatcher(mockDispatcher);
+    EXPECT_TRUE(messageSender.sendInProcessRequest(
+            senderID, receiverID, qosSettings, request, callBack));
+}
+
+TEST_F(MessageSenderTest, sendInProcessRequest_providerNotInSameRuntime_returnsFalse)
+{
+    Request request;
+    request.setMethodName("methodName");
+    request.setRequestReplyId(requestID);
+
+    EXPECT_CALL(*mockMessageRouter, canDispatchInProcess(Eq(receiverID)))
+            .WillOnce(Return(false));
+    EXPECT_CALL(*mockDispatcher, addReplyCaller(_, _, _)).Times(0);
+    EXPECT_CALL(*mockDispatcher, dispatchInProcessRequestMock(_, _, _, _)).Times(0);
+
+    MessageSender messageSender(mockMessageRouter, nullptr);
+    messageSender.registerDispatcher(mockDispatcher);
+    EXPECT_FALSE(messageSender.sendInProcessRequest(
+            senderID, receiverID, qosSettings, request, callBack));
+    EXPECT_EQ(requestID, request.getRequestReplyId());
+}
+
+TEST_F(MessageSenderTest, sendInProcessOneWayRequest_providerInSameRuntime_bypassesRouting)
+{
+    OneWayRequest oneWayRequest;
+    oneWayRequest.setMethodName("methodName");
+
+    EXPECT_CALL(*mockMessageRouter, canDispatchInProcess(Eq(receiverID))).WillOnce(Return(true));
+    EXPECT_CALL(*mockMessageRouter, route(_, _)).Times(0);
+    EXPECT_CALL(*mockDispatcher,
+                dispatchInProcessOneWayRequestMock(
+                        Eq(receiverID),
+                        _,
+                        Property(&OneWayRequest::getMethodName, Eq("methodName"))));
+
+    MessageSender messageSender(mockMessageRouter, nullptr);
+    messageSender.registerDispatcher(mockDispatcher);
+    EXPECT_TRUE(messageSender.sendInProcessOneWayRequest(
+            senderID, receiverID, qosSettings, oneWayRequest));
+}
+
 TEST_F(MessageSenderTest, sendReply_normal)
 {
     Reply reply;
@@ -25,6 +25,7 @@
 #include "joynr/MutableMessage.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/TimePoint.h"
+#include "joynr/TrackingInfo.h"
 
 #include "tests/mock/MockKeychain.h"
 
@@ -149,3 +150,33 @@ TEST_F(ImmutableMessageTest, isCompressed)
     auto immutableMessage = _mutableMessage.getImmutableMessage();
     EXPECT_EQ(immutableMessage->isCompressed(), expectedValue);
 }
+
+TEST_F(ImmutableMessageTest, getTrackingInfo)
+{
+    auto immutableMessage = _mutableMessage.getImmutableMessage();
+    const std::string expectedTrackingInfo =
+            "messageId: " + immutableMessage->getId() + ", type: " + immutableMessage->getType() +
+            ", sender: sender, recipient: recipient, expiryDate: " +
+            std::to_string(immutableMessage->getExpiryDate().toMilliseconds()) +
+            ", size: " + std::to_string(immutableMessage->getMessageSize());
+    EXPECT_EQ(expectedTrackingInfo, immutableMessage->getTrackingInfo());
+}
+
+TEST_F(ImmutableMessageTest, getTrackingInfoContainsRequestReplyId)
+{
+    _mutableMessage.setCustomHeader(Message::CUSTOM_HEADER_REQUEST_REPLY_ID(), "requestReplyId");
+    auto immutableMessage = _mutableMessage.getImmutableMessage();
+    const std::string trackingInfo = immutableMessage->getTrackingInfo();
+    EXPECT_THAT(trackingInfo,
+                HasSubstr(", recipient: recipient, requestReplyId: requestReplyId, expiryDate: "));
+}
+
+TEST_F(ImmutableMessageTest, trackingInfoFormatsLikeGetTrackingInfo)
+{
+    _mutableMessage.setCustomHeader(Message::CUSTOM_HEADER_REQUEST_REPLY_ID(), "requestReplyId");
+    auto immutableMessage = _mutableMessage.getImmutableMessage();
+    EXPECT_EQ(immutableMessage->getTrackingInfo(),
+              fmt::format("{}", TrackingInfo(*immutableMessage)));
+    EXPECT_EQ("message: " + immutableMessage->getTrackingInfo() + " queued",
+              fmt::format("message: {} queued", TrackingInfo(*immutableMessage)));
+}
@@ -0,0 +1,135 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/MessageTracer.h"
+
+using namespace joynr;
+using namespace joynr::tracing;
+
+class MessageTracerTest : public ::testing::Test
+{
+public:
+    MessageTracerTest() : _messageTracer(MessageTracer::instance())
+    {
+        _messageTracer.clear();
+    }
+
+    ~MessageTracerTest() override
+    {
+        _messageTracer.disable();
+        _messageTracer.clear();
+    }
+
+protected:
+    MessageTracer& _messageTracer;
+};
+
+TEST_F(MessageTracerTest, nothingIsRecordedWhileDisabled)
+{
+    _messageTracer.disable();
+    bool messageIdEvaluated = false;
+    auto getMessageId = [&messageIdEvaluated]() {
+        messageIdEvaluated = true;
+        return std::string("messageId");
+    };
+    JOYNR_TRACE_MESSAGE(CREATED, getMessageId());
+    EXPECT_FALSE(messageIdEvaluated);
+    EXPECT_TRUE(_messageTracer.getRecords().empty());
+}
+
+TEST_F(MessageTracerTest, recordsLifecycleOfMessage)
+{
+    _messageTracer.enable();
+    const std::string messageId("messageId");
+    JOYNR_TRACE_MESSAGE(CREATED, messageId);
+    JOYNR_TRACE_MESSAGE(ROUTER_ENTRY, messageId);
+    JOYNR_TRACE_MESSAGE(TRANSPORT_SEND, messageId);
+
+    const std::vector<TraceRecord> records = _messageTracer.getRecords();
+    ASSERT_EQ(3, records.size());
+    EXPECT_EQ(TracePoint::CREATED, records[0].tracePoint);
+    EXPECT_EQ(TracePoint::ROUTER_ENTRY, records[1].tracePoint);
+    EXPECT_EQ(TracePoint::TRANSPORT_SEND, records[2].tracePoint);
+    for (const TraceRecord& traceRecord : records) {
+        EXPECT_EQ(messageId, traceRecord.getMessageId());
+    }
+    EXPECT_LE(records[0].timestampNs, records[1].timestampNs);
+    EXPECT_LE(records[1].timestampNs, records[2].timestampNs);
+}
+
+TEST_F(MessageTracerTest, ringBufferKeepsNewestRecords)
+{
+    _messageTracer.enable(4);
+    std::thread recordingThread([]() {
+        for (int i = 0; i < 10; ++i) {
+            JOYNR_TRACE_MESSAGE(RECEIVED, std::to_string(i));
+        }
+    });
+    recordingThread.join();
+
+    const std::vector<TraceRecord> records = _messageTracer.getRecords();
+    ASSERT_EQ(4, records.size());
+    EXPECT_EQ("6", records[0].getMessageId());
+    EXPECT_EQ("9", records[3].getMessageId());
+}
+
+TEST_F(MessageTracerTest, longMessageIdsAreTruncated)
+{
+    _messageTracer.enable();
+    const std::string messageId(2 * TraceRecord::MAX_MESSAGE_ID_LENGTH, 'x');
+    JOYNR_TRACE_MESSAGE(SCHEDULED, messageId);
+
+    const std::vector<TraceRecord> records = _messageTracer.getRecords();
+    ASSERT_EQ(1, records.size());
+    EXPECT_EQ(messageId.substr(0, TraceRecord::MAX_MESSAGE_ID_LENGTH), records[0].getMessageId());
+}
+
+TEST_F(MessageTracerTest, chromeTraceContainsAsyncEventPerRecord)
+{
+    TraceRecord traceRecord{};
+    traceRecord.timestampNs = 1234567;
+    traceRecord.threadIndex = 3;
+    traceRecord.tracePoint = TracePoint::DISPATCH_START;
+    traceRecord.messageIdLength = 2;
+    traceRecord.messageId[0] = 'i';
+    traceRecord.messageId[1] = 'd';
+
+    const std::string chromeTrace = MessageTracer::toChromeTrace({traceRecord});
+    EXPECT_EQ(R"({"displayTimeUnit":"ns","traceEvents":[{"name":"DISPATCH_START",)"
+              R"("cat":"joynr.message","ph":"n","pid":1,"tid":3,"ts":1234.567,"id":"id"}]})",
+              chromeTrace);
+}
+
+TEST_F(MessageTracerTest, binaryFormatIsCompact)
+{
+    TraceRecord traceRecord{};
+    traceRecord.tracePoint = TracePoint::DISPATCH_END;
+    traceRecord.messageIdLength = 2;
+
+    const std::string binary = MessageTracer::toBinary({traceRecord, traceRecord});
+    // magic + version + 2 * (timestamp + thread index + trace point + id length + id)
+    EXPECT_EQ(4 + 2 + 2 * (8 + 4 + 1 + 1 + 2), binary.size());
+    EXPECT_EQ("JTRC", binary.substr(0, 4));
+}
@@ -0,0 +1,132 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/Metrics.h"
+
+using namespace joynr;
+using namespace joynr::metrics;
+
+TEST(MetricsTest, counterSumsUpIncrementsFromMultipleThreads)
+{
+    Counter counter;
+    const std::size_t numberOfThreads = 8;
+    const std::uint64_t incrementsPerThread = 10000;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < numberOfThreads; ++i) {
+        threads.emplace_back([&counter, incrementsPerThread]() {
+            for (std::uint64_t j = 0; j < incrementsPerThread; ++j) {
+                counter.increment();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(numberOfThreads * incrementsPerThread, counter.getValue());
+
+    counter.reset();
+    EXPECT_EQ(0, counter.getValue());
+}
+
+TEST(MetricsTest, gaugeCanGoUpAndDown)
+{
+    Gauge gauge;
+    gauge.set(5);
+    gauge.increment(3);
+    gauge.decrement();
+    EXPECT_EQ(7, gauge.getValue());
+}
+
+TEST(MetricsTest, histogramBucketsAreContiguous)
+{
+    EXPECT_EQ(0, Histogram::getBucketLowerBound(0));
+    for (std::size_t i = 1; i < Histogram::NUMBER_OF_BUCKETS; ++i) {
+        EXPECT_EQ(Histogram::getBucketUpperBound(i - 1) + 1, Histogram::getBucketLowerBound(i));
+        EXPECT_EQ(i, Histogram::getBucketIndex(Histogram::getBucketLowerBound(i)));
+        EXPECT_EQ(i, Histogram::getBucketIndex(Histogram::getBucketUpperBound(i)));
+    }
+    EXPECT_EQ(std::numeric_limits<std::uint64_t>::max(),
+              Histogram::getBucketUpperBound(Histogram::NUMBER_OF_BUCKETS - 1));
+}
+
+TEST(MetricsTest, histogramSnapshotContainsPercentiles)
+{
+    Histogram histogram;
+    for (std::uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value);
+    }
+    const HistogramSnapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(1000, snapshot.count);
+    EXPECT_EQ(500500, snapshot.sum);
+    EXPECT_EQ(1, snapshot.min);
+    EXPECT_EQ(1000, snapshot.max);
+    // buckets guarantee a relative error below 12.5%
+    EXPECT_NEAR(500, snapshot.p50, 500 / 8);
+    EXPECT_NEAR(900, snapshot.p90, 900 / 8);
+    EXPECT_NEAR(990, snapshot.p99, 990 / 8);
+    EXPECT_LE(snapshot.p999, snapshot.max);
+
+    histogram.reset();
+    EXPECT_EQ(0, histogram.getSnapshot().count);
+}
+
+TEST(MetricsTest, emptyHistogramReturnsEmptySnapshot)
+{
+    Histogram histogram;
+    const HistogramSnapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(0, snapshot.count);
+    EXPECT_EQ(0, snapshot.min);
+    EXPECT_EQ(0, snapshot.p99);
+}
+
+TEST(MetricsTest, registryReturnsSameMetricForSameName)
+{
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    auto counter = registry.getCounter("MetricsTest.counter");
+    EXPECT_EQ(counter, registry.getCounter("MetricsTest.counter"));
+    EXPECT_NE(counter, registry.getCounter("MetricsTest.otherCounter"));
+}
+
+TEST(MetricsTest, registryProvidesMetricValues)
+{
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    registry.reset();
+    registry.getCounter("MetricsTest.provider.counter")->increment(3);
+    registry.getGauge("MetricsTest.provider.gauge")->set(-2);
+    registry.getHistogram("MetricsTest.provider.histogram")->record(42);
+
+    IMetricsProvider& provider = registry;
+    EXPECT_EQ(3, provider.getCounterValue("MetricsTest.provider.counter"));
+    EXPECT_EQ(-2, provider.getGaugeValue("MetricsTest.provider.gauge"));
+    EXPECT_EQ(1, provider.getHistogramSnapshot("MetricsTest.provider.histogram").count);
+    EXPECT_EQ(0, provider.getCounterValue("MetricsTest.provider.unknown"));
+
+    const std::string json = provider.getMetricsAsJson();
+    EXPECT_NE(std::string::npos, json.find("\"MetricsTest.provider.counter\":3"));
+    EXPECT_NE(std::string::npos, json.find("\"MetricsTest.provider.gauge\":-2"));
+    EXPECT_NE(std::string::npos,
+              json.find("\"MetricsTest.provider.histogram\":{\"count\":1,\"sum\":42"));
+}
@@ -16,12 +16,14 @@
  * limitations under the License.
  * #L%
  */
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <ctime>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "tests/utils/Gmock.h"
 #include "tests/utils/Gtest.h"
@@ -40,6 +42,29 @@
 
 using namespace joynr;
 
+// records the number of topics of every SUBSCRIBE packet instead of sending it
+class SubscribeRecordingMosquittoConnection : public MosquittoConnection
+{
+public:
+    using MosquittoConnection::MosquittoConnection;
+
+    std::uint32_t getMqttMaximumPacketSize() const override
+    {
+        return _maximumPacketSize;
+    }
+
+    std::uint32_t _maximumPacketSize = 0;
+    int _subscribeResult = MOSQ_ERR_SUCCESS;
+    std::vector<std::size_t> _subscribeBatchSizes;
+
+private:
+    int subscribeMultiple(std::vector<char*>& topics) override
+    {
+        _subscribeBatchSizes.push_back(topics.size());
+        return _subscribeResult;
+    }
+};
+
 class MosquittoConnectionTest : public ::testing::Test
 {
 public:
@@ -106,6 +131,32 @@ protected:
         return mosquittoConnection;
     }
 
+    std::shared_ptr<SubscribeRecordingMosquittoConnection> createSubscribeRecordingConnection()
+    {
+        auto mosquittoConnection = std::make_shared<SubscribeRecordingMosquittoConnection>(
+                _ccSettings,
+                _brokerUrl,
+                _mqttKeepAliveTimeSeconds,
+                _mqttReconnectDelayTimeSeconds,
+                _mqttReconnectMaxDelayTimeSeconds,
+                _isMqttExponentialBackoffEnabled,
+                "clientIdSubscribeBatches",
+                "gbidSubscribeBatches");
+        mosquittoConnection->registerChannelId("channelIdSubscribeBatches");
+        return mosquittoConnection;
+    }
+
+    static std::vector<std::string> createTopics(std::size_t count, std::size_t length)
+    {
+        std::vector<std::string> topics;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::string topic = "topic/" + std::to_string(i);
+            topic.resize(std::max(length, topic.size()), 'x');
+            topics.push_back(std::move(topic));
+        }
+        return topics;
+    }
+
     Settings _settings;
     MessagingSettings _messagingSettings;
     ClusterControllerSettings _ccSettings;
@@ -370,3 +421,119 @@ TEST_F(MosquittoConnectionTest, noMessageDeliveryWhenExceedingItsExpiryIntervalA
     mosquittoConnection1->stop();
     mosquittoConnection2->stop();
 }
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicValidatesTopicBeforeBatching)
+{
+    auto readyToSendSemaphore = std::make_shared<joynr::Semaphore>(0);
+    auto mosquittoConnection = createMosquittoConnection(
+            readyToSendSemaphore, "clientIdBatching", "channelIdBatching", "gbidBatching");
+
+    // not connected: valid topics are kept and subscribed on connect
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_NO_THROW(mosquittoConnection->subscribeToTopic("multicast/topic" +
+                                                               std::to_string(i)));
+    }
+    EXPECT_THROW(mosquittoConnection->subscribeToTopic("invalid/#/topic"),
+                 exceptions::JoynrRuntimeException);
+    EXPECT_NO_THROW(mosquittoConnection->unsubscribeFromTopic("multicast/topic0"));
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsSendsSeveralTopicsInOneSubscribePacket)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+
+    mosquittoConnection->subscribeToTopics(createTopics(10, 20));
+
+    EXPECT_EQ(std::vector<std::size_t>{10}, mosquittoConnection->_subscribeBatchSizes);
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsSplitsBatchesAt256Topics)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+
+    mosquittoConnection->subscribeToTopics(createTopics(600, 20));
+
+    const std::vector<std::size_t> expectedBatchSizes = {256, 256, 88};
+    EXPECT_EQ(expectedBatchSizes, mosquittoConnection->_subscribeBatchSizes);
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsSplitsBatchesAtMaximumPacketSize)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+    // packet overhead of 16 bytes plus 3 topics of 20 bytes with length prefix and options
+    mosquittoConnection->_maximumPacketSize = 16 + 3 * (2 + 20 + 1);
+
+    mosquittoConnection->subscribeToTopics(createTopics(7, 20));
+
+    const std::vector<std::size_t> expectedBatchSizes = {3, 3, 1};
+    EXPECT_EQ(expectedBatchSizes, mosquittoConnection->_subscribeBatchSizes);
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsSendsTopicExceedingMaximumPacketSizeAlone)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+    mosquittoConnection->_maximumPacketSize = 64;
+    std::vector<std::string> topics = createTopics(3, 20);
+    topics[1].resize(100, 'x');
+
+    mosquittoConnection->subscribeToTopics(topics);
+
+    const std::vector<std::size_t> expectedBatchSizes = {1, 1, 1};
+    EXPECT_EQ(expectedBatchSizes, mosquittoConnection->_subscribeBatchSizes);
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsSendsOnlyTopicsNotSubscribedYet)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+    const std::vector<std::string> topics = createTopics(10, 20);
+
+    mosquittoConnection->subscribeToTopics(topics);
+    mosquittoConnection->subscribeToTopic(topics[3]);
+    mosquittoConnection->subscribeToTopics(createTopics(12, 20));
+
+    const std::vector<std::size_t> expectedBatchSizes = {10, 2};
+    EXPECT_EQ(expectedBatchSizes, mosquittoConnection->_subscribeBatchSizes);
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsRejectsInvalidTopicWithoutSubscribingOthers)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+    std::vector<std::string> topics = createTopics(3, 20);
+    topics.push_back("invalid/#/topic");
+
+    EXPECT_THROW(mosquittoConnection->subscribeToTopics(topics),
+                 exceptions::JoynrRuntimeException);
+    EXPECT_TRUE(mosquittoConnection->_subscribeBatchSizes.empty());
+
+    topics.pop_back();
+    mosquittoConnection->subscribeToTopics(topics);
+    EXPECT_EQ(std::vector<std::size_t>{3}, mosquittoConnection->_subscribeBatchSizes);
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsThrowsWhenSubscribePacketCannotBeSent)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+    mosquittoConnection->_subscribeResult = MOSQ_ERR_NOMEM;
+
+    EXPECT_THROW(mosquittoConnection->subscribeToTopics(createTopics(10, 20)),
+                 exceptions::JoynrRuntimeException);
+
+    // the topics were not subscribed, hence they are sent again
+    mosquittoConnection->_subscribeResult = MOSQ_ERR_SUCCESS;
+    mosquittoConnection->subscribeToTopics(createTopics(10, 20));
+    const std::vector<std::size_t> expectedBatchSizes = {10, 10};
+    EXPECT_EQ(expectedBatchSizes, mosquittoConnection->_subscribeBatchSizes);
+}
+
+TEST_F(MosquittoConnectionTest, subscribeToTopicsKeepsTopicsWhenNotConnected)
+{
+    auto mosquittoConnection = createSubscribeRecordingConnection();
+    mosquittoConnection->_subscribeResult = MOSQ_ERR_NO_CONN;
+
+    EXPECT_NO_THROW(mosquittoConnection->subscribeToTopics(createTopics(10, 20)));
+
+    // the topics are subscribed on connect, hence they are not sent again
+    mosquittoConnection->_subscribeResult = MOSQ_ERR_SUCCESS;
+    mosquittoConnection->subscribeToTopics(createTopics(10, 20));
+    EXPECT_EQ(std::vector<std::size_t>{10}, mosquittoConnection->_subscribeBatchSizes);
+}
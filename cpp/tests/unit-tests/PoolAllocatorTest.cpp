@@ -0,0 +1,156 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/PoolAllocator.h"
+
+using namespace joynr;
+using namespace joynr::util;
+
+namespace
+{
+
+struct PooledTestObject {
+    PooledTestObject(std::string text, std::size_t number) : _text(std::move(text)), _number(number)
+    {
+    }
+
+    std::string _text;
+    std::size_t _number;
+    // make the block size unique among the tests of this file
+    char _padding[1000];
+};
+
+struct ThreadCachedTestObject {
+    // make the block size unique among the tests of this file
+    char _padding[2000];
+};
+
+} // namespace
+
+TEST(PoolAllocatorTest, releasedBlockIsReused)
+{
+    const void* firstAddress = nullptr;
+    {
+        auto first = makePooledShared<PooledTestObject>("first", 1);
+        firstAddress = first.get();
+    }
+    auto second = makePooledShared<PooledTestObject>("second", 2);
+    EXPECT_EQ(firstAddress, second.get());
+    EXPECT_EQ("second", second->_text);
+    EXPECT_EQ(2u, second->_number);
+}
+
+TEST(PoolAllocatorTest, blockSizeIsRoundedUpToFundamentalAlignment)
+{
+    EXPECT_EQ(alignof(std::max_align_t), PoolAllocator<char>::getBlockSize());
+    EXPECT_EQ(0u, PoolAllocator<PooledTestObject>::getBlockSize() % alignof(std::max_align_t));
+    EXPECT_LE(sizeof(PooledTestObject), PoolAllocator<PooledTestObject>::getBlockSize());
+}
+
+TEST(PoolAllocatorTest, numberOfFreeBlocksIsLimited)
+{
+    using Pool = PoolAllocator<PooledTestObject>::Pool;
+    PoolAllocator<PooledTestObject> allocator;
+    std::vector<PooledTestObject*> blocks;
+    for (std::size_t i = 0; i < Pool::MAX_FREE_BLOCKS + Pool::MAX_CACHED_BLOCKS + 10; ++i) {
+        blocks.push_back(allocator.allocate(1));
+    }
+    for (PooledTestObject* block : blocks) {
+        allocator.deallocate(block, 1);
+    }
+    EXPECT_EQ(Pool::MAX_FREE_BLOCKS, Pool::instance().getNumberOfFreeBlocks());
+    EXPECT_LE(Pool::instance().getNumberOfCachedBlocks(), Pool::MAX_CACHED_BLOCKS);
+}
+
+TEST(PoolAllocatorTest, releasedBlocksAreCachedByThreadAndReturnedInBatches)
+{
+    using Pool = PoolAllocator<ThreadCachedTestObject>::Pool;
+    PoolAllocator<ThreadCachedTestObject> allocator;
+    std::vector<ThreadCachedTestObject*> blocks;
+    for (std::size_t i = 0; i < Pool::MAX_CACHED_BLOCKS + 1; ++i) {
+        blocks.push_back(allocator.allocate(1));
+    }
+    const std::size_t freeBlocksBefore = Pool::instance().getNumberOfFreeBlocks();
+    const std::size_t cachedBlocksBefore = Pool::instance().getNumberOfCachedBlocks();
+
+    // the cache of this thread fills up before blocks are returned to the shared free list
+    std::size_t numberOfReleasedBlocks = 0;
+    while (cachedBlocksBefore + numberOfReleasedBlocks < Pool::MAX_CACHED_BLOCKS) {
+        allocator.deallocate(blocks[numberOfReleasedBlocks++], 1);
+    }
+    EXPECT_EQ(freeBlocksBefore, Pool::instance().getNumberOfFreeBlocks());
+    EXPECT_EQ(Pool::MAX_CACHED_BLOCKS, Pool::instance().getNumberOfCachedBlocks());
+
+    allocator.deallocate(blocks[numberOfReleasedBlocks++], 1);
+    EXPECT_EQ(freeBlocksBefore + Pool::TRANSFER_BATCH_SIZE,
+              Pool::instance().getNumberOfFreeBlocks());
+    EXPECT_EQ(Pool::MAX_CACHED_BLOCKS - Pool::TRANSFER_BATCH_SIZE + 1,
+              Pool::instance().getNumberOfCachedBlocks());
+
+    for (std::size_t i = numberOfReleasedBlocks; i < blocks.size(); ++i) {
+        allocator.deallocate(blocks[i], 1);
+    }
+}
+
+TEST(PoolAllocatorTest, cachedBlocksAreReturnedWhenThreadExits)
+{
+    using Pool = PoolAllocator<ThreadCachedTestObject>::Pool;
+    const std::size_t freeBlocksBefore = Pool::instance().getNumberOfFreeBlocks();
+    const std::size_t numberOfBlocks = 10;
+    std::thread thread([numberOfBlocks]() {
+        PoolAllocator<ThreadCachedTestObject> allocator;
+        std::vector<ThreadCachedTestObject*> blocks;
+        for (std::size_t i = 0; i < numberOfBlocks; ++i) {
+            blocks.push_back(allocator.allocate(1));
+        }
+        for (ThreadCachedTestObject* block : blocks) {
+            allocator.deallocate(block, 1);
+        }
+        EXPECT_LE(numberOfBlocks, Pool::instance().getNumberOfCachedBlocks());
+    });
+    thread.join();
+
+    // blocks taken from the shared free list by the thread have been returned as well
+    EXPECT_LE(freeBlocksBefore, Pool::instance().getNumberOfFreeBlocks());
+    EXPECT_LE(numberOfBlocks, Pool::instance().getNumberOfFreeBlocks());
+}
+
+TEST(PoolAllocatorTest, concurrentAllocationsAndReleases)
+{
+    const std::size_t numberOfThreads = 8;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < numberOfThreads; ++i) {
+        threads.emplace_back([i]() {
+            for (std::size_t j = 0; j < 1000; ++j) {
+                auto object = makePooledShared<PooledTestObject>("object", i * j);
+                ASSERT_EQ(i * j, object->_number);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
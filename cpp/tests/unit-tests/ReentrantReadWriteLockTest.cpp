@@ -0,0 +1,143 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/ReentrantReadWriteLock.h"
+#include "joynr/Semaphore.h"
+
+using namespace joynr;
+
+TEST(ReentrantReadWriteLockTest, multipleReadersDoNotBlockEachOther)
+{
+    ReentrantReadWriteLock lock;
+    ReentrantReadLocker readLock1(lock);
+    Semaphore otherReaderAcquired(0);
+
+    std::thread otherReader([&lock, &otherReaderAcquired]() {
+        ReentrantReadLocker readLock2(lock);
+        otherReaderAcquired.notify();
+    });
+
+    EXPECT_TRUE(otherReaderAcquired.waitFor(std::chrono::milliseconds(1000)));
+    otherReader.join();
+}
+
+TEST(ReentrantReadWriteLockTest, writerIsReentrantAndMayTakeSharedLock)
+{
+    ReentrantReadWriteLock lock;
+    ReentrantWriteLocker writeLock1(lock);
+    {
+        ReentrantWriteLocker writeLock2(lock);
+        ReentrantReadLocker readLock(lock);
+        EXPECT_TRUE(lock.isLockedExclusivelyByCurrentThread());
+    }
+    EXPECT_TRUE(lock.isLockedExclusivelyByCurrentThread());
+    writeLock1.unlock();
+    EXPECT_FALSE(lock.isLockedExclusivelyByCurrentThread());
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(ReentrantReadWriteLockTest, writerWaitsForReaders)
+{
+    ReentrantReadWriteLock lock;
+    ReentrantReadLocker readLock(lock);
+    std::atomic<bool> writerAcquired(false);
+    Semaphore writerStarted(0);
+
+    std::thread writer([&lock, &writerAcquired, &writerStarted]() {
+        writerStarted.notify();
+        ReentrantWriteLocker writeLock(lock);
+        writerAcquired = true;
+    });
+
+    EXPECT_TRUE(writerStarted.waitFor(std::chrono::milliseconds(1000)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(writerAcquired);
+    EXPECT_FALSE(lock.try_lock());
+
+    readLock.unlock();
+    writer.join();
+    EXPECT_TRUE(writerAcquired);
+}
+
+TEST(ReentrantReadWriteLockTest, waitingWriterIsPreferredOverNewReaders)
+{
+    ReentrantReadWriteLock lock;
+    ReentrantReadLocker readLock(lock);
+    Semaphore writerStarted(0);
+
+    std::thread writer([&lock, &writerStarted]() {
+        writerStarted.notify();
+        ReentrantWriteLocker writeLock(lock);
+    });
+    EXPECT_TRUE(writerStarted.waitFor(std::chrono::milliseconds(1000)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::atomic<bool> newReaderResult(true);
+    std::thread newReader([&lock, &newReaderResult]() { newReaderResult = lock.try_lock_shared(); });
+    newReader.join();
+    EXPECT_FALSE(newReaderResult);
+
+    // the thread already holding a shared lock must not deadlock on nested shared locks
+    {
+        ReentrantReadLocker nestedReadLock(lock);
+    }
+
+    readLock.unlock();
+    writer.join();
+}
+
+TEST(ReentrantReadWriteLockTest, concurrentReadersAndWriters)
+{
+    ReentrantReadWriteLock lock;
+    std::int64_t value = 0;
+    std::atomic<bool> inconsistent(false);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&lock, &value]() {
+            for (int j = 0; j < 1000; ++j) {
+                ReentrantWriteLocker writeLock(lock);
+                ++value;
+                ReentrantWriteLocker nestedWriteLock(lock);
+                ++value;
+            }
+        });
+        threads.emplace_back([&lock, &value, &inconsistent]() {
+            for (int j = 0; j < 1000; ++j) {
+                ReentrantReadLocker readLock(lock);
+                if (value % 2 != 0) {
+                    inconsistent = true;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(inconsistent);
+    EXPECT_EQ(8000, value);
+}
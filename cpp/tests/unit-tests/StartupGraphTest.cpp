@@ -0,0 +1,157 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/Semaphore.h"
+#include "joynr/StartupGraph.h"
+
+using namespace joynr;
+
+class StartupGraphTest : public ::testing::Test
+{
+public:
+    StartupGraphTest() : _startupGraph("StartupGraphTest"), _executionOrder(), _mutex()
+    {
+    }
+
+protected:
+    std::function<void()> recordExecution(const std::string& name)
+    {
+        return [this, name]() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _executionOrder.push_back(name);
+        };
+    }
+
+    std::size_t getPosition(const std::string& name)
+    {
+        return static_cast<std::size_t>(
+                std::find(_executionOrder.cbegin(), _executionOrder.cend(), name) -
+                _executionOrder.cbegin());
+    }
+
+    StartupGraph _startupGraph;
+    std::vector<std::string> _executionOrder;
+    std::mutex _mutex;
+};
+
+TEST_F(StartupGraphTest, runsStepsAfterTheirDependencies)
+{
+    _startupGraph.addStep("router", {"connection"}, recordExecution("router"));
+    _startupGraph.addStep("connection", {}, recordExecution("connection"));
+    _startupGraph.addStep("storage", {}, recordExecution("storage"));
+    _startupGraph.addStep("providers", {"router", "storage"}, recordExecution("providers"));
+
+    _startupGraph.run(4);
+
+    ASSERT_EQ(4, _executionOrder.size());
+    EXPECT_LT(getPosition("connection"), getPosition("router"));
+    EXPECT_LT(getPosition("router"), getPosition("providers"));
+    EXPECT_LT(getPosition("storage"), getPosition("providers"));
+    EXPECT_EQ(4, _startupGraph.getTimings().size());
+}
+
+TEST_F(StartupGraphTest, runsIndependentStepsConcurrently)
+{
+    // both steps only finish if the other one has been started
+    Semaphore firstStarted(0);
+    Semaphore secondStarted(0);
+    std::atomic<bool> firstSawSecond(false);
+    std::atomic<bool> secondSawFirst(false);
+    _startupGraph.addStep("first", {}, [&]() {
+        firstStarted.notify();
+        firstSawSecond = secondStarted.waitFor(std::chrono::seconds(5));
+    });
+    _startupGraph.addStep("second", {}, [&]() {
+        secondStarted.notify();
+        secondSawFirst = firstStarted.waitFor(std::chrono::seconds(5));
+    });
+
+    _startupGraph.run(2);
+
+    EXPECT_TRUE(firstSawSecond);
+    EXPECT_TRUE(secondSawFirst);
+}
+
+TEST_F(StartupGraphTest, maxParallelismOfOneRunsOnCallingThread)
+{
+    const std::thread::id callingThread = std::this_thread::get_id();
+    std::atomic<int> stepsOnOtherThreads(0);
+    for (const std::string name : {"a", "b", "c"}) {
+        _startupGraph.addStep(name, {}, [&]() {
+            if (std::this_thread::get_id() != callingThread) {
+                ++stepsOnOtherThreads;
+            }
+        });
+    }
+
+    _startupGraph.run(1);
+
+    EXPECT_EQ(0, stepsOnOtherThreads);
+    EXPECT_EQ(3, _startupGraph.getTimings().size());
+}
+
+TEST_F(StartupGraphTest, failingStepPreventsDependentSteps)
+{
+    _startupGraph.addStep("failing", {}, []() { throw std::runtime_error("step failed"); });
+    _startupGraph.addStep("dependent", {"failing"}, recordExecution("dependent"));
+
+    EXPECT_THROW(_startupGraph.run(2), std::runtime_error);
+    EXPECT_TRUE(_executionOrder.empty());
+}
+
+TEST_F(StartupGraphTest, rejectsInvalidGraphs)
+{
+    _startupGraph.addStep("a", {}, recordExecution("a"));
+    EXPECT_THROW(_startupGraph.addStep("a", {}, recordExecution("a")), std::invalid_argument);
+
+    StartupGraph unknownDependency("unknownDependency");
+    unknownDependency.addStep("a", {"missing"}, recordExecution("a"));
+    EXPECT_THROW(unknownDependency.run(2), std::invalid_argument);
+
+    StartupGraph cyclicDependency("cyclicDependency");
+    cyclicDependency.addStep("a", {"b"}, recordExecution("a"));
+    cyclicDependency.addStep("b", {"a"}, recordExecution("b"));
+    EXPECT_THROW(cyclicDependency.run(2), std::invalid_argument);
+
+    EXPECT_TRUE(_executionOrder.empty());
+}
+
+TEST_F(StartupGraphTest, timingReportContainsAllSteps)
+{
+    _startupGraph.addStep("loadStore", {}, []() {});
+    _startupGraph.addStep("registerProviders", {"loadStore"}, []() {});
+
+    _startupGraph.run(2);
+
+    const std::string report = _startupGraph.getTimingReport();
+    EXPECT_NE(std::string::npos, report.find("StartupGraphTest took"));
+    EXPECT_NE(std::string::npos, report.find("loadStore"));
+    EXPECT_NE(std::string::npos, report.find("registerProviders"));
+}
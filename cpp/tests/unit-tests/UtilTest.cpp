@@ -408,3 +408,21 @@ TEST(UtilTest, loadStringFromFileNoFileTest)
 
     EXPECT_THROW(util::loadStringFromFile(filename), std::runtime_error);
 }
+
+TEST(UtilTest, getMethodNameHashIsUsableAtCompileTime)
+{
+    constexpr std::uint64_t hash = util::getMethodNameHash("getLocation");
+    static_assert(hash == util::getMethodNameHash("getLocation"), "hash must be constexpr");
+
+    // FNV-1a reference values
+    EXPECT_EQ(14695981039346656037ULL, util::getMethodNameHash(""));
+    EXPECT_EQ(12638187200555641996ULL, util::getMethodNameHash("a"));
+}
+
+TEST(UtilTest, getMethodNameHashMatchesForLiteralsAndStrings)
+{
+    const std::string methodName("getLocation");
+    EXPECT_EQ(util::getMethodNameHash("getLocation"), util::getMethodNameHash(methodName));
+    EXPECT_NE(util::getMethodNameHash("getLocation"), util::getMethodNameHash("setLocation"));
+    EXPECT_NE(util::getMethodNameHash("getLocation"), util::getMethodNameHash("getLocatio"));
+}
@@ -155,7 +155,7 @@ TEST_F(UdsClientTest, sendFromClientBufferOverflow)
     std::atomic_uint32_t countSendFailures{0};
     MockUdsClientCallbacks mockUdsClientCallbacks;
     EXPECT_CALL(mockUdsClientCallbacks, sendFailed(_))
-            .Times(sendQueueSize)
+            .Times(AtLeast(sendQueueSize))
             .WillRepeatedly(InvokeWithoutArgs([&countSendFailures] { countSendFailures++; }));
     const smrf::ByteVector messageEmpty;
     _udsSettings.setSendingQueueSize(sendQueueSize);
@@ -167,13 +167,41 @@ TEST_F(UdsClientTest, sendFromClientBufferOverflow)
     // That number depends on the thread switches and OS dependent UDS buffer size (which is e.g.
     // just around KB).
     // These send attempts are blocking (no timeout implemented by client), hence they do not appear
-    // in the failures.
-    for (unsigned int i = 0; i < 2 * sendQueueSize; i++) {
+    // in the failures. Messages exceeding the queue limit are rejected while queued messages are
+    // kept.
+    for (unsigned int i = 0; i < 3 * sendQueueSize; i++) {
         sendFromClient(client, messageEmpty, mockUdsClientCallbacks);
     }
     EXPECT_EQ(waitForGreaterThan(countSendFailures, sendQueueSize), sendQueueSize);
 }
 
+TEST_F(UdsClientTest, sendFromClientBackpressure)
+{
+    constexpr unsigned int sendQueueSize = 100;
+    std::atomic_uint32_t countPaused{0};
+    std::atomic_uint32_t countResumed{0};
+    const smrf::ByteVector messageEmpty;
+    _udsSettings.setSendingQueueSize(sendQueueSize);
+    auto client = createClient();
+    client->setBackpressureCallback([&countPaused, &countResumed](bool isPaused) {
+        if (isPaused) {
+            countPaused++;
+        } else {
+            countResumed++;
+        }
+    });
+    client->start();
+    ASSERT_EQ(countServerConnections(1), 1);
+    {
+        std::lock_guard<std::mutex> lockNextServerSideRead(_connectedClientsMutex);
+        for (unsigned int i = 0; i < 10 * sendQueueSize; i++) {
+            sendFromClient(client, messageEmpty);
+        }
+        EXPECT_EQ(waitForGreaterThan(countPaused, 1), 1) << "High watermark not reported.";
+    }
+    EXPECT_EQ(waitForGreaterThan(countResumed, 1), 1) << "Low watermark not reported.";
+}
+
 TEST_F(UdsClientTest, sendFromClientAfterDisconnection)
 {
     MockUdsClientCallbacks mockUdsClientCallbacks;
@@ -224,7 +252,9 @@ TEST_F(UdsClientTest, sendException)
     constexpr std::size_t sizeViolatingLimit =
             1UL + std::numeric_limits<UdsFrameBufferV1::BodyLength>::max();
     smrf::ByteArrayView viewCausingException(nullptr, sizeViolatingLimit);
-    client->send(viewCausingException, [](const exceptions::JoynrRuntimeException&) {});
+    client->send(viewCausingException,
+                 [](const exceptions::JoynrRuntimeException&) {},
+                 IUdsSender::Priority::NORMAL);
     ASSERT_EQ(countServerConnections(0), 0);
 }
 
@@ -168,7 +168,9 @@ protected:
         smrf::ByteVector array(1, value);
         smrf::ByteArrayView view(array);
         for (auto& clientInfo : _connectedClients) {
-            clientInfo._sender->send(view, [](const joynr::exceptions::JoynrRuntimeException&) {});
+            clientInfo._sender->send(view,
+                                     [](const joynr::exceptions::JoynrRuntimeException&) {},
+                                     joynr::IUdsSender::Priority::NORMAL);
         }
     }
 
@@ -178,7 +180,7 @@ protected:
             const joynr::IUdsSender::SendFailed& callback =
                     [](const joynr::exceptions::JoynrRuntimeException&) {})
     {
-        client->send(smrf::ByteArrayView(msg), callback);
+        client->send(smrf::ByteArrayView(msg), callback, joynr::IUdsSender::Priority::NORMAL);
     }
 
     static void sendFromClient(std::unique_ptr<joynr::UdsClient>& client,
@@ -17,6 +17,7 @@
  * #L%
  */
 #include <cstring>
+#include <string>
 #include <vector>
 
 #include "tests/utils/Gmock.h"
@@ -24,6 +25,7 @@
 
 #include "libjoynr/uds/UdsFrameBufferV1.h"
 
+#include "joynr/serializer/Serializer.h"
 #include "joynr/system/RoutingTypes/UdsClientAddress.h"
 
 #include "tests/PrettyPrint.h"
@@ -207,3 +209,70 @@ TEST(UdsFrameBufferV1Test, readInitExceptions)
         EXPECT_THAT(std::string(e.what()), HasSubstr("decode"));
     }
 }
+
+TEST(UdsFrameBufferV1Test, readInitWithSharedMemoryCapability)
+{
+    const joynr::system::RoutingTypes::UdsClientAddress testAddress("Hello World");
+    for (const bool supportsSharedMemory : {false, true}) {
+        UdsFrameBufferV1 testDataBuffer(testAddress, supportsSharedMemory);
+
+        UdsFrameBufferV1 test;
+        std::memcpy(test.header().data(), testDataBuffer.header().data(), test.header().size());
+        std::memcpy(test.body().data(), testDataBuffer.body().data(), test.body().size());
+        bool readSupportsSharedMemory = !supportsSharedMemory;
+        ASSERT_EQ(test.readInit(readSupportsSharedMemory), testAddress);
+        EXPECT_EQ(readSupportsSharedMemory, supportsSharedMemory);
+    }
+}
+
+TEST(UdsFrameBufferV1Test, initWithSharedMemoryCapabilityIsReadableWithoutCapabilitySupport)
+{
+    // peers without shared memory support parse the whole init body as client address
+    const joynr::system::RoutingTypes::UdsClientAddress testAddress("Hello World");
+    UdsFrameBufferV1 test(testAddress, true);
+    const auto body = convertAsioBuffer(test.body());
+    joynr::system::RoutingTypes::UdsClientAddress readAddress;
+    joynr::serializer::deserializeFromJson(readAddress, smrf::ByteArrayView(body));
+    EXPECT_EQ(readAddress, testAddress);
+}
+
+TEST(UdsFrameBufferV1Test, readSharedMemoryInit)
+{
+    const std::string testName("/joynr-uds-test");
+    UdsFrameBufferV1 testDataBuffer = UdsFrameBufferV1::createSharedMemoryInit(testName);
+    ASSERT_TRUE(testDataBuffer);
+
+    UdsFrameBufferV1 test;
+    std::memcpy(test.header().data(), testDataBuffer.header().data(), test.header().size());
+    EXPECT_TRUE(test.isSharedMemoryInit());
+    EXPECT_FALSE(test.isSharedMemorySignal());
+    std::memcpy(test.body().data(), testDataBuffer.body().data(), test.body().size());
+    EXPECT_EQ(test.readSharedMemoryInit(), testName);
+
+    // Check initialization after read
+    ASSERT_EQ(test.raw().size(), headerSize);
+    ASSERT_THAT(convertAsioBuffer(test.raw()), Each(0));
+}
+
+TEST(UdsFrameBufferV1Test, readSharedMemorySignal)
+{
+    const std::uint64_t writePosition = 0x0102030405060708;
+    UdsFrameBufferV1 testDataBuffer = UdsFrameBufferV1::createSharedMemorySignal(writePosition);
+    ASSERT_TRUE(testDataBuffer);
+    ASSERT_EQ(testDataBuffer.raw().size(), headerSize + sizeof(writePosition));
+
+    UdsFrameBufferV1 test;
+    std::memcpy(test.header().data(), testDataBuffer.header().data(), test.header().size());
+    EXPECT_TRUE(test.isSharedMemorySignal());
+    EXPECT_FALSE(test.isSharedMemoryInit());
+    ASSERT_EQ(test.body().size(), sizeof(writePosition));
+    std::memcpy(test.body().data(), testDataBuffer.body().data(), test.body().size());
+    try {
+        test.readMessage();
+        FAIL() << "Signal frame should not be interpreted as message frame";
+    } catch (const joynr::exceptions::JoynrRuntimeException& e) {
+        EXPECT_THAT(e.what(), HasSubstr("'MJM1'"));
+    }
+    EXPECT_EQ(test.readSharedMemorySignal(), writePosition);
+    ASSERT_THAT(convertAsioBuffer(test.raw()), Each(0));
+}
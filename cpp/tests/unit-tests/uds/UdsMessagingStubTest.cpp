@@ -19,11 +19,16 @@
 
 #include <chrono>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "tests/utils/Gmock.h"
 #include "tests/utils/Gtest.h"
 
+#include "joynr/IUdsSender.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
 #include "joynr/MutableMessage.h"
 #include "joynr/Semaphore.h"
 
@@ -79,7 +84,8 @@ TEST_F(UdsMessagingStubTest, transmitCallsIUdsSenderSendWithCorrectArgs)
     EXPECT_CALL(
             *_mockIUdsSender,
             send(A<const smrf::ByteArrayView&>(),
-                 A<const std::function<void(const joynr::exceptions::JoynrRuntimeException&)>&>()))
+                 A<const std::function<void(const joynr::exceptions::JoynrRuntimeException&)>&>(),
+                 Eq(IUdsSender::Priority::NORMAL)))
             .WillOnce(DoAll(
                     ::testing::SaveArg<0>(&capturedByteArrayView), ReleaseSemaphore(_semaphore)));
 
@@ -102,7 +108,8 @@ TEST_F(UdsMessagingStubTest, transmitOnErrorIsInvokedWhenCalledFromUdsSenderSend
     EXPECT_CALL(
             *_mockIUdsSender,
             send(A<const smrf::ByteArrayView&>(),
-                 A<const std::function<void(const joynr::exceptions::JoynrRuntimeException&)>&>()))
+                 A<const std::function<void(const joynr::exceptions::JoynrRuntimeException&)>&>(),
+                 Eq(IUdsSender::Priority::NORMAL)))
             .WillOnce(DoAll(InvokeArgument<1>(expectedException), ReleaseSemaphore(_semaphore)));
 
     auto callback = std::make_shared<MockCallback<void>>();
@@ -117,3 +124,24 @@ TEST_F(UdsMessagingStubTest, transmitOnErrorIsInvokedWhenCalledFromUdsSenderSend
             });
     EXPECT_TRUE(_semaphore->waitFor(std::chrono::seconds(2)));
 }
+
+TEST_F(UdsMessagingStubTest, transmitUsesPriorityOfMessageType)
+{
+    const std::vector<std::pair<std::string, IUdsSender::Priority>> expectedPriorities{
+            {Message::VALUE_MESSAGE_TYPE_REPLY(), IUdsSender::Priority::HIGH},
+            {Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_STOP(), IUdsSender::Priority::NORMAL},
+            {Message::VALUE_MESSAGE_TYPE_REQUEST(), IUdsSender::Priority::NORMAL},
+            {Message::VALUE_MESSAGE_TYPE_PUBLICATION(), IUdsSender::Priority::LOW},
+            {Message::VALUE_MESSAGE_TYPE_MULTICAST(), IUdsSender::Priority::LOW}};
+    EXPECT_CALL(*_mockIUdsSender, dtorCalled()).Times(1);
+    finalizeObjectsCreation();
+
+    for (const auto& expectedPriority : expectedPriorities) {
+        _mutableMessage.setType(expectedPriority.first);
+        EXPECT_CALL(*_mockIUdsSender, send(_, _, Eq(expectedPriority.second)))
+                .WillOnce(ReleaseSemaphore(_semaphore));
+        _udsMessagingStub->transmit(_mutableMessage.getImmutableMessage(),
+                                    [](const exceptions::JoynrRuntimeException&) {});
+        EXPECT_TRUE(_semaphore->waitFor(std::chrono::seconds(2))) << expectedPriority.first;
+    }
+}
@@ -128,18 +128,17 @@ TEST_F(UdsSendQueueTest, queueLimitExceeded)
             << "Error callbacks executed, though queue limit has not been exceeded.";
 
     constexpr smrf::Byte latestValue{testLimit + 1};
-    test.pushBack(createFrame(latestValue),
-                  [this, latestValue](const exceptions::JoynrRuntimeException& ex) {
-                      _queuedErrorCallbacks.push_back({latestValue, ex});
-                  });
-
-    EXPECT_EQ(latestValue, extractBodyData(test.showFront()))
-            << "Front queue element not the one inserted after queue limit reached.";
-    EXPECT_EQ(testLimit, _queuedErrorCallbacks.size())
-            << "Error callbacks not executed though queue limit has been exceeded.";
-    _queuedFrameData.pop_back();
-    EXPECT_EQ(getErrorCallbackData(), _queuedFrameData)
-            << "Unexpected data reported by error call backs";
+    EXPECT_FALSE(test.pushBack(createFrame(latestValue),
+                               [this, latestValue](const exceptions::JoynrRuntimeException& ex) {
+                                   _queuedErrorCallbacks.push_back({latestValue, ex});
+                               }));
+
+    EXPECT_EQ(0, extractBodyData(test.showFront()))
+            << "Queued entries shall be kept if the queue limit has been reached.";
+    EXPECT_EQ(getErrorCallbackData(), std::vector<smrf::Byte>{latestValue})
+            << "Only the entry exceeding the queue limit shall be rejected.";
+    EXPECT_NO_THROW(dynamic_cast<const exceptions::JoynrDelayMessageException&>(
+            _queuedErrorCallbacks.front().second));
 }
 
 TEST_F(UdsSendQueueTest, queueLimitExceededWhileSending)
@@ -169,13 +168,110 @@ TEST_F(UdsSendQueueTest, queueLimitExceededWhileSending)
                                                        "(shown before the test limit has been "
                                                        "reached.";
 
-    EXPECT_EQ(testLimit, _queuedErrorCallbacks.size());
+    EXPECT_EQ(getErrorCallbackData(), std::vector<smrf::Byte>{testLimit + 1})
+            << "The entry shown to the sender socket does not count to the queue limit, hence "
+               "only the last entry shall be rejected.";
+}
+
+TEST_F(UdsSendQueueTest, higherPriorityOvertakesQueuedEntries)
+{
+    constexpr std::size_t hugeLimitNeverReached = 10;
+    UdsSendQueue<UdsFrameBufferV1> test(hugeLimitNeverReached);
+
+    test.pushBack(createFrame(0));
+    test.showFront(); // entry being sent must not be overtaken
+    test.pushBack(createFrame(1), nullptr, IUdsSender::Priority::LOW);
+    test.pushBack(createFrame(2), nullptr, IUdsSender::Priority::NORMAL);
+    test.pushBack(createFrame(3), nullptr, IUdsSender::Priority::LOW);
+    test.pushBack(createFrame(4), nullptr, IUdsSender::Priority::HIGH);
+    test.pushBack(createFrame(5), nullptr, IUdsSender::Priority::NORMAL);
+    test.pushBack(createFrame(6), nullptr, IUdsSender::Priority::HIGH);
+
+    std::vector<smrf::Byte> sentData;
+    do {
+        sentData.push_back(extractBodyData(test.showFront()));
+    } while (test.popFrontOnSuccess(boost::system::error_code()));
+
+    EXPECT_EQ(sentData, (std::vector<smrf::Byte>{0, 4, 6, 2, 5, 1, 3}));
+}
+
+TEST_F(UdsSendQueueTest, higherPriorityReplacesLowestPriorityIfQueueIsFull)
+{
+    constexpr smrf::Byte testLimit{3};
+    UdsSendQueue<UdsFrameBufferV1> test(testLimit);
+    auto addErrorCallback = [this](smrf::Byte data) {
+        return [this, data](const exceptions::JoynrRuntimeException& ex) {
+            _queuedErrorCallbacks.push_back({data, ex});
+        };
+    };
+
+    test.pushBack(createFrame(0), addErrorCallback(0), IUdsSender::Priority::LOW);
+    test.pushBack(createFrame(1), addErrorCallback(1), IUdsSender::Priority::NORMAL);
+    test.pushBack(createFrame(2), addErrorCallback(2), IUdsSender::Priority::LOW);
 
-    for (std::size_t i = 0; i < _queuedErrorCallbacks.size(); i++) {
-        EXPECT_EQ(_queuedErrorCallbacks[i].first, i + 1)
-                << "The error callback shall start at the second entry inserted, since the first "
-                   "entry has already been shown to the sender socket.";
+    test.pushBack(createFrame(3), addErrorCallback(3), IUdsSender::Priority::HIGH);
+    EXPECT_EQ(getErrorCallbackData(), std::vector<smrf::Byte>{2})
+            << "The most recent entry of the lowest priority shall be dropped.";
+
+    test.pushBack(createFrame(4), addErrorCallback(4), IUdsSender::Priority::LOW);
+    EXPECT_EQ(getErrorCallbackData(), (std::vector<smrf::Byte>{2, 4}))
+            << "An entry must not replace an entry of the same priority.";
+
+    std::vector<smrf::Byte> sentData;
+    do {
+        sentData.push_back(extractBodyData(test.showFront()));
+    } while (test.popFrontOnSuccess(boost::system::error_code()));
+    EXPECT_EQ(sentData, (std::vector<smrf::Byte>{3, 1, 0}));
+}
+
+TEST_F(UdsSendQueueTest, backpressureWithHysteresis)
+{
+    constexpr std::size_t testLimit{8};
+    std::vector<bool> backpressureChanges;
+    UdsSendQueue<UdsFrameBufferV1> test(
+            testLimit, [&backpressureChanges](bool isPaused) {
+                backpressureChanges.push_back(isPaused);
+            });
+
+    // high watermark is 6
+    for (smrf::Byte i = 0; i < 5; i++) {
+        test.pushBack(createFrame(i));
+    }
+    EXPECT_TRUE(backpressureChanges.empty());
+    test.pushBack(createFrame(5));
+    EXPECT_EQ(backpressureChanges, std::vector<bool>{true});
+    EXPECT_TRUE(test.isPaused());
+    test.pushBack(createFrame(6));
+    EXPECT_EQ(backpressureChanges, std::vector<bool>{true}) << "Pause shall be signaled once.";
+
+    // low watermark is 2, the entry shown to the sender socket is not counted
+    for (int i = 0; i < 4; i++) {
+        test.showFront();
+        test.popFrontOnSuccess(boost::system::error_code());
+    }
+    EXPECT_EQ(backpressureChanges, std::vector<bool>{true})
+            << "Queue shall stay paused until the low watermark is reached.";
+    test.showFront();
+    test.popFrontOnSuccess(boost::system::error_code());
+    EXPECT_EQ(backpressureChanges, (std::vector<bool>{true, false}));
+    EXPECT_FALSE(test.isPaused());
+}
+
+TEST_F(UdsSendQueueTest, clearQueueReleasesBackpressure)
+{
+    constexpr std::size_t testLimit{4};
+    std::vector<bool> backpressureChanges;
+    UdsSendQueue<UdsFrameBufferV1> test(
+            testLimit, [&backpressureChanges](bool isPaused) {
+                backpressureChanges.push_back(isPaused);
+            });
+
+    for (smrf::Byte i = 0; i < testLimit; i++) {
+        test.pushBack(createFrame(i));
     }
+    test.emptyQueueAndNotify("");
+    EXPECT_EQ(backpressureChanges, (std::vector<bool>{true, false}));
+    EXPECT_FALSE(test.isPaused());
 }
 
 TEST_F(UdsSendQueueTest, clearQueueWhileSending)
@@ -215,6 +311,8 @@ TEST_F(UdsSendQueueTest, zeroLimit)
         test.pushBack(createFrame(i), [this, i](const exceptions::JoynrRuntimeException& ex) {
             _queuedErrorCallbacks.push_back({i, ex});
         });
-        EXPECT_EQ(_queuedErrorCallbacks.size(), i);
     }
+    EXPECT_EQ(getErrorCallbackData(), (std::vector<smrf::Byte>{1, 2}))
+            << "A zero limit shall still allow one queued entry.";
+    EXPECT_EQ(extractBodyData(test.showFront()), 0);
 }
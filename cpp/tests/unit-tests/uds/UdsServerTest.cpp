@@ -168,7 +168,9 @@ TEST_F(UdsServerTest, robustness_sendException_otherClientsNotAffected)
     constexpr std::size_t sizeViolatingLimit =
             1UL + std::numeric_limits<UdsFrameBufferV1::BodyLength>::max();
     smrf::ByteArrayView viewCausingException(nullptr, sizeViolatingLimit);
-    erroneousSender->send(viewCausingException, [](const exceptions::JoynrRuntimeException&) {});
+    erroneousSender->send(viewCausingException,
+                          [](const exceptions::JoynrRuntimeException&) {},
+                          IUdsSender::Priority::NORMAL);
     ASSERT_TRUE(disconnectionSemaphore->waitFor(_waitPeriodForClientServerCommunication))
             << "Failed to receive disconnection callback for other client.";
 
@@ -344,6 +346,49 @@ TEST_F(UdsServerTest, robustness_nonblockingWrite)
     ASSERT_FALSE(disconnectSemaphore->getStatus());
 }
 
+TEST_F(UdsServerTest, backpressureOfBlockingClient)
+{
+    auto connectionSemaphore = std::make_shared<Semaphore>();
+    auto pausedSemaphore = std::make_shared<Semaphore>(0);
+    auto resumedSemaphore = std::make_shared<Semaphore>(0);
+
+    MockUdsServerCallbacks mockUdsServerCallbacks;
+    std::shared_ptr<joynr::IUdsSender> blockingClientSender;
+    EXPECT_CALL(mockUdsServerCallbacks, connectedMock(_, _))
+            .Times(2)
+            .WillRepeatedly(DoAll(
+                    SaveArg<1>(&blockingClientSender), ReleaseSemaphore(connectionSemaphore)));
+    EXPECT_CALL(mockUdsServerCallbacks, disconnected(_)).Times(AtMost(1));
+    _udsSettings.setSendingQueueSize(64);
+    auto server = createServer(mockUdsServerCallbacks);
+    server->setBackpressureCallback(
+            [pausedSemaphore, resumedSemaphore](
+                    const joynr::system::RoutingTypes::UdsClientAddress& address, bool isPaused) {
+                EXPECT_EQ(address.getId(), "blockMessageProcessing");
+                (isPaused ? pausedSemaphore : resumedSemaphore)->notify();
+            });
+    server->start();
+    ASSERT_TRUE(connectionSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for good client.";
+
+    _udsSettings.setClientId("blockMessageProcessing");
+    BlockReceptionClient blockingClient(_udsSettings);
+    blockingClient.start();
+    ASSERT_TRUE(connectionSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for blocking client.";
+
+    for (unsigned int i = 0; i < 1024; i++) {
+        sendToClient(blockingClientSender, smrf::ByteVector(1024, 1));
+    }
+    ASSERT_TRUE(pausedSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "High watermark not reported.";
+    EXPECT_FALSE(resumedSemaphore->getStatus());
+
+    blockingClient.stopBlocking();
+    ASSERT_TRUE(resumedSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Low watermark not reported.";
+}
+
 TEST_F(UdsServerTest, sendToClientWhileClientDisconnection)
 {
     auto semaphore = std::make_shared<Semaphore>();
@@ -587,3 +632,126 @@ TEST_F(UdsServerTest, getCorrectUsernameAfterConnection)
     std::string expectedUsername = getUserName();
     ASSERT_EQ(capturedUsername, expectedUsername);
 }
+
+TEST_F(UdsServerTest, sendAndReceiveViaSharedMemory)
+{
+    constexpr std::size_t sharedMemorySize = 1024;
+    _udsSettings.setSharedMemorySize(sharedMemorySize);
+    restartClient();
+
+    auto connectedSemaphore = std::make_shared<Semaphore>();
+    auto receivedSemaphore = std::make_shared<Semaphore>();
+    MockUdsServerCallbacks mockUdsServerCallbacks;
+    std::shared_ptr<joynr::IUdsSender> sender;
+    EXPECT_CALL(mockUdsServerCallbacks, connectedMock(_, _))
+            .WillOnce(DoAll(SaveArg<1>(&sender), ReleaseSemaphore(connectedSemaphore)));
+    const smrf::Byte message1 = 42;
+    const smrf::Byte message2 = 43;
+    // larger than the shared memory, hence sent via socket
+    const smrf::ByteVector largeMessage(2 * sharedMemorySize, 44);
+    // messages sent via socket and shared memory keep their order
+    Sequence sequence;
+    EXPECT_CALL(mockUdsServerCallbacks, receivedMock(_, ElementsAre(message1), _))
+            .InSequence(sequence)
+            .WillOnce(ReleaseSemaphore(receivedSemaphore));
+    EXPECT_CALL(mockUdsServerCallbacks, receivedMock(_, Eq(largeMessage), _))
+            .InSequence(sequence)
+            .WillOnce(ReleaseSemaphore(receivedSemaphore));
+    EXPECT_CALL(mockUdsServerCallbacks, receivedMock(_, ElementsAre(message2), _))
+            .InSequence(sequence)
+            .WillOnce(ReleaseSemaphore(receivedSemaphore));
+    auto server = createServer(mockUdsServerCallbacks);
+    server->start();
+    ASSERT_TRUE(connectedSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback.";
+
+    sendFromClient(message1);
+    sendFromClient(largeMessage);
+    sendFromClient(message2);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(receivedSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+                << "Failed to receive message from client.";
+    }
+
+    const smrf::ByteVector messageWithContent(10, 1);
+    const smrf::ByteVector messageEmpty;
+    sendToClient(sender, messageWithContent);
+    sendToClient(sender, largeMessage);
+    sendToClient(sender, messageEmpty);
+    ASSERT_EQ(waitFor(_messagesReceivedByClient, 3), 3);
+    std::lock_guard<std::mutex> lck(_syncAllMutex);
+    EXPECT_THAT(_messagesReceivedByClient,
+                ElementsAre(messageWithContent, largeMessage, messageEmpty));
+}
+
+TEST_F(UdsServerTest, sharedMemoryOnlyAnnouncedToClientsSupportingIt)
+{
+    _udsSettings.setSharedMemorySize(1024);
+    auto connectSemaphore = std::make_shared<Semaphore>();
+    MockUdsServerCallbacks mockUdsServerCallbacks;
+    std::shared_ptr<joynr::IUdsSender> tmpSender;
+    EXPECT_CALL(mockUdsServerCallbacks, connectedMock(_, _))
+            .WillRepeatedly(DoAll(SaveArg<1>(&tmpSender), ReleaseSemaphore(connectSemaphore)));
+    auto server = createServer(mockUdsServerCallbacks);
+    server->start();
+    ASSERT_TRUE(connectSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for default client.";
+
+    // client without shared memory support receives the message via socket only
+    ErroneousClient clientWithoutSharedMemory(_udsSettings);
+    joynr::UdsFrameBufferV1 initFrame(
+            joynr::system::RoutingTypes::UdsClientAddress("clientWithoutSharedMemory"));
+    EXPECT_TRUE(clientWithoutSharedMemory.write(initFrame.raw()));
+    ASSERT_TRUE(connectSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for client without shared memory.";
+    const smrf::ByteVector message(1, 42);
+    sendToClient(tmpSender, message);
+    joynr::UdsFrameBufferV1 frame;
+    ASSERT_TRUE(clientWithoutSharedMemory.readFrame(frame));
+    EXPECT_FALSE(frame.isSharedMemoryInit());
+    EXPECT_EQ(frame.readMessage(), message);
+
+    // client announcing shared memory support receives the server's ring buffer first
+    ErroneousClient clientWithSharedMemory(_udsSettings);
+    joynr::UdsFrameBufferV1 initFrameWithCapability(
+            joynr::system::RoutingTypes::UdsClientAddress("clientWithSharedMemory"), true);
+    EXPECT_TRUE(clientWithSharedMemory.write(initFrameWithCapability.raw()));
+    ASSERT_TRUE(connectSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for client with shared memory.";
+    ASSERT_TRUE(clientWithSharedMemory.readFrame(frame));
+    EXPECT_TRUE(frame.isSharedMemoryInit());
+}
+
+TEST_F(UdsServerTest, unreadSharedMemoryMessagesFailedOnDisconnection)
+{
+    _udsSettings.setSharedMemorySize(1024);
+    auto connectSemaphore = std::make_shared<Semaphore>();
+    auto sendFailedSemaphore = std::make_shared<Semaphore>();
+    MockUdsServerCallbacks mockUdsServerCallbacks;
+    std::shared_ptr<joynr::IUdsSender> tmpSender;
+    EXPECT_CALL(mockUdsServerCallbacks, connectedMock(_, _))
+            .WillRepeatedly(DoAll(SaveArg<1>(&tmpSender), ReleaseSemaphore(connectSemaphore)));
+    EXPECT_CALL(mockUdsServerCallbacks, sendFailed(_))
+            .Times(1)
+            .WillOnce(ReleaseSemaphore(sendFailedSemaphore));
+    auto server = createServer(mockUdsServerCallbacks);
+    server->start();
+    ASSERT_TRUE(connectSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for default client.";
+
+    {
+        // client never reads the server's ring buffer
+        ErroneousClient client(_udsSettings);
+        joynr::UdsFrameBufferV1 initFrame(
+                joynr::system::RoutingTypes::UdsClientAddress("clientWithSharedMemory"), true);
+        EXPECT_TRUE(client.write(initFrame.raw()));
+        ASSERT_TRUE(connectSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+                << "Failed to receive connection callback for client with shared memory.";
+        joynr::UdsFrameBufferV1 frame;
+        ASSERT_TRUE(client.readFrame(frame));
+        ASSERT_TRUE(frame.isSharedMemoryInit());
+        sendToClient(tmpSender, smrf::ByteVector(1, 42), mockUdsServerCallbacks);
+    }
+    EXPECT_TRUE(sendFailedSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive send-failure for unread shared memory message.";
+}
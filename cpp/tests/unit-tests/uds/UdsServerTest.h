@@ -101,6 +101,16 @@ protected:
             return !error;
         }
 
+        bool readFrame(joynr::UdsFrameBufferV1& frame)
+        {
+            boost::system::error_code error;
+            boost::asio::read(_socket, frame.header(), error);
+            if (!error) {
+                boost::asio::read(_socket, frame.body(), error);
+            }
+            return !error;
+        }
+
         bool waitTillClose()
         {
             const auto tbegin = std::chrono::steady_clock::now();
@@ -197,7 +207,9 @@ protected:
     void sendFromClient(const smrf::ByteVector& message)
     {
         smrf::ByteArrayView messageView(message);
-        _client->send(messageView, [](const joynr::exceptions::JoynrRuntimeException&) {});
+        _client->send(messageView,
+                      [](const joynr::exceptions::JoynrRuntimeException&) {},
+                      joynr::IUdsSender::Priority::NORMAL);
     }
 
     template <typename V>
@@ -239,7 +251,7 @@ protected:
             const joynr::IUdsSender::SendFailed& callback =
                     [](const joynr::exceptions::JoynrRuntimeException&) {})
     {
-        user->send(smrf::ByteArrayView(msg), callback);
+        user->send(smrf::ByteArrayView(msg), callback, joynr::IUdsSender::Priority::NORMAL);
     }
 
     static void sendToClient(std::shared_ptr<joynr::IUdsSender>& user,
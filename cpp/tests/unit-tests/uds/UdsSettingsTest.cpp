@@ -56,12 +56,14 @@ TEST_F(UdsSettingsTest, intializedWithDefaultSettings)
     EXPECT_TRUE(udsSettings.contains(UdsSettings::SETTING_CONNECT_SLEEP_TIME_MS()));
     EXPECT_TRUE(udsSettings.contains(UdsSettings::SETTING_CLIENT_ID()));
     EXPECT_TRUE(udsSettings.contains(UdsSettings::SETTING_SENDING_QUEUE_SIZE()));
+    EXPECT_TRUE(udsSettings.contains(UdsSettings::SETTING_SHARED_MEMORY_SIZE()));
 
     EXPECT_EQ(udsSettings.getSocketPath(), joynr::UdsSettings::DEFAULT_SOCKET_PATH());
     EXPECT_EQ(udsSettings.getConnectSleepTimeMs(),
               joynr::UdsSettings::DEFAULT_CONNECT_SLEEP_TIME_MS());
     EXPECT_NE(udsSettings.getClientId(), "");
     EXPECT_EQ(udsSettings.getSendingQueueSize(), joynr::UdsSettings::DEFAULT_SENDING_QUEUE_SIZE());
+    EXPECT_EQ(udsSettings.getSharedMemorySize(), joynr::UdsSettings::DEFAULT_SHARED_MEMORY_SIZE());
 }
 
 TEST_F(UdsSettingsTest, overrideDefaultSettings)
@@ -94,6 +96,11 @@ TEST_F(UdsSettingsTest, overrideDefaultSettings)
     udsSettings.setSendingQueueSize(expectedSendingQueueSize);
     const auto sendingQueueSize = udsSettings.getSendingQueueSize();
     EXPECT_EQ(expectedSendingQueueSize, sendingQueueSize);
+
+    const std::size_t expectedSharedMemorySize(1024 * 1024);
+    EXPECT_NE(expectedSharedMemorySize, joynr::UdsSettings::DEFAULT_SHARED_MEMORY_SIZE());
+    udsSettings.setSharedMemorySize(expectedSharedMemorySize);
+    EXPECT_EQ(expectedSharedMemorySize, udsSettings.getSharedMemorySize());
 }
 
 TEST_F(UdsSettingsTest, createsUdsAddress)
@@ -0,0 +1,149 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "tests/utils/Gmock.h"
+#include "tests/utils/Gtest.h"
+
+#include "libjoynr/uds/UdsSharedMemoryRingBuffer.h"
+
+#include "joynr/exceptions/JoynrException.h"
+
+using namespace joynr;
+using namespace testing;
+
+class UdsSharedMemoryRingBufferTest : public ::testing::Test
+{
+protected:
+    static constexpr std::size_t _capacity = 64;
+
+    UdsSharedMemoryRingBufferTest()
+            : _writer(UdsSharedMemoryRingBuffer::create(_capacity)),
+              _reader(UdsSharedMemoryRingBuffer::open(_writer->getName()))
+    {
+    }
+
+    static smrf::ByteVector createMessage(std::size_t size, smrf::Byte firstByte)
+    {
+        smrf::ByteVector message(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            message[i] = static_cast<smrf::Byte>(firstByte + i);
+        }
+        return message;
+    }
+
+    std::unique_ptr<UdsSharedMemoryRingBuffer> _writer;
+    std::unique_ptr<UdsSharedMemoryRingBuffer> _reader;
+};
+
+constexpr std::size_t UdsSharedMemoryRingBufferTest::_capacity;
+
+TEST_F(UdsSharedMemoryRingBufferTest, messagesAreReadInOrder)
+{
+    EXPECT_EQ(_capacity, _reader->getCapacity());
+    const smrf::ByteVector message1 = createMessage(10, 1);
+    const smrf::ByteVector message2;
+    const smrf::ByteVector message3 = createMessage(3, 100);
+    ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(message1)));
+    ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(message2)));
+    ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(message3)));
+
+    const std::uint64_t writePosition = _writer->getWritePosition();
+    smrf::ByteVector received;
+    ASSERT_TRUE(_reader->tryRead(received, writePosition));
+    EXPECT_EQ(message1, received);
+    ASSERT_TRUE(_reader->tryRead(received, writePosition));
+    EXPECT_EQ(message2, received);
+    ASSERT_TRUE(_reader->tryRead(received, writePosition));
+    EXPECT_EQ(message3, received);
+    EXPECT_FALSE(_reader->tryRead(received, writePosition));
+    EXPECT_EQ(writePosition, _writer->getReadPosition());
+}
+
+TEST_F(UdsSharedMemoryRingBufferTest, messagesWrapAroundEndOfBuffer)
+{
+    smrf::ByteVector received;
+    for (smrf::Byte i = 0; i < 20; ++i) {
+        const smrf::ByteVector message = createMessage(21, i);
+        ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(message)));
+        ASSERT_TRUE(_reader->tryRead(received, _writer->getWritePosition()));
+        EXPECT_EQ(message, received);
+    }
+}
+
+TEST_F(UdsSharedMemoryRingBufferTest, writeFailsIfMessageDoesNotFit)
+{
+    const smrf::ByteVector tooLarge = createMessage(_capacity, 0);
+    EXPECT_FALSE(_writer->tryWrite(smrf::ByteArrayView(tooLarge)));
+
+    // length field and payload use the whole capacity
+    const smrf::ByteVector fitsExactly = createMessage(_capacity - sizeof(std::uint32_t), 0);
+    ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(fitsExactly)));
+    const smrf::ByteVector empty;
+    EXPECT_FALSE(_writer->tryWrite(smrf::ByteArrayView(empty)));
+
+    smrf::ByteVector received;
+    ASSERT_TRUE(_reader->tryRead(received, _writer->getWritePosition()));
+    EXPECT_EQ(fitsExactly, received);
+    EXPECT_TRUE(_writer->tryWrite(smrf::ByteArrayView(empty)));
+}
+
+TEST_F(UdsSharedMemoryRingBufferTest, readStopsAtSignaledPosition)
+{
+    const smrf::ByteVector message1 = createMessage(10, 1);
+    const smrf::ByteVector message2 = createMessage(10, 2);
+    ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(message1)));
+    const std::uint64_t signaledPosition = _writer->getWritePosition();
+    ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(message2)));
+
+    smrf::ByteVector received;
+    ASSERT_TRUE(_reader->tryRead(received, signaledPosition));
+    EXPECT_EQ(message1, received);
+    EXPECT_FALSE(_reader->tryRead(received, signaledPosition));
+    ASSERT_TRUE(_reader->tryRead(received, _writer->getWritePosition()));
+    EXPECT_EQ(message2, received);
+}
+
+TEST_F(UdsSharedMemoryRingBufferTest, signaledPositionBehindWritePositionIsRejected)
+{
+    const smrf::ByteVector message = createMessage(10, 1);
+    ASSERT_TRUE(_writer->tryWrite(smrf::ByteArrayView(message)));
+
+    smrf::ByteVector received;
+    EXPECT_THROW(_reader->tryRead(received, _writer->getWritePosition() + 1),
+                 exceptions::JoynrRuntimeException);
+}
+
+TEST_F(UdsSharedMemoryRingBufferTest, nameIsRemovedAfterOpen)
+{
+    EXPECT_THROW(UdsSharedMemoryRingBuffer::open(_writer->getName()),
+                 exceptions::JoynrRuntimeException);
+}
+
+TEST_F(UdsSharedMemoryRingBufferTest, openRejectsForeignNames)
+{
+    try {
+        UdsSharedMemoryRingBuffer::open("/some-other-segment");
+        FAIL() << "Only joynr segments must be opened";
+    } catch (const exceptions::JoynrRuntimeException& e) {
+        EXPECT_THAT(e.getMessage(), HasSubstr("Invalid shared memory name"));
+    }
+}
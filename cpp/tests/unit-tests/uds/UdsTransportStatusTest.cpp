@@ -0,0 +1,114 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+#include "joynr/system/RoutingTypes/UdsAddress.h"
+#include "joynr/system/RoutingTypes/UdsClientAddress.h"
+
+#include "libjoynr/uds/UdsTransportStatus.h"
+
+using namespace joynr;
+
+class UdsTransportStatusTest : public ::testing::Test
+{
+public:
+    UdsTransportStatusTest()
+            : _clientAddress1("client1"),
+              _clientAddress2("client2"),
+              _serverAddress("/tmp/joynr.sock"),
+              _availabilityChanges(),
+              _availableDestinations()
+    {
+        _transportStatus.setAvailabilityChangedCallback(
+                [this](bool isAvailable) { _availabilityChanges.push_back(isAvailable); });
+        _transportStatus.setDestinationAvailableCallback(
+                [this](std::shared_ptr<const system::RoutingTypes::Address> destAddress) {
+                    _availableDestinations.push_back(destAddress->toString());
+                });
+    }
+
+protected:
+    UdsTransportStatus _transportStatus;
+    system::RoutingTypes::UdsClientAddress _clientAddress1;
+    system::RoutingTypes::UdsClientAddress _clientAddress2;
+    system::RoutingTypes::UdsAddress _serverAddress;
+    std::vector<bool> _availabilityChanges;
+    std::vector<std::string> _availableDestinations;
+};
+
+TEST_F(UdsTransportStatusTest, isResponsibleForUdsAddressesOnly)
+{
+    EXPECT_TRUE(_transportStatus.isReponsibleFor(
+            std::make_shared<system::RoutingTypes::UdsClientAddress>(_clientAddress1)));
+    EXPECT_TRUE(_transportStatus.isReponsibleFor(
+            std::make_shared<system::RoutingTypes::UdsAddress>(_serverAddress)));
+    EXPECT_FALSE(_transportStatus.isReponsibleFor(
+            std::make_shared<system::RoutingTypes::MqttAddress>("broker", "topic")));
+}
+
+TEST_F(UdsTransportStatusTest, pausesSingleClient)
+{
+    auto client1 = std::make_shared<system::RoutingTypes::UdsClientAddress>(_clientAddress1);
+    auto client2 = std::make_shared<system::RoutingTypes::UdsClientAddress>(_clientAddress2);
+    EXPECT_TRUE(_transportStatus.isAvailable());
+    EXPECT_TRUE(_transportStatus.isAvailableFor(client1));
+
+    _transportStatus.onBackpressureChanged(_clientAddress1, true);
+    EXPECT_FALSE(_transportStatus.isAvailable());
+    EXPECT_FALSE(_transportStatus.isAvailableFor(client1));
+    EXPECT_TRUE(_transportStatus.isAvailableFor(client2));
+    EXPECT_TRUE(_transportStatus.isAvailableFor(
+            std::make_shared<system::RoutingTypes::UdsAddress>(_serverAddress)));
+
+    _transportStatus.onBackpressureChanged(_clientAddress1, false);
+    EXPECT_TRUE(_transportStatus.isAvailable());
+    EXPECT_TRUE(_transportStatus.isAvailableFor(client1));
+    EXPECT_EQ(_availableDestinations, std::vector<std::string>{_clientAddress1.toString()});
+    EXPECT_TRUE(_availabilityChanges.empty())
+            << "Resuming a single destination must not resume the whole transport";
+}
+
+TEST_F(UdsTransportStatusTest, pausesServer)
+{
+    auto server = std::make_shared<system::RoutingTypes::UdsAddress>(_serverAddress);
+    _transportStatus.onBackpressureChanged(_serverAddress, true);
+    EXPECT_FALSE(_transportStatus.isAvailableFor(server));
+    _transportStatus.onBackpressureChanged(_serverAddress, false);
+    EXPECT_TRUE(_transportStatus.isAvailableFor(server));
+    EXPECT_EQ(_availableDestinations, std::vector<std::string>{_serverAddress.toString()});
+}
+
+TEST_F(UdsTransportStatusTest, ignoresRepeatedAndUnknownChanges)
+{
+    _transportStatus.onBackpressureChanged(_clientAddress2, false);
+    EXPECT_TRUE(_availableDestinations.empty()) << "Resuming a destination which is not paused";
+
+    _transportStatus.onBackpressureChanged(_clientAddress1, true);
+    _transportStatus.onBackpressureChanged(_clientAddress1, true);
+    EXPECT_TRUE(_availableDestinations.empty());
+
+    _transportStatus.onBackpressureChanged(_clientAddress1, false);
+    _transportStatus.onBackpressureChanged(_clientAddress1, false);
+    EXPECT_EQ(_availableDestinations, std::vector<std::string>{_clientAddress1.toString()});
+}
@@ -0,0 +1,239 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <memory>
+#include <string>
+
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/Metrics.h"
+#include "joynr/TlsSessionCache.h"
+
+using namespace joynr;
+
+namespace
+{
+struct SslDeleter {
+    void operator()(SSL* ssl) const
+    {
+        SSL_free(ssl);
+    }
+    void operator()(SSL_CTX* context) const
+    {
+        SSL_CTX_free(context);
+    }
+    void operator()(EVP_PKEY* key) const
+    {
+        EVP_PKEY_free(key);
+    }
+    void operator()(X509* certificate) const
+    {
+        X509_free(certificate);
+    }
+};
+
+template <typename T>
+using SslPtr = std::unique_ptr<T, SslDeleter>;
+} // namespace
+
+/**
+ * Runs TLS handshakes between a client and a server which are connected by an in-memory
+ * BIO pair, i.e. a loopback connection without sockets.
+ */
+class TlsSessionCacheTest : public ::testing::TestWithParam<int>
+{
+public:
+    TlsSessionCacheTest()
+            : _metricsPrefix("test.tls." +
+                             std::string(::testing::UnitTest::GetInstance()
+                                                 ->current_test_info()
+                                                 ->name())),
+              _serverContext(SSL_CTX_new(TLS_server_method())),
+              _clientContext(SSL_CTX_new(TLS_client_method())),
+              _cache(std::make_shared<TlsSessionCache>(_metricsPrefix))
+    {
+        metrics::MetricsRegistry::instance().reset();
+        setupServerContext();
+        SSL_CTX_set_verify(_clientContext.get(), SSL_VERIFY_NONE, nullptr);
+        SSL_CTX_set_max_proto_version(_clientContext.get(), GetParam());
+    }
+
+protected:
+    bool connect()
+    {
+        SslPtr<SSL> client(SSL_new(_clientContext.get()));
+        SslPtr<SSL> server(SSL_new(_serverContext.get()));
+        BIO* clientBio = nullptr;
+        BIO* serverBio = nullptr;
+        if (BIO_new_bio_pair(&clientBio, 0, &serverBio, 0) != 1) {
+            return false;
+        }
+        SSL_set_bio(client.get(), clientBio, clientBio);
+        SSL_set_bio(server.get(), serverBio, serverBio);
+        SSL_set_connect_state(client.get());
+        SSL_set_accept_state(server.get());
+
+        bool isClientDone = false;
+        bool isServerDone = false;
+        for (int i = 0; i < 20 && !(isClientDone && isServerDone); ++i) {
+            isClientDone = isClientDone || SSL_do_handshake(client.get()) == 1;
+            isServerDone = isServerDone || SSL_do_handshake(server.get()) == 1;
+        }
+        // let the client process post handshake messages, e.g. TLS 1.3 session tickets
+        char buffer;
+        SSL_read(client.get(), &buffer, sizeof(buffer));
+        SSL_shutdown(client.get());
+        SSL_shutdown(server.get());
+        return isClientDone && isServerDone;
+    }
+
+    std::uint64_t getCounterValue(const std::string& name) const
+    {
+        return metrics::MetricsRegistry::instance().getCounterValue(_metricsPrefix + name);
+    }
+
+    const std::string _metricsPrefix;
+    SslPtr<SSL_CTX> _serverContext;
+    SslPtr<SSL_CTX> _clientContext;
+    std::shared_ptr<TlsSessionCache> _cache;
+
+private:
+    void setupServerContext()
+    {
+        SslPtr<EVP_PKEY> key(EVP_PKEY_new());
+        {
+            std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> keyContext(
+                    EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr), &EVP_PKEY_CTX_free);
+            EVP_PKEY* generatedKey = nullptr;
+            ASSERT_EQ(1, EVP_PKEY_keygen_init(keyContext.get()));
+            ASSERT_EQ(1,
+                      EVP_PKEY_CTX_set_ec_paramgen_curve_nid(
+                              keyContext.get(), NID_X9_62_prime256v1));
+            ASSERT_EQ(1, EVP_PKEY_keygen(keyContext.get(), &generatedKey));
+            key.reset(generatedKey);
+        }
+
+        SslPtr<X509> certificate(X509_new());
+        X509_set_version(certificate.get(), 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(certificate.get()), 1);
+        X509_gmtime_adj(X509_getm_notBefore(certificate.get()), 0);
+        X509_gmtime_adj(X509_getm_notAfter(certificate.get()), 60 * 60);
+        X509_NAME* name = X509_get_subject_name(certificate.get());
+        X509_NAME_add_entry_by_txt(name,
+                                   "CN",
+                                   MBSTRING_ASC,
+                                   reinterpret_cast<const unsigned char*>("localhost"),
+                                   -1,
+                                   -1,
+                                   0);
+        X509_set_issuer_name(certificate.get(), name);
+        X509_set_pubkey(certificate.get(), key.get());
+        ASSERT_NE(0, X509_sign(certificate.get(), key.get(), EVP_sha256()));
+
+        ASSERT_EQ(1, SSL_CTX_use_certificate(_serverContext.get(), certificate.get()));
+        ASSERT_EQ(1, SSL_CTX_use_PrivateKey(_serverContext.get(), key.get()));
+        SSL_CTX_set_max_proto_version(_serverContext.get(), GetParam());
+    }
+};
+
+TEST_P(TlsSessionCacheTest, firstHandshakeIsFullAndReconnectIsResumed)
+{
+    _cache->attachTo(_clientContext.get());
+
+    ASSERT_TRUE(connect());
+    EXPECT_TRUE(_cache->hasSession());
+    EXPECT_EQ(1, getCounterValue(".handshake.full"));
+    EXPECT_EQ(0, getCounterValue(".handshake.resumed"));
+
+    ASSERT_TRUE(connect());
+    ASSERT_TRUE(connect());
+    EXPECT_EQ(1, getCounterValue(".handshake.full"));
+    EXPECT_EQ(2, getCounterValue(".handshake.resumed"));
+    EXPECT_EQ(3,
+              metrics::MetricsRegistry::instance()
+                      .getHistogramSnapshot(_metricsPrefix + ".handshake.latencyUs")
+                      .count);
+}
+
+TEST_P(TlsSessionCacheTest, sessionIsResumedWithNewClientContext)
+{
+    _cache->attachTo(_clientContext.get());
+    ASSERT_TRUE(connect());
+
+    // e.g. the websocket client creates a new context for every connection
+    _clientContext.reset(SSL_CTX_new(TLS_client_method()));
+    SSL_CTX_set_verify(_clientContext.get(), SSL_VERIFY_NONE, nullptr);
+    SSL_CTX_set_max_proto_version(_clientContext.get(), GetParam());
+    _cache->attachTo(_clientContext.get());
+
+    ASSERT_TRUE(connect());
+    EXPECT_EQ(1, getCounterValue(".handshake.full"));
+    EXPECT_EQ(1, getCounterValue(".handshake.resumed"));
+}
+
+TEST_P(TlsSessionCacheTest, changedCredentialsForceFullHandshake)
+{
+    _cache->attachTo(_clientContext.get(), "certificate1");
+    ASSERT_TRUE(connect());
+
+    // same credentials, e.g. a new context for a reconnect
+    _cache->attachTo(_clientContext.get(), "certificate1");
+    EXPECT_TRUE(_cache->hasSession());
+    ASSERT_TRUE(connect());
+
+    // rotated credentials
+    _cache->attachTo(_clientContext.get(), "certificate2");
+    EXPECT_FALSE(_cache->hasSession());
+    ASSERT_TRUE(connect());
+    EXPECT_EQ(2, getCounterValue(".handshake.full"));
+    EXPECT_EQ(1, getCounterValue(".handshake.resumed"));
+}
+
+TEST_P(TlsSessionCacheTest, clearForcesFullHandshake)
+{
+    _cache->attachTo(_clientContext.get());
+    ASSERT_TRUE(connect());
+
+    _cache->clear();
+    EXPECT_FALSE(_cache->hasSession());
+
+    ASSERT_TRUE(connect());
+    EXPECT_EQ(2, getCounterValue(".handshake.full"));
+    EXPECT_EQ(0, getCounterValue(".handshake.resumed"));
+}
+
+TEST_P(TlsSessionCacheTest, cacheOutlivesItsOwner)
+{
+    _cache->attachTo(_clientContext.get());
+    ASSERT_TRUE(connect());
+
+    // the context keeps the cache alive
+    _cache.reset();
+
+    ASSERT_TRUE(connect());
+    EXPECT_EQ(1, getCounterValue(".handshake.full"));
+    EXPECT_EQ(1, getCounterValue(".handshake.resumed"));
+}
+
+INSTANTIATE_TEST_SUITE_P(TlsVersions,
+                         TlsSessionCacheTest,
+                         ::testing::Values(TLS1_2_VERSION, TLS1_3_VERSION));
@@ -0,0 +1,103 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "tests/utils/Gtest.h"
+
+#include <string>
+#include <vector>
+
+#include <smrf/ByteArrayView.h>
+#include <smrf/ByteVector.h>
+
+#include "libjoynr/websocket/WebSocketMessageBatch.h"
+
+using namespace joynr;
+
+namespace
+{
+
+std::vector<smrf::ByteVector> splitFrame(const std::string& frame, bool& isValid)
+{
+    std::vector<smrf::ByteVector> messages;
+    isValid = WebSocketMessageBatch::split(
+            frame, [&messages](smrf::ByteVector&& message) {
+                messages.push_back(std::move(message));
+            });
+    return messages;
+}
+
+} // namespace
+
+TEST(WebSocketMessageBatchTest, splitReturnsAppendedMessagesInOrder)
+{
+    const smrf::ByteVector message1{1, 2, 3};
+    const smrf::ByteVector message2{};
+    smrf::ByteVector message3(70000, 0xAB);
+
+    std::string frame;
+    WebSocketMessageBatch::append(frame, smrf::ByteArrayView(message1));
+    WebSocketMessageBatch::append(frame, smrf::ByteArrayView(message2));
+    WebSocketMessageBatch::append(frame, smrf::ByteArrayView(message3));
+    EXPECT_EQ(3 * WebSocketMessageBatch::SIZE_PREFIX_LENGTH + message1.size() + message3.size(),
+              frame.size());
+
+    bool isValid = false;
+    const std::vector<smrf::ByteVector> messages = splitFrame(frame, isValid);
+    EXPECT_TRUE(isValid);
+    ASSERT_EQ(3u, messages.size());
+    EXPECT_EQ(message1, messages[0]);
+    EXPECT_EQ(message2, messages[1]);
+    EXPECT_EQ(message3, messages[2]);
+}
+
+TEST(WebSocketMessageBatchTest, sizePrefixIsBigEndian)
+{
+    const smrf::ByteVector message(258, 0);
+    std::string frame;
+    WebSocketMessageBatch::append(frame, smrf::ByteArrayView(message));
+
+    EXPECT_EQ(std::string("\x00\x00\x01\x02", 4), frame.substr(0, 4));
+}
+
+TEST(WebSocketMessageBatchTest, emptyFrameContainsNoMessages)
+{
+    bool isValid = false;
+    EXPECT_TRUE(splitFrame(std::string(), isValid).empty());
+    EXPECT_TRUE(isValid);
+}
+
+TEST(WebSocketMessageBatchTest, truncatedFrameIsRejected)
+{
+    const smrf::ByteVector message1{1, 2, 3};
+    const smrf::ByteVector message2{4, 5, 6};
+    std::string frame;
+    WebSocketMessageBatch::append(frame, smrf::ByteArrayView(message1));
+    WebSocketMessageBatch::append(frame, smrf::ByteArrayView(message2));
+
+    bool isValid = true;
+    std::vector<smrf::ByteVector> messages =
+            splitFrame(frame.substr(0, frame.size() - 1), isValid);
+    EXPECT_FALSE(isValid);
+    ASSERT_EQ(1u, messages.size());
+    EXPECT_EQ(message1, messages[0]);
+
+    isValid = true;
+    messages = splitFrame(std::string("\x00\x00", 2), isValid);
+    EXPECT_FALSE(isValid);
+    EXPECT_TRUE(messages.empty());
+}
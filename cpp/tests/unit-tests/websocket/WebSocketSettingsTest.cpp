@@ -52,6 +52,8 @@ TEST_F(WebSocketSettingsTest, intializedWithDefaultSettings)
 
     EXPECT_TRUE(wsSettings.contains(WebSocketSettings::SETTING_CC_MESSAGING_URL()));
     EXPECT_TRUE(wsSettings.contains(WebSocketSettings::SETTING_RECONNECT_SLEEP_TIME_MS()));
+    EXPECT_TRUE(wsSettings.contains(WebSocketSettings::SETTING_ENABLE_MESSAGE_BATCHING()));
+    EXPECT_TRUE(wsSettings.isMessageBatchingEnabled());
 }
 
 TEST_F(WebSocketSettingsTest, overrideDefaultSettings)
@@ -69,6 +71,15 @@ TEST_F(WebSocketSettingsTest, overrideDefaultSettings)
     EXPECT_EQ(expectedReconnectSleepTimeMs, reconnectSleepTimeMs);
 }
 
+TEST_F(WebSocketSettingsTest, disableMessageBatching)
+{
+    Settings testSettings(testSettingsFileName);
+    WebSocketSettings wsSettings(testSettings);
+    wsSettings.setMessageBatchingEnabled(false);
+
+    EXPECT_FALSE(wsSettings.isMessageBatchingEnabled());
+}
+
 TEST_F(WebSocketSettingsTest, createsWebSocketAddress)
 {
     std::string expectedMessagingUrl("ws://test-host:42/test-path");
@@ -20,9 +20,11 @@ package io.joynr.capabilities.directory;
 
 import static java.lang.String.format;
 
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Collection;
 import java.util.HashSet;
+import java.util.List;
 import java.util.Optional;
 import java.util.Set;
 import java.util.stream.Collectors;
@@ -186,6 +188,52 @@ public class CapabilitiesDirectoryImpl extends GlobalCapabilitiesDirectoryAbstra
         return promise;
     }
 
+    @Override
+    public Promise<AddMultipleDeferred> addMultiple(GlobalDiscoveryEntry[] globalDiscoveryEntries, String[] gbids) {
+        AddMultipleDeferred deferred = new AddMultipleDeferred();
+        Promise<AddMultipleDeferred> promise = new Promise<AddMultipleDeferred>(deferred);
+        if (globalDiscoveryEntries == null) {
+            logger.trace("Error adding GlobalDiscoveryEntries. List of entries is null");
+            deferred.reject(new ProviderRuntimeException("Error adding GlobalDiscoveryEntries. List of entries is null"));
+            return promise;
+        }
+        for (GlobalDiscoveryEntry globalDiscoveryEntry : globalDiscoveryEntries) {
+            if (globalDiscoveryEntry == null) {
+                logger.trace("Error adding GlobalDiscoveryEntry. Entry is null");
+                deferred.reject(new ProviderRuntimeException("Error adding GlobalDiscoveryEntry. Entry is null"));
+                return promise;
+            }
+        }
+        logger.info("Adding {} global discovery entries to {}", globalDiscoveryEntries.length, Arrays.toString(gbids));
+        switch (GcdUtilities.validateGbids(gbids, gcdGbid, validGbids)) {
+        case INVALID:
+            deferred.reject(DiscoveryError.INVALID_GBID);
+            break;
+        case UNKNOWN:
+            deferred.reject(DiscoveryError.UNKNOWN_GBID);
+            break;
+        case OK:
+            List<String> failedParticipantIds = new ArrayList<>();
+            for (GlobalDiscoveryEntry globalDiscoveryEntry : globalDiscoveryEntries) {
+                try {
+                    addInternal(globalDiscoveryEntry, gbids);
+                } catch (ProviderRuntimeException | ApplicationException e) {
+                    logger.warn("Error adding global discovery entry for {} to {}: {}",
+                                globalDiscoveryEntry.getParticipantId(),
+                                Arrays.toString(gbids),
+                                e.toString());
+                    failedParticipantIds.add(globalDiscoveryEntry.getParticipantId());
+                }
+            }
+            deferred.resolve(failedParticipantIds.toArray(new String[failedParticipantIds.size()]));
+            break;
+        default:
+            deferred.reject(DiscoveryError.INTERNAL_ERROR);
+            break;
+        }
+        return promise;
+    }
+
     @Override
     public Promise<DeferredVoid> remove(String[] participantIds) {
         DeferredVoid deferred = new DeferredVoid();
@@ -278,6 +326,67 @@ public class CapabilitiesDirectoryImpl extends GlobalCapabilitiesDirectoryAbstra
         return promise;
     }
 
+    @Override
+    public Promise<RemoveMultipleDeferred> removeMultiple(String[] participantIds, String[] gbids) {
+        RemoveMultipleDeferred deferred = new RemoveMultipleDeferred();
+        Promise<RemoveMultipleDeferred> promise = new Promise<RemoveMultipleDeferred>(deferred);
+        if (participantIds == null) {
+            deferred.reject(new ProviderRuntimeException("Error removing GlobalDiscoveryEntries. List of participantIds is null"));
+            return promise;
+        }
+        switch (GcdUtilities.validateGbids(gbids, gcdGbid, validGbids)) {
+        case INVALID:
+            logger.error("Error removing participantIds {}: INVALID GBIDs: {}",
+                         Arrays.toString(participantIds),
+                         Arrays.toString(gbids));
+            deferred.reject(DiscoveryError.INVALID_GBID);
+            break;
+        case UNKNOWN:
+            logger.error("Error removing participantIds {}: UNKNOWN_GBID: {}",
+                         Arrays.toString(participantIds),
+                         Arrays.toString(gbids));
+            deferred.reject(DiscoveryError.UNKNOWN_GBID);
+            break;
+        case OK:
+            String[] selectedGbids = Arrays.asList(gbids).stream().map(gbid -> {
+                if (gbid.isEmpty()) {
+                    logger.warn("Received removeMultiple with empty gbid, defaulting to ownGbid.");
+                    return gcdGbid;
+                } else {
+                    return gbid;
+                }
+            }).toArray(String[]::new);
+            List<String> failedParticipantIds = new ArrayList<>();
+            int deletedCount = 0;
+            for (String participantId : participantIds) {
+                try {
+                    int deletedCountForParticipant = removeInternal(participantId, selectedGbids);
+                    if (deletedCountForParticipant <= 0) {
+                        failedParticipantIds.add(participantId);
+                    } else {
+                        deletedCount += deletedCountForParticipant;
+                    }
+                } catch (Exception e) {
+                    logger.error("Error removing discoveryEntry for {} and gbids {}:",
+                                 participantId,
+                                 Arrays.toString(selectedGbids),
+                                 e);
+                    failedParticipantIds.add(participantId);
+                }
+            }
+            logger.info("Deleted {} entries (number of IDs passed in {}, failed {})",
+                        deletedCount,
+                        participantIds.length,
+                        failedParticipantIds.size());
+            deferred.resolve(failedParticipantIds.toArray(new String[failedParticipantIds.size()]));
+            break;
+        default:
+            deferred.reject(DiscoveryError.INTERNAL_ERROR);
+            break;
+        }
+        return promise;
+    }
+
     @Override
     public Promise<Lookup1Deferred> lookup(final String[] domains, final String interfaceName) {
         logger.info("Looking up global discovery entries for domains {} and interfaceName {} and own Gbid {}",
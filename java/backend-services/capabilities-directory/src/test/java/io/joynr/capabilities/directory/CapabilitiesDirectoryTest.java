@@ -18,6 +18,7 @@
  */
 package io.joynr.capabilities.directory;
 
+import static org.junit.Assert.assertArrayEquals;
 import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertNotNull;
 import static org.junit.Assert.assertTrue;
@@ -26,6 +27,7 @@ import static org.mockito.ArgumentMatchers.any;
 import static org.mockito.ArgumentMatchers.anyLong;
 import static org.mockito.ArgumentMatchers.anyString;
 import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.doNothing;
 import static org.mockito.Mockito.doReturn;
 import static org.mockito.Mockito.doThrow;
 import static org.mockito.Mockito.times;
@@ -57,11 +59,13 @@ import io.joynr.util.ObjectMapper;
 import joynr.exceptions.ApplicationException;
 import joynr.exceptions.ProviderRuntimeException;
 import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.Add1Deferred;
+import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.AddMultipleDeferred;
 import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.Lookup1Deferred;
 import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.Lookup2Deferred;
 import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.Lookup3Deferred;
 import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.Lookup4Deferred;
 import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.Remove1Deferred;
+import joynr.infrastructure.GlobalCapabilitiesDirectoryProvider.RemoveMultipleDeferred;
 import joynr.system.RoutingTypes.MqttAddress;
 import joynr.types.DiscoveryError;
 import joynr.types.GlobalDiscoveryEntry;
@@ -313,6 +317,52 @@ public class CapabilitiesDirectoryTest {
                               PARTICIPANT_ID);
     }
 
+    @Test
+    public void addMultiple_callsStoreWithSelectedGbids() throws InterruptedException {
+        GlobalDiscoveryEntry otherGlobalDiscoveryEntry = new GlobalDiscoveryEntry(testGlobalDiscoveryEntry);
+        otherGlobalDiscoveryEntry.setParticipantId(PARTICIPANT_ID + "2");
+        String[] selectedGbids = new String[]{ validGbids[1], "" };
+        String[] expectedGbids = new String[]{ validGbids[1], GCD_GBID };
+        Promise<AddMultipleDeferred> promise = subject.addMultiple(new GlobalDiscoveryEntry[]{
+                testGlobalDiscoveryEntry, otherGlobalDiscoveryEntry }, selectedGbids);
+        verify(discoveryEntryStoreMock, times(2)).add(gdepCaptor.capture(), eq(expectedGbids));
+        checkDiscoveryEntryPersisted(expectedGlobalDiscoveryEntry, gdepCaptor.getAllValues().get(0));
+        assertEquals(otherGlobalDiscoveryEntry.getParticipantId(),
+                     gdepCaptor.getAllValues().get(1).getParticipantId());
+        Object[] values = checkPromiseSuccess(promise);
+        assertArrayEquals(new String[0], (String[]) values[0]);
+    }
+
+    @Test
+    public void addMultiple_unknownGbid() throws InterruptedException {
+        Promise<AddMultipleDeferred> promise = subject.addMultiple(new GlobalDiscoveryEntry[]{
+                testGlobalDiscoveryEntry }, new String[]{ "unknownGbid" });
+        checkPromiseError(promise, DiscoveryError.UNKNOWN_GBID);
+        verify(discoveryEntryStoreMock, times(0)).add(any(GlobalDiscoveryEntryPersisted.class), any(String[].class));
+    }
+
+    @Test
+    public void addMultiple_invalidGbid() throws InterruptedException {
+        Promise<AddMultipleDeferred> promise = subject.addMultiple(new GlobalDiscoveryEntry[]{
+                testGlobalDiscoveryEntry }, new String[0]);
+        checkPromiseError(promise, DiscoveryError.INVALID_GBID);
+        verify(discoveryEntryStoreMock, times(0)).add(any(GlobalDiscoveryEntryPersisted.class), any(String[].class));
+    }
+
+    @Test
+    public void addMultiple_returnsFailedParticipantIds() throws InterruptedException {
+        GlobalDiscoveryEntry otherGlobalDiscoveryEntry = new GlobalDiscoveryEntry(testGlobalDiscoveryEntry);
+        otherGlobalDiscoveryEntry.setParticipantId(PARTICIPANT_ID + "2");
+        doNothing().doThrow(new RuntimeException("error in DiscoveryEntryStore"))
+                   .when(discoveryEntryStoreMock)
+                   .add(any(GlobalDiscoveryEntryPersisted.class), any(String[].class));
+        Promise<AddMultipleDeferred> promise = subject.addMultiple(new GlobalDiscoveryEntry[]{
+                testGlobalDiscoveryEntry, otherGlobalDiscoveryEntry }, validGbids.clone());
+        verify(discoveryEntryStoreMock, times(2)).add(any(GlobalDiscoveryEntryPersisted.class), eq(validGbids));
+        Object[] values = checkPromiseSuccess(promise);
+        assertArrayEquals(new String[]{ otherGlobalDiscoveryEntry.getParticipantId() }, (String[]) values[0]);
+    }
+
     @Test
     public void remove_callsStore() throws InterruptedException {
         Promise<DeferredVoid> promise = subject.remove(PARTICIPANT_ID);
@@ -416,6 +466,30 @@ public class CapabilitiesDirectoryTest {
         checkPromiseError(promise, DiscoveryError.NO_ENTRY_FOR_SELECTED_BACKENDS);
     }
 
+    @Test
+    public void removeMultiple_callsStoreAndReturnsFailedParticipantIds() throws InterruptedException {
+        String[] participantIds = new String[]{ PARTICIPANT_ID, PARTICIPANT_ID + "2", PARTICIPANT_ID + "3" };
+        String[] selectedGbids = new String[]{ validGbids[2], "" };
+        String[] expectedGbids = new String[]{ validGbids[2], GCD_GBID };
+        doReturn(1).when(discoveryEntryStoreMock).remove(eq(participantIds[0]), any(String[].class));
+        doReturn(0).when(discoveryEntryStoreMock).remove(eq(participantIds[1]), any(String[].class));
+        doReturn(-1).when(discoveryEntryStoreMock).remove(eq(participantIds[2]), any(String[].class));
+        Promise<RemoveMultipleDeferred> promise = subject.removeMultiple(participantIds, selectedGbids);
+        for (String participantId : participantIds) {
+            verify(discoveryEntryStoreMock).remove(eq(participantId), eq(expectedGbids));
+        }
+        Object[] values = checkPromiseSuccess(promise);
+        assertArrayEquals(new String[]{ participantIds[1], participantIds[2] }, (String[]) values[0]);
+    }
+
+    @Test
+    public void removeMultiple_unknownGbid() throws InterruptedException {
+        Promise<RemoveMultipleDeferred> promise = subject.removeMultiple(new String[]{ PARTICIPANT_ID },
+                                                                         new String[]{ "unknown" });
+        checkPromiseError(promise, DiscoveryError.UNKNOWN_GBID);
+        verify(discoveryEntryStoreMock, times(0)).remove(anyString(), any(String[].class));
+    }
+
     @Test
     public void lookupByDomainInterface_callsStoreAndFiltersByOwnGbid() throws InterruptedException {
         GlobalDiscoveryEntryPersisted gdep1 = new GlobalDiscoveryEntryPersisted(testGlobalDiscoveryEntry,
@@ -171,6 +171,28 @@ public class RoutingProviderImpl extends RoutingAbstractProvider {
         return new Promise<>(deferred);
     }
 
+    @Override
+    public Promise<DeferredVoid> addNextHops(String[] participantIds,
+                                             WebSocketClientAddress address,
+                                             Boolean isGloballyVisible) {
+        // If it throws, the error will be forwarded to the calling proxy
+        for (String participantId : participantIds) {
+            messageRouter.addNextHop(participantId, address, isGloballyVisible);
+        }
+        return resolvedDeferred();
+    }
+
+    @Override
+    public Promise<DeferredVoid> addNextHops(String[] participantIds,
+                                             UdsClientAddress address,
+                                             Boolean isGloballyVisible) {
+        final DeferredVoid deferred = new DeferredVoid();
+        final String msg = "UdsClientAddress is not supported in Java";
+        logger.error(msg);
+        deferred.reject(new ProviderRuntimeException(msg));
+        return new Promise<>(deferred);
+    }
+
     @Override
     public Promise<DeferredVoid> removeNextHop(String participantId) {
         messageRouter.removeNextHop(participantId);
@@ -185,6 +207,17 @@ public class RoutingProviderImpl extends RoutingAbstractProvider {
         return new Promise<>(deferred);
     }
 
+    @Override
+    public Promise<ResolveNextHopsDeferred> resolveNextHops(String[] participantIds) {
+        Boolean[] resolved = new Boolean[participantIds.length];
+        for (int i = 0; i < participantIds.length; i++) {
+            resolved[i] = messageRouter.resolveNextHop(participantIds[i]);
+        }
+        ResolveNextHopsDeferred deferred = new ResolveNextHopsDeferred();
+        deferred.resolve(resolved);
+        return new Promise<>(deferred);
+    }
+
     @Override
     public Promise<DeferredVoid> addMulticastReceiver(String multicastId,
                                                       String subscriberParticipantId,
@@ -18,11 +18,16 @@
  */
 package io.joynr.messaging.routing;
 
+import static org.junit.Assert.assertArrayEquals;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.anyBoolean;
 import static org.mockito.ArgumentMatchers.anyString;
 import static org.mockito.Mockito.doAnswer;
+import static org.mockito.Mockito.never;
 import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
 
 import java.lang.reflect.Field;
 import java.util.Optional;
@@ -55,6 +60,7 @@ import joynr.system.RoutingTypes.MqttAddress;
 import joynr.system.RoutingTypes.RoutingTypesUtil;
 import joynr.system.RoutingTypes.UdsAddress;
 import joynr.system.RoutingTypes.UdsClientAddress;
+import joynr.system.RoutingTypes.WebSocketClientAddress;
 
 @RunWith(MockitoJUnitRunner.class)
 public class RoutingProviderImplTest {
@@ -250,4 +256,48 @@ public class RoutingProviderImplTest {
         });
         assertTrue(cdl.await(1, TimeUnit.SECONDS));
     }
+
+    @Test
+    public void addNextHops_webSocketClientAddress_addsAllParticipants() {
+        final String[] participantIds = { "participantId1", "participantId2", "participantId3" };
+        final boolean isGloballyVisible = false;
+        final WebSocketClientAddress address = new WebSocketClientAddress("testClientId");
+        Promise<DeferredVoid> addNextHopsPromise = routingProvider.addNextHops(participantIds,
+                                                                              address,
+                                                                              isGloballyVisible);
+        assertTrue(addNextHopsPromise.isFulfilled());
+        for (String participantId : participantIds) {
+            verify(mockMessageRouter).addNextHop(participantId, address, isGloballyVisible);
+        }
+    }
+
+    @Test
+    public void addNextHops_udsClientAddress() {
+        final String[] participantIds = { "participantId1", "participantId2" };
+        final UdsClientAddress address = new UdsClientAddress();
+        Promise<DeferredVoid> addNextHopsPromise = routingProvider.addNextHops(participantIds, address, true);
+        assertTrue(addNextHopsPromise.isRejected());
+        verify(mockMessageRouter, never()).addNextHop(anyString(), any(), anyBoolean());
+    }
+
+    @Test
+    public void resolveNextHops_returnsResultPerParticipant() throws InterruptedException {
+        final String[] participantIds = { "knownParticipantId", "unknownParticipantId" };
+        when(mockMessageRouter.resolveNextHop("knownParticipantId")).thenReturn(true);
+        when(mockMessageRouter.resolveNextHop("unknownParticipantId")).thenReturn(false);
+        CountDownLatch cdl = new CountDownLatch(1);
+        routingProvider.resolveNextHops(participantIds).then(new PromiseListener() {
+            @Override
+            public void onRejection(JoynrException error) {
+                fail("resolveNextHops failed: " + error);
+            }
+
+            @Override
+            public void onFulfillment(Object... values) {
+                assertArrayEquals(new Boolean[]{ true, false }, (Boolean[]) values[0]);
+                cdl.countDown();
+            }
+        });
+        assertTrue(cdl.await(1, TimeUnit.SECONDS));
+    }
 }
@@ -0,0 +1,276 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "ChildProcess.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "LoadHarnessProtocol.h"
+
+namespace joynr
+{
+
+ChildProcess::ChildProcess(const std::string& name,
+                           const std::vector<std::string>& arguments,
+                           const std::string& workingDirectory,
+                           const std::string& logFileName)
+        : _name(name),
+          _pid(-1),
+          _isReaped(false),
+          _stdinFd(-1),
+          _stdoutFd(-1),
+          _logFile(logFileName, std::ios::trunc),
+          _linesMutex(),
+          _linesChanged(),
+          _lines(),
+          _isOutputClosed(false),
+          _readThread()
+{
+    if (arguments.empty()) {
+        throw std::invalid_argument("no executable given for " + name);
+    }
+    // prepared before fork, the child may only call async-signal-safe functions
+    std::vector<char*> argv;
+    for (const auto& argument : arguments) {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    int stdinPipe[2];
+    int stdoutPipe[2];
+    if (::pipe2(stdinPipe, O_CLOEXEC) != 0) {
+        throw std::runtime_error("unable to create pipe for " + name + ": " +
+                                 std::strerror(errno));
+    }
+    if (::pipe2(stdoutPipe, O_CLOEXEC) != 0) {
+        ::close(stdinPipe[0]);
+        ::close(stdinPipe[1]);
+        throw std::runtime_error("unable to create pipe for " + name + ": " +
+                                 std::strerror(errno));
+    }
+
+    _pid = ::fork();
+    if (_pid == 0) {
+        // do not leave processes behind if the harness is killed
+        ::prctl(PR_SET_PDEATHSIG, SIGTERM);
+        if (::chdir(workingDirectory.c_str()) != 0 || ::dup2(stdinPipe[0], STDIN_FILENO) < 0 ||
+            ::dup2(stdoutPipe[1], STDOUT_FILENO) < 0 || ::dup2(stdoutPipe[1], STDERR_FILENO) < 0) {
+            ::_exit(126);
+        }
+        ::execv(argv[0], argv.data());
+        static const char execFailed[] = "execv failed\n";
+        static_cast<void>(::write(STDERR_FILENO, execFailed, sizeof(execFailed) - 1));
+        ::_exit(127);
+    }
+
+    ::close(stdinPipe[0]);
+    ::close(stdoutPipe[1]);
+    if (_pid < 0) {
+        ::close(stdinPipe[1]);
+        ::close(stdoutPipe[0]);
+        throw std::runtime_error("unable to start " + name + ": " + std::strerror(errno));
+    }
+    _stdinFd = stdinPipe[1];
+    _stdoutFd = stdoutPipe[0];
+    _readThread = std::thread(&ChildProcess::readLoop, this);
+}
+
+ChildProcess::~ChildProcess()
+{
+    terminate(std::chrono::seconds(5));
+}
+
+const std::string& ChildProcess::getName() const
+{
+    return _name;
+}
+
+pid_t ChildProcess::getPid() const
+{
+    return _pid;
+}
+
+bool ChildProcess::isRunning()
+{
+    return !waitForExit(std::chrono::milliseconds(0));
+}
+
+void ChildProcess::sendLine(const std::string& line)
+{
+    if (_stdinFd < 0) {
+        return;
+    }
+    const std::string data = line + '\n';
+    std::size_t written = 0;
+    while (written < data.size()) {
+        const ssize_t result = ::write(_stdinFd, data.data() + written, data.size() - written);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            // the process is gone, this is detected by the caller waiting for its answer
+            return;
+        }
+        written += static_cast<std::size_t>(result);
+    }
+}
+
+bool ChildProcess::waitForLine(const std::string& keyword,
+                               std::chrono::milliseconds timeout,
+                               std::string& line)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(_linesMutex);
+    while (true) {
+        for (auto it = _lines.begin(); it != _lines.end(); ++it) {
+            if (it->compare(0, keyword.size(), keyword) == 0) {
+                line = it->substr(std::min(keyword.size() + 1, it->size()));
+                _lines.erase(it);
+                return true;
+            }
+        }
+        if (_isOutputClosed ||
+            _linesChanged.wait_until(lock, deadline) == std::cv_status::timeout) {
+            return false;
+        }
+    }
+}
+
+void ChildProcess::terminate(std::chrono::milliseconds gracePeriod)
+{
+    if (_pid > 0 && !_isReaped) {
+        ::kill(_pid, SIGTERM);
+        if (!waitForExit(gracePeriod)) {
+            ::kill(_pid, SIGKILL);
+            int status;
+            ::waitpid(_pid, &status, 0);
+            _isReaped = true;
+        }
+    }
+    if (_stdinFd >= 0) {
+        ::close(_stdinFd);
+        _stdinFd = -1;
+    }
+    if (_readThread.joinable()) {
+        _readThread.join();
+    }
+}
+
+bool ChildProcess::waitForExit(std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!_isReaped) {
+        int status;
+        const pid_t result = ::waitpid(_pid, &status, WNOHANG);
+        if (result == _pid || (result < 0 && errno != EINTR)) {
+            _isReaped = true;
+            break;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+std::uint64_t ChildProcess::getMemoryKb(const std::string& field) const
+{
+    std::ifstream status("/proc/" + std::to_string(_pid) + "/status");
+    std::string line;
+    const std::string key = field + ":";
+    while (std::getline(status, line)) {
+        if (line.compare(0, key.size(), key) == 0) {
+            std::istringstream value(line.substr(key.size()));
+            std::uint64_t kiloBytes = 0;
+            value >> kiloBytes;
+            return kiloBytes;
+        }
+    }
+    return 0;
+}
+
+std::uint64_t ChildProcess::getCpuTimeMs() const
+{
+    std::ifstream statFile("/proc/" + std::to_string(_pid) + "/stat");
+    std::string stat;
+    std::getline(statFile, stat);
+    // the command name may contain spaces, the fields start after its closing bracket
+    const std::size_t commandEnd = stat.rfind(')');
+    if (commandEnd == std::string::npos) {
+        return 0;
+    }
+    std::istringstream fields(stat.substr(commandEnd + 1));
+    std::string field;
+    std::uint64_t userTicks = 0;
+    std::uint64_t systemTicks = 0;
+    // utime and stime are the 14th and 15th field, the first one after the bracket is the 3rd
+    for (int index = 3; index <= 15 && fields >> field; ++index) {
+        if (index == 14) {
+            userTicks = std::stoull(field);
+        } else if (index == 15) {
+            systemTicks = std::stoull(field);
+        }
+    }
+    const auto ticksPerSecond = static_cast<std::uint64_t>(::sysconf(_SC_CLK_TCK));
+    return (userTicks + systemTicks) * 1000 / ticksPerSecond;
+}
+
+void ChildProcess::readLoop()
+{
+    std::string pending;
+    char buffer[4096];
+    while (true) {
+        const ssize_t received = ::read(_stdoutFd, buffer, sizeof(buffer));
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            break;
+        }
+        _logFile.write(buffer, received);
+        _logFile.flush();
+        pending.append(buffer, static_cast<std::size_t>(received));
+        std::size_t lineEnd;
+        while ((lineEnd = pending.find('\n')) != std::string::npos) {
+            const std::string line = pending.substr(0, lineEnd);
+            pending.erase(0, lineEnd + 1);
+            const std::string& prefix = LoadHarnessProtocol::PREFIX();
+            if (line.compare(0, prefix.size(), prefix) == 0) {
+                std::lock_guard<std::mutex> lock(_linesMutex);
+                _lines.push_back(line.substr(prefix.size()));
+                _linesChanged.notify_all();
+            }
+        }
+    }
+    ::close(_stdoutFd);
+    std::lock_guard<std::mutex> lock(_linesMutex);
+    _isOutputClosed = true;
+    _linesChanged.notify_all();
+}
+
+} // namespace joynr
@@ -0,0 +1,111 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef LOADHARNESS_CHILDPROCESS_H
+#define LOADHARNESS_CHILDPROCESS_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace joynr
+{
+
+/**
+ * @brief Process started and controlled by the load harness.
+ *
+ * Everything the process writes to stdout and stderr is appended to its log file. Lines
+ * starting with LoadHarnessProtocol::PREFIX() are additionally queued, they are used by the
+ * workers to report their state and results. Commands are sent line by line to the stdin of the
+ * process.
+ */
+class ChildProcess
+{
+public:
+    ChildProcess(const std::string& name,
+                 const std::vector<std::string>& arguments,
+                 const std::string& workingDirectory,
+                 const std::string& logFileName);
+    ~ChildProcess();
+
+    const std::string& getName() const;
+    pid_t getPid() const;
+    bool isRunning();
+
+    void sendLine(const std::string& line);
+
+    /**
+     * @brief Waits for a protocol line starting with the given keyword
+     * @param line set to the remainder of the line after the keyword
+     * @return false if the process did not report the keyword within the timeout
+     */
+    bool waitForLine(const std::string& keyword,
+                     std::chrono::milliseconds timeout,
+                     std::string& line);
+
+    /**
+     * @brief Sends SIGTERM and SIGKILL after the grace period, then reaps the process
+     */
+    void terminate(std::chrono::milliseconds gracePeriod);
+
+    /**
+     * @brief Waits until the process exited on its own
+     * @return false on timeout
+     */
+    bool waitForExit(std::chrono::milliseconds timeout);
+
+    /**
+     * @return the value of the given field of /proc/<pid>/status in kB, e.g. VmRSS or VmHWM
+     */
+    std::uint64_t getMemoryKb(const std::string& field) const;
+
+    /**
+     * @return user and system CPU time consumed so far in milliseconds
+     */
+    std::uint64_t getCpuTimeMs() const;
+
+private:
+    ChildProcess(const ChildProcess&) = delete;
+    ChildProcess& operator=(const ChildProcess&) = delete;
+
+    void readLoop();
+
+    const std::string _name;
+    pid_t _pid;
+    bool _isReaped;
+    int _stdinFd;
+    int _stdoutFd;
+    std::ofstream _logFile;
+    std::mutex _linesMutex;
+    std::condition_variable _linesChanged;
+    std::deque<std::string> _lines;
+    bool _isOutputClosed;
+    std::thread _readThread;
+};
+
+} // namespace joynr
+
+#endif // LOADHARNESS_CHILDPROCESS_H
@@ -0,0 +1,129 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef LOADHARNESS_LATENCYRECORDER_H
+#define LOADHARNESS_LATENCYRECORDER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace joynr
+{
+
+/**
+ * steady_clock is CLOCK_MONOTONIC on Linux and hence comparable between processes on the same
+ * host. Publications carry the time they were sent, which allows the receiving process to
+ * calculate the one-way latency.
+ */
+inline std::int64_t nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+struct LatencySummary {
+    std::size_t count = 0;
+    std::uint64_t min = 0;
+    std::uint64_t mean = 0;
+    std::uint64_t p50 = 0;
+    std::uint64_t p90 = 0;
+    std::uint64_t p99 = 0;
+    std::uint64_t p999 = 0;
+    std::uint64_t max = 0;
+
+    static LatencySummary fromSamples(std::vector<std::uint64_t> samples)
+    {
+        LatencySummary summary;
+        if (samples.empty()) {
+            return summary;
+        }
+        std::sort(samples.begin(), samples.end());
+        std::uint64_t sum = 0;
+        for (const auto sample : samples) {
+            sum += sample;
+        }
+        const auto percentile = [&samples](double fraction) {
+            const auto index = static_cast<std::size_t>(fraction * (samples.size() - 1) + 0.5);
+            return samples[index];
+        };
+        summary.count = samples.size();
+        summary.min = samples.front();
+        summary.mean = sum / samples.size();
+        summary.p50 = percentile(0.5);
+        summary.p90 = percentile(0.9);
+        summary.p99 = percentile(0.99);
+        summary.p999 = percentile(0.999);
+        summary.max = samples.back();
+        return summary;
+    }
+};
+
+/**
+ * @brief Thread safe collection of latency samples in microseconds.
+ *
+ * All samples are kept, so that the samples of several processes can be merged exactly.
+ * They are exchanged as text files with one sample per line.
+ */
+class LatencyRecorder
+{
+public:
+    void record(std::int64_t latencyUs)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _samples.push_back(latencyUs > 0 ? static_cast<std::uint64_t>(latencyUs) : 0);
+    }
+
+    std::size_t getCount() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _samples.size();
+    }
+
+    bool writeToFile(const std::string& fileName) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::ofstream file(fileName, std::ios::trunc);
+        for (const auto sample : _samples) {
+            file << sample << '\n';
+        }
+        return static_cast<bool>(file);
+    }
+
+    static void appendFromFile(const std::string& fileName, std::vector<std::uint64_t>& samples)
+    {
+        std::ifstream file(fileName);
+        std::uint64_t sample;
+        while (file >> sample) {
+            samples.push_back(sample);
+        }
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<std::uint64_t> _samples;
+};
+
+} // namespace joynr
+
+#endif // LOADHARNESS_LATENCYRECORDER_H
@@ -0,0 +1,325 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef LOADHARNESS_LOADCONSUMER_H
+#define LOADHARNESS_LOADCONSUMER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include "joynr/DiscoveryQos.h"
+#include "joynr/ISubscriptionListener.h"
+#include "joynr/JoynrRuntime.h"
+#include "joynr/MulticastSubscriptionQos.h"
+#include "joynr/OnChangeSubscriptionQos.h"
+#include "joynr/ProxyBuilder.h"
+#include "joynr/Util.h"
+#include "joynr/exceptions/JoynrException.h"
+#include "joynr/tests/performance/EchoProxy.h"
+
+#include "LatencyRecorder.h"
+
+namespace joynr
+{
+
+/**
+ * Publications are sent as "<send time in us>;<padding>", see nowUs()
+ */
+inline std::string createPublication(const std::string& padding)
+{
+    return std::to_string(nowUs()) + ";" + padding;
+}
+
+/**
+ * @brief Records the latency of publications created by createPublication()
+ */
+class PublicationLatencyListener : public ISubscriptionListener<std::string>
+{
+public:
+    PublicationLatencyListener() : _isMeasuring(false), _errors(0)
+    {
+    }
+
+    void onReceive(const std::string& value) override
+    {
+        if (!_isMeasuring) {
+            return;
+        }
+        const std::size_t separator = value.find(';');
+        if (separator == std::string::npos) {
+            // e.g. the initial publication of the attribute value
+            return;
+        }
+        _latencies.record(nowUs() - std::stoll(value.substr(0, separator)));
+    }
+
+    void onError(const exceptions::JoynrRuntimeException& error) override
+    {
+        std::ignore = error;
+        ++_errors;
+    }
+
+    void onSubscribed(const std::string& subscriptionId) override
+    {
+        std::ignore = subscriptionId;
+    }
+
+    void setMeasuring(bool isMeasuring)
+    {
+        _isMeasuring = isMeasuring;
+    }
+
+    const LatencyRecorder& getLatencies() const
+    {
+        return _latencies;
+    }
+
+    std::uint64_t getErrors() const
+    {
+        return _errors;
+    }
+
+private:
+    std::atomic<bool> _isMeasuring;
+    std::atomic<std::uint64_t> _errors;
+    LatencyRecorder _latencies;
+};
+
+struct LoadConsumerConfig {
+    std::string domain;
+    std::chrono::milliseconds duration{10000};
+    // maximum number of outstanding RPCs, 0 disables RPCs
+    std::size_t rpcInFlight = 1;
+    // RPCs per second, 0 sends as fast as rpcInFlight allows
+    double rpcRate = 0;
+    bool subscribeAttribute = true;
+    bool subscribeBroadcast = true;
+    std::size_t payloadSize = 100;
+};
+
+/**
+ * @brief Consumer of the load harness.
+ *
+ * Calls echoString in a closed loop limited by the number of outstanding calls and optionally
+ * by a rate, while receiving the attribute and broadcast publications of the provider.
+ */
+class LoadConsumer : public std::enable_shared_from_this<LoadConsumer>
+{
+public:
+    using EchoProxy = joynr::tests::performance::EchoProxy;
+
+    LoadConsumer(std::shared_ptr<JoynrRuntime> runtime, const LoadConsumerConfig& config)
+            : _runtime(std::move(runtime)),
+              _config(config),
+              _rpcPayload(config.payloadSize, 'x'),
+              _rpcMutex(),
+              _rpcFinished(),
+              _rpcInFlight(0),
+              _rpcCalls(0),
+              _rpcErrors(0),
+              _rpcLatencies(),
+              _attributeListener(std::make_shared<PublicationLatencyListener>()),
+              _broadcastListener(std::make_shared<PublicationLatencyListener>()),
+              _measuredDuration(0)
+    {
+        DiscoveryQos discoveryQos;
+        discoveryQos.setDiscoveryScope(types::DiscoveryScope::LOCAL_ONLY);
+        discoveryQos.setDiscoveryTimeoutMs(60000);
+        discoveryQos.setCacheMaxAgeMs(std::numeric_limits<std::int64_t>::max());
+        discoveryQos.setArbitrationStrategy(DiscoveryQos::ArbitrationStrategy::HIGHEST_PRIORITY);
+        _echoProxy = _runtime->createProxyBuilder<EchoProxy>(config.domain)
+                             ->setMessagingQos(MessagingQos(60000))
+                             ->setDiscoveryQos(discoveryQos)
+                             ->build();
+    }
+
+    void subscribe()
+    {
+        const std::int64_t validityMs = 24 * 60 * 60 * 1000;
+        if (_config.subscribeAttribute) {
+            auto qos = std::make_shared<OnChangeSubscriptionQos>(
+                    validityMs, UnicastSubscriptionQos::DEFAULT_PUBLICATION_TTL_MS(), 0);
+            _echoProxy->subscribeToSimpleAttribute(_attributeListener, qos)
+                    ->get(subscriptionTimeoutMs(), _attributeSubscriptionId);
+        }
+        if (_config.subscribeBroadcast) {
+            auto qos = std::make_shared<MulticastSubscriptionQos>();
+            qos->setValidityMs(validityMs);
+            _echoProxy
+                    ->subscribeToBroadcastWithSinglePrimitiveParameterBroadcast(
+                            _broadcastListener, qos)
+                    ->get(subscriptionTimeoutMs(), _broadcastSubscriptionId);
+        }
+    }
+
+    void unsubscribe()
+    {
+        if (!_attributeSubscriptionId.empty()) {
+            _echoProxy->unsubscribeFromSimpleAttribute(_attributeSubscriptionId);
+        }
+        if (!_broadcastSubscriptionId.empty()) {
+            _echoProxy->unsubscribeFromBroadcastWithSinglePrimitiveParameterBroadcast(
+                    _broadcastSubscriptionId);
+        }
+    }
+
+    /**
+     * @brief Generates load for the configured duration and waits for outstanding replies
+     */
+    void run()
+    {
+        _attributeListener->setMeasuring(true);
+        _broadcastListener->setMeasuring(true);
+        const auto start = std::chrono::steady_clock::now();
+        const auto end = start + _config.duration;
+        if (_config.rpcInFlight > 0) {
+            runRpcs(end);
+        }
+        std::this_thread::sleep_until(end);
+        _measuredDuration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+        _attributeListener->setMeasuring(false);
+        _broadcastListener->setMeasuring(false);
+
+        std::unique_lock<std::mutex> lock(_rpcMutex);
+        _rpcFinished.wait_for(lock, std::chrono::seconds(30), [this]() {
+            return _rpcInFlight == 0;
+        });
+    }
+
+    std::chrono::milliseconds getMeasuredDuration() const
+    {
+        return _measuredDuration;
+    }
+
+    std::uint64_t getRpcCalls() const
+    {
+        return _rpcCalls;
+    }
+
+    std::uint64_t getRpcErrors() const
+    {
+        return _rpcErrors;
+    }
+
+    const LatencyRecorder& getRpcLatencies() const
+    {
+        return _rpcLatencies;
+    }
+
+    const PublicationLatencyListener& getAttributeListener() const
+    {
+        return *_attributeListener;
+    }
+
+    const PublicationLatencyListener& getBroadcastListener() const
+    {
+        return *_broadcastListener;
+    }
+
+private:
+    static std::int64_t subscriptionTimeoutMs()
+    {
+        return 30000;
+    }
+
+    void runRpcs(std::chrono::steady_clock::time_point end)
+    {
+        const auto interval =
+                _config.rpcRate > 0
+                        ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                  std::chrono::duration<double>(1.0 / _config.rpcRate))
+                        : std::chrono::steady_clock::duration::zero();
+        auto nextCall = std::chrono::steady_clock::now();
+
+        std::unique_lock<std::mutex> lock(_rpcMutex);
+        while (_rpcFinished.wait_until(
+                lock, end, [this]() { return _rpcInFlight < _config.rpcInFlight; })) {
+            if (interval > std::chrono::steady_clock::duration::zero()) {
+                lock.unlock();
+                std::this_thread::sleep_until(nextCall);
+                nextCall += interval;
+                lock.lock();
+                if (std::chrono::steady_clock::now() >= end) {
+                    break;
+                }
+            }
+            ++_rpcInFlight;
+            ++_rpcCalls;
+            lock.unlock();
+
+            const std::int64_t callStart = nowUs();
+            auto thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this());
+            _echoProxy->echoStringAsync(
+                    _rpcPayload,
+                    [thisWeakPtr, callStart](const std::string& responseData) {
+                        std::ignore = responseData;
+                        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                            thisSharedPtr->_rpcLatencies.record(nowUs() - callStart);
+                            thisSharedPtr->onRpcFinished();
+                        }
+                    },
+                    [thisWeakPtr](const exceptions::JoynrRuntimeException& error) {
+                        std::ignore = error;
+                        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                            ++thisSharedPtr->_rpcErrors;
+                            thisSharedPtr->onRpcFinished();
+                        }
+                    });
+            lock.lock();
+        }
+    }
+
+    void onRpcFinished()
+    {
+        std::lock_guard<std::mutex> lock(_rpcMutex);
+        --_rpcInFlight;
+        _rpcFinished.notify_all();
+    }
+
+    std::shared_ptr<JoynrRuntime> _runtime;
+    const LoadConsumerConfig _config;
+    const std::string _rpcPayload;
+    std::shared_ptr<EchoProxy> _echoProxy;
+
+    std::mutex _rpcMutex;
+    std::condition_variable _rpcFinished;
+    std::size_t _rpcInFlight;
+    std::uint64_t _rpcCalls;
+    std::atomic<std::uint64_t> _rpcErrors;
+    LatencyRecorder _rpcLatencies;
+
+    std::shared_ptr<PublicationLatencyListener> _attributeListener;
+    std::shared_ptr<PublicationLatencyListener> _broadcastListener;
+    std::string _attributeSubscriptionId;
+    std::string _broadcastSubscriptionId;
+    std::chrono::milliseconds _measuredDuration;
+};
+
+} // namespace joynr
+
+#endif // LOADHARNESS_LOADCONSUMER_H
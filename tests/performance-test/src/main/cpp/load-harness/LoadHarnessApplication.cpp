@@ -0,0 +1,657 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/program_options.hpp>
+
+#include "../common/Enum.h"
+#include "ChildProcess.h"
+#include "LatencyRecorder.h"
+#include "LoadHarnessProtocol.h"
+#include "LoopbackMqttBroker.h"
+
+using namespace joynr;
+
+JOYNR_ENUM(Transport, (UDS)(WS));
+
+namespace
+{
+
+using Results = std::map<std::string, std::uint64_t>;
+
+constexpr std::chrono::milliseconds TERMINATION_GRACE_PERIOD(5000);
+const std::array<std::string, 3> CATEGORIES = {{"rpc", "attribute", "broadcast"}};
+
+struct HarnessConfig {
+    std::string clusterControllerExecutable;
+    std::vector<std::string> clusterControllerSettings;
+    std::string udsWorkerExecutable;
+    std::string wsWorkerExecutable;
+    std::size_t udsConsumers;
+    std::size_t wsConsumers;
+    Transport providerTransport;
+    std::size_t durationMs;
+    std::size_t rpcInFlight;
+    double rpcRate;
+    double attributeRate;
+    double broadcastRate;
+    std::size_t payloadSize;
+    std::size_t startupTimeoutMs;
+    std::string workDirectory;
+    std::string runDirectory;
+    std::string reportFile;
+};
+
+struct Worker {
+    std::unique_ptr<ChildProcess> process;
+    Transport transport;
+    std::string samplesPrefix;
+    Results results;
+};
+
+struct CategoryReport {
+    std::string category;
+    std::string transport;
+    double throughput;
+    std::uint64_t errors;
+    LatencySummary latency;
+};
+
+std::string toString(Transport transport)
+{
+    std::ostringstream stream;
+    stream << transport;
+    return stream.str();
+}
+
+Results parseResults(const std::string& line)
+{
+    Results results;
+    std::istringstream stream(line);
+    std::string pair;
+    while (stream >> pair) {
+        const auto separator = pair.find('=');
+        if (separator != std::string::npos) {
+            results[pair.substr(0, separator)] = std::stoull(pair.substr(separator + 1));
+        }
+    }
+    return results;
+}
+
+void writeFile(const std::string& fileName, const std::string& content)
+{
+    std::ofstream file(fileName, std::ios::trunc);
+    file << content;
+    if (!file) {
+        throw std::runtime_error("could not write " + fileName);
+    }
+}
+
+bool canConnect(std::uint16_t port)
+{
+    const int socket = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (socket < 0) {
+        return false;
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    const bool connected =
+            ::connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    ::close(socket);
+    return connected;
+}
+
+/**
+ * The port is released again before the cluster controller binds it, which is good enough on a
+ * host which is not busy opening listening sockets at the same time.
+ */
+std::uint16_t findFreePort()
+{
+    const int socket = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (socket < 0) {
+        throw std::runtime_error("could not create socket");
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = 0;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if (::bind(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::getsockname(socket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        ::close(socket);
+        throw std::runtime_error("could not find a free port");
+    }
+    ::close(socket);
+    return ntohs(address.sin_port);
+}
+
+bool isSocketFile(const std::string& path)
+{
+    struct stat status {
+    };
+    return ::stat(path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode);
+}
+
+bool waitForClusterController(ChildProcess& clusterController,
+                              const std::string& udsSocketPath,
+                              std::uint16_t wsPort,
+                              std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (!clusterController.isRunning()) {
+            return false;
+        }
+        if (isSocketFile(udsSocketPath) && canConnect(wsPort)) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return false;
+}
+
+std::string createClusterControllerSettings(const HarnessConfig& config,
+                                            std::uint16_t brokerPort,
+                                            std::uint16_t wsPort,
+                                            const std::string& udsSocketPath)
+{
+    const auto workDirectory = boost::filesystem::path(config.workDirectory);
+    std::ostringstream settings;
+    settings << "[messaging]\n"
+             << "broker-url=tcp://127.0.0.1:" << brokerPort << "\n"
+             << "persistence-file=" << (workDirectory / "cc.persist").string() << "\n"
+             << "metrics-dump-file=" << (workDirectory / "cc-metrics.json").string() << "\n"
+             << "metrics-dump-interval-ms=1000\n"
+             << "\n"
+             << "[lib-joynr]\n"
+             << "participant-ids-persistence-file="
+             << (workDirectory / "cc.participantids").string() << "\n"
+             << "\n"
+             << "[cluster-controller]\n"
+             << "ws-enabled=true\n"
+             << "ws-port=" << wsPort << "\n"
+             << "uds-enabled=true\n"
+             << "local-capabilities-directory-persistency-enabled=false\n"
+             << "\n"
+             << "[uds]\n"
+             << "socket-path=" << udsSocketPath << "\n";
+    return settings.str();
+}
+
+std::string createWorkerSettings(const HarnessConfig& config,
+                                 const std::string& name,
+                                 Transport transport,
+                                 std::uint16_t wsPort,
+                                 const std::string& udsSocketPath)
+{
+    const auto workDirectory = boost::filesystem::path(config.workDirectory);
+    std::ostringstream settings;
+    if (transport == Transport::UDS) {
+        settings << "[uds]\n"
+                 << "socket-path=" << udsSocketPath << "\n"
+                 << "client-id=" << name << "\n";
+    } else {
+        settings << "[websocket]\n"
+                 << "cluster-controller-messaging-url=ws://localhost:" << wsPort << "\n";
+    }
+    settings << "\n"
+             << "[messaging]\n"
+             << "persistence-file=" << (workDirectory / (name + ".persist")).string() << "\n"
+             << "\n"
+             << "[lib-joynr]\n"
+             << "participant-ids-persistence-file="
+             << (workDirectory / (name + ".participantids")).string() << "\n";
+    return settings.str();
+}
+
+Worker startWorker(const HarnessConfig& config,
+                   const std::string& name,
+                   Transport transport,
+                   std::vector<std::string> roleArguments,
+                   std::uint16_t wsPort,
+                   const std::string& udsSocketPath)
+{
+    const auto workDirectory = boost::filesystem::path(config.workDirectory);
+    const auto settingsFile = (workDirectory / (name + ".settings")).string();
+    writeFile(settingsFile, createWorkerSettings(config, name, transport, wsPort, udsSocketPath));
+
+    Worker worker;
+    worker.transport = transport;
+    worker.samplesPrefix = (workDirectory / name).string();
+    std::vector<std::string> arguments = {transport == Transport::UDS
+                                                  ? config.udsWorkerExecutable
+                                                  : config.wsWorkerExecutable,
+                                          "--settings",
+                                          settingsFile,
+                                          "--domain",
+                                          "load-harness",
+                                          "--payload-size",
+                                          std::to_string(config.payloadSize),
+                                          "--samples-prefix",
+                                          worker.samplesPrefix};
+    arguments.insert(arguments.end(), roleArguments.begin(), roleArguments.end());
+    worker.process = std::make_unique<ChildProcess>(
+            name, arguments, config.runDirectory, (workDirectory / (name + ".log")).string());
+    return worker;
+}
+
+void waitForReady(Worker& worker, std::chrono::milliseconds timeout)
+{
+    std::string line;
+    if (!worker.process->waitForLine(LoadHarnessProtocol::READY(), timeout, line)) {
+        throw std::runtime_error(worker.process->getName() + " did not become ready");
+    }
+}
+
+void waitForResults(Worker& worker, std::chrono::milliseconds timeout)
+{
+    std::string line;
+    if (!worker.process->waitForLine(LoadHarnessProtocol::RESULT(), timeout, line)) {
+        throw std::runtime_error(worker.process->getName() + " did not report results");
+    }
+    worker.results = parseResults(line);
+}
+
+CategoryReport createCategoryReport(const std::vector<Worker>& consumers,
+                                    const std::string& category,
+                                    const std::string& transport)
+{
+    CategoryReport report;
+    report.category = category;
+    report.transport = transport;
+    report.throughput = 0;
+    report.errors = 0;
+    std::vector<std::uint64_t> samples;
+    for (const auto& consumer : consumers) {
+        if (transport != "ALL" && transport != toString(consumer.transport)) {
+            continue;
+        }
+        const auto samplesBefore = samples.size();
+        LatencyRecorder::appendFromFile(consumer.samplesPrefix + "." + category, samples);
+        // the consumers do not start and stop at exactly the same time, hence the throughput
+        // is the sum of the throughputs of the individual consumers
+        const auto durationMs = consumer.results.at("durationMs");
+        if (durationMs > 0) {
+            report.throughput += (samples.size() - samplesBefore) * 1000.0 / durationMs;
+        }
+        const auto errors = consumer.results.find(category + "Errors");
+        if (errors != consumer.results.cend()) {
+            report.errors += errors->second;
+        }
+    }
+    report.latency = LatencySummary::fromSamples(std::move(samples));
+    return report;
+}
+
+void printCategoryReport(std::ostream& out, const CategoryReport& report)
+{
+    const auto& latency = report.latency;
+    out << std::left << std::setw(10) << report.category << std::setw(5) << report.transport
+        << std::right << std::setw(10) << latency.count << std::setw(12) << std::fixed
+        << std::setprecision(1) << report.throughput << std::setw(8) << report.errors
+        << std::setw(9) << latency.min << std::setw(9) << latency.mean << std::setw(9)
+        << latency.p50 << std::setw(9) << latency.p90 << std::setw(9) << latency.p99
+        << std::setw(9) << latency.p999 << std::setw(9) << latency.max << "\n";
+}
+
+void writeJsonReport(const std::string& fileName,
+                     const HarnessConfig& config,
+                     const std::vector<CategoryReport>& categoryReports,
+                     const Results& clusterController,
+                     const Worker& provider,
+                     const std::vector<Worker>& consumers,
+                     const LoopbackMqttBroker& broker)
+{
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"config\": {\"udsConsumers\": " << config.udsConsumers
+         << ", \"wsConsumers\": " << config.wsConsumers << ", \"providerTransport\": \""
+         << toString(config.providerTransport) << "\", \"durationMs\": " << config.durationMs
+         << ", \"rpcInFlight\": " << config.rpcInFlight << ", \"rpcRate\": " << config.rpcRate
+         << ", \"attributeRate\": " << config.attributeRate
+         << ", \"broadcastRate\": " << config.broadcastRate
+         << ", \"payloadSize\": " << config.payloadSize << "},\n"
+         << "  \"traffic\": [\n";
+    for (std::size_t i = 0; i < categoryReports.size(); ++i) {
+        const auto& report = categoryReports[i];
+        const auto& latency = report.latency;
+        json << "    {\"category\": \"" << report.category << "\", \"transport\": \""
+             << report.transport << "\", \"count\": " << latency.count
+             << ", \"throughputPerSecond\": " << report.throughput
+             << ", \"errors\": " << report.errors << ", \"latencyUs\": {\"min\": " << latency.min
+             << ", \"mean\": " << latency.mean << ", \"p50\": " << latency.p50
+             << ", \"p90\": " << latency.p90 << ", \"p99\": " << latency.p99
+             << ", \"p999\": " << latency.p999 << ", \"max\": " << latency.max << "}}"
+             << (i + 1 < categoryReports.size() ? "," : "") << "\n";
+    }
+    json << "  ],\n"
+         << "  \"clusterController\": {\"cpuMs\": " << clusterController.at("cpuMs")
+         << ", \"maxRssKb\": " << clusterController.at("maxRssKb")
+         << ", \"rssKb\": " << clusterController.at("rssKb") << "},\n"
+         << "  \"provider\": {\"attributeUpdates\": " << provider.results.at("attributeUpdates")
+         << ", \"broadcasts\": " << provider.results.at("broadcasts")
+         << ", \"maxRssKb\": " << provider.results.at("maxRssKb") << "},\n"
+         << "  \"consumers\": [\n";
+    for (std::size_t i = 0; i < consumers.size(); ++i) {
+        const auto& consumer = consumers[i];
+        json << "    {\"name\": \"" << consumer.process->getName() << "\", \"transport\": \""
+             << toString(consumer.transport) << "\"";
+        for (const auto& result : consumer.results) {
+            json << ", \"" << result.first << "\": " << result.second;
+        }
+        json << "}" << (i + 1 < consumers.size() ? "," : "") << "\n";
+    }
+    json << "  ],\n"
+         << "  \"broker\": {\"receivedPublications\": " << broker.getReceivedPublications()
+         << ", \"forwardedPublications\": " << broker.getForwardedPublications() << "}\n"
+         << "}\n";
+    writeFile(fileName, json.str());
+}
+
+int runHarness(const HarnessConfig& config)
+{
+    const auto workDirectory = boost::filesystem::path(config.workDirectory);
+    const auto startupTimeout = std::chrono::milliseconds(config.startupTimeoutMs);
+    const auto udsSocketPath = (workDirectory / "cc.sock").string();
+
+    LoopbackMqttBroker broker;
+    const auto brokerPort = broker.start();
+    const auto wsPort = findFreePort();
+    std::cout << "MQTT broker stand-in listening on port " << brokerPort << std::endl;
+
+    const auto ccSettingsFile = (workDirectory / "cc.settings").string();
+    writeFile(ccSettingsFile,
+              createClusterControllerSettings(config, brokerPort, wsPort, udsSocketPath));
+    // settings given later override earlier ones, the generated settings have to win
+    std::vector<std::string> ccArguments = {config.clusterControllerExecutable};
+    ccArguments.insert(ccArguments.end(),
+                       config.clusterControllerSettings.cbegin(),
+                       config.clusterControllerSettings.cend());
+    ccArguments.push_back(ccSettingsFile);
+    const auto ccLogFile = (workDirectory / "cluster-controller.log").string();
+    ChildProcess clusterController(
+            "cluster-controller", ccArguments, config.runDirectory, ccLogFile);
+    if (!waitForClusterController(clusterController, udsSocketPath, wsPort, startupTimeout)) {
+        throw std::runtime_error("cluster controller did not start, see " + ccLogFile);
+    }
+    std::cout << "cluster controller started, pid " << clusterController.getPid() << std::endl;
+
+    auto provider = startWorker(config,
+                                "provider",
+                                config.providerTransport,
+                                {"--role",
+                                 "PROVIDER",
+                                 "--attribute-rate",
+                                 std::to_string(config.attributeRate),
+                                 "--broadcast-rate",
+                                 std::to_string(config.broadcastRate)},
+                                wsPort,
+                                udsSocketPath);
+    waitForReady(provider, startupTimeout);
+
+    const std::vector<std::string> consumerArguments = {
+            "--role",
+            "CONSUMER",
+            "--duration-ms",
+            std::to_string(config.durationMs),
+            "--rpc-in-flight",
+            std::to_string(config.rpcInFlight),
+            "--rpc-rate",
+            std::to_string(config.rpcRate),
+            "--subscribe-attribute",
+            config.attributeRate > 0 ? "1" : "0",
+            "--subscribe-broadcast",
+            config.broadcastRate > 0 ? "1" : "0"};
+    std::vector<Worker> consumers;
+    for (std::size_t i = 0; i < config.udsConsumers + config.wsConsumers; ++i) {
+        const Transport transport = i < config.udsConsumers ? Transport::UDS : Transport::WS;
+        const std::string name = std::string(transport == Transport::UDS ? "consumer-uds-"
+                                                                         : "consumer-ws-") +
+                                 std::to_string(i);
+        consumers.push_back(startWorker(
+                config, name, transport, consumerArguments, wsPort, udsSocketPath));
+    }
+    for (auto& consumer : consumers) {
+        waitForReady(consumer, startupTimeout);
+    }
+    std::cout << "provider and " << consumers.size() << " consumers ready, running for "
+              << config.durationMs << "ms" << std::endl;
+
+    const auto ccCpuTimeBefore = clusterController.getCpuTimeMs();
+    provider.process->sendLine(LoadHarnessProtocol::START());
+    for (auto& consumer : consumers) {
+        consumer.process->sendLine(LoadHarnessProtocol::START());
+    }
+    // consumers stop on their own after the duration, give them time to drain
+    const auto resultTimeout = std::chrono::milliseconds(config.durationMs) + startupTimeout;
+    for (auto& consumer : consumers) {
+        waitForResults(consumer, resultTimeout);
+    }
+    Results clusterControllerResults;
+    clusterControllerResults["cpuMs"] = clusterController.getCpuTimeMs() - ccCpuTimeBefore;
+    clusterControllerResults["maxRssKb"] = clusterController.getMemoryKb("VmHWM");
+    clusterControllerResults["rssKb"] = clusterController.getMemoryKb("VmRSS");
+    provider.process->sendLine(LoadHarnessProtocol::STOP());
+    waitForResults(provider, startupTimeout);
+
+    for (auto& consumer : consumers) {
+        if (!consumer.process->waitForExit(TERMINATION_GRACE_PERIOD)) {
+            consumer.process->terminate(TERMINATION_GRACE_PERIOD);
+        }
+    }
+    if (!provider.process->waitForExit(TERMINATION_GRACE_PERIOD)) {
+        provider.process->terminate(TERMINATION_GRACE_PERIOD);
+    }
+    // SIGTERM makes the cluster controller shut down and write the metrics a last time
+    clusterController.terminate(TERMINATION_GRACE_PERIOD);
+    broker.stop();
+
+    std::vector<CategoryReport> categoryReports;
+    for (const auto& category : CATEGORIES) {
+        categoryReports.push_back(createCategoryReport(consumers, category, "ALL"));
+        if (config.udsConsumers > 0 && config.wsConsumers > 0) {
+            categoryReports.push_back(createCategoryReport(consumers, category, "UDS"));
+            categoryReports.push_back(createCategoryReport(consumers, category, "WS"));
+        }
+    }
+    std::uint64_t consumerMaxRssKb = 0;
+    for (const auto& consumer : consumers) {
+        consumerMaxRssKb = std::max(consumerMaxRssKb, consumer.results.at("maxRssKb"));
+    }
+
+    std::ostream& out = std::cout;
+    out << "\n"
+        << "consumers: " << config.udsConsumers << " UDS, " << config.wsConsumers
+        << " WS, provider via " << toString(config.providerTransport) << "\n\n"
+        << std::left << std::setw(10) << "traffic" << std::setw(5) << "via" << std::right
+        << std::setw(10) << "count" << std::setw(12) << "msg/s" << std::setw(8) << "errors"
+        << std::setw(9) << "min" << std::setw(9) << "mean" << std::setw(9) << "p50"
+        << std::setw(9) << "p90" << std::setw(9) << "p99" << std::setw(9) << "p99.9"
+        << std::setw(9) << "max"
+        << "\n";
+    for (const auto& report : categoryReports) {
+        printCategoryReport(out, report);
+    }
+    out << "(latencies in us, RPCs are round trip, publications are one way)\n\n"
+        << "cluster controller: cpu " << clusterControllerResults["cpuMs"] << "ms, peak rss "
+        << clusterControllerResults["maxRssKb"] << "kB, rss "
+        << clusterControllerResults["rssKb"] << "kB\n"
+        << "provider:           peak rss " << provider.results.at("maxRssKb")
+        << "kB, attribute updates " << provider.results.at("attributeUpdates")
+        << ", broadcasts " << provider.results.at("broadcasts") << "\n"
+        << "consumers:          peak rss " << consumerMaxRssKb << "kB (max)\n"
+        << "MQTT broker:        publications received " << broker.getReceivedPublications()
+        << ", forwarded " << broker.getForwardedPublications() << "\n\n"
+        << "logs, samples and cluster controller metrics (cc-metrics.json) are in "
+        << config.workDirectory << std::endl;
+
+    if (!config.reportFile.empty()) {
+        writeJsonReport(config.reportFile,
+                        config,
+                        categoryReports,
+                        clusterControllerResults,
+                        provider,
+                        consumers,
+                        broker);
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+
+/**
+ * Self-contained load test: starts a cluster controller, one provider and a configurable number
+ * of consumers connected via UDS and WebSocket as separate processes, drives a mix of RPC,
+ * attribute subscription and broadcast traffic and reports throughput, latency percentiles and
+ * memory usage. The MQTT broker the cluster controller requires is replaced by an embedded
+ * loopback broker, hence nothing has to be running beforehand.
+ */
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    // a crashing worker must not take down the harness while it writes to its stdin
+    std::signal(SIGPIPE, SIG_IGN);
+
+    const auto appDirectory = boost::filesystem::system_complete(argv[0]).parent_path();
+    HarnessConfig config;
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "cluster-controller",
+            po::value(&config.clusterControllerExecutable)->required(),
+            "cluster controller executable")(
+            "cc-settings",
+            po::value(&config.clusterControllerSettings)->composing(),
+            "additional settings file for the cluster controller, may be repeated")(
+            "uds-worker",
+            po::value(&config.udsWorkerExecutable)
+                    ->default_value(
+                            (appDirectory / "performance-load-worker-uds").string()),
+            "worker executable using the UDS runtime")(
+            "ws-worker",
+            po::value(&config.wsWorkerExecutable)
+                    ->default_value((appDirectory / "performance-load-worker-ws").string()),
+            "worker executable using the WebSocket runtime")(
+            "uds-consumers",
+            po::value(&config.udsConsumers)->default_value(2),
+            "number of consumers connected via UDS")(
+            "ws-consumers",
+            po::value(&config.wsConsumers)->default_value(2),
+            "number of consumers connected via WebSocket")(
+            "provider-transport",
+            po::value(&config.providerTransport)->default_value(Transport::UDS),
+            "UDS|WS")("duration-ms",
+                      po::value(&config.durationMs)->default_value(10000),
+                      "duration of the measurement")(
+            "rpc-in-flight",
+            po::value(&config.rpcInFlight)->default_value(1),
+            "maximum number of outstanding RPCs per consumer, 0 disables RPCs")(
+            "rpc-rate",
+            po::value(&config.rpcRate)->default_value(0),
+            "RPCs per second and consumer, 0 is only limited by rpc-in-flight")(
+            "attribute-rate",
+            po::value(&config.attributeRate)->default_value(10),
+            "attribute updates per second, 0 disables attribute subscriptions")(
+            "broadcast-rate",
+            po::value(&config.broadcastRate)->default_value(10),
+            "broadcasts per second, 0 disables broadcast subscriptions")(
+            "payload-size",
+            po::value(&config.payloadSize)->default_value(100),
+            "size of the string sent with every RPC and publication")(
+            "startup-timeout-ms",
+            po::value(&config.startupTimeoutMs)->default_value(30000),
+            "time each process may take to become ready")(
+            "work-dir",
+            po::value(&config.workDirectory),
+            "directory for settings, logs and samples, a new temporary directory by default")(
+            "run-dir",
+            po::value(&config.runDirectory)->default_value(appDirectory.string()),
+            "working directory of all processes, must contain the joynr resources directory")(
+            "report", po::value(&config.reportFile), "write the results as JSON to this file");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        po::notify(vm);
+
+        if (config.udsConsumers + config.wsConsumers == 0) {
+            throw std::invalid_argument("at least one consumer is required");
+        }
+        const bool usesUds =
+                config.udsConsumers > 0 || config.providerTransport == Transport::UDS;
+        const bool usesWs = config.wsConsumers > 0 || config.providerTransport == Transport::WS;
+        if (usesUds && !boost::filesystem::exists(config.udsWorkerExecutable)) {
+            throw std::invalid_argument("UDS worker not found: " + config.udsWorkerExecutable);
+        }
+        if (usesWs && !boost::filesystem::exists(config.wsWorkerExecutable)) {
+            throw std::invalid_argument("WebSocket worker not found: " +
+                                        config.wsWorkerExecutable);
+        }
+
+        if (config.workDirectory.empty()) {
+            std::string workDirectoryTemplate("/tmp/joynr-load-harness-XXXXXX");
+            if (::mkdtemp(&workDirectoryTemplate[0]) == nullptr) {
+                throw std::runtime_error("could not create work directory");
+            }
+            config.workDirectory = workDirectoryTemplate;
+        } else {
+            boost::filesystem::create_directories(config.workDirectory);
+        }
+        config.workDirectory =
+                boost::filesystem::system_complete(config.workDirectory).string();
+        std::cout << "work directory: " << config.workDirectory << std::endl;
+
+        return runHarness(config);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
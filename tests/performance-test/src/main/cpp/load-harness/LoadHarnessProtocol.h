@@ -0,0 +1,68 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef LOADHARNESS_LOADHARNESSPROTOCOL_H
+#define LOADHARNESS_LOADHARNESSPROTOCOL_H
+
+#include <string>
+
+namespace joynr
+{
+
+/**
+ * @brief Line based protocol between the load harness and its workers.
+ *
+ * Workers report on stdout with lines starting with PREFIX(), e.g. "LOADHARNESS READY", all other
+ * output is only logged. The harness sends commands as single lines to the stdin of a worker.
+ * RESULT is followed by space separated key=value pairs.
+ */
+struct LoadHarnessProtocol {
+    static const std::string& PREFIX()
+    {
+        static const std::string value("LOADHARNESS ");
+        return value;
+    }
+
+    static const std::string& READY()
+    {
+        static const std::string value("READY");
+        return value;
+    }
+
+    static const std::string& RESULT()
+    {
+        static const std::string value("RESULT");
+        return value;
+    }
+
+    static const std::string& START()
+    {
+        static const std::string value("START");
+        return value;
+    }
+
+    static const std::string& STOP()
+    {
+        static const std::string value("STOP");
+        return value;
+    }
+};
+
+} // namespace joynr
+
+#endif // LOADHARNESS_LOADHARNESSPROTOCOL_H
@@ -0,0 +1,51 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef LOADHARNESS_LOADTESTECHOPROVIDER_H
+#define LOADHARNESS_LOADTESTECHOPROVIDER_H
+
+#include <string>
+
+#include "../provider/PerformanceTestEchoProvider.h"
+
+namespace joynr
+{
+
+/**
+ * @brief Echo provider which additionally publishes attribute changes and broadcasts on demand
+ */
+class LoadTestEchoProvider : public PerformanceTestEchoProvider
+{
+public:
+    LoadTestEchoProvider() = default;
+    ~LoadTestEchoProvider() override = default;
+
+    void publishAttribute(const std::string& value)
+    {
+        simpleAttributeChanged(value);
+    }
+
+    void publishBroadcast(const std::string& value)
+    {
+        fireBroadcastWithSinglePrimitiveParameter(value);
+    }
+};
+
+} // namespace joynr
+
+#endif // LOADHARNESS_LOADTESTECHOPROVIDER_H
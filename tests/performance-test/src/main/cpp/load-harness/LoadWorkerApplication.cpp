@@ -0,0 +1,268 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <boost/program_options.hpp>
+
+#include <joynr/JoynrRuntime.h>
+#include <joynr/Settings.h>
+
+#include "../common/Enum.h"
+#include "LatencyRecorder.h"
+#include "LoadConsumer.h"
+#include "LoadHarnessProtocol.h"
+#include "LoadTestEchoProvider.h"
+
+using namespace joynr;
+
+JOYNR_ENUM(WorkerRole, (PROVIDER)(CONSUMER));
+
+namespace
+{
+
+void sendToHarness(const std::string& line)
+{
+    std::cout << LoadHarnessProtocol::PREFIX() << line << std::endl;
+}
+
+/**
+ * @return false if stdin was closed before the command was received
+ */
+bool waitForCommand(const std::string& command)
+{
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line == command) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::uint64_t getMaxRssKb()
+{
+    rusage usage{};
+    ::getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::uint64_t>(usage.ru_maxrss);
+}
+
+/**
+ * Calls publish with the given rate until isStopped is set
+ */
+std::thread startPublisher(double rate,
+                           const std::atomic<bool>& isStopped,
+                           std::function<void()> publish)
+{
+    return std::thread([rate, &isStopped, publish = std::move(publish)]() {
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(1.0 / rate));
+        auto nextPublication = std::chrono::steady_clock::now();
+        while (!isStopped) {
+            std::this_thread::sleep_until(nextPublication);
+            nextPublication += interval;
+            publish();
+        }
+    });
+}
+
+int runProvider(std::shared_ptr<JoynrRuntime> runtime,
+                const std::string& domain,
+                double attributeRate,
+                double broadcastRate,
+                std::size_t payloadSize)
+{
+    auto provider = std::make_shared<LoadTestEchoProvider>();
+    const auto millisecondsSinceEpoch = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+    types::ProviderQos providerQos;
+    providerQos.setPriority(millisecondsSinceEpoch.count());
+    // the harness has no global capabilities directory
+    providerQos.setScope(types::ProviderScope::LOCAL);
+    runtime->registerProvider<tests::performance::EchoProvider>(domain, provider, providerQos);
+
+    sendToHarness(LoadHarnessProtocol::READY());
+    if (!waitForCommand(LoadHarnessProtocol::START())) {
+        return EXIT_FAILURE;
+    }
+
+    const std::string padding(payloadSize, 'x');
+    std::atomic<bool> isStopped(false);
+    std::atomic<std::uint64_t> attributeUpdates(0);
+    std::atomic<std::uint64_t> broadcasts(0);
+    std::vector<std::thread> publishers;
+    if (attributeRate > 0) {
+        publishers.push_back(startPublisher(attributeRate, isStopped, [&]() {
+            provider->publishAttribute(createPublication(padding));
+            ++attributeUpdates;
+        }));
+    }
+    if (broadcastRate > 0) {
+        publishers.push_back(startPublisher(broadcastRate, isStopped, [&]() {
+            provider->publishBroadcast(createPublication(padding));
+            ++broadcasts;
+        }));
+    }
+
+    waitForCommand(LoadHarnessProtocol::STOP());
+    isStopped = true;
+    for (auto& publisher : publishers) {
+        publisher.join();
+    }
+
+    std::ostringstream result;
+    result << LoadHarnessProtocol::RESULT() << " attributeUpdates=" << attributeUpdates
+           << " broadcasts=" << broadcasts << " maxRssKb=" << getMaxRssKb();
+    sendToHarness(result.str());
+
+    runtime->unregisterProvider<tests::performance::EchoProvider>(domain, provider);
+    return EXIT_SUCCESS;
+}
+
+int runConsumer(std::shared_ptr<JoynrRuntime> runtime,
+                const LoadConsumerConfig& config,
+                const std::string& samplesPrefix)
+{
+    auto consumer = std::make_shared<LoadConsumer>(std::move(runtime), config);
+    consumer->subscribe();
+
+    sendToHarness(LoadHarnessProtocol::READY());
+    if (!waitForCommand(LoadHarnessProtocol::START())) {
+        return EXIT_FAILURE;
+    }
+    consumer->run();
+    consumer->unsubscribe();
+
+    const auto& attributeListener = consumer->getAttributeListener();
+    const auto& broadcastListener = consumer->getBroadcastListener();
+    consumer->getRpcLatencies().writeToFile(samplesPrefix + ".rpc");
+    attributeListener.getLatencies().writeToFile(samplesPrefix + ".attribute");
+    broadcastListener.getLatencies().writeToFile(samplesPrefix + ".broadcast");
+
+    std::ostringstream result;
+    result << LoadHarnessProtocol::RESULT()
+           << " durationMs=" << consumer->getMeasuredDuration().count()
+           << " rpcCalls=" << consumer->getRpcCalls()
+           << " rpcReplies=" << consumer->getRpcLatencies().getCount()
+           << " rpcErrors=" << consumer->getRpcErrors()
+           << " attributeUpdates=" << attributeListener.getLatencies().getCount()
+           << " attributeErrors=" << attributeListener.getErrors()
+           << " broadcasts=" << broadcastListener.getLatencies().getCount()
+           << " broadcastErrors=" << broadcastListener.getErrors()
+           << " maxRssKb=" << getMaxRssKb();
+    sendToHarness(result.str());
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+
+/**
+ * Provider or consumer process of the load harness, see LoadHarnessApplication.cpp. It is
+ * controlled by the harness via the LoadHarnessProtocol and not meant to be started manually.
+ */
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    WorkerRole role;
+    std::string settingsFile;
+    std::string samplesPrefix;
+    std::size_t durationMs;
+    double attributeRate;
+    double broadcastRate;
+    LoadConsumerConfig consumerConfig;
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "role", po::value(&role)->required(), "PROVIDER|CONSUMER")(
+            "settings", po::value(&settingsFile)->required(), "joynr settings file")(
+            "domain", po::value(&consumerConfig.domain)->required(), "domain of the provider")(
+            "duration-ms",
+            po::value(&durationMs)->default_value(10000),
+            "consumer: duration of the measurement")(
+            "rpc-in-flight",
+            po::value(&consumerConfig.rpcInFlight)->default_value(1),
+            "consumer: maximum number of outstanding RPCs, 0 disables RPCs")(
+            "rpc-rate",
+            po::value(&consumerConfig.rpcRate)->default_value(0),
+            "consumer: RPCs per second, 0 is only limited by rpc-in-flight")(
+            "subscribe-attribute",
+            po::value(&consumerConfig.subscribeAttribute)->default_value(true),
+            "consumer: subscribe to the attribute")(
+            "subscribe-broadcast",
+            po::value(&consumerConfig.subscribeBroadcast)->default_value(true),
+            "consumer: subscribe to the broadcast")(
+            "samples-prefix",
+            po::value(&samplesPrefix)->default_value("samples"),
+            "consumer: latency samples are written to <prefix>.rpc|attribute|broadcast")(
+            "attribute-rate",
+            po::value(&attributeRate)->default_value(0),
+            "provider: attribute updates per second")(
+            "broadcast-rate",
+            po::value(&broadcastRate)->default_value(0),
+            "provider: broadcasts per second")(
+            "payload-size",
+            po::value(&consumerConfig.payloadSize)->default_value(100),
+            "size of the string sent with every RPC and publication");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        po::notify(vm);
+        consumerConfig.duration = std::chrono::milliseconds(durationMs);
+
+        std::function<void(const joynr::exceptions::JoynrRuntimeException&)> onFatalRuntimeError =
+                [](const joynr::exceptions::JoynrRuntimeException& exception) {
+                    std::cerr << "Unexpected joynr runtime error occured: "
+                              << exception.getMessage() << std::endl;
+                };
+        std::shared_ptr<JoynrRuntime> runtime(
+                JoynrRuntime::createRuntime(std::make_unique<joynr::Settings>(settingsFile),
+                                            std::move(onFatalRuntimeError)));
+
+        if (role == WorkerRole::PROVIDER) {
+            return runProvider(std::move(runtime),
+                               consumerConfig.domain,
+                               attributeRate,
+                               broadcastRate,
+                               consumerConfig.payloadSize);
+        }
+        return runConsumer(std::move(runtime), consumerConfig, samplesPrefix);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,584 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "LoopbackMqttBroker.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace joynr
+{
+
+namespace
+{
+
+constexpr std::uint8_t CONNECT = 1;
+constexpr std::uint8_t PUBLISH = 3;
+constexpr std::uint8_t PUBACK = 4;
+constexpr std::uint8_t PUBREC = 5;
+constexpr std::uint8_t PUBREL = 6;
+constexpr std::uint8_t PUBCOMP = 7;
+constexpr std::uint8_t SUBSCRIBE = 8;
+constexpr std::uint8_t SUBACK = 9;
+constexpr std::uint8_t UNSUBSCRIBE = 10;
+constexpr std::uint8_t UNSUBACK = 11;
+constexpr std::uint8_t PINGREQ = 12;
+constexpr std::uint8_t PINGRESP = 13;
+constexpr std::uint8_t DISCONNECT = 14;
+
+constexpr std::uint8_t MQTT_V5 = 5;
+// QoS 2 would require state per forwarded message
+constexpr std::uint8_t MAX_FORWARD_QOS = 1;
+
+/**
+ * Bounds checked reader for the variable header and payload of a packet
+ */
+class PacketReader
+{
+public:
+    explicit PacketReader(const std::vector<std::uint8_t>& data) : _data(data), _position(0)
+    {
+    }
+
+    std::uint8_t readByte()
+    {
+        if (_position >= _data.size()) {
+            throw std::out_of_range("malformed MQTT packet");
+        }
+        return _data[_position++];
+    }
+
+    std::uint16_t readUint16()
+    {
+        const std::uint16_t high = readByte();
+        return static_cast<std::uint16_t>((high << 8) | readByte());
+    }
+
+    std::uint32_t readVariableByteInteger()
+    {
+        std::uint32_t value = 0;
+        for (int shift = 0; shift < 28; shift += 7) {
+            const std::uint8_t byte = readByte();
+            value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        throw std::out_of_range("malformed MQTT variable byte integer");
+    }
+
+    std::string readString()
+    {
+        const std::size_t length = readUint16();
+        const auto begin = readBytes(length);
+        return std::string(begin, begin + static_cast<std::ptrdiff_t>(length));
+    }
+
+    std::vector<std::uint8_t>::const_iterator readBytes(std::size_t length)
+    {
+        if (length > remaining()) {
+            throw std::out_of_range("malformed MQTT packet");
+        }
+        const auto begin = _data.cbegin() + static_cast<std::ptrdiff_t>(_position);
+        _position += length;
+        return begin;
+    }
+
+    std::size_t remaining() const
+    {
+        return _data.size() - _position;
+    }
+
+private:
+    const std::vector<std::uint8_t>& _data;
+    std::size_t _position;
+};
+
+void appendUint16(std::vector<std::uint8_t>& buffer, std::uint16_t value)
+{
+    buffer.push_back(static_cast<std::uint8_t>(value >> 8));
+    buffer.push_back(static_cast<std::uint8_t>(value & 0xFF));
+}
+
+void appendVariableByteInteger(std::vector<std::uint8_t>& buffer, std::size_t value)
+{
+    do {
+        std::uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value > 0) {
+            byte |= 0x80;
+        }
+        buffer.push_back(byte);
+    } while (value > 0);
+}
+
+void appendString(std::vector<std::uint8_t>& buffer, const std::string& value)
+{
+    appendUint16(buffer, static_cast<std::uint16_t>(value.size()));
+    buffer.insert(buffer.end(), value.cbegin(), value.cend());
+}
+
+std::vector<std::uint8_t> makePacket(std::uint8_t header, const std::vector<std::uint8_t>& body)
+{
+    std::vector<std::uint8_t> packet;
+    packet.reserve(body.size() + 5);
+    packet.push_back(header);
+    appendVariableByteInteger(packet, body.size());
+    packet.insert(packet.end(), body.cbegin(), body.cend());
+    return packet;
+}
+
+std::vector<std::uint8_t> makeAck(std::uint8_t type, std::uint16_t packetId)
+{
+    std::vector<std::uint8_t> body;
+    appendUint16(body, packetId);
+    // PUBREL is the only acknowledgement with reserved flags
+    return makePacket(static_cast<std::uint8_t>((type << 4) | (type == PUBREL ? 0x02 : 0x00)),
+                      body);
+}
+
+bool readExactly(int socket, std::uint8_t* buffer, std::size_t length)
+{
+    while (length > 0) {
+        const ssize_t received = ::recv(socket, buffer, length, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        buffer += received;
+        length -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+bool readPacket(int socket, std::uint8_t& header, std::vector<std::uint8_t>& body)
+{
+    if (!readExactly(socket, &header, 1)) {
+        return false;
+    }
+    std::size_t remainingLength = 0;
+    for (int shift = 0;; shift += 7) {
+        std::uint8_t byte;
+        if (shift >= 28 || !readExactly(socket, &byte, 1)) {
+            return false;
+        }
+        remainingLength |= static_cast<std::size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+    body.resize(remainingLength);
+    return remainingLength == 0 || readExactly(socket, body.data(), remainingLength);
+}
+
+std::string removeSharedSubscriptionPrefix(const std::string& filter)
+{
+    static const std::string sharePrefix("$share/");
+    if (filter.compare(0, sharePrefix.size(), sharePrefix) != 0) {
+        return filter;
+    }
+    const std::size_t groupEnd = filter.find('/', sharePrefix.size());
+    return groupEnd == std::string::npos ? filter : filter.substr(groupEnd + 1);
+}
+
+} // namespace
+
+LoopbackMqttBroker::Connection::Connection(int socket)
+        : _socket(socket),
+          _writeMutex(),
+          _protocolVersion(MQTT_V5),
+          _nextPacketId(1),
+          _subscriptions(),
+          _thread()
+{
+}
+
+LoopbackMqttBroker::Connection::~Connection()
+{
+    ::close(_socket);
+}
+
+bool LoopbackMqttBroker::Connection::write(const std::vector<std::uint8_t>& packet)
+{
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    std::size_t sent = 0;
+    while (sent < packet.size()) {
+        const ssize_t result =
+                ::send(_socket, packet.data() + sent, packet.size() - sent, MSG_NOSIGNAL);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        sent += static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+std::uint16_t LoopbackMqttBroker::Connection::allocatePacketId()
+{
+    std::uint16_t packetId = _nextPacketId++;
+    if (packetId == 0) {
+        packetId = _nextPacketId++;
+    }
+    return packetId;
+}
+
+LoopbackMqttBroker::LoopbackMqttBroker()
+        : _listenSocket(-1),
+          _isRunning(false),
+          _acceptThread(),
+          _connectionsMutex(),
+          _connections(),
+          _receivedPublications(0),
+          _forwardedPublications(0)
+{
+}
+
+LoopbackMqttBroker::~LoopbackMqttBroker()
+{
+    stop();
+}
+
+std::uint16_t LoopbackMqttBroker::start(std::uint16_t port)
+{
+    _listenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (_listenSocket < 0) {
+        throw std::runtime_error(std::string("unable to create broker socket: ") +
+                                 std::strerror(errno));
+    }
+    const int reuseAddress = 1;
+    ::setsockopt(
+            _listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    socklen_t addressLength = sizeof(address);
+    if (::bind(_listenSocket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0 ||
+        ::listen(_listenSocket, SOMAXCONN) != 0 ||
+        ::getsockname(_listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) !=
+                0) {
+        const std::string error(std::strerror(errno));
+        ::close(_listenSocket);
+        _listenSocket = -1;
+        throw std::runtime_error("unable to listen on broker socket: " + error);
+    }
+
+    _isRunning = true;
+    _acceptThread = std::thread(&LoopbackMqttBroker::acceptLoop, this);
+    return ntohs(address.sin_port);
+}
+
+void LoopbackMqttBroker::stop()
+{
+    if (!_isRunning.exchange(false)) {
+        return;
+    }
+    // wakes up the blocking accept
+    ::shutdown(_listenSocket, SHUT_RDWR);
+    _acceptThread.join();
+    ::close(_listenSocket);
+    _listenSocket = -1;
+
+    std::vector<std::shared_ptr<Connection>> connections;
+    {
+        std::lock_guard<std::mutex> lock(_connectionsMutex);
+        connections.swap(_connections);
+    }
+    for (const auto& connection : connections) {
+        ::shutdown(connection->_socket, SHUT_RDWR);
+    }
+    for (const auto& connection : connections) {
+        connection->_thread.join();
+    }
+}
+
+std::uint64_t LoopbackMqttBroker::getReceivedPublications() const
+{
+    return _receivedPublications;
+}
+
+std::uint64_t LoopbackMqttBroker::getForwardedPublications() const
+{
+    return _forwardedPublications;
+}
+
+void LoopbackMqttBroker::acceptLoop()
+{
+    while (_isRunning) {
+        const int socket = ::accept(_listenSocket, nullptr, nullptr);
+        if (socket < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            break;
+        }
+        const int noDelay = 1;
+        ::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        auto connection = std::make_shared<Connection>(socket);
+        std::lock_guard<std::mutex> lock(_connectionsMutex);
+        // closed connections are kept until stop() in order to join their threads
+        _connections.push_back(connection);
+        connection->_thread = std::thread(&LoopbackMqttBroker::connectionLoop, this, connection);
+    }
+}
+
+void LoopbackMqttBroker::connectionLoop(std::shared_ptr<Connection> connection)
+{
+    std::uint8_t header;
+    std::vector<std::uint8_t> body;
+    try {
+        while (readPacket(connection->_socket, header, body) &&
+               handlePacket(*connection, header, body)) {
+        }
+    } catch (const std::out_of_range&) {
+        // malformed packet, close the connection like a broker would do
+    }
+    ::shutdown(connection->_socket, SHUT_RDWR);
+    std::lock_guard<std::mutex> lock(_connectionsMutex);
+    connection->_subscriptions.clear();
+}
+
+bool LoopbackMqttBroker::handlePacket(Connection& connection,
+                                      std::uint8_t header,
+                                      const std::vector<std::uint8_t>& body)
+{
+    switch (header >> 4) {
+    case CONNECT: {
+        PacketReader reader(body);
+        reader.readString();
+        connection._protocolVersion = reader.readByte();
+        // session present = 0, reason code / return code = success
+        std::vector<std::uint8_t> connack{0x00, 0x00};
+        if (connection._protocolVersion >= MQTT_V5) {
+            // no properties
+            connack.push_back(0x00);
+        }
+        return connection.write(makePacket(0x20, connack));
+    }
+    case PUBLISH:
+        handlePublish(connection, header, body);
+        return true;
+    case PUBREL:
+        return connection.write(makeAck(PUBCOMP, PacketReader(body).readUint16()));
+    case PUBACK:
+    case PUBREC:
+    case PUBCOMP:
+        // acknowledgements of forwarded publications, there is nothing to retransmit
+        return true;
+    case SUBSCRIBE:
+        handleSubscribe(connection, body);
+        return true;
+    case UNSUBSCRIBE:
+        handleUnsubscribe(connection, body);
+        return true;
+    case PINGREQ:
+        return connection.write({PINGRESP << 4, 0x00});
+    case DISCONNECT:
+    default:
+        return false;
+    }
+}
+
+void LoopbackMqttBroker::handleSubscribe(Connection& connection,
+                                         const std::vector<std::uint8_t>& body)
+{
+    PacketReader reader(body);
+    const std::uint16_t packetId = reader.readUint16();
+    const bool isV5 = connection._protocolVersion >= MQTT_V5;
+    if (isV5) {
+        reader.readBytes(reader.readVariableByteInteger());
+    }
+
+    std::vector<std::uint8_t> suback;
+    appendUint16(suback, packetId);
+    if (isV5) {
+        suback.push_back(0x00);
+    }
+    {
+        std::lock_guard<std::mutex> lock(_connectionsMutex);
+        while (reader.remaining() > 0) {
+            const std::string filter = removeSharedSubscriptionPrefix(reader.readString());
+            const std::uint8_t qos = std::min<std::uint8_t>(reader.readByte() & 0x03,
+                                                            MAX_FORWARD_QOS);
+            auto& subscriptions = connection._subscriptions;
+            subscriptions.erase(std::remove_if(subscriptions.begin(),
+                                               subscriptions.end(),
+                                               [&filter](const Subscription& subscription) {
+                                                   return subscription.filter == filter;
+                                               }),
+                                subscriptions.end());
+            subscriptions.push_back(Subscription{filter, qos});
+            // granted QoS
+            suback.push_back(qos);
+        }
+    }
+    connection.write(makePacket(SUBACK << 4, suback));
+}
+
+void LoopbackMqttBroker::handleUnsubscribe(Connection& connection,
+                                           const std::vector<std::uint8_t>& body)
+{
+    PacketReader reader(body);
+    const std::uint16_t packetId = reader.readUint16();
+    const bool isV5 = connection._protocolVersion >= MQTT_V5;
+    if (isV5) {
+        reader.readBytes(reader.readVariableByteInteger());
+    }
+
+    std::vector<std::uint8_t> unsuback;
+    appendUint16(unsuback, packetId);
+    if (isV5) {
+        unsuback.push_back(0x00);
+    }
+    {
+        std::lock_guard<std::mutex> lock(_connectionsMutex);
+        while (reader.remaining() > 0) {
+            const std::string filter = removeSharedSubscriptionPrefix(reader.readString());
+            auto& subscriptions = connection._subscriptions;
+            subscriptions.erase(std::remove_if(subscriptions.begin(),
+                                               subscriptions.end(),
+                                               [&filter](const Subscription& subscription) {
+                                                   return subscription.filter == filter;
+                                               }),
+                                subscriptions.end());
+            if (isV5) {
+                // success
+                unsuback.push_back(0x00);
+            }
+        }
+    }
+    connection.write(makePacket(UNSUBACK << 4, unsuback));
+}
+
+void LoopbackMqttBroker::handlePublish(Connection& connection,
+                                       std::uint8_t header,
+                                       const std::vector<std::uint8_t>& body)
+{
+    const std::uint8_t qos = (header >> 1) & 0x03;
+    const bool isV5 = connection._protocolVersion >= MQTT_V5;
+    PacketReader reader(body);
+    const std::string topic = reader.readString();
+    const std::uint16_t packetId = qos > 0 ? reader.readUint16() : 0;
+    std::vector<std::uint8_t> properties;
+    if (isV5) {
+        const std::size_t propertiesLength = reader.readVariableByteInteger();
+        const auto begin = reader.readBytes(propertiesLength);
+        properties.assign(begin, begin + static_cast<std::ptrdiff_t>(propertiesLength));
+    }
+    const std::size_t payloadLength = reader.remaining();
+    const auto payload = reader.readBytes(payloadLength);
+
+    if (qos == 1) {
+        connection.write(makeAck(PUBACK, packetId));
+    } else if (qos == 2) {
+        connection.write(makeAck(PUBREC, packetId));
+    }
+    ++_receivedPublications;
+
+    std::vector<std::pair<std::shared_ptr<Connection>, std::uint8_t>> receivers;
+    {
+        std::lock_guard<std::mutex> lock(_connectionsMutex);
+        for (const auto& receiver : _connections) {
+            int forwardQos = -1;
+            for (const auto& subscription : receiver->_subscriptions) {
+                if (matches(subscription.filter, topic)) {
+                    forwardQos = std::max<int>(forwardQos, std::min(qos, subscription.qos));
+                }
+            }
+            if (forwardQos >= 0) {
+                receivers.emplace_back(receiver, static_cast<std::uint8_t>(forwardQos));
+            }
+        }
+    }
+
+    for (const auto& receiver : receivers) {
+        Connection& target = *receiver.first;
+        const std::uint8_t forwardQos = receiver.second;
+        std::vector<std::uint8_t> forwardBody;
+        forwardBody.reserve(body.size() + 2);
+        appendString(forwardBody, topic);
+        if (forwardQos > 0) {
+            appendUint16(forwardBody, target.allocatePacketId());
+        }
+        if (target._protocolVersion >= MQTT_V5) {
+            appendVariableByteInteger(forwardBody, properties.size());
+            forwardBody.insert(forwardBody.end(), properties.cbegin(), properties.cend());
+        }
+        forwardBody.insert(
+                forwardBody.end(), payload, payload + static_cast<std::ptrdiff_t>(payloadLength));
+        if (target.write(makePacket(
+                    static_cast<std::uint8_t>((PUBLISH << 4) | (forwardQos << 1)), forwardBody))) {
+            ++_forwardedPublications;
+        }
+    }
+}
+
+bool LoopbackMqttBroker::matches(const std::string& filter, const std::string& topic)
+{
+    // topics starting with '$' are not matched by wildcards at the first level
+    if (!topic.empty() && topic[0] == '$' && !filter.empty() &&
+        (filter[0] == '#' || filter[0] == '+')) {
+        return false;
+    }
+    std::size_t filterPosition = 0;
+    std::size_t topicPosition = 0;
+    while (true) {
+        const std::size_t filterEnd = std::min(filter.find('/', filterPosition), filter.size());
+        const std::size_t topicEnd = std::min(topic.find('/', topicPosition), topic.size());
+        const std::string filterLevel = filter.substr(filterPosition, filterEnd - filterPosition);
+        if (filterLevel == "#") {
+            return true;
+        }
+        if (filterLevel != "+" &&
+            filterLevel != topic.substr(topicPosition, topicEnd - topicPosition)) {
+            return false;
+        }
+        const bool isLastFilterLevel = filterEnd == filter.size();
+        const bool isLastTopicLevel = topicEnd == topic.size();
+        if (isLastFilterLevel || isLastTopicLevel) {
+            if (isLastFilterLevel && isLastTopicLevel) {
+                return true;
+            }
+            if (isLastTopicLevel) {
+                // only a trailing "/#" may follow
+                return filter.compare(filterEnd, std::string::npos, "/#") == 0;
+            }
+            return false;
+        }
+        filterPosition = filterEnd + 1;
+        topicPosition = topicEnd + 1;
+    }
+}
+
+} // namespace joynr
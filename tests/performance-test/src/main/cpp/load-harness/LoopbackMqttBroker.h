@@ -0,0 +1,109 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2022 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef LOADHARNESS_LOOPBACKMQTTBROKER_H
+#define LOADHARNESS_LOOPBACKMQTTBROKER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace joynr
+{
+
+/**
+ * @brief Minimal MQTT broker listening on the loopback interface.
+ *
+ * Stand-in for a real broker so that the cluster controller can connect to its backend without
+ * any outside service. It supports what the joynr MQTT client needs: CONNECT, SUBSCRIBE,
+ * UNSUBSCRIBE, PUBLISH with QoS 0 to 2, PINGREQ and DISCONNECT of MQTT 3.1.1 and 5, including
+ * wildcard and shared subscriptions. Publications are forwarded with QoS 0 or 1, there is no
+ * retained message store, no session state and no authentication.
+ */
+class LoopbackMqttBroker
+{
+public:
+    LoopbackMqttBroker();
+    ~LoopbackMqttBroker();
+
+    /**
+     * @brief Starts listening on 127.0.0.1
+     * @param port the port to listen on, 0 selects a free port
+     * @return the port the broker listens on
+     */
+    std::uint16_t start(std::uint16_t port = 0);
+    void stop();
+
+    std::uint64_t getReceivedPublications() const;
+    std::uint64_t getForwardedPublications() const;
+
+private:
+    LoopbackMqttBroker(const LoopbackMqttBroker&) = delete;
+    LoopbackMqttBroker& operator=(const LoopbackMqttBroker&) = delete;
+
+    struct Subscription {
+        std::string filter;
+        std::uint8_t qos;
+    };
+
+    struct Connection {
+        explicit Connection(int socket);
+        ~Connection();
+
+        bool write(const std::vector<std::uint8_t>& packet);
+        std::uint16_t allocatePacketId();
+
+        const int _socket;
+        std::mutex _writeMutex;
+        std::atomic<std::uint8_t> _protocolVersion;
+        std::atomic<std::uint16_t> _nextPacketId;
+        // guarded by _connectionsMutex of the broker
+        std::vector<Subscription> _subscriptions;
+        std::thread _thread;
+    };
+
+    void acceptLoop();
+    void connectionLoop(std::shared_ptr<Connection> connection);
+    bool handlePacket(Connection& connection,
+                      std::uint8_t header,
+                      const std::vector<std::uint8_t>& body);
+    void handleSubscribe(Connection& connection, const std::vector<std::uint8_t>& body);
+    void handleUnsubscribe(Connection& connection, const std::vector<std::uint8_t>& body);
+    void handlePublish(Connection& connection,
+                       std::uint8_t header,
+                       const std::vector<std::uint8_t>& body);
+
+    static bool matches(const std::string& filter, const std::string& topic);
+
+    int _listenSocket;
+    std::atomic<bool> _isRunning;
+    std::thread _acceptThread;
+    // guards the connection list and the subscriptions of all connections
+    std::mutex _connectionsMutex;
+    std::vector<std::shared_ptr<Connection>> _connections;
+    std::atomic<std::uint64_t> _receivedPublications;
+    std::atomic<std::uint64_t> _forwardedPublications;
+};
+
+} // namespace joynr
+
+#endif // LOADHARNESS_LOOPBACKMQTTBROKER_H
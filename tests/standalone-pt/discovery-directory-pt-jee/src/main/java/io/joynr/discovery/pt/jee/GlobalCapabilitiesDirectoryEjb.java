@@ -76,6 +76,12 @@ public class GlobalCapabilitiesDirectoryEjb implements GlobalCapabilitiesDirecto
         throw new ProviderRuntimeException("Not implemented yet");
     }
 
+    @Override
+    public String[] addMultiple(GlobalDiscoveryEntry[] globalDiscoveryEntries,
+                                String[] gbids) throws ApplicationException {
+        throw new ProviderRuntimeException("Not implemented yet");
+    }
+
     @Override
     public void fireGlobalDiscoveryEntryChanged() {
         throw new UnsupportedOperationException("Not implemented yet");
@@ -169,6 +175,14 @@ public class GlobalCapabilitiesDirectoryEjb implements GlobalCapabilitiesDirecto
         logger.debug("Calling remove entries for participantId {} and gbids )", participantId, Arrays.toString(gbids));
     }
 
+    @Override
+    public String[] removeMultiple(String[] participantIds, String[] gbids) throws ApplicationException {
+        logger.debug("Calling remove entries for participantIds {} and gbids {}",
+                     Arrays.toString(participantIds),
+                     Arrays.toString(gbids));
+        return new String[0];
+    }
+
     @Override
     public void touch(String clusterControllerId) {
         throw new ProviderRuntimeException("Not implemented yet");
@@ -26,6 +26,8 @@ import io.joynr.generator.templates.util.AttributeUtil
 import io.joynr.generator.templates.util.InterfaceUtil
 import io.joynr.generator.templates.util.MethodUtil
 import io.joynr.generator.templates.util.NamingUtil
+import org.franca.core.franca.FAttribute
+import org.franca.core.franca.FMethod
 
 class InterfaceRequestInterpreterCppTemplate extends InterfaceTemplate {
 
@@ -92,108 +94,30 @@ void «interfaceName»RequestInterpreter::execute(
 		const std::string& methodName = request.getMethodName();
 
 		// execute operation
-		«IF !attributes.empty»
-			«FOR attribute : attributes»
-				«val attributeName = attribute.joynrName»
-				«IF attribute.readable»
-				if (methodName == "get«attributeName.toFirstUpper»" && paramTypes.size() == 0){
-					try {
-						auto requestCallerOnSuccess =
-								[onSuccess = std::move(onSuccess)](«attribute.getTypeName(generateVersion)» «attributeName»){
-									BaseReply reply;
-									reply.setResponse(std::move(«attributeName»));
-									onSuccess(std::move(reply));
-								};
-						«requestCallerName»->get«attributeName.toFirstUpper»(
-																			std::move(requestCallerOnSuccess),
-																			onError);
-					} catch (const std::exception& exception) {
-						const std::string errorMessage = "Unexpected exception occurred in attribute getter get«attributeName.toFirstUpper» (): " + std::string(exception.what());
-						JOYNR_LOG_ERROR(logger(), errorMessage);
-						onError(
-							std::make_shared<exceptions::MethodInvocationException>(
-								errorMessage,
-								requestCaller->getProviderVersion()));
-					}
-					return;
+		«val requestMethodNames = (attributes.filter[readable].map[getterName] +
+				attributes.filter[writable].map[setterName] +
+				methodsWithoutFireAndForget.map[joynrName]).toSet»
+		switch (joynr::util::getMethodNameHash(methodName)) {
+		«FOR requestMethodName : requestMethodNames»
+			case joynr::util::getMethodNameHash("«requestMethodName»"): {
+				if (methodName != "«requestMethodName»") {
+					break;
 				}
-			«ENDIF»
-			«IF attribute.writable»
-				if (methodName == "set«attributeName.toFirstUpper»" && paramTypes.size() == 1){
-					try {
-						«attribute.getTypeName(generateVersion)» typedInput«attributeName.toFirstUpper»;
-						request.getParams(typedInput«attributeName.toFirstUpper»);
-						auto requestCallerOnSuccess =
-								[onSuccess = std::move(onSuccess)] () {
-									BaseReply reply;
-									reply.setResponse();
-									onSuccess(std::move(reply));
-								};
-						«requestCallerName»->set«attributeName.toFirstUpper»(
-																			typedInput«attributeName.toFirstUpper»,
-																			std::move(requestCallerOnSuccess),
-																			onError);
-					} catch (const std::exception& exception) {
-						const std::string errorMessage = "Unexpected exception occurred in attribute setter set«attributeName.toFirstUpper» («getJoynrTypeName(attribute, generateVersion)»): " + std::string(exception.what());
-						JOYNR_LOG_ERROR(logger(), errorMessage);
-						onError(
-							std::make_shared<exceptions::MethodInvocationException>(
-								errorMessage,
-								requestCaller->getProviderVersion()));
-					}
-					return;
-				}
-			«ENDIF»
-			«ENDFOR»
-		«ENDIF»
-		«FOR method: methodsWithoutFireAndForget»
-			«val inputUntypedParamList = getCommaSeperatedUntypedInputParameterList(method)»
-			«val methodName = method.joynrName»
-			«val inputParams = getInputParameters(method)»
-			«var iterator = -1»
-			if (methodName == "«methodName»" && paramTypes.size() == «inputParams.size»
-				«FOR input : inputParams»
-					&& paramTypes.at(«iterator=iterator+1») == "«input.getJoynrTypeName(generateVersion)»"
+				«FOR attribute : attributes.filter[readable && getterName == requestMethodName]»
+					«produceAttributeGetterDispatch(attribute, requestCallerName, generateVersion)»
 				«ENDFOR»
-			) {
-				«val outputTypedParamList = getCommaSeperatedTypedConstOutputParameterList(method, generateVersion)»
-				auto requestCallerOnSuccess =
-						[onSuccess = std::move(onSuccess)](«outputTypedParamList»){
-							BaseReply reply;
-							reply.setResponse(
-							«FOR param : method.outputParameters SEPARATOR ','»
-							«param.joynrName»
-							«ENDFOR»
-							);
-							onSuccess(std::move(reply));
-						};
-
-				«FOR input : inputParams»
-				«val inputName = input.joynrName»
-				«val inputType = input.type.resolveTypeDef»
-				«IF input.isArray»
-				std::vector<«inputType.getTypeName(generateVersion)»> «inputName»;
-				«ELSE»
-				«inputType.getTypeName(generateVersion)» «inputName»;
-				«ENDIF»
+				«FOR attribute : attributes.filter[writable && setterName == requestMethodName]»
+					«produceAttributeSetterDispatch(attribute, requestCallerName, generateVersion)»
 				«ENDFOR»
-				try {
-					«IF !method.inputParameters.empty»
-					request.getParams(«inputUntypedParamList»);
-					«ENDIF»
-					«requestCallerName»->«methodName»(
-							«IF !method.inputParameters.empty»«inputUntypedParamList»,«ENDIF»
-							std::move(requestCallerOnSuccess),
-							onError);
-				} catch (const std::exception& exception) {
-					const std::string errorMessage = "Unexpected exception occurred in method «methodName» (...): " + std::string(exception.what());
-					JOYNR_LOG_ERROR(logger(), errorMessage);
-					onError(std::make_shared<exceptions::MethodInvocationException>(errorMessage, requestCaller->getProviderVersion()));
-				}
-
-				return;
+				«FOR method : methodsWithoutFireAndForget.filter[joynrName == requestMethodName]»
+					«produceMethodDispatch(method, requestCallerName, generateVersion)»
+				«ENDFOR»
+				break;
 			}
 		«ENDFOR»
+		default:
+			break;
+		}
 	«ELSE»
 		std::ignore = requestCaller;
 		std::ignore = onSuccess;
@@ -221,41 +145,172 @@ void «interfaceName»RequestInterpreter::execute(
 				std::dynamic_pointer_cast<«interfaceName»RequestCaller>(requestCaller);
 
 		// execute operation
-		«FOR method : fireAndForgetMethods»
-			«val inputUntypedParamList = getCommaSeperatedUntypedInputParameterList(method)»
-			«val methodName = method.joynrName»
-			«val inputParams = getInputParameters(method)»
-			«var iterator = -1»
-			if (methodName == "«methodName»" && paramTypes.size() == «inputParams.size»
-				«FOR input : inputParams»
-					&& paramTypes.at(«iterator=iterator+1») == "«input.getJoynrTypeName(generateVersion)»"
-				«ENDFOR»
-			){
-				«FOR input : inputParams»
-				«val inputName = input.joynrName»
-				«val inputType = input.type.resolveTypeDef»
-				«IF input.isArray»
-				std::vector<«inputType.getTypeName(generateVersion)»> «inputName»;
-				«ELSE»
-				«inputType.getTypeName(generateVersion)» «inputName»;
-				«ENDIF»
-				«ENDFOR»
-				try {
-					«IF !method.inputParameters.empty»
-					request.getParams(«inputUntypedParamList»);
-					«ENDIF»
-					«requestCallerName»->«methodName»(«IF !method.inputParameters.empty»«inputUntypedParamList»«ENDIF»);
-				} catch (const std::exception& exception) {
-					const std::string errorMessage = "Unexpected exception occurred in method «methodName» (...): " + std::string(exception.what());
-					JOYNR_LOG_ERROR(logger(), errorMessage);
+		switch (joynr::util::getMethodNameHash(methodName)) {
+		«FOR fireAndForgetMethodName : fireAndForgetMethods.map[joynrName].toSet»
+			case joynr::util::getMethodNameHash("«fireAndForgetMethodName»"): {
+				if (methodName != "«fireAndForgetMethodName»") {
+					break;
 				}
-				return;
+				«FOR method : fireAndForgetMethods.filter[joynrName == fireAndForgetMethodName]»
+					«produceFireAndForgetMethodDispatch(method, requestCallerName, generateVersion)»
+				«ENDFOR»
+				break;
 			}
 		«ENDFOR»
+		default:
+			break;
+		}
 	«ENDIF»
 
 	JOYNR_LOG_WARN(logger(), "unknown method name for interface «interfaceName»: {}", request.getMethodName());
 }
 «getNamespaceEnder(francaIntf, generateVersion)»
 '''
+
+
+	private def getterName(FAttribute attribute) {
+		"get" + attribute.joynrName.toFirstUpper
+	}
+
+	private def setterName(FAttribute attribute) {
+		"set" + attribute.joynrName.toFirstUpper
+	}
+
+	private def produceAttributeGetterDispatch(FAttribute attribute, String requestCallerName, boolean generateVersion)
+'''
+	«val attributeName = attribute.joynrName»
+	if (paramTypes.size() == 0){
+		try {
+			auto requestCallerOnSuccess =
+					[onSuccess = std::move(onSuccess)](«attribute.getTypeName(generateVersion)» «attributeName»){
+						BaseReply reply;
+						reply.setResponse(std::move(«attributeName»));
+						onSuccess(std::move(reply));
+					};
+			«requestCallerName»->get«attributeName.toFirstUpper»(
+																std::move(requestCallerOnSuccess),
+																onError);
+		} catch (const std::exception& exception) {
+			const std::string errorMessage = "Unexpected exception occurred in attribute getter get«attributeName.toFirstUpper» (): " + std::string(exception.what());
+			JOYNR_LOG_ERROR(logger(), errorMessage);
+			onError(
+				std::make_shared<exceptions::MethodInvocationException>(
+					errorMessage,
+					requestCaller->getProviderVersion()));
+		}
+		return;
+	}
+'''
+
+	private def produceAttributeSetterDispatch(FAttribute attribute, String requestCallerName, boolean generateVersion)
+'''
+	«val attributeName = attribute.joynrName»
+	if (paramTypes.size() == 1){
+		try {
+			«attribute.getTypeName(generateVersion)» typedInput«attributeName.toFirstUpper»;
+			request.getParams(typedInput«attributeName.toFirstUpper»);
+			auto requestCallerOnSuccess =
+					[onSuccess = std::move(onSuccess)] () {
+						BaseReply reply;
+						reply.setResponse();
+						onSuccess(std::move(reply));
+					};
+			«requestCallerName»->set«attributeName.toFirstUpper»(
+																typedInput«attributeName.toFirstUpper»,
+																std::move(requestCallerOnSuccess),
+																onError);
+		} catch (const std::exception& exception) {
+			const std::string errorMessage = "Unexpected exception occurred in attribute setter set«attributeName.toFirstUpper» («getJoynrTypeName(attribute, generateVersion)»): " + std::string(exception.what());
+			JOYNR_LOG_ERROR(logger(), errorMessage);
+			onError(
+				std::make_shared<exceptions::MethodInvocationException>(
+					errorMessage,
+					requestCaller->getProviderVersion()));
+		}
+		return;
+	}
+'''
+
+	private def produceMethodDispatch(FMethod method, String requestCallerName, boolean generateVersion)
+'''
+	«val inputUntypedParamList = getCommaSeperatedUntypedInputParameterList(method)»
+	«val methodName = method.joynrName»
+	«val inputParams = getInputParameters(method)»
+	«var iterator = -1»
+	if (paramTypes.size() == «inputParams.size»
+		«FOR input : inputParams»
+			&& paramTypes.at(«iterator=iterator+1») == "«input.getJoynrTypeName(generateVersion)»"
+		«ENDFOR»
+	) {
+		«val outputTypedParamList = getCommaSeperatedTypedConstOutputParameterList(method, generateVersion)»
+		auto requestCallerOnSuccess =
+				[onSuccess = std::move(onSuccess)](«outputTypedParamList»){
+					BaseReply reply;
+					reply.setResponse(
+					«FOR param : method.outputParameters SEPARATOR ','»
+					«param.joynrName»
+					«ENDFOR»
+					);
+					onSuccess(std::move(reply));
+				};
+
+		«FOR input : inputParams»
+		«val inputName = input.joynrName»
+		«val inputType = input.type.resolveTypeDef»
+		«IF input.isArray»
+		std::vector<«inputType.getTypeName(generateVersion)»> «inputName»;
+		«ELSE»
+		«inputType.getTypeName(generateVersion)» «inputName»;
+		«ENDIF»
+		«ENDFOR»
+		try {
+			«IF !method.inputParameters.empty»
+			request.getParams(«inputUntypedParamList»);
+			«ENDIF»
+			«requestCallerName»->«methodName»(
+					«IF !method.inputParameters.empty»«inputUntypedParamList»,«ENDIF»
+					std::move(requestCallerOnSuccess),
+					onError);
+		} catch (const std::exception& exception) {
+			const std::string errorMessage = "Unexpected exception occurred in method «methodName» (...): " + std::string(exception.what());
+			JOYNR_LOG_ERROR(logger(), errorMessage);
+			onError(std::make_shared<exceptions::MethodInvocationException>(errorMessage, requestCaller->getProviderVersion()));
+		}
+
+		return;
+	}
+'''
+
+	private def produceFireAndForgetMethodDispatch(FMethod method, String requestCallerName, boolean generateVersion)
+'''
+	«val inputUntypedParamList = getCommaSeperatedUntypedInputParameterList(method)»
+	«val methodName = method.joynrName»
+	«val inputParams = getInputParameters(method)»
+	«var iterator = -1»
+	if (paramTypes.size() == «inputParams.size»
+		«FOR input : inputParams»
+			&& paramTypes.at(«iterator=iterator+1») == "«input.getJoynrTypeName(generateVersion)»"
+		«ENDFOR»
+	){
+		«FOR input : inputParams»
+		«val inputName = input.joynrName»
+		«val inputType = input.type.resolveTypeDef»
+		«IF input.isArray»
+		std::vector<«inputType.getTypeName(generateVersion)»> «inputName»;
+		«ELSE»
+		«inputType.getTypeName(generateVersion)» «inputName»;
+		«ENDIF»
+		«ENDFOR»
+		try {
+			«IF !method.inputParameters.empty»
+			request.getParams(«inputUntypedParamList»);
+			«ENDIF»
+			«requestCallerName»->«methodName»(«IF !method.inputParameters.empty»«inputUntypedParamList»«ENDIF»);
+		} catch (const std::exception& exception) {
+			const std::string errorMessage = "Unexpected exception occurred in method «methodName» (...): " + std::string(exception.what());
+			JOYNR_LOG_ERROR(logger(), errorMessage);
+		}
+		return;
+	}
+'''
 }